@@ -0,0 +1,648 @@
+#ifndef CPPAD_CG_ALGEBRAIC_SIMPLIFIER_INCLUDED
+#define CPPAD_CG_ALGEBRAIC_SIMPLIFIER_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Rewrites the operations of a graph with algebraically equivalent and
+ * cheaper operations:
+ *  - integer powers become multiplications (pow(x, 3) -> (x * x) * x) and
+ *    pow(x, 0.5) becomes sqrt(x);
+ *  - divisions by the same variable become multiplications by a single
+ *    reciprocal (a / d, b / d -> r = 1 / d, a * r, b * r);
+ *  - inverse functions cancel out (exp(log(x)), log(exp(x)),
+ *    sqrt(x) * sqrt(x) -> x);
+ *  - sign changes are folded (-(-x) -> x, x * -1 -> -x, a + -b -> a - b,
+ *    -(a - b) -> b - a, (-a) * (-b) -> a * b, abs(-x) -> abs(x), ...);
+ *  - constants are reassociated ((x + 1) + 2 -> x + 3, 2 * (3 * x) -> 6 * x)
+ *    and a - a becomes zero.
+ *
+ * These rewrites are exact for real numbers but they can change the
+ * rounding of results and the propagation of NaNs (e.g. exp(log(x)) for
+ * x < 0), similarly to the "fast math" options of compilers.
+ *
+ * Nodes are modified in place and the replaced operations are kept so that
+ * the original graph can be restored. Operations replaced by one of their
+ * arguments (or a constant) are never modified; only the arguments of the
+ * operations which use them are updated.
+ *
+ * @author Feng Yang
+ */
+template <class Base>
+class AlgebraicSimplifier {
+public:
+    using Node = OperationNode<Base>;
+    using Arg = Argument<Base>;
+    using CGB = CG<Base>;
+
+protected:
+    /**
+     * The handler which owns the operation graph
+     */
+    CodeHandler<Base>& handler_;
+    /**
+     * The maximum absolute value of integer exponents of pow() replaced by
+     * multiplications
+     */
+    int maxPowExponent_;
+    /**
+     * The number of times each node is used (by node position in the handler)
+     */
+    std::vector<size_t> useCount_;
+    /**
+     * The value used instead of each node (by node position in the handler)
+     */
+    std::vector<std::unique_ptr<Arg>> replacement_;
+    /**
+     * Whether or not the original operation of each node was saved
+     * (by node position in the handler)
+     */
+    std::vector<bool> saved_;
+    /**
+     * The original operations of the modified nodes
+     */
+    std::list<std::pair<Node*, Node*>>* originals_;
+    /**
+     * The number of operations before the simplification
+     */
+    size_t operationsBefore_;
+    /**
+     * The number of operations after the simplification
+     */
+    size_t operationsAfter_;
+
+public:
+    /**
+     * @param handler the handler which owns the operation graph
+     * @param maxPowExponent the maximum absolute value of integer exponents
+     *                       of pow() which are replaced by multiplications
+     */
+    inline explicit AlgebraicSimplifier(CodeHandler<Base>& handler, int maxPowExponent = 16)
+        : handler_(handler),
+          maxPowExponent_(maxPowExponent),
+          originals_(nullptr),
+          operationsBefore_(0),
+          operationsAfter_(0) {}
+
+    AlgebraicSimplifier(const AlgebraicSimplifier&) = delete;
+
+    AlgebraicSimplifier& operator=(const AlgebraicSimplifier&) = delete;
+
+    inline virtual ~AlgebraicSimplifier() = default;
+
+    /**
+     * Simplifies the operations used by the dependent variables.
+     *
+     * @param dependent the dependent variables
+     * @param originals pairs with the modified nodes and a copy of their
+     *                  original operation (can be used to restore the graph)
+     * @return the number of modified nodes
+     */
+    inline size_t simplify(ArrayView<CGB>& dependent, std::list<std::pair<Node*, Node*>>& originals) {
+        size_t nNodes = handler_.getManagedNodesCount();
+        useCount_.assign(nNodes, 0);
+        replacement_.clear();
+        replacement_.resize(nNodes);
+        saved_.assign(nNodes, false);
+        originals_ = &originals;
+        size_t originalsSize = originals.size();
+
+        std::vector<Node*> order = postOrder(dependent, true);
+        operationsBefore_ = countOperations(order);
+
+        for (Node* node : order) {
+            simplify(*node);
+        }
+
+        shareReciprocals(order);
+
+        // the dependent variables cannot be replaced, use an alias
+        for (size_t i = 0; i < dependent.size(); ++i) {
+            Node* root = dependent[i].getOperationNode();
+            if (root == nullptr) continue;
+            const Arg* r = getReplacement(*root);
+            if (r != nullptr && r->getOperation() != nullptr) {
+                save(*root);
+                root->setOperation(CGOpCode::Alias, {*r});
+            }
+        }
+
+        operationsAfter_ = countOperations(postOrder(dependent, false));
+
+        originals_ = nullptr;
+        replacement_.clear();
+
+        return originals.size() - originalsSize;
+    }
+
+    /**
+     * @return the number of operations used by the dependent variables
+     *         before the last simplification
+     */
+    inline size_t getOperationsBefore() const { return operationsBefore_; }
+
+    /**
+     * @return the number of operations used by the dependent variables
+     *         after the last simplification
+     */
+    inline size_t getOperationsAfter() const { return operationsAfter_; }
+
+    /**
+     * @return the number of operations removed by the last simplification
+     */
+    inline size_t getOperationReduction() const {
+        return operationsBefore_ > operationsAfter_ ? operationsBefore_ - operationsAfter_ : 0;
+    }
+
+    /**
+     * Whether or not an operation can be rewritten by this class
+     */
+    static inline bool isSimplifiable(CGOpCode op) {
+        return SubgraphOutliner<Base>::isOutlinable(op);
+    }
+
+protected:
+    /**
+     * Determines the post-order of the nodes used by the dependents.
+     *
+     * @param countUses whether or not to determine the number of uses of
+     *                  each node
+     */
+    inline std::vector<Node*> postOrder(ArrayView<CGB>& dependent, bool countUses) {
+        size_t nNodes = handler_.getManagedNodesCount();
+        std::vector<Node*> order;
+        order.reserve(nNodes);
+        std::vector<bool> visited(nNodes, false);
+        std::vector<std::pair<Node*, size_t>> stack;
+
+        for (size_t i = 0; i < dependent.size(); ++i) {
+            Node* root = dependent[i].getOperationNode();
+            if (root == nullptr) continue;
+
+            if (countUses) useCount_[root->getHandlerPosition()]++;
+            if (visited[root->getHandlerPosition()]) continue;
+
+            visited[root->getHandlerPosition()] = true;
+            stack.emplace_back(root, 0);
+
+            while (!stack.empty()) {
+                Node* node = stack.back().first;
+                size_t a = stack.back().second;
+                const std::vector<Arg>& args = node->getArguments();
+                if (a < args.size()) {
+                    stack.back().second++;
+                    Node* arg = args[a].getOperation();
+                    if (arg != nullptr) {
+                        if (countUses) useCount_[arg->getHandlerPosition()]++;
+                        if (!visited[arg->getHandlerPosition()]) {
+                            visited[arg->getHandlerPosition()] = true;
+                            stack.emplace_back(arg, 0);
+                        }
+                    }
+                } else {
+                    order.push_back(node);
+                    stack.pop_back();
+                }
+            }
+        }
+
+        return order;
+    }
+
+    static inline size_t countOperations(const std::vector<Node*>& order) {
+        size_t n = 0;
+        for (const Node* node : order) {
+            if (isSimplifiable(node->getOperationType())) n++;
+        }
+        return n;
+    }
+
+    inline void simplify(Node& node) {
+        if (!isSimplifiable(node.getOperationType())) return;
+
+        CGOpCode op = node.getOperationType();
+        std::vector<Arg> args = node.getArguments();
+
+        bool changed = false;
+        for (Arg& a : args) {
+            if (a.getOperation() != nullptr) {
+                const Arg* r = getReplacement(*a.getOperation());
+                if (r != nullptr) {
+                    a = *r;
+                    changed = true;
+                }
+            }
+        }
+
+        std::unique_ptr<Arg> replacement;
+        for (size_t it = 0; it < 8 && replacement == nullptr; ++it) {
+            if (!rewrite(op, args, replacement)) break;
+            changed = true;
+        }
+
+        if (replacement != nullptr) {
+            replacement_[node.getHandlerPosition()] = std::move(replacement);
+        } else if (changed) {
+            save(node);
+            node.setOperation(op, args);
+        }
+    }
+
+    /**
+     * Applies a single rewrite rule.
+     *
+     * @param op the operation type (can be modified)
+     * @param args the operation arguments (can be modified)
+     * @param replacement the value which replaces the operation (output)
+     * @return true if the operation was rewritten or replaced
+     */
+    inline bool rewrite(CGOpCode& op, std::vector<Arg>& args, std::unique_ptr<Arg>& replacement) {
+        switch (op) {
+            case CGOpCode::Add:
+                return rewriteAdd(op, args, replacement);
+            case CGOpCode::Sub:
+                return rewriteSub(op, args, replacement);
+            case CGOpCode::Mul:
+                return rewriteMul(op, args, replacement);
+            case CGOpCode::Div:
+                return rewriteDiv(op, args, replacement);
+            case CGOpCode::UnMinus:
+                if (args[0].getParameter() != nullptr) {
+                    replacement.reset(new Arg(-*args[0].getParameter()));
+                    return true;
+                } else if (isOperation(args[0], CGOpCode::UnMinus)) {
+                    // -(-x) -> x
+                    replacement.reset(new Arg(argument(args[0], 0)));
+                    return true;
+                } else if (isOperation(args[0], CGOpCode::Sub) && isSingleUse(args[0])) {
+                    // -(a - b) -> b - a
+                    op = CGOpCode::Sub;
+                    args = {argument(args[0], 1), argument(args[0], 0)};
+                    return true;
+                }
+                return false;
+            case CGOpCode::Abs:
+                if (isOperation(args[0], CGOpCode::UnMinus)) {
+                    // abs(-x) -> abs(x)
+                    args = {argument(args[0], 0)};
+                    return true;
+                } else if (isOperation(args[0], CGOpCode::Abs)) {
+                    // abs(abs(x)) -> abs(x)
+                    replacement.reset(new Arg(args[0]));
+                    return true;
+                }
+                return false;
+            case CGOpCode::Exp:
+                if (isOperation(args[0], CGOpCode::Log)) {
+                    // exp(log(x)) -> x
+                    replacement.reset(new Arg(argument(args[0], 0)));
+                    return true;
+                }
+                return false;
+            case CGOpCode::Log:
+                if (isOperation(args[0], CGOpCode::Exp)) {
+                    // log(exp(x)) -> x
+                    replacement.reset(new Arg(argument(args[0], 0)));
+                    return true;
+                }
+                return false;
+            case CGOpCode::Pow:
+                return rewritePow(op, args, replacement);
+            default:
+                return false;
+        }
+    }
+
+    inline bool rewriteAdd(CGOpCode& op, std::vector<Arg>& args, std::unique_ptr<Arg>& replacement) {
+        if (args[0].getParameter() != nullptr && args[1].getParameter() != nullptr) {
+            replacement.reset(new Arg(*args[0].getParameter() + *args[1].getParameter()));
+            return true;
+        } else if (isParameter(args[1], 0)) {
+            replacement.reset(new Arg(args[0]));
+            return true;
+        } else if (isParameter(args[0], 0)) {
+            replacement.reset(new Arg(args[1]));
+            return true;
+        } else if (isOperation(args[1], CGOpCode::UnMinus)) {
+            // a + -b -> a - b
+            op = CGOpCode::Sub;
+            args = {args[0], argument(args[1], 0)};
+            return true;
+        } else if (isOperation(args[0], CGOpCode::UnMinus)) {
+            // -a + b -> b - a
+            op = CGOpCode::Sub;
+            args = {args[1], argument(args[0], 0)};
+            return true;
+        }
+        return reassociateAdd(op, args, replacement);
+    }
+
+    inline bool rewriteSub(CGOpCode& op, std::vector<Arg>& args, std::unique_ptr<Arg>& replacement) {
+        if (args[0].getParameter() != nullptr && args[1].getParameter() != nullptr) {
+            replacement.reset(new Arg(*args[0].getParameter() - *args[1].getParameter()));
+            return true;
+        } else if (isParameter(args[1], 0)) {
+            replacement.reset(new Arg(args[0]));
+            return true;
+        } else if (isParameter(args[0], 0)) {
+            op = CGOpCode::UnMinus;
+            args = {args[1]};
+            return true;
+        } else if (args[0].getOperation() != nullptr && args[0].getOperation() == args[1].getOperation()) {
+            // a - a -> 0
+            replacement.reset(new Arg(Base(0.0)));
+            return true;
+        } else if (isOperation(args[1], CGOpCode::UnMinus)) {
+            // a - -b -> a + b
+            op = CGOpCode::Add;
+            args = {args[0], argument(args[1], 0)};
+            return true;
+        }
+        return reassociateAdd(op, args, replacement);
+    }
+
+    inline bool rewriteMul(CGOpCode& op, std::vector<Arg>& args, std::unique_ptr<Arg>& replacement) {
+        if (args[0].getParameter() != nullptr && args[1].getParameter() != nullptr) {
+            replacement.reset(new Arg(*args[0].getParameter() * *args[1].getParameter()));
+            return true;
+        } else if (isParameter(args[0], 0) || isParameter(args[1], 0)) {
+            replacement.reset(new Arg(Base(0.0)));
+            return true;
+        } else if (isParameter(args[1], 1)) {
+            replacement.reset(new Arg(args[0]));
+            return true;
+        } else if (isParameter(args[0], 1)) {
+            replacement.reset(new Arg(args[1]));
+            return true;
+        } else if (isParameter(args[1], -1)) {
+            // x * -1 -> -x
+            op = CGOpCode::UnMinus;
+            args = {args[0]};
+            return true;
+        } else if (isParameter(args[0], -1)) {
+            // -1 * x -> -x
+            op = CGOpCode::UnMinus;
+            args = {args[1]};
+            return true;
+        } else if (isOperation(args[0], CGOpCode::UnMinus) && isOperation(args[1], CGOpCode::UnMinus)) {
+            // (-a) * (-b) -> a * b
+            args = {argument(args[0], 0), argument(args[1], 0)};
+            return true;
+        } else if (isOperation(args[0], CGOpCode::Sqrt) && args[0].getOperation() == args[1].getOperation()) {
+            // sqrt(x) * sqrt(x) -> x
+            replacement.reset(new Arg(argument(args[0], 0)));
+            return true;
+        }
+
+        /**
+         * c1 * (c2 * x) -> (c1 * c2) * x
+         */
+        size_t p = args[0].getParameter() != nullptr ? 0 : 1;
+        const Arg& inner = args[1 - p];
+        if (args[p].getParameter() != nullptr && isOperation(inner, CGOpCode::Mul) && isSingleUse(inner)) {
+            const Arg& i0 = argument(inner, 0);
+            const Arg& i1 = argument(inner, 1);
+            size_t ip = i0.getParameter() != nullptr ? 0 : (i1.getParameter() != nullptr ? 1 : 2);
+            if (ip < 2) {
+                Base k = *args[p].getParameter() * *(ip == 0 ? i0 : i1).getParameter();
+                args = {Arg(k), ip == 0 ? i1 : i0};
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    inline bool rewriteDiv(CGOpCode& op, std::vector<Arg>& args, std::unique_ptr<Arg>& replacement) {
+        if (args[0].getParameter() != nullptr && args[1].getParameter() != nullptr) {
+            replacement.reset(new Arg(*args[0].getParameter() / *args[1].getParameter()));
+            return true;
+        } else if (isParameter(args[1], 1)) {
+            replacement.reset(new Arg(args[0]));
+            return true;
+        } else if (isParameter(args[1], -1)) {
+            // x / -1 -> -x
+            op = CGOpCode::UnMinus;
+            args = {args[0]};
+            return true;
+        } else if (isOperation(args[0], CGOpCode::UnMinus) && isOperation(args[1], CGOpCode::UnMinus)) {
+            // (-a) / (-b) -> a / b
+            args = {argument(args[0], 0), argument(args[1], 0)};
+            return true;
+        }
+        return false;
+    }
+
+    inline bool rewritePow(CGOpCode& op, std::vector<Arg>& args, std::unique_ptr<Arg>& replacement) {
+        if (args[0].getOperation() == nullptr || args[1].getParameter() == nullptr) return false;
+
+        const Base& e = *args[1].getParameter();
+        if (e == Base(0.5)) {
+            op = CGOpCode::Sqrt;
+            args = {args[0]};
+            return true;
+        }
+
+        int n = -maxPowExponent_;
+        while (n <= maxPowExponent_ && e != Base(double(n))) n++;
+        if (n > maxPowExponent_) return false;  // not an integer exponent
+
+        if (n == 0) {
+            replacement.reset(new Arg(Base(1.0)));
+        } else if (n == 1) {
+            replacement.reset(new Arg(args[0]));
+        } else if (n < 0) {
+            op = CGOpCode::Div;
+            args = {Arg(Base(1.0)), power(args[0], unsigned(-n))};
+        } else {
+            op = CGOpCode::Mul;
+            if (n % 2 == 0) {
+                Arg h = power(args[0], unsigned(n / 2));
+                args = {h, h};
+            } else {
+                args = {power(args[0], unsigned(n - 1)), args[0]};
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Creates the multiplications which compute an integer power.
+     */
+    inline Arg power(const Arg& x, unsigned n) {
+        if (n == 1) return x;
+
+        Node* node;
+        if (n % 2 == 0) {
+            Arg h = power(x, n / 2);
+            node = handler_.makeNode(CGOpCode::Mul, {h, h});
+        } else {
+            node = handler_.makeNode(CGOpCode::Mul, {power(x, n - 1), x});
+        }
+        addNode(*node);
+        return Arg(*node);
+    }
+
+    /**
+     * Combines the constants of nested additions/subtractions:
+     * (x + c1) + c2 -> x + (c1 + c2), c2 - (c1 - x) -> x + (c2 - c1), ...
+     */
+    inline bool reassociateAdd(CGOpCode& op, std::vector<Arg>& args, std::unique_ptr<Arg>& replacement) {
+        bool negOuter;
+        Base kOuter;
+        const Arg* innerArg = affine(op, args, negOuter, kOuter);
+        if (innerArg == nullptr || !isSingleUse(*innerArg)) return false;
+
+        const Node& inner = *innerArg->getOperation();
+        bool negInner;
+        Base kInner;
+        const Arg* x = affine(inner.getOperationType(), inner.getArguments(), negInner, kInner);
+        if (x == nullptr) return false;
+
+        // outer = sOuter * (sInner * x + kInner) + kOuter
+        bool neg = negOuter != negInner;
+        Base k = (negOuter ? -kInner : kInner) + kOuter;
+        Arg xArg = *x;
+
+        if (k == Base(0.0)) {
+            if (neg) {
+                op = CGOpCode::UnMinus;
+                args = {xArg};
+            } else {
+                replacement.reset(new Arg(xArg));
+            }
+        } else if (neg) {
+            op = CGOpCode::Sub;
+            args = {Arg(k), xArg};
+        } else {
+            op = CGOpCode::Add;
+            args = {xArg, Arg(k)};
+        }
+        return true;
+    }
+
+    /**
+     * Determines if an addition or subtraction has the form
+     * (neg ? -x : x) + k where x is a variable and k a constant.
+     *
+     * @return the argument with x or nullptr if the operation does not have
+     *         this form
+     */
+    static inline const Arg* affine(CGOpCode op, const std::vector<Arg>& args, bool& neg, Base& k) {
+        if ((op != CGOpCode::Add && op != CGOpCode::Sub) || args.size() != 2) return nullptr;
+
+        if (args[0].getOperation() != nullptr && args[1].getParameter() != nullptr) {
+            neg = false;
+            k = op == CGOpCode::Add ? *args[1].getParameter() : -*args[1].getParameter();
+            return &args[0];
+        } else if (args[0].getParameter() != nullptr && args[1].getOperation() != nullptr) {
+            neg = op == CGOpCode::Sub;
+            k = *args[0].getParameter();
+            return &args[1];
+        }
+        return nullptr;
+    }
+
+    /**
+     * Replaces divisions by the same variable with multiplications by a
+     * single reciprocal.
+     */
+    inline void shareReciprocals(const std::vector<Node*>& order) {
+        // by denominator position in the handler (the same order in every run)
+        std::map<size_t, std::vector<Node*>> divisions;
+        for (Node* node : order) {
+            if (node->getOperationType() != CGOpCode::Div || getReplacement(*node) != nullptr) continue;
+            Node* den = node->getArguments()[1].getOperation();
+            if (den != nullptr) divisions[den->getHandlerPosition()].push_back(node);
+        }
+
+        for (auto& it : divisions) {
+            std::vector<Node*>& divs = it.second;
+            if (divs.size() < 2) continue;
+            Node& den = *divs[0]->getArguments()[1].getOperation();
+
+            Node* reciprocal = nullptr;
+            for (Node* div : divs) {
+                if (isParameter(div->getArguments()[0], 1)) {
+                    reciprocal = div;
+                    break;
+                }
+            }
+
+            if (reciprocal == nullptr) {
+                reciprocal = handler_.makeNode(CGOpCode::Div, {Arg(Base(1.0)), Arg(den)});
+                addNode(*reciprocal);
+            }
+
+            for (Node* div : divs) {
+                if (div == reciprocal) continue;
+                save(*div);
+                if (isParameter(div->getArguments()[0], 1))
+                    div->setOperation(CGOpCode::Alias, {Arg(*reciprocal)});  // repeated reciprocal
+                else
+                    div->setOperation(CGOpCode::Mul, {div->getArguments()[0], Arg(*reciprocal)});
+            }
+        }
+    }
+
+    inline void save(Node& node) {
+        size_t pos = node.getHandlerPosition();
+        if (pos < saved_.size() && !saved_[pos]) {
+            saved_[pos] = true;
+            originals_->emplace_back(&node, handler_.cloneNode(node));
+        }
+    }
+
+    /**
+     * Registers a new node created by this class
+     */
+    inline void addNode(const Node& node) {
+        size_t n = handler_.getManagedNodesCount();
+        useCount_.resize(n, 0);
+        replacement_.resize(n);
+        saved_.resize(n, true);  // new nodes do not need to be restored
+        useCount_[node.getHandlerPosition()] = 1;
+    }
+
+    inline const Arg* getReplacement(const Node& node) const {
+        size_t pos = node.getHandlerPosition();
+        return pos < replacement_.size() ? replacement_[pos].get() : nullptr;
+    }
+
+    inline bool isSingleUse(const Arg& arg) const {
+        Node* node = arg.getOperation();
+        return node != nullptr && node->getHandlerPosition() < useCount_.size() &&
+               useCount_[node->getHandlerPosition()] == 1;
+    }
+
+    static inline bool isOperation(const Arg& arg, CGOpCode op) {
+        return arg.getOperation() != nullptr && arg.getOperation()->getOperationType() == op &&
+               !arg.getOperation()->getArguments().empty();
+    }
+
+    static inline bool isParameter(const Arg& arg, double value) {
+        return arg.getParameter() != nullptr && *arg.getParameter() == Base(value);
+    }
+
+    static inline const Arg& argument(const Arg& arg, size_t i) { return arg.getOperation()->getArguments()[i]; }
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
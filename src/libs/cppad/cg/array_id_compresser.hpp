@@ -34,10 +34,24 @@ private:
      * [end] = start
      */
     std::map<size_t, size_t> _freeArrayEndSpace;
+    /**
+     * the free spaces sorted by size: (size, start)
+     */
+    std::set<std::pair<size_t, size_t>> _freeArraySizeSpace;
     /**
      * values in temporary array
      */
     std::vector<const Argument<Base>*> _tmpArrayValues;
+    /**
+     * the positions in the temporary array holding the result of an
+     * operation: (operation, position)
+     */
+    std::set<std::pair<const OperationNode<Base>*, size_t>> _tmpArrayPositions;
+    /**
+     * the positions in the temporary array holding a parameter value:
+     * (value, position)
+     */
+    std::set<std::pair<Base, size_t>> _tmpArrayParameterPositions;
     /**
      * Variable IDs
      */
@@ -68,22 +82,21 @@ public:
             // try to merge with previous free space
             it = _freeArrayEndSpace.find(arrayStart - 1);  // previous
             if (it != _freeArrayEndSpace.end()) {
-                arrayStart = it->second;  // merge space
-                _freeArrayEndSpace.erase(it);
-                _freeArrayStartSpace.erase(arrayStart);
+                size_t prevStart = it->second;
+                removeFreeSpace(prevStart, arrayStart - 1);
+                arrayStart = prevStart;  // merge space
             }
         }
 
         // try to merge with the next free space
         it = _freeArrayStartSpace.find(arrayEnd + 1);  // next
         if (it != _freeArrayStartSpace.end()) {
-            arrayEnd = it->second;  // merge space
-            _freeArrayStartSpace.erase(it);
-            _freeArrayEndSpace.erase(arrayEnd);
+            size_t nextEnd = it->second;
+            removeFreeSpace(arrayEnd + 1, nextEnd);
+            arrayEnd = nextEnd;  // merge space
         }
 
-        _freeArrayStartSpace[arrayStart] = arrayEnd;
-        _freeArrayEndSpace[arrayEnd] = arrayStart;
+        insertFreeSpace(arrayStart, arrayEnd);
 
         CPPADCG_ASSERT_UNKNOWN(_freeArrayStartSpace.size() == _freeArrayEndSpace.size());
     }
@@ -93,7 +106,7 @@ public:
 
         if (arraySize == 0) return 0;  // nothing to do (no space required)
 
-        std::set<size_t> blackList;
+        std::vector<size_t> blackList;
         const std::vector<Argument<Base>>& args = newArray.getArguments();
         for (size_t i = 0; i < args.size(); i++) {
             const OperationNode<Base>* argOp = args[i].getOperation();
@@ -102,70 +115,84 @@ public:
                 CPPADCG_ASSERT_UNKNOWN(_varId[otherArray] > 0);  // make sure it had already been assigned space
                 size_t otherArrayStart = _varId[otherArray] - 1;
                 size_t index = argOp->getInfo()[0];
-                blackList.insert(otherArrayStart + index);
+                blackList.push_back(otherArrayStart + index);
             }
         }
+        std::sort(blackList.begin(), blackList.end());
 
         /**
          * Find the best location for the new array
          */
-        std::map<size_t, size_t>::reverse_iterator it;
-        std::map<size_t, size_t>::reverse_iterator itBestFit = _freeArrayStartSpace.rend();
+        size_t bestStart = (std::numeric_limits<size_t>::max)();
+        size_t bestSpace = 0;
         size_t bestCommonValues = 0;  // the number of values likely to be the same
-        for (it = _freeArrayStartSpace.rbegin(); it != _freeArrayStartSpace.rend(); ++it) {
-            size_t start = it->first;
-            size_t end = it->second;
+
+        auto evaluate = [&](size_t start, size_t end) {
             size_t space = end - start + 1;
-            if (space < arraySize) {
-                continue;
+            size_t commonVals = countCommonValues(start, args);
+            if (bestStart == (std::numeric_limits<size_t>::max)() || commonVals > bestCommonValues ||
+                (commonVals == bestCommonValues && space < bestSpace)) {
+                bestStart = start;
+                bestSpace = space;
+                bestCommonValues = commonVals;
             }
+        };
 
-            std::set<size_t>::const_iterator itBlack = blackList.lower_bound(start);
-            if (itBlack != blackList.end() && *itBlack <= end) {
-                continue;  // cannot use this space
+        // the smallest free space which can be used
+        // (each blacklisted element can only exclude one free space)
+        auto itSize = _freeArraySizeSpace.lower_bound(std::make_pair(arraySize, size_t(0)));
+        for (; itSize != _freeArraySizeSpace.end(); ++itSize) {
+            size_t start = itSize->second;
+            size_t end = start + itSize->first - 1;
+            if (!isBlackListed(blackList, start, end)) {
+                evaluate(start, end);
+                break;
             }
+        }
 
-            // possible candidate
-            if (itBestFit == _freeArrayStartSpace.rend()) {
-                itBestFit = it;
-            } else {
-                size_t bestSpace = itBestFit->second - itBestFit->first + 1;
+        // free spaces which already contain some of the values
+        if (bestStart != (std::numeric_limits<size_t>::max)() && bestCommonValues < arraySize) {
+            std::set<size_t> evaluated;
+            auto evaluateFreeSpace = [&](size_t start) {
+                auto itStart = _freeArrayStartSpace.find(start);
+                if (itStart == _freeArrayStartSpace.end() || !evaluated.insert(start).second) return;
+                size_t end = itStart->second;
+                if (end - start + 1 < arraySize || isBlackListed(blackList, start, end)) return;
 
-                size_t commonVals = 0;
-                for (size_t i = 0; i < arraySize; i++) {
-                    if (isSameArrayElement(_tmpArrayValues[start + i], args[i])) {
-                        commonVals++;
+                evaluate(start, end);
+            };
+
+            for (size_t i = 0; i < arraySize; i++) {
+                // only the positions which allow the value to be at index i
+                const OperationNode<Base>* op = args[i].getOperation();
+                if (op != nullptr) {
+                    auto itPos = _tmpArrayPositions.lower_bound(std::make_pair(op, i));
+                    for (; itPos != _tmpArrayPositions.end() && itPos->first == op; ++itPos) {
+                        evaluateFreeSpace(itPos->second - i);
+                    }
+                } else if (isIndexedParameter(args[i])) {
+                    const Base& value = *args[i].getParameter();
+                    auto itPos = _tmpArrayParameterPositions.lower_bound(std::make_pair(value, i));
+                    for (; itPos != _tmpArrayParameterPositions.end() && itPos->first == value; ++itPos) {
+                        evaluateFreeSpace(itPos->second - i);
                     }
                 }
 
-                if (space < bestSpace || commonVals > bestCommonValues) {
-                    // better fit
-                    itBestFit = it;
-                    bestCommonValues = commonVals;
-                    if (bestCommonValues == arraySize) {
-                        break;  // jackpot
-                    }
+                if (bestCommonValues == arraySize) {
+                    break;  // jackpot
                 }
             }
         }
 
-        size_t bestStart = (std::numeric_limits<size_t>::max)();
-        if (itBestFit != _freeArrayStartSpace.rend()) {
+        if (bestStart != (std::numeric_limits<size_t>::max)()) {
             /**
              * Use available space
              */
-            bestStart = itBestFit->first;
-            size_t bestEnd = itBestFit->second;
-            size_t bestSpace = bestEnd - bestStart + 1;
-            _freeArrayStartSpace.erase(bestStart);
-            if (bestSpace == arraySize) {
-                // entire space
-                _freeArrayEndSpace.erase(bestEnd);
-            } else {
+            size_t bestEnd = bestStart + bestSpace - 1;
+            removeFreeSpace(bestStart, bestEnd);
+            if (bestSpace > arraySize) {
                 // some space left
-                size_t newFreeStart = bestStart + arraySize;
-                _freeArrayStartSpace[newFreeStart] = bestEnd;
-                _freeArrayEndSpace.at(bestEnd) = newFreeStart;
+                insertFreeSpace(bestStart + arraySize, bestEnd);
             }
 
         } else {
@@ -180,11 +207,9 @@ public:
                 size_t lastSpotStart = itEnd->second;
                 size_t lastSpotEnd = itEnd->first;
                 size_t lastSpotSize = lastSpotEnd - lastSpotStart + 1;
-                std::set<size_t>::const_iterator itBlack = blackList.lower_bound(lastSpotStart);
-                if (itBlack == blackList.end()) {
+                if (blackList.empty() || blackList.back() < lastSpotStart) {
                     // can use this space
-                    _freeArrayEndSpace.erase(itEnd);
-                    _freeArrayStartSpace.erase(lastSpotStart);
+                    removeFreeSpace(lastSpotStart, lastSpotEnd);
 
                     _idArrayCount += arraySize - lastSpotSize;
                     bestStart = lastSpotStart;
@@ -199,11 +224,29 @@ public:
             }
         }
 
+        if (_tmpArrayValues.size() < bestStart + arraySize) {
+            _tmpArrayValues.resize(bestStart + arraySize, nullptr);
+        }
+
         for (size_t i = 0; i < arraySize; i++) {
-            _tmpArrayValues[bestStart + i] = &args[i];
+            const Argument<Base>*& value = _tmpArrayValues[bestStart + i];
+            if (value != nullptr) {
+                if (value->getOperation() != nullptr) {
+                    _tmpArrayPositions.erase(std::make_pair(value->getOperation(), bestStart + i));
+                } else if (isIndexedParameter(*value)) {
+                    _tmpArrayParameterPositions.erase(std::make_pair(*value->getParameter(), bestStart + i));
+                }
+            }
+            value = &args[i];
+            if (args[i].getOperation() != nullptr) {
+                _tmpArrayPositions.emplace(args[i].getOperation(), bestStart + i);
+            } else if (isIndexedParameter(args[i])) {
+                _tmpArrayParameterPositions.emplace(*args[i].getParameter(), bestStart + i);
+            }
         }
 
         CPPADCG_ASSERT_UNKNOWN(_freeArrayStartSpace.size() == _freeArrayEndSpace.size());
+        CPPADCG_ASSERT_UNKNOWN(_freeArrayStartSpace.size() == _freeArraySizeSpace.size());
 
         return bestStart;
     }
@@ -222,6 +265,46 @@ public:
     }
 
     virtual ~ArrayIdCompresser() {}
+
+private:
+    inline void insertFreeSpace(size_t start, size_t end) {
+        _freeArrayStartSpace[start] = end;
+        _freeArrayEndSpace[end] = start;
+        _freeArraySizeSpace.emplace(end - start + 1, start);
+    }
+
+    inline void removeFreeSpace(size_t start, size_t end) {
+        _freeArrayStartSpace.erase(start);
+        _freeArrayEndSpace.erase(end);
+        _freeArraySizeSpace.erase(std::make_pair(end - start + 1, start));
+    }
+
+    inline size_t countCommonValues(size_t start, const std::vector<Argument<Base>>& args) const {
+        size_t commonVals = 0;
+        for (size_t i = 0; i < args.size() && start + i < _tmpArrayValues.size(); i++) {
+            if (isSameArrayElement(_tmpArrayValues[start + i], args[i])) {
+                commonVals++;
+            }
+        }
+        return commonVals;
+    }
+
+    /**
+     * Whether or not the position of a parameter value is saved
+     * (NaN is never the same array element and cannot be sorted)
+     */
+    static inline bool isIndexedParameter(const Argument<Base>& arg) {
+        const Base* value = arg.getParameter();
+        return value != nullptr && *value == *value;
+    }
+
+    /**
+     * Whether or not a sorted blacklist has any element in [start, end]
+     */
+    static inline bool isBlackListed(const std::vector<size_t>& blackList, size_t start, size_t end) {
+        auto itBlack = std::lower_bound(blackList.begin(), blackList.end(), start);
+        return itBlack != blackList.end() && *itBlack <= end;
+    }
 };
 
 }  // namespace cg
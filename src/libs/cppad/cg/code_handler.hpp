@@ -40,6 +40,36 @@ public:
 protected:
     struct LoopData;  // forward declaration
 
+    /**
+     * Evaluation order data associated with an operation node.
+     * 32-bit values are used since the number of nodes managed by a
+     * code handler is limited to the range of uint32_t (12 bytes for each
+     * node instead of three separate tables with 8 bytes each).
+     */
+    struct NodeOrder {
+        /**
+         * evaluation order of the node
+         * (zero means that an evaluation position was never assigned)
+         */
+        uint32_t evaluation;
+        /**
+         * the last index in the evaluation order for which the node is taken
+         * as an argument of another operation node
+         * (zero means that the node was never used)
+         */
+        uint32_t lastUsage;
+        /**
+         * The number of operations used in the expression that directly
+         * assign the value to a (temporary/dependent) variable.
+         * Operations used to compute other temporary variables are not
+         * considered.
+         */
+        uint32_t operationCount;
+
+        inline NodeOrder() noexcept : evaluation(0), lastUsage(0), operationCount(0) {}
+    };
+    static_assert(sizeof(NodeOrder) == 3 * sizeof(uint32_t), "NodeOrder must not contain padding");
+
 protected:
     // counter used to determine visitation IDs for the operation tree
     size_t _idVisit;
@@ -66,33 +96,22 @@ protected:
     std::set<CodeHandlerVectorSync<Base>*> _managedVectors;
     /**
      * the ID of the last visit to each managed node
+     * (32-bit: the visit counter restarts when it reaches the maximum value)
      */
-    CodeHandlerVector<Base, size_t> _lastVisit;
+    CodeHandlerVector<Base, uint32_t> _lastVisit;
     /**
      * scope of each managed operation node
      */
     CodeHandlerVector<Base, ScopeIDType> _scope;
     /**
-     * evaluation order of each managed node
-     * (zero means that an evaluation position was never assigned)
-     */
-    CodeHandlerVector<Base, size_t> _evaluationOrder;
-    /**
-     * the last index in the evaluation order for which an operation node
-     * is taken as an argument of another operation node.
-     * (zero means that the node was never used)
+     * evaluation order data of each managed node
+     * (these values are always accessed together while creating variables)
      */
-    CodeHandlerVector<Base, size_t> _lastUsageOrder;
+    CodeHandlerVector<Base, NodeOrder> _nodeOrder;
     /**
      * the total number of times the result of an operation node  is used
      */
     CodeHandlerVector<Base, size_t> _totalUseCount;
-    /**
-     * The number of operations used in the expression that directly assign the value
-     * to a (temporary/dependent) variable.
-     * Operations used to compute other temporary variables are not considered.
-     */
-    CodeHandlerVector<Base, size_t> _operationCount;
     /**
      * Provides the variable ID that was altered/assigned to operation nodes.
      * Zero means that no variable is assigned.
@@ -143,6 +162,8 @@ protected:
     bool _used;
     // a flag indicating whether or not to reuse the IDs of destroyed variables
     bool _reuseIDs;
+    // a flag indicating whether or not to reorder operations to reduce the number of simultaneously live temporaries
+    bool _registerPressureScheduling;
     // scope color/index counter
     ScopeIDType _scopeColorCount;
     // the current scope color/index counter
@@ -151,6 +172,20 @@ protected:
     std::vector<ScopePath> _scopes;
     // possible altered nodes due to scope conditionals (altered node <-> clone of original)
     std::list<std::pair<Node*, Node*>> _alteredNodes;
+    // a flag indicating whether or not to simplify the operation graph before generating source code
+    bool _algebraicSimplification;
+    // nodes rewritten by the algebraic simplification (rewritten node <-> clone of original)
+    std::list<std::pair<Node*, Node*>> _simplifiedNodes;
+    // the number of operations removed by the last algebraic simplification
+    size_t _simplifiedOperations;
+    // the minimum number of operations in repeated subgraphs for them to be outlined (zero means disabled)
+    size_t _minOutlineOperations;
+    // functions shared by repeated subgraphs (they also keep the original operations of the replaced nodes)
+    std::vector<std::unique_ptr<OutlinedFunction<Base>>> _outlinedFunctions;
+    // the minimum number of operations exclusive to a conditional expression case for it to use an if/else (zero means disabled)
+    size_t _minLazyBranchOperations;
+    // conditional expressions replaced by if/else branches (replaced node <-> clone of original)
+    std::list<std::pair<Node*, Node*>> _loweredBranchNodes;
     // the language used for source code generation
     Language<Base>* _lang;
     // the lowest ID used for temporary variables
@@ -199,6 +234,94 @@ public:
      */
     inline bool isReuseVariableIDs() const;
 
+    /**
+     * Defines whether or not to reorder the evaluation of temporary variables
+     * so that each one is computed as close as possible to its first usage.
+     * Operands that require more temporaries are evaluated first
+     * (Sethi-Ullman ordering) which reduces the number of simultaneously
+     * live temporary variables and, therefore, the register pressure in the
+     * compiled source code.
+     * This option is only used when variable IDs are reused.
+     */
+    inline void setRegisterPressureScheduling(bool schedule);
+
+    /**
+     * Whether or not the evaluation of temporary variables is reordered to
+     * reduce the number of simultaneously live temporaries.
+     */
+    inline bool isRegisterPressureScheduling() const;
+
+    /**
+     * Defines whether or not to rewrite the operation graph with cheaper
+     * algebraically equivalent operations during source code generation
+     * (see AlgebraicSimplifier).
+     * Integer powers become multiplications, divisions by the same variable
+     * use a single reciprocal, inverse functions cancel out, and sign
+     * changes and constants are folded.
+     * The results can differ in rounding from the original operations.
+     * The operation graph is restored once the source code is generated.
+     */
+    inline void setAlgebraicSimplification(bool simplify);
+
+    /**
+     * Whether or not the operation graph is simplified during source code
+     * generation.
+     */
+    inline bool isAlgebraicSimplification() const;
+
+    /**
+     * The number of operations removed by the algebraic simplification in
+     * the last source code generation.
+     */
+    inline size_t getSimplifiedOperationCount() const;
+
+    /**
+     * Defines the minimum number of operations of repeated (isomorphic)
+     * subgraphs for them to be replaced by calls to a shared function
+     * during source code generation.
+     * This can significantly reduce the size of the generated source code,
+     * the compilation time and the instruction cache pressure of models
+     * with repeated structures (e.g. kinematic transformations).
+     * The operation graph is restored once the source code is generated.
+     * The language must support CGOpCode::OutlinedCall operations.
+     *
+     * @param minOperations the minimum number of operations in a subgraph
+     *                      (zero disables outlining)
+     */
+    inline void setMinOutlineOperations(size_t minOperations);
+
+    /**
+     * The minimum number of operations of repeated subgraphs for them to be
+     * replaced by calls to a shared function.
+     *
+     * @return the minimum number of operations (zero means disabled)
+     */
+    inline size_t getMinOutlineOperations() const;
+
+    /**
+     * Defines the minimum number of operations used exclusively by the true
+     * or the false case of a conditional expression (e.g. CondExpLt) for it
+     * to be replaced by if/else branches during source code generation.
+     * The operations used only by one of the cases are then evaluated
+     * inside the corresponding branch instead of always evaluating both
+     * cases (see LazyBranchLowering).
+     * The operation graph is restored once the source code is generated.
+     * The language must support if/else branches whose condition is a
+     * comparison operation with two arguments (e.g. LanguageC).
+     *
+     * @param minOperations the minimum number of operations in a case
+     *                      (zero disables the if/else branches)
+     */
+    inline void setMinLazyBranchOperations(size_t minOperations);
+
+    /**
+     * The minimum number of operations used exclusively by a case of a
+     * conditional expression for it to be replaced by if/else branches.
+     *
+     * @return the minimum number of operations (zero means disabled)
+     */
+    inline size_t getMinLazyBranchOperations() const;
+
     /**
      * Marks the provided variables as being independent variables.
      *
@@ -241,6 +364,12 @@ public:
      */
     size_t getIndependentVariableSize() const;
 
+    /**
+     * The operation nodes of the independent variables defined with
+     * makeVariable() (in the order they were created).
+     */
+    inline const std::vector<Node*>& getIndependentVariables() const;
+
     /**
      * @throws CGException if a variable is not found in the independent vector
      */
@@ -606,6 +735,12 @@ protected:
 
     inline bool handleTemporaryVarInDiffScopes(Node& code, size_t oldScope, size_t newScope);
 
+    /**
+     * Whether or not the if/else branches of a scope use conditions based on
+     * loop iteration indexes (CGOpCode::IndexCondExpr)
+     */
+    static inline bool isIndexConditionBranch(const Node& bScope);
+
     inline void replaceWithConditionalTempVar(Node& tmp,
                                               IndexOperationNode<Base>& iterationIndexOp,
                                               const std::vector<size_t>& iterationRegions,
@@ -674,6 +809,29 @@ protected:
 
     inline void reorderOperation(Node& node);
 
+    /**
+     * Change the evaluation order of the temporary variables so that each
+     * one is evaluated right before its first usage.
+     * Only operations inside the same scope and without side effects are
+     * moved.
+     */
+    inline void scheduleForRegisterPressure();
+
+    /**
+     * Reorders the operations in a region of the evaluation queue without
+     * any scope change.
+     *
+     * @param begin the location of the first operation in the region
+     * @param end the location after the last operation in the region
+     */
+    inline void scheduleForRegisterPressure(size_t begin, size_t end);
+
+    /**
+     * Determines whether or not an operation can be freely moved to a later
+     * location in its scope.
+     */
+    inline bool isMovableForScheduling(const Node& node);
+
     /**
      * Determine the highest location in the evaluation queue of temporary
      * variables used by an operation node in the same scope.
@@ -29,15 +29,18 @@ CodeHandler<Base>::CodeHandler(size_t varCount)
       _dependents(nullptr),
       _lastVisit(*this),
       _scope(*this),
-      _evaluationOrder(*this),
-      _lastUsageOrder(*this),
+      _nodeOrder(*this),
       _totalUseCount(*this),
-      _operationCount(*this),
       _varId(*this),
       _scopedVariableOrder(1),
       _atomicFunctionsOrder(nullptr),
       _used(false),
       _reuseIDs(true),
+      _registerPressureScheduling(false),
+      _algebraicSimplification(false),
+      _simplifiedOperations(0),
+      _minOutlineOperations(0),
+      _minLazyBranchOperations(0),
       _scopeColorCount(0),
       _currentScopeColor(0),
       _lang(nullptr),
@@ -72,6 +75,51 @@ inline bool CodeHandler<Base>::isReuseVariableIDs() const {
     return _reuseIDs;
 }
 
+template <class Base>
+inline void CodeHandler<Base>::setRegisterPressureScheduling(bool schedule) {
+    _registerPressureScheduling = schedule;
+}
+
+template <class Base>
+inline bool CodeHandler<Base>::isRegisterPressureScheduling() const {
+    return _registerPressureScheduling;
+}
+
+template <class Base>
+inline void CodeHandler<Base>::setAlgebraicSimplification(bool simplify) {
+    _algebraicSimplification = simplify;
+}
+
+template <class Base>
+inline bool CodeHandler<Base>::isAlgebraicSimplification() const {
+    return _algebraicSimplification;
+}
+
+template <class Base>
+inline size_t CodeHandler<Base>::getSimplifiedOperationCount() const {
+    return _simplifiedOperations;
+}
+
+template <class Base>
+inline void CodeHandler<Base>::setMinOutlineOperations(size_t minOperations) {
+    _minOutlineOperations = minOperations;
+}
+
+template <class Base>
+inline size_t CodeHandler<Base>::getMinOutlineOperations() const {
+    return _minOutlineOperations;
+}
+
+template <class Base>
+inline void CodeHandler<Base>::setMinLazyBranchOperations(size_t minOperations) {
+    _minLazyBranchOperations = minOperations;
+}
+
+template <class Base>
+inline size_t CodeHandler<Base>::getMinLazyBranchOperations() const {
+    return _minLazyBranchOperations;
+}
+
 template <class Base>
 inline void CodeHandler<Base>::makeVariables(std::vector<AD<CGB>>& variables) {
     for (auto& v : variables) {
@@ -97,6 +145,11 @@ size_t CodeHandler<Base>::getIndependentVariableSize() const {
     return _independentVariables.size();
 }
 
+template <class Base>
+inline const std::vector<OperationNode<Base>*>& CodeHandler<Base>::getIndependentVariables() const {
+    return _independentVariables;
+}
+
 template <class Base>
 inline const CodeHandlerVector<Base, size_t>& CodeHandler<Base>::getVariablesIDs() const {
     return _varId;
@@ -156,9 +209,13 @@ inline size_t CodeHandler<Base>::getOperationTreeVisitId() const {
 
 template <class Base>
 inline void CodeHandler<Base>::startNewOperationTreeVisit() {
-    assert(_idVisit < (std::numeric_limits<size_t>::max)());
-
     _lastVisit.adjustSize();
+
+    if (_idVisit == (std::numeric_limits<uint32_t>::max)()) {
+        // restart the visitation IDs
+        _lastVisit.fill(0);
+        _idVisit = 0;
+    }
     _idVisit++;
 }
 
@@ -171,7 +228,7 @@ inline bool CodeHandler<Base>::isVisited(const Node& node) const {
 template <class Base>
 inline void CodeHandler<Base>::markVisited(const Node& node) {
     _lastVisit.adjustSize(node);
-    _lastVisit[node] = _idVisit;
+    _lastVisit[node] = uint32_t(_idVisit);
 }
 
 template <class Base>
@@ -295,10 +352,8 @@ void CodeHandler<Base>::generateCode(std::ostream& out,
     _scopes.reserve(4);
     _scopes.resize(1);
     _alteredNodes.clear();
-    _evaluationOrder.adjustSize();
-    _lastUsageOrder.adjustSize();
+    _nodeOrder.adjustSize();
     _totalUseCount.adjustSize();
-    _operationCount.adjustSize();
     _varId.adjustSize();
     _scope.adjustSize();
 
@@ -313,6 +368,49 @@ void CodeHandler<Base>::generateCode(std::ostream& out,
     }
     _used = true;
 
+    /**
+     * rewrite operations with cheaper equivalent operations
+     */
+    _simplifiedNodes.clear();
+    _simplifiedOperations = 0;
+    if (_algebraicSimplification) {
+        AlgebraicSimplifier<Base> simplifier(*this);
+        if (simplifier.simplify(dependent, _simplifiedNodes) > 0) {
+            _simplifiedOperations = simplifier.getOperationReduction();
+            // might have created new nodes, must adjust vector sizes
+            _scope.adjustSize();
+            _lastVisit.adjustSize();
+            _nodeOrder.adjustSize();
+            _totalUseCount.adjustSize();
+            _varId.adjustSize();
+        }
+    }
+
+    /**
+     * replace repeated subgraphs with function calls
+     */
+    _outlinedFunctions.clear();
+    if (_minOutlineOperations > 0) {
+        SubgraphOutliner<Base> outliner(*this, _minOutlineOperations);
+        outliner.outline(dependent, _outlinedFunctions);
+    }
+
+    /**
+     * only evaluate the selected case of expensive conditional expressions
+     */
+    _loweredBranchNodes.clear();
+    if (_minLazyBranchOperations > 0) {
+        LazyBranchLowering<Base> lowering(*this, _minLazyBranchOperations);
+        if (lowering.lower(dependent, _loweredBranchNodes) > 0) {
+            // created new nodes, must adjust vector sizes
+            _scope.adjustSize();
+            _lastVisit.adjustSize();
+            _nodeOrder.adjustSize();
+            _totalUseCount.adjustSize();
+            _varId.adjustSize();
+        }
+    }
+
     /**
      * the first variable IDs are for the independent variables
      */
@@ -438,10 +536,25 @@ void CodeHandler<Base>::generateCode(std::ostream& out,
             nameGen, atomicFunctionId2Index, atomicFunctionId2Name, _atomicFunctionsMaxForward,
             _atomicFunctionsMaxReverse, _reuseIDs, _loops.indexes, _loops.indexRandomPatterns,
             _loops.dependentIndexPatterns, _loops.independentIndexPatterns, _totalUseCount, _scope,
-            *_auxIterationIndexOp, _zeroDependents));
+            *_auxIterationIndexOp, _zeroDependents, _outlinedFunctions));
+
+    std::streampos outBegin = _jobTimer != nullptr && _jobTimer->isTracing() ? out.tellp() : std::streampos(-1);
 
     lang.generateSourceCode(out, std::move(_info));
 
+    if (_jobTimer != nullptr && _jobTimer->isTracing()) {
+        _jobTimer->addJobCounter("nodes", _codeBlocks.size());
+        _jobTimer->addJobCounter("variables", _variableOrder.size());
+        _jobTimer->addJobCounter("dependents", dependent.size());
+        if (_algebraicSimplification) {
+            _jobTimer->addJobCounter("simplified_operations", _simplifiedOperations);
+        }
+        std::streampos outEnd = out.tellp();
+        if (outBegin != std::streampos(-1) && outEnd != std::streampos(-1) && outEnd > outBegin) {
+            _jobTimer->addJobCounter("source_bytes", size_t(outEnd - outBegin));
+        }
+    }
+
     /**
      * clean-up
      */
@@ -459,6 +572,30 @@ void CodeHandler<Base>::generateCode(std::ostream& out,
     }
     _alteredNodes.clear();
 
+    // restore conditional expressions
+    for (const auto& itLow : _loweredBranchNodes) {
+        Node* node = itLow.first;
+        Node* opClone = itLow.second;
+        node->setOperation(opClone->getOperationType(), opClone->getArguments());
+        node->getInfo() = opClone->getInfo();
+    }
+    _loweredBranchNodes.clear();
+
+    // restore outlined subgraphs
+    for (auto& fun : _outlinedFunctions) {
+        fun->restoreCalls();
+    }
+    _outlinedFunctions.clear();
+
+    // restore simplified operations
+    for (const auto& itSimp : _simplifiedNodes) {
+        Node* node = itSimp.first;
+        Node* opClone = itSimp.second;
+        node->setOperation(opClone->getOperationType(), opClone->getArguments());
+        node->getInfo() = opClone->getInfo();
+    }
+    _simplifiedNodes.clear();
+
     if (_jobTimer != nullptr) {
         _jobTimer->finishedJob();
     } else if (_verbose) {
@@ -506,10 +643,8 @@ void CodeHandler<Base>::reset() {
 template <class Base>
 inline void CodeHandler<Base>::resetNodes() {
     _scope.fill(0);
-    _evaluationOrder.fill(0);
-    _lastUsageOrder.fill(0);
+    _nodeOrder.fill(NodeOrder());
     _totalUseCount.fill(0);
-    _operationCount.fill(0);
     _varId.fill(0);
 }
 
@@ -711,6 +846,11 @@ OperationNode<Base>* CodeHandler<Base>::manageOperationNode(Node* code) {
         _codeBlocks.reserve((_codeBlocks.size() * 3) / 2 + 1);
     }
 
+    if (_codeBlocks.size() >= OperationNode<Base>::MAX_HANDLER_POSITION) {
+        throw CGException("The maximum number of operation nodes managed by a code handler was reached (",
+                          OperationNode<Base>::MAX_HANDLER_POSITION, ")");
+    }
+
     code->setHandlerPosition(_codeBlocks.size());
     _codeBlocks.push_back(code);
     return code;
@@ -925,7 +1065,9 @@ inline bool CodeHandler<Base>::handleTemporaryVarInDiffScopes(Node& code, size_t
     CGOpCode bOldOp = bScopeOldEnd->getOperationType();
 
     if ((bNewOp == CGOpCode::EndIf || bNewOp == CGOpCode::Else || bNewOp == CGOpCode::ElseIf) &&
-        (bOldOp == CGOpCode::EndIf || bOldOp == CGOpCode::Else || bOldOp == CGOpCode::ElseIf)) {
+        (bOldOp == CGOpCode::EndIf || bOldOp == CGOpCode::Else || bOldOp == CGOpCode::ElseIf) &&
+        isIndexConditionBranch(*bScopeNewEnd->getArguments()[0].getOperation()) &&
+        isIndexConditionBranch(*bScopeOldEnd->getArguments()[0].getOperation())) {
         // used in 2 different if/else branches
 
         /**
@@ -956,6 +1098,31 @@ inline bool CodeHandler<Base>::handleTemporaryVarInDiffScopes(Node& code, size_t
     return false;
 }
 
+template <class Base>
+inline bool CodeHandler<Base>::isIndexConditionBranch(const Node& bScope) {
+    // find the condition of the first if branch
+    const Node* node = &bScope;
+    while (node != nullptr) {
+        switch (node->getOperationType()) {
+            case CGOpCode::IndexCondExpr:
+                return true;
+            case CGOpCode::StartIf:
+                node = node->getArguments()[0].getOperation();
+                return node != nullptr && node->getOperationType() == CGOpCode::IndexCondExpr;
+            case CGOpCode::ElseIf:
+                node = node->getArguments()[1].getOperation();
+                break;
+            case CGOpCode::Else:
+            case CGOpCode::EndIf:
+                node = node->getArguments()[0].getOperation();
+                break;
+            default:
+                return false;
+        }
+    }
+    return false;
+}
+
 template <class Base>
 inline void CodeHandler<Base>::replaceWithConditionalTempVar(Node& tmp,
                                                              IndexOperationNode<Base>& iterationIndexOp,
@@ -994,10 +1161,8 @@ inline void CodeHandler<Base>::replaceWithConditionalTempVar(Node& tmp,
     _scope.adjustSize();
     _lastVisit.adjustSize();
     _scope.adjustSize();
-    _evaluationOrder.adjustSize();
-    _lastUsageOrder.adjustSize();
+    _nodeOrder.adjustSize();
     _totalUseCount.adjustSize();
-    _operationCount.adjustSize();
     _varId.adjustSize();
 
     /**
@@ -1498,14 +1663,14 @@ void CodeHandler<Base>::checkVariableCreation(Node& root) {
 
             } else {
                 // determine the number of operations required to compute this variable
-                size_t& opCount = _operationCount[arg];
+                uint32_t& opCount = _nodeOrder[arg].operationCount;
 
                 opCount = 1;
                 for (const auto& a : arg) {
                     if (a.getOperation() != nullptr) {
                         auto& n = *a.getOperation();
                         if (_varId[n] == 0) {
-                            opCount += _operationCount[n];
+                            opCount += _nodeOrder[n].operationCount;
                         }
                     }
                 }
@@ -1576,6 +1741,10 @@ template <class Base>
 inline void CodeHandler<Base>::reduceTemporaryVariables(ArrayView<CGB>& dependent) {
     reorderOperations(dependent);
 
+    if (_registerPressureScheduling) {
+        scheduleForRegisterPressure();
+    }
+
     /**
      * determine the last line where each temporary variable is used
      */
@@ -1741,6 +1910,156 @@ inline void CodeHandler<Base>::reorderOperation(Node& node) {
     }
 }
 
+template <class Base>
+inline void CodeHandler<Base>::scheduleForRegisterPressure() {
+    /**
+     * split the evaluation queue into regions without scope changes
+     */
+    size_t begin = 0;
+    for (size_t l = 0; l < _variableOrder.size(); ++l) {
+        CGOpCode op = _variableOrder[l]->getOperationType();
+        if (op == CGOpCode::LoopStart || op == CGOpCode::LoopEnd || op == CGOpCode::StartIf ||
+            op == CGOpCode::ElseIf || op == CGOpCode::Else || op == CGOpCode::EndIf) {
+            scheduleForRegisterPressure(begin, l);
+            begin = l + 1;
+        }
+    }
+    scheduleForRegisterPressure(begin, _variableOrder.size());
+}
+
+template <class Base>
+inline void CodeHandler<Base>::scheduleForRegisterPressure(size_t begin, size_t end) {
+    if (end <= begin + 2) return;  // nothing to gain
+
+    const size_t n = end - begin;
+
+    /**
+     * determine which operations can be moved and the variables
+     * (in this region) required by each operation
+     */
+    std::vector<bool> movable(n);
+    std::vector<std::vector<size_t>> deps(n);
+
+    for (size_t i = 0; i < n; ++i) {
+        Node& var = *_variableOrder[begin + i];
+        bool pinned = false;
+
+        startNewOperationTreeVisit();
+
+        auto analyse = [&](SimpleOperationStackData<Base>& stackEl, SimpleOperationStack<Base>& stack) {
+            auto& node = stackEl.node();
+
+            if (isVisited(node)) return;
+            markVisited(node);
+
+            CGOpCode op = node.getOperationType();
+            if (op == CGOpCode::Tmp || op == CGOpCode::LoopIndexedTmp || op == CGOpCode::DependentRefRhs) {
+                pinned = true;  // reads a value which can be changed by other operations
+            }
+
+            if (_varId[node] == 0) {
+                stack.pushNodeArguments(node);  // evaluated inline by its user
+                return;
+            }
+
+            size_t order = getEvaluationOrder(node);
+            if (order > begin && order <= end && _variableOrder[order - 1] == &node) {
+                deps[i].push_back(order - 1 - begin);
+            }
+        };
+
+        depthFirstGraphNavigation(var, analyse, false);
+
+        movable[i] = !pinned && isMovableForScheduling(var);
+    }
+
+    /**
+     * number of temporaries required to evaluate each operation (Sethi-Ullman)
+     */
+    std::vector<size_t> label(n, 1);
+    for (size_t i = 0; i < n; ++i) {
+        std::vector<size_t>& d = deps[i];
+
+        // only the operations which can be moved are scheduled with their users
+        d.erase(std::remove_if(d.begin(), d.end(), [&](size_t j) { return !movable[j]; }), d.end());
+
+        std::stable_sort(d.begin(), d.end(), [&](size_t j1, size_t j2) { return label[j1] > label[j2]; });
+
+        for (size_t k = 0; k < d.size(); ++k) {
+            label[i] = std::max(label[i], label[d[k]] + k);
+        }
+    }
+
+    /**
+     * operations with side effects keep their relative order while
+     * the other operations are evaluated right before their first usage
+     */
+    std::vector<Node*> newOrder;
+    newOrder.reserve(n);
+    std::vector<bool> emitted(n, false);
+    std::vector<std::pair<size_t, size_t>> stack;
+
+    auto emit = [&](size_t root) {
+        stack.emplace_back(root, 0);
+        while (!stack.empty()) {
+            auto& top = stack.back();
+            const std::vector<size_t>& d = deps[top.first];
+            if (top.second < d.size()) {
+                size_t j = d[top.second];
+                top.second++;
+                if (!emitted[j]) {
+                    stack.emplace_back(j, 0);
+                }
+            } else {
+                emitted[top.first] = true;
+                newOrder.push_back(_variableOrder[begin + top.first]);
+                stack.pop_back();
+            }
+        }
+    };
+
+    for (size_t i = 0; i < n; ++i) {
+        if (!movable[i]) {
+            emit(i);
+        }
+    }
+
+    // operations only used in other regions
+    for (size_t i = 0; i < n; ++i) {
+        if (!emitted[i]) {
+            emit(i);
+        }
+    }
+
+    CPPADCG_ASSERT_UNKNOWN(newOrder.size() == n)
+
+    /**
+     * update the evaluation order
+     * (the locations are first moved outside the range used by the
+     * evaluation queue to avoid mixing up old and new locations)
+     */
+    const size_t offset = _variableOrder.size();
+    for (size_t i = 0; i < n; ++i) {
+        if (newOrder[i] != _variableOrder[begin + i]) {
+            updateEvaluationQueueOrder(*newOrder[i], offset + begin + i + 1);
+        }
+    }
+    for (size_t i = 0; i < n; ++i) {
+        if (newOrder[i] != _variableOrder[begin + i]) {
+            updateEvaluationQueueOrder(*newOrder[i], begin + i + 1);
+            _variableOrder[begin + i] = newOrder[i];
+        }
+    }
+}
+
+template <class Base>
+inline bool CodeHandler<Base>::isMovableForScheduling(const Node& node) {
+    CGOpCode op = node.getOperationType();
+    return isTemporary(node) && op != CGOpCode::Pri && op != CGOpCode::TmpDcl && op != CGOpCode::CondResult &&
+           op != CGOpCode::DependentMultiAssign && op != CGOpCode::DependentRefRhs &&
+           op != CGOpCode::IndexDeclaration && op != CGOpCode::IndexCondExpr && op != CGOpCode::UserCustom;
+}
+
 template <class Base>
 inline size_t CodeHandler<Base>::findLastTemporaryLocation(Node& root) {
     size_t depOrder = getEvaluationOrder(root);
@@ -2005,24 +2324,24 @@ inline OperationNode<Base>* CodeHandler<Base>::getOperationFromAlias(Node& alias
 
 template <class Base>
 inline size_t CodeHandler<Base>::getEvaluationOrder(const Node& node) const {
-    return _evaluationOrder[node];
+    return _nodeOrder[node].evaluation;
 }
 
 template <class Base>
 inline void CodeHandler<Base>::setEvaluationOrder(Node& node, size_t order) {
     CPPADCG_ASSERT_UNKNOWN(order <= _variableOrder.size())
-    _evaluationOrder[node] = order;
+    _nodeOrder[node].evaluation = uint32_t(order);
 }
 
 template <class Base>
 inline size_t CodeHandler<Base>::getLastUsageEvaluationOrder(const Node& node) const {
-    return _lastUsageOrder[node];
+    return _nodeOrder[node].lastUsage;
 }
 
 template <class Base>
 inline void CodeHandler<Base>::setLastUsageEvaluationOrder(const Node& node, size_t last) {
-    CPPADCG_ASSERT_UNKNOWN(last <= _variableOrder.size())  // _lastUsageOrder[node] = 0  means that it was never used
-    _lastUsageOrder[node] = last;
+    CPPADCG_ASSERT_UNKNOWN(last <= _variableOrder.size())  // lastUsage = 0  means that it was never used
+    _nodeOrder[node].lastUsage = uint32_t(last);
 
     CGOpCode op = node.getOperationType();
     if (op == CGOpCode::ArrayElement) {
@@ -2060,10 +2379,8 @@ inline void CodeHandler<Base>::resetManagedNodes() {
     _variableOrder.clear();
     _scopedVariableOrder.resize(1);
     _scopedVariableOrder[0].clear();
-    _evaluationOrder.fill(0);
-    _lastUsageOrder.fill(0);
+    _nodeOrder.fill(NodeOrder());
     _totalUseCount.fill(0);
-    _operationCount.fill(0);
     _varId.fill(0);
     _scope.fill(0);
 }
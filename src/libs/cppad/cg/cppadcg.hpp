@@ -29,7 +29,9 @@ static_assert(false,
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
+#include <cctype>
 #include <cstddef>
 #include <cerrno>
 #include <fstream>
@@ -54,6 +56,9 @@ static_assert(false,
 #include <cstring>
 #include <chrono>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
 #include <functional>
 
 // ---------------------------------------------------------------------------
@@ -146,6 +151,14 @@ static_assert(false,
 #include <cppad/cg/code_handler_impl.hpp>
 #include <cppad/cg/code_handler_vector.hpp>
 #include <cppad/cg/code_handler_loops.hpp>
+#include <cppad/cg/outlined_function.hpp>
+#include <cppad/cg/subgraph_outliner.hpp>
+#include <cppad/cg/lazy_branch_lowering.hpp>
+#include <cppad/cg/algebraic_simplifier.hpp>
+#include <cppad/cg/mixed_precision_selector.hpp>
+#include <cppad/cg/level_clustering.hpp>
+#include <cppad/cg/operation_graph_file.hpp>
+#include <cppad/cg/reverse_differentiator.hpp>
 
 // ---------------------------------------------------------------------------
 #include <cppad/cg/base_double.hpp>
@@ -159,6 +172,7 @@ static_assert(false,
 #include <cppad/cg/arithmetic_ad.hpp>
 
 // addons
+#include <cppad/cg/csr_sparsity.hpp>
 #include <cppad/cg/extra/extra.hpp>
 
 // ---------------------------------------------------------------------------
@@ -168,6 +182,7 @@ static_assert(false,
 #include <cppad/cg/evaluator/evaluator_ad.hpp>
 #include <cppad/cg/evaluator/evaluator_adcg.hpp>
 #include <cppad/cg/evaluator/evaluator_cg.hpp>
+#include <cppad/cg/evaluator/evaluator_cg_subgraph.hpp>
 #include <cppad/cg/operation_path_node.hpp>
 #include <cppad/cg/operation_path.hpp>
 #include <cppad/cg/solver.hpp>
@@ -208,6 +223,7 @@ static_assert(false,
 #include <cppad/cg/lang/c/lang_c_default_hessian_var_name_gen.hpp>
 #include <cppad/cg/lang/c/lang_c_default_reverse2_var_name_gen.hpp>
 #include <cppad/cg/lang/c/lang_c_custom_var_name_gen.hpp>
+#include <cppad/cg/lang/c/lang_c_cluster_var_name_gen.hpp>
 #include <cppad/cg/lang/c/lang_c_util.hpp>
 
 //
@@ -219,9 +235,11 @@ static_assert(false,
 #include <cppad/cg/model/model_library_processor.hpp>
 #include <cppad/cg/model/model_library.hpp>
 #include <cppad/cg/model/generic_model.hpp>
+#include <cppad/cg/model/model_function_table.hpp>
 #include <cppad/cg/model/functor_generic_model.hpp>
 #include <cppad/cg/model/functor_model_library.hpp>
 #include <cppad/cg/model/save_files_model_library_processor.hpp>
+#include <cppad/cg/model/header_only_model_library_processor.hpp>
 
 // automated static library creation
 #include <cppad/cg/model/dynamic_lib/archiver.hpp>
@@ -229,6 +247,7 @@ static_assert(false,
 
 // compiler
 #include <cppad/cg/model/compiler/c_compiler.hpp>
+#include <cppad/cg/model/compiler/compiler_job_pool.hpp>
 #include <cppad/cg/model/compiler/abstract_c_compiler.hpp>
 #include <cppad/cg/model/compiler/gcc_compiler.hpp>
 #include <cppad/cg/model/compiler/clang_compiler.hpp>
@@ -245,10 +264,12 @@ static_assert(false,
 
 #include <cppad/cg/model/model_c_source_gen_for0.hpp>
 #include <cppad/cg/model/model_c_source_gen_for1.hpp>
+#include <cppad/cg/model/model_c_source_gen_for_taylor.hpp>
 #include <cppad/cg/model/model_c_source_gen_rev1.hpp>
 #include <cppad/cg/model/model_c_source_gen_rev2.hpp>
 #include <cppad/cg/model/model_c_source_gen_jac.hpp>
 #include <cppad/cg/model/model_c_source_gen_hes.hpp>
+#include <cppad/cg/model/model_c_source_gen_hvp.hpp>
 #include <cppad/cg/model/patterns/model_c_source_gen_loops.hpp>
 #include <cppad/cg/model/patterns/model_c_source_gen_loops_for0.hpp>
 #include <cppad/cg/model/patterns/model_c_source_gen_loops_for1.hpp>
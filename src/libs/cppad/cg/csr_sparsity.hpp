@@ -0,0 +1,352 @@
+#ifndef CPPAD_CG_CSR_SPARSITY_INCLUDED
+#define CPPAD_CG_CSR_SPARSITY_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * A sparsity pattern in the compressed sparse row (CSR) format.
+ * The column indexes of each row are sorted.
+ *
+ * Unlike a vector of std::set, the elements are stored contiguously which
+ * allows fast products and sums of patterns (boolean sparse matrix
+ * operations) for large models. A blocked bitset accumulates the columns of
+ * each row of the result. Callers can opt in to compute large results with
+ * several threads.
+ *
+ * @author Feng Yang
+ */
+class CsrSparsity {
+protected:
+    /**
+     * the number of columns
+     */
+    size_t nCols_;
+    /**
+     * the position in cols_ of the first element of each row
+     * (the last value is the number of elements)
+     */
+    std::vector<size_t> rowStart_;
+    /**
+     * the column index of each element
+     */
+    std::vector<size_t> cols_;
+
+public:
+    /**
+     * Creates an empty pattern with zero rows and columns
+     */
+    inline CsrSparsity() : nCols_(0), rowStart_(1, 0) {}
+
+    /**
+     * Creates an empty pattern.
+     *
+     * @param mRows the number of rows
+     * @param nCols the number of columns
+     */
+    inline CsrSparsity(size_t mRows, size_t nCols) : nCols_(nCols), rowStart_(mRows + 1, 0) {}
+
+    /**
+     * Creates a pattern from a vector of sets (e.g. std::vector<std::set<size_t>>).
+     *
+     * @param pattern the column indexes of each row
+     * @param mRows the number of rows of pattern to use
+     * @param nCols the number of columns
+     */
+    template <class VectorSet>
+    inline CsrSparsity(const VectorSet& pattern, size_t mRows, size_t nCols) : nCols_(nCols) {
+        CPPADCG_ASSERT_UNKNOWN(pattern.size() >= mRows)
+
+        rowStart_.resize(mRows + 1);
+        size_t nnz = 0;
+        for (size_t i = 0; i < mRows; i++) {
+            rowStart_[i] = nnz;
+            nnz += pattern[i].size();
+        }
+        rowStart_[mRows] = nnz;
+
+        cols_.reserve(nnz);
+        for (size_t i = 0; i < mRows; i++) {
+            for (size_t j : pattern[i]) {
+                CPPADCG_ASSERT_UNKNOWN(j < nCols)
+                cols_.push_back(j);
+            }
+        }
+    }
+
+    inline size_t rows() const { return rowStart_.size() - 1; }
+
+    inline size_t cols() const { return nCols_; }
+
+    /**
+     * @return the number of elements in the pattern
+     */
+    inline size_t nnz() const { return cols_.size(); }
+
+    inline size_t rowSize(size_t i) const { return rowStart_[i + 1] - rowStart_[i]; }
+
+    inline const size_t* rowBegin(size_t i) const { return cols_.data() + rowStart_[i]; }
+
+    inline const size_t* rowEnd(size_t i) const { return cols_.data() + rowStart_[i + 1]; }
+
+    inline bool isIdentity() const {
+        if (rows() != nCols_ || nnz() != nCols_) return false;
+        for (size_t i = 0; i < nCols_; i++) {
+            if (rowSize(i) != 1 || cols_[rowStart_[i]] != i) return false;
+        }
+        return true;
+    }
+
+    /**
+     * Creates the transpose of this pattern (in linear time).
+     */
+    inline CsrSparsity transpose() const {
+        size_t m = rows();
+        CsrSparsity t(nCols_, m);
+
+        for (size_t j : cols_) t.rowStart_[j + 1]++;
+        for (size_t j = 0; j < nCols_; j++) t.rowStart_[j + 1] += t.rowStart_[j];
+
+        t.cols_.resize(cols_.size());
+        std::vector<size_t> next(t.rowStart_.begin(), t.rowStart_.end() - 1);
+        for (size_t i = 0; i < m; i++) {
+            for (size_t e = rowStart_[i]; e < rowStart_[i + 1]; e++) {
+                t.cols_[next[cols_[e]]++] = i;  // rows are visited in order: sorted
+            }
+        }
+
+        return t;
+    }
+
+    /**
+     * Adds the elements of this pattern to a vector of sets:
+     * R += this
+     */
+    template <class VectorSet>
+    inline void addTo(VectorSet& result) const {
+        CPPADCG_ASSERT_UNKNOWN(result.size() >= rows())
+
+        for (size_t i = 0; i < rows(); i++) {
+            auto& r = result[i];
+            if (r.empty()) {
+                r.insert(rowBegin(i), rowEnd(i));
+            } else {
+                auto hint = r.begin();
+                for (const size_t* j = rowBegin(i); j != rowEnd(i); ++j) {
+                    hint = std::next(r.insert(hint, *j));  // sorted input
+                }
+            }
+        }
+    }
+
+    /**
+     * Converts this pattern into a vector of sets
+     */
+    template <class VectorSet>
+    inline VectorSet toSets() const {
+        VectorSet s(rows());
+        addTo(s);
+        return s;
+    }
+
+    /**
+     * Determines the sparsity pattern of the product of two matrices:
+     * A * B
+     *
+     * @param a the left matrix
+     * @param b the right matrix
+     * @param maxThreads the maximum number of threads (zero uses the number
+     *                   of hardware threads); small products are always
+     *                   computed by the current thread
+     * @return the sparsity pattern of the product
+     */
+    static inline CsrSparsity multiply(const CsrSparsity& a, const CsrSparsity& b, size_t maxThreads = 1) {
+        CPPADCG_ASSERT_KNOWN(a.cols() == b.rows(), "Invalid matrix dimensions for a sparsity pattern product")
+
+        size_t m = a.rows();
+        if (m == 0 || a.nnz() == 0 || b.nnz() == 0) return CsrSparsity(m, b.cols());
+
+        // the number of operations of each row (used to balance the work)
+        std::vector<size_t> work(m + 1, 0);
+        for (size_t i = 0; i < m; i++) {
+            size_t w = 1;
+            for (const size_t* k = a.rowBegin(i); k != a.rowEnd(i); ++k) w += b.rowSize(*k);
+            work[i + 1] = work[i] + w;
+        }
+
+        auto row = [&](size_t i, std::vector<uint64_t>& bits, std::vector<size_t>& blocks) {
+            for (const size_t* k = a.rowBegin(i); k != a.rowEnd(i); ++k) {
+                markColumns(b.rowBegin(*k), b.rowEnd(*k), bits, blocks);
+            }
+        };
+
+        return build(m, b.cols(), work, row, maxThreads);
+    }
+
+    /**
+     * Determines the sparsity pattern of the sum of several matrices with
+     * the same dimensions:
+     * P_0 + P_1 + ... + P_k
+     *
+     * @param patterns the matrices (must not be empty)
+     * @param maxThreads the maximum number of threads (zero uses the number
+     *                   of hardware threads); small sums are always
+     *                   computed by the current thread
+     * @return the sparsity pattern of the sum
+     */
+    static inline CsrSparsity unite(const std::vector<CsrSparsity>& patterns, size_t maxThreads = 1) {
+        CPPADCG_ASSERT_KNOWN(!patterns.empty(), "No sparsity patterns to add")
+
+        size_t m = patterns[0].rows();
+        size_t n = patterns[0].cols();
+        for (const CsrSparsity& p : patterns) {
+            CPPADCG_ASSERT_KNOWN(p.rows() == m && p.cols() == n, "Invalid matrix dimensions for a sparsity pattern sum")
+        }
+        if (patterns.size() == 1) return patterns[0];
+
+        std::vector<size_t> work(m + 1, 0);
+        for (size_t i = 0; i < m; i++) {
+            size_t w = 1;
+            for (const CsrSparsity& p : patterns) w += p.rowSize(i);
+            work[i + 1] = work[i] + w;
+        }
+
+        auto row = [&](size_t i, std::vector<uint64_t>& bits, std::vector<size_t>& blocks) {
+            for (const CsrSparsity& p : patterns) {
+                markColumns(p.rowBegin(i), p.rowEnd(i), bits, blocks);
+            }
+        };
+
+        return build(m, n, work, row, maxThreads);
+    }
+
+protected:
+    /**
+     * the minimum number of operations in a product for each thread
+     */
+    static constexpr size_t MIN_THREAD_WORK = 1 << 16;
+
+    /**
+     * Creates a pattern whose rows are determined by marking their columns
+     * in a blocked bitset.
+     *
+     * @param m the number of rows
+     * @param nCols the number of columns
+     * @param work the accumulated number of operations up to each row
+     *             (used to balance the work of the threads)
+     * @param row marks the columns of a row: row(i, bits, blocks)
+     * @param maxThreads the maximum number of threads (zero uses the number
+     *                   of hardware threads)
+     */
+    template <class RowFunc>
+    static inline CsrSparsity build(
+            size_t m, size_t nCols, const std::vector<size_t>& work, RowFunc& row, size_t maxThreads) {
+        CsrSparsity r(m, nCols);
+
+        if (maxThreads == 0) maxThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        size_t nThreads = std::min<size_t>(maxThreads, std::max<size_t>(work[m] / MIN_THREAD_WORK, 1));
+        nThreads = std::min(nThreads, m);
+
+        // the first row of each block of rows
+        std::vector<size_t> blockStart(nThreads + 1, m);
+        blockStart[0] = 0;
+        for (size_t t = 1, i = 0; t < nThreads; t++) {
+            size_t target = work[m] / nThreads * t;
+            while (i < m && work[i] < target) i++;
+            blockStart[t] = i;
+        }
+
+        std::vector<std::vector<size_t>> blockCols(nThreads);
+        auto buildBlock = [&](size_t t) {
+            buildRows(nCols, blockStart[t], blockStart[t + 1], row, r.rowStart_, blockCols[t]);
+        };
+
+        if (nThreads == 1) {
+            buildBlock(0);
+        } else {
+            std::vector<std::thread> threads;
+            threads.reserve(nThreads - 1);
+            for (size_t t = 1; t < nThreads; t++) threads.emplace_back(buildBlock, t);
+            buildBlock(0);
+            for (std::thread& th : threads) th.join();
+        }
+
+        // join the blocks (rowStart_ contains the size of each row)
+        size_t nnz = 0;
+        for (size_t i = 0; i < m; i++) {
+            size_t s = r.rowStart_[i + 1];
+            r.rowStart_[i] = nnz;
+            nnz += s;
+        }
+        r.rowStart_[m] = nnz;
+
+        r.cols_.reserve(nnz);
+        for (const std::vector<size_t>& c : blockCols) r.cols_.insert(r.cols_.end(), c.begin(), c.end());
+
+        return r;
+    }
+
+    /**
+     * Determines the columns of some rows of a new pattern.
+     * The size of row i is saved in rowSize[i + 1].
+     */
+    template <class RowFunc>
+    static inline void buildRows(size_t nCols,
+                                 size_t rowBegin,
+                                 size_t rowEnd,
+                                 RowFunc& row,
+                                 std::vector<size_t>& rowSize,
+                                 std::vector<size_t>& cols) {
+        // blocked bitset with the columns of the current row
+        std::vector<uint64_t> bits((nCols + 63) / 64, 0);
+        // the blocks of the bitset which are not empty
+        std::vector<size_t> blocks;
+
+        for (size_t i = rowBegin; i < rowEnd; i++) {
+            row(i, bits, blocks);
+
+            size_t size = cols.size();
+            std::sort(blocks.begin(), blocks.end());
+            for (size_t blk : blocks) {
+                uint64_t block = bits[blk];
+                for (size_t bit = 0; block != 0; bit++, block >>= 1) {
+                    if ((block & 1) != 0) cols.push_back(blk * 64 + bit);
+                }
+                bits[blk] = 0;
+            }
+            blocks.clear();
+
+            rowSize[i + 1] = cols.size() - size;
+        }
+    }
+
+    static inline void markColumns(const size_t* begin,
+                                   const size_t* end,
+                                   std::vector<uint64_t>& bits,
+                                   std::vector<size_t>& blocks) {
+        for (const size_t* j = begin; j != end; ++j) {
+            uint64_t& block = bits[*j / 64];
+            if (block == 0) blocks.push_back(*j / 64);
+            block |= uint64_t(1) << (*j % 64);
+        }
+    }
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
@@ -62,6 +62,41 @@ protected:
      * should be kept by also adding PrintFor operations in the reduced model.
      */
     bool preserveNames_;
+    /**
+     * Whether or not the time derivatives of the equations are determined
+     * directly in an operation graph (otherwise the model is re-taped for
+     * each differentiation order)
+     */
+    bool symbolicTimeDerivatives_;
+    /**
+     * Operation graph with the original equations and their time
+     * derivatives (used to create the reduced model without re-taping the
+     * model for each differentiation order)
+     */
+    std::unique_ptr<CodeHandler<Base>> diffHandler_;
+    /**
+     * The variables of diffHandler_ (one per variable in the reduced model)
+     */
+    std::vector<CGBase> diffIndep_;
+    /**
+     * The time derivative of each variable used to create the cached
+     * equations in diffHandler_
+     */
+    std::vector<int> diffDerivative_;
+    /**
+     * Differentiates the equations in diffHandler_
+     */
+    std::unique_ptr<ReverseDifferentiator<Base>> differentiator_;
+    /**
+     * The cached equations in diffHandler_
+     * (by original equation index and differentiation order)
+     */
+    std::map<std::pair<size_t, size_t>, CGBase> diffEquations_;
+    /**
+     * Jacobian sparsity of the last reduced model determined from the
+     * operation graph (empty if not available)
+     */
+    std::vector<bool> reducedSparsity_;
 
 private:
     int timeOrigVarIndex_;  // time index in the original user model (may not exist)
@@ -84,6 +119,7 @@ public:
           origMaxTimeDivOrder_(0),
           origTimeDependentCount_(0),
           preserveNames_(false),
+          symbolicTimeDerivatives_(true),
           timeOrigVarIndex_(-1),
           logger_(logger) {
         using namespace std;
@@ -278,6 +314,15 @@ public:
 
     inline size_t getOrigTimeDependentCount() const { return origTimeDependentCount_; }
 
+    /**
+     * Provides the Jacobian sparsity of the last model created by
+     * generateNewModel() which was determined from its operation graph.
+     *
+     * @return the sparsity pattern (row-major) or an empty vector if it is
+     *         not available
+     */
+    inline const std::vector<bool>& getReducedModelSparsity() const { return reducedSparsity_; }
+
     /**
      * Defines whether or not original names saved by using
      * CppAD::PrintFor(0, "", val, name)
@@ -292,6 +337,21 @@ public:
      */
     bool isPreserveNames() const { return preserveNames_; }
 
+    /**
+     * Defines whether or not the time derivatives of the equations are
+     * determined by differentiating an operation graph with the original
+     * equations (the default). Otherwise, the model is re-taped for each
+     * differentiation order. Models which cannot be differentiated
+     * symbolically (e.g. with atomic functions) are always re-taped.
+     */
+    void setSymbolicTimeDerivatives(bool symbolic) { symbolicTimeDerivatives_ = symbolic; }
+
+    /**
+     * Whether or not the time derivatives of the equations are determined
+     * by differentiating an operation graph with the original equations.
+     */
+    bool isSymbolicTimeDerivatives() const { return symbolicTimeDerivatives_; }
+
     /**
      * Provides the structural index after this graph has been reduced.
      *
@@ -458,6 +518,8 @@ public:
         CPPADCG_ASSERT_UNKNOWN(it != enodes_.end());
         enodes_.erase(it);
 
+        diffEquations_.clear();  // cached by equation index
+
         delete &i;  // no longer required
     }
 
@@ -576,6 +638,19 @@ public:
             equationInfo[i] = DaeEquationInfo(i, origIndex, derivativeOf, assignedVarIndex);
         }
 
+        if (symbolicTimeDerivatives_) {
+            reducedFun = generateNewModelFromGraph(newVarInfo, equationInfo, x);
+            if (reducedFun != nullptr) {
+                return reducedFun;
+            }
+        }
+
+        reducedSparsity_.clear();
+
+        /**
+         * the equations cannot be differentiated symbolically (e.g. atomic
+         * functions): create a new tape for each differentiation order
+         */
         size_t timeTapeIndex;
         {
             CodeHandler<Base> handler;
@@ -699,6 +774,173 @@ public:
         return reducedFun;
     }
 
+    /**
+     * Creates a new tape for the index 1 model using the cached equations
+     * of an operation graph (differentiated directly in the graph).
+     *
+     * @return the new model or null if the equations cannot be
+     *         differentiated symbolically
+     */
+    inline std::unique_ptr<ADFun<CGBase>> generateNewModelFromGraph(const std::vector<DaeVarInfo>& newVarInfo,
+                                                                    const std::vector<DaeEquationInfo>& equationInfo,
+                                                                    const std::vector<Base>& x) {
+        using std::vector;
+
+        reducedSparsity_.clear();
+
+        const size_t n = newVarInfo.size();
+        vector<int> derivative(n);
+        for (size_t j = 0; j < n; j++) {
+            derivative[j] = newVarInfo[j].getDerivative();
+        }
+
+        if (diffHandler_ == nullptr || derivative != diffDerivative_) {
+            /**
+             * register the operations of the original model
+             * (the cache is only valid for the same variables)
+             */
+            diffEquations_.clear();
+            differentiator_.reset();
+            diffIndep_.clear();
+            diffHandler_.reset(new CodeHandler<Base>());
+            diffDerivative_ = derivative;
+
+            diffIndep_.resize(n);
+            diffHandler_->makeVariables(diffIndep_);
+
+            vector<CGBase> indep0(diffIndep_.begin(), diffIndep_.begin() + this->fun_->Domain());
+            vector<CGBase> dep0 = forward0(*this->fun_, indep0);
+
+            differentiator_.reset(new ReverseDifferentiator<Base>(*diffHandler_, diffIndep_));
+            if (!differentiator_->isDifferentiable(dep0)) {
+                differentiator_.reset();
+                diffIndep_.clear();
+                diffHandler_.reset();
+                diffDerivative_.clear();
+                return nullptr;
+            }
+
+            for (size_t i = 0; i < dep0.size(); i++) {
+                diffEquations_[std::make_pair(i, size_t(0))] = dep0[i];
+            }
+        }
+
+        vector<CGBase> dep(enodes_.size());
+        for (size_t i = 0; i < enodes_.size(); i++) {
+            dep[i] = equationGraph(*enodes_[i]);
+        }
+
+        reducedSparsity_ = graphSparsity(dep, diffIndep_);
+
+        /**
+         * generate a single new tape
+         */
+        vector<ADCG> indepNew(n);
+        for (size_t j = 0; j < x.size(); j++) {
+            indepNew[j] = x[j];
+        }
+        Independent(indepNew);
+
+        Evaluator<Base, CGBase> evaluator(*diffHandler_);
+        evaluator.setPrintFor(preserveNames_);  // variable names saved with CppAD::PrintFor
+        vector<ADCG> depNew = evaluator.evaluate(indepNew, dep);
+
+        std::unique_ptr<ADFun<CGBase>> reducedFun;
+        try {
+            reducedFun.reset(new ADFun<CGBase>(indepNew, depNew));
+        } catch (const std::exception& ex) {
+            throw CGException("Failed to create ADFun: ", ex.what());
+        }
+
+        if (logger_.getVerbosity() >= Verbosity::High) {
+            logger_.log() << "Reduced model:\n";
+            printModel(logger_.log(), *reducedFun, newVarInfo, equationInfo);
+        }
+
+        return reducedFun;
+    }
+
+    /**
+     * Provides an equation (or the time derivative of an equation) from the
+     * operation graph in diffHandler_, differentiating it if it was not
+     * determined before.
+     */
+    inline const CGBase& equationGraph(Enode<Base>& i) {
+        size_t order = 0;
+        for (const Enode<Base>* ii = &i; ii->derivativeOf() != nullptr; ii = ii->derivativeOf()) {
+            order++;
+        }
+        auto key = std::make_pair(i.originalEquation()->index(), order);
+
+        auto it = diffEquations_.find(key);
+        if (it != diffEquations_.end()) {
+            return it->second;
+        }
+
+        CPPADCG_ASSERT_UNKNOWN(i.derivativeOf() != nullptr);
+        CGBase eq = equationGraph(*i.derivativeOf());  // copy (the map might change)
+
+        /**
+         * d f(x, t) / dt = sum_j df/dx_j * dx_j/dt + df/dt
+         */
+        CGBase diff(Base(0));
+        for (const auto& g : differentiator_->gradient(eq)) {
+            size_t j = g.first;
+            if (int(j) == timeOrigVarIndex_) {
+                diff += g.second;
+            } else if (diffDerivative_[j] >= 0) {
+                diff += g.second * diffIndep_[diffDerivative_[j]];
+            }
+        }
+
+        return diffEquations_[key] = diff;
+    }
+
+    /**
+     * Determines the Jacobian sparsity of some expressions by visiting
+     * their operation graph.
+     */
+    static inline std::vector<bool> graphSparsity(const std::vector<CGBase>& dep, const std::vector<CGBase>& indep) {
+        const size_t m = dep.size();
+        const size_t n = indep.size();
+        std::vector<bool> sparsity(m * n, false);
+        if (n == 0) return sparsity;
+
+        CodeHandler<Base>& handler = *indep[0].getCodeHandler();
+        const size_t nodes = handler.getManagedNodesCount();
+
+        std::vector<size_t> indepIndex(nodes, 0);  // the independent index plus one
+        for (size_t j = 0; j < n; j++) {
+            indepIndex[indep[j].getOperationNode()->getHandlerPosition()] = j + 1;
+        }
+
+        std::vector<size_t> visited(nodes, 0);  // the last equation (plus one) which visited each node
+        std::vector<OperationNode<Base>*> stack;
+        for (size_t i = 0; i < m; i++) {
+            if (!dep[i].isVariable()) continue;
+
+            stack.push_back(dep[i].getOperationNode());
+            while (!stack.empty()) {
+                OperationNode<Base>* node = stack.back();
+                stack.pop_back();
+
+                size_t pos = node->getHandlerPosition();
+                if (visited[pos] == i + 1) continue;
+                visited[pos] = i + 1;
+
+                if (indepIndex[pos] > 0) {
+                    sparsity[i * n + indepIndex[pos] - 1] = true;
+                } else {
+                    for (const Argument<Base>& a : node->getArguments()) {
+                        if (a.getOperation() != nullptr) stack.push_back(a.getOperation());
+                    }
+                }
+            }
+        }
+
+        return sparsity;
+    }
+
     inline static void forwardTimeDiff(ADFun<CGBase>& reducedFun,
                                        const std::vector<Enode<Base>*>& equations,
                                        std::vector<CG<Base>>& dep,
@@ -0,0 +1,70 @@
+#ifndef CPPAD_CG_DAE_BLOCK_INFO_INCLUDED
+#define CPPAD_CG_DAE_BLOCK_INFO_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * A diagonal block of the block lower triangular form of a DAE system.
+ * The equations of a block can only be solved together for the block
+ * variables (an algebraic loop) unless the block is explicit.
+ */
+class DaeBlockInfo {
+private:
+    /**
+     * The equation indexes in the model (sorted)
+     */
+    std::vector<size_t> equations_;
+    /**
+     * The variable indexes in the model tape.
+     * The variable at a given position is the one matched to the equation
+     * at the same position in equations_.
+     */
+    std::vector<size_t> variables_;
+    /**
+     * Whether or not the single equation of this block could be solved
+     * symbolically for its variable
+     */
+    bool explicit_;
+
+public:
+    inline DaeBlockInfo() : explicit_(false) {}
+
+    inline DaeBlockInfo(std::vector<size_t> equations, std::vector<size_t> variables, bool explicitBlock = false)
+        : equations_(std::move(equations)), variables_(std::move(variables)), explicit_(explicitBlock) {}
+
+    inline const std::vector<size_t>& getEquations() const { return equations_; }
+
+    inline const std::vector<size_t>& getVariables() const { return variables_; }
+
+    inline size_t size() const { return equations_.size(); }
+
+    /**
+     * Whether or not the block variable is determined by an explicit
+     * expression (only possible for blocks with a single equation).
+     */
+    inline bool isExplicit() const { return explicit_; }
+
+    inline void setExplicit(bool explicitBlock) { explicit_ = explicitBlock; }
+
+    inline virtual ~DaeBlockInfo() {}
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
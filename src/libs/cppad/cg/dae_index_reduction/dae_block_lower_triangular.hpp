@@ -0,0 +1,616 @@
+#ifndef CPPAD_CG_DAE_BLOCK_LOWER_TRIANGULAR_INCLUDED
+#define CPPAD_CG_DAE_BLOCK_LOWER_TRIANGULAR_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+#include <cppad/cg/dae_index_reduction/dae_index_reduction.hpp>
+#include <cppad/cg/dae_index_reduction/dae_block_info.hpp>
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Determines the block lower triangular (BLT) form of an index one DAE
+ * system and generates source code to evaluate it block by block.
+ *
+ * The unknowns of the system are the time derivatives and the algebraic
+ * variables. The equations are matched to the unknowns and the strongly
+ * connected components (Tarjan) of the resulting equation dependency graph
+ * provide the diagonal blocks, sorted so that each block only depends on
+ * the unknowns of the previous blocks.
+ * Blocks with a single equation which can be solved symbolically for its
+ * variable (CodeHandler::solveFor) are explicit, all the other blocks are
+ * algebraic loops which must be solved numerically.
+ */
+template <class Base>
+class DaeBlockLowerTriangular : public SimpleLogger {
+public:
+    using CGBase = CG<Base>;
+    using Node = OperationNode<Base>;
+
+protected:
+    /**
+     * Variable information of the index one model
+     */
+    const std::vector<DaeVarInfo> varInfo_;
+    /**
+     * Equation information of the index one model
+     */
+    const std::vector<DaeEquationInfo> eqInfo_;
+    /**
+     * The operation graph of the model
+     */
+    CodeHandler<Base> handler_;
+    /**
+     * independent variables in the operation graph
+     */
+    std::vector<CGBase> indep_;
+    /**
+     * equation residuals in the operation graph
+     */
+    std::vector<CGBase> res_;
+    /**
+     * the variables used in each equation (only unknowns, sorted)
+     */
+    std::vector<std::vector<size_t>> eqVars_;
+    /**
+     * whether or not each variable is an unknown of the system
+     */
+    std::vector<bool> unknown_;
+    /**
+     * the blocks in the evaluation order
+     */
+    std::vector<DaeBlockInfo> blocks_;
+    /**
+     * the expression for the variable of each explicit block
+     * (parameters for implicit blocks)
+     */
+    std::vector<CGBase> explicitSolution_;
+    /**
+     * the names of the atomic functions used by the model
+     */
+    std::vector<std::string> atomicFunctions_;
+    /**
+     * whether or not the decomposition has already been determined
+     */
+    bool decomposed_;
+
+public:
+    /**
+     * Creates a new block lower triangular decomposition of an index one
+     * DAE system.
+     * The model is immediately taped into an internal operation graph and,
+     * therefore, it is not used afterwards.
+     *
+     * @param fun The index one model (e.g. the model provided by
+     *            DummyDerivatives::reduceIndex())
+     * @param varInfo The variable information of the index one model
+     * @param eqInfo The equation information of the index one model
+     */
+    DaeBlockLowerTriangular(ADFun<CGBase>& fun,
+                            const std::vector<DaeVarInfo>& varInfo,
+                            const std::vector<DaeEquationInfo>& eqInfo)
+        : varInfo_(varInfo), eqInfo_(eqInfo), decomposed_(false) {
+        CPPADCG_ASSERT_KNOWN(varInfo_.size() == fun.Domain(), "Invalid variable information size")
+        CPPADCG_ASSERT_KNOWN(eqInfo_.size() == fun.Range(), "Invalid equation information size")
+
+        indep_.resize(fun.Domain());
+        handler_.makeVariables(indep_);
+
+        res_ = fun.Forward(0, indep_);
+
+        determineUnknowns();
+        determineStructure();
+    }
+
+    DaeBlockLowerTriangular(const DaeBlockLowerTriangular& p) = delete;
+
+    DaeBlockLowerTriangular& operator=(const DaeBlockLowerTriangular& p) = delete;
+
+    inline virtual ~DaeBlockLowerTriangular() = default;
+
+    /**
+     * Whether or not a variable is an unknown of the system (a time
+     * derivative or an algebraic variable).
+     */
+    inline bool isUnknown(size_t j) const { return unknown_[j]; }
+
+    /**
+     * Provides the blocks of the BLT form in evaluation order.
+     * The decomposition must have been determined with decompose().
+     */
+    inline const std::vector<DaeBlockInfo>& getBlocks() const { return blocks_; }
+
+    /**
+     * Provides the indexes of the blocks which are algebraic loops
+     * (blocks that must be solved numerically).
+     */
+    inline std::vector<size_t> getAlgebraicLoops() const {
+        std::vector<size_t> loops;
+        for (size_t b = 0; b < blocks_.size(); ++b) {
+            if (!blocks_[b].isExplicit()) loops.push_back(b);
+        }
+        return loops;
+    }
+
+    /**
+     * Determines the block lower triangular form of the system.
+     *
+     * @return the blocks in the evaluation order
+     * @throws CGException if the system is structurally singular
+     */
+    inline const std::vector<DaeBlockInfo>& decompose() {
+        if (decomposed_) return blocks_;
+
+        std::vector<int> eq2var, var2eq;
+        matchEquations(eq2var, var2eq);
+
+        std::vector<std::vector<size_t>> components = findStronglyConnectedComponents(eq2var, var2eq);
+
+        blocks_.clear();
+        blocks_.reserve(components.size());
+        explicitSolution_.clear();
+        explicitSolution_.reserve(components.size());
+
+        size_t explicitCount = 0;
+        for (std::vector<size_t>& eqs : components) {
+            std::sort(eqs.begin(), eqs.end());
+            std::vector<size_t> vars(eqs.size());
+            for (size_t p = 0; p < eqs.size(); ++p) {
+                vars[p] = eq2var[eqs[p]];
+            }
+
+            CGBase solution(Base(0.0));
+            bool explicitBlock = eqs.size() == 1 && solveExplicitly(eqs[0], vars[0], solution);
+            if (explicitBlock) explicitCount++;
+
+            blocks_.push_back(DaeBlockInfo(std::move(eqs), std::move(vars), explicitBlock));
+            explicitSolution_.push_back(solution);
+        }
+
+        decomposed_ = true;
+
+        if (this->verbosity_ >= Verbosity::Low) {
+            log() << "## BLT: " << blocks_.size() << " blocks (" << explicitCount << " explicit, "
+                  << (blocks_.size() - explicitCount) << " algebraic loops)\n";
+            if (this->verbosity_ >= Verbosity::High) {
+                printBlocks(log());
+            }
+        }
+
+        return blocks_;
+    }
+
+    /**
+     * Prints the blocks of the BLT form.
+     */
+    inline void printBlocks(std::ostream& out) const {
+        for (size_t b = 0; b < blocks_.size(); ++b) {
+            const DaeBlockInfo& block = blocks_[b];
+            out << "# block " << b << (block.isExplicit() ? " (explicit)" : " (algebraic loop)") << ":";
+            for (size_t p = 0; p < block.size(); ++p) {
+                out << " " << varInfo_[block.getVariables()[p]].getName() << "<->eq" << block.getEquations()[p];
+            }
+            out << "\n";
+        }
+        out << std::endl;
+    }
+
+    /**
+     * Defines the names of the atomic functions used by the model (in the
+     * same order as in the model library)
+     */
+    inline void setAtomicFunctions(const std::vector<std::string>& atomicFunctions) {
+        atomicFunctions_ = atomicFunctions;
+    }
+
+    /**
+     * Generates the source code that evaluates the system block by block.
+     *
+     * For each block a function <name>_block<b>(in, out, atomicFun) is
+     * created where in[0] are all the model variables (the unknowns of the
+     * previous blocks must already contain their solution).
+     * An explicit block places the value of its variable in out[0][0],
+     * while an algebraic loop places the residuals of its equations in
+     * out[0] (same order as DaeBlockInfo::getEquations()).
+     * Additional functions provide the block structure:
+     *  - <name>_block(pos, in, out, atomicFun) calls the function of block pos;
+     *  - <name>_blocks_info(nBlocks, sizes, explicitBlocks);
+     *  - <name>_block_sparsity(pos, equations, variables, size).
+     *
+     * @param sources maps the file names to their contents (the new sources
+     *                are added to this map)
+     * @param name the prefix for the generated functions
+     * @param baseTypeName the data type name used in the generated source
+     */
+    inline void generateSources(std::map<std::string, std::string>& sources,
+                                const std::string& name = "dae",
+                                const std::string& baseTypeName = "double") {
+        decompose();
+
+        for (size_t b = 0; b < blocks_.size(); ++b) {
+            const DaeBlockInfo& block = blocks_[b];
+
+            std::vector<CGBase> dep;
+            if (block.isExplicit()) {
+                dep.push_back(explicitSolution_[b]);
+            } else {
+                dep.reserve(block.size());
+                for (size_t i : block.getEquations()) {
+                    dep.push_back(res_[i]);
+                }
+            }
+
+            // names from the previous blocks must not be reused
+            for (Node* node : handler_.getManagedNodes()) {
+                if (node->getOperationType() != CGOpCode::Inv) node->clearName();
+            }
+
+            LanguageC<Base> langC(baseTypeName);
+            langC.setMaxAssignmentsPerFunction(0, &sources);
+            langC.setGenerateFunction(name + "_block" + std::to_string(b));
+
+            std::ostringstream code;
+            LangCDefaultVariableNameGenerator<Base> nameGen;
+            handler_.generateCode(code, langC, dep, nameGen, atomicFunctions_, "block " + std::to_string(b));
+        }
+
+        sources[name + "_blocks.c"] = generateBlockInfoSource(name, baseTypeName);
+    }
+
+protected:
+    /**
+     * The unknowns are the variables which depend on the integrated
+     * variable and which are not differential variables (their values are
+     * provided by the integrator).
+     */
+    inline void determineUnknowns() {
+        const size_t n = varInfo_.size();
+        unknown_.assign(n, false);
+
+        for (size_t j = 0; j < n; ++j) {
+            const DaeVarInfo& v = varInfo_[j];
+            unknown_[j] = v.isFunctionOfIntegrated() && !v.isIntegratedVariable() && v.getDerivative() < 0;
+        }
+
+        // the variables of explicit differential equations are differential
+        for (const DaeEquationInfo& eq : eqInfo_) {
+            if (eq.isExplicit() && eq.getAssignedVarIndex() >= 0) {
+                unknown_[eq.getAssignedVarIndex()] = false;
+            }
+        }
+    }
+
+    /**
+     * Determines which unknowns are used by each equation directly from the
+     * operation graph.
+     */
+    inline void determineStructure() {
+        const size_t m = res_.size();
+
+        std::map<const Node*, size_t> indep2Index;
+        for (size_t j = 0; j < indep_.size(); ++j) {
+            indep2Index[indep_[j].getOperationNode()] = j;
+        }
+
+        eqVars_.resize(m);
+
+        std::vector<Node*> stack;
+        for (size_t i = 0; i < m; ++i) {
+            std::vector<size_t>& vars = eqVars_[i];
+            vars.clear();
+            if (eqInfo_[i].isExplicit()) continue;  // not part of the implicit system
+
+            Node* root = res_[i].getOperationNode();
+            if (root == nullptr) continue;
+
+            handler_.startNewOperationTreeVisit();
+            stack.push_back(root);
+            handler_.markVisited(*root);
+
+            while (!stack.empty()) {
+                Node* node = stack.back();
+                stack.pop_back();
+
+                if (node->getOperationType() == CGOpCode::Inv) {
+                    size_t j = indep2Index.at(node);
+                    if (unknown_[j]) vars.push_back(j);
+                    continue;
+                }
+
+                for (const Argument<Base>& a : node->getArguments()) {
+                    Node* arg = a.getOperation();
+                    if (arg != nullptr && !handler_.isVisited(*arg)) {
+                        handler_.markVisited(*arg);
+                        stack.push_back(arg);
+                    }
+                }
+            }
+
+            std::sort(vars.begin(), vars.end());
+        }
+    }
+
+    /**
+     * Matches each equation to one unknown using augmenting paths.
+     * The assignments already in the equation information are used as a
+     * starting point when they are structurally valid.
+     *
+     * @throws CGException if the system is structurally singular
+     */
+    inline void matchEquations(std::vector<int>& eq2var, std::vector<int>& var2eq) const {
+        const size_t m = eqVars_.size();
+        const size_t n = varInfo_.size();
+
+        eq2var.assign(m, -1);
+        var2eq.assign(n, -1);
+
+        size_t unknownCount = std::count(unknown_.begin(), unknown_.end(), true);
+        size_t eqCount = 0;
+
+        for (size_t i = 0; i < m; ++i) {
+            if (eqInfo_[i].isExplicit()) continue;
+            eqCount++;
+
+            int j = eqInfo_[i].getAssignedVarIndex();
+            if (j >= 0 && var2eq[j] < 0 && std::binary_search(eqVars_[i].begin(), eqVars_[i].end(), size_t(j))) {
+                eq2var[i] = j;
+                var2eq[j] = i;
+            }
+        }
+
+        if (eqCount != unknownCount) {
+            throw CGException("Unable to determine the BLT form: the system has ", eqCount, " equations and ",
+                              unknownCount, " unknowns");
+        }
+
+        // breadth-first search for augmenting paths
+        std::vector<size_t> visited(n, 0);
+        std::vector<size_t> parentEq(n, 0);
+        std::deque<size_t> queue;
+        size_t stamp = 0;
+
+        for (size_t i = 0; i < m; ++i) {
+            if (eqInfo_[i].isExplicit() || eq2var[i] >= 0) continue;
+
+            stamp++;
+            queue.clear();
+            queue.push_back(i);
+            int found = -1;
+
+            while (!queue.empty() && found < 0) {
+                size_t e = queue.front();
+                queue.pop_front();
+
+                for (size_t j : eqVars_[e]) {
+                    if (visited[j] == stamp) continue;
+                    visited[j] = stamp;
+                    parentEq[j] = e;
+                    if (var2eq[j] < 0) {
+                        found = int(j);
+                        break;
+                    }
+                    queue.push_back(var2eq[j]);
+                }
+            }
+
+            if (found < 0) {
+                throw CGException("Unable to determine the BLT form: the system is structurally singular (equation ",
+                                  i, " cannot be matched to an unknown)");
+            }
+
+            // flip the assignments along the path
+            int j = found;
+            while (j >= 0) {
+                size_t e = parentEq[j];
+                int previous = eq2var[e];
+                eq2var[e] = j;
+                var2eq[j] = int(e);
+                j = previous;
+            }
+        }
+    }
+
+    /**
+     * Determines the strongly connected components of the equation
+     * dependency graph (Tarjan's algorithm).
+     * An equation depends on the equations assigned to the unknowns it uses.
+     *
+     * @return the equations of each component sorted so that the components
+     *         only depend on the previous ones
+     */
+    inline std::vector<std::vector<size_t>> findStronglyConnectedComponents(const std::vector<int>& eq2var,
+                                                                            const std::vector<int>& var2eq) const {
+        const size_t m = eqVars_.size();
+        const size_t unvisited = (std::numeric_limits<size_t>::max)();
+
+        std::vector<size_t> index(m, unvisited);
+        std::vector<size_t> lowLink(m, 0);
+        std::vector<bool> onStack(m, false);
+        std::vector<size_t> stack;
+        // (equation, position of the next unknown to visit)
+        std::vector<std::pair<size_t, size_t>> callStack;
+        std::vector<std::vector<size_t>> components;
+        size_t counter = 0;
+
+        for (size_t r = 0; r < m; ++r) {
+            if (eq2var[r] < 0 || index[r] != unvisited) continue;
+
+            callStack.emplace_back(r, 0);
+            while (!callStack.empty()) {
+                size_t e = callStack.back().first;
+                size_t& pos = callStack.back().second;
+
+                if (pos == 0 && index[e] == unvisited) {
+                    index[e] = lowLink[e] = counter++;
+                    stack.push_back(e);
+                    onStack[e] = true;
+                }
+
+                const std::vector<size_t>& vars = eqVars_[e];
+                bool descended = false;
+                while (pos < vars.size()) {
+                    size_t k = size_t(var2eq[vars[pos]]);
+                    pos++;
+                    if (k == e) continue;
+                    if (index[k] == unvisited) {
+                        callStack.emplace_back(k, 0);
+                        descended = true;
+                        break;
+                    } else if (onStack[k]) {
+                        lowLink[e] = std::min(lowLink[e], index[k]);
+                    }
+                }
+                if (descended) continue;
+
+                // all dependencies visited
+                if (lowLink[e] == index[e]) {
+                    components.emplace_back();
+                    std::vector<size_t>& component = components.back();
+                    size_t k;
+                    do {
+                        k = stack.back();
+                        stack.pop_back();
+                        onStack[k] = false;
+                        component.push_back(k);
+                    } while (k != e);
+                }
+
+                callStack.pop_back();
+                if (!callStack.empty()) {
+                    size_t parent = callStack.back().first;
+                    lowLink[parent] = std::min(lowLink[parent], lowLink[e]);
+                }
+            }
+        }
+
+        return components;
+    }
+
+    /**
+     * Attempts to solve an equation symbolically for a variable.
+     *
+     * @return true if the equation was solved
+     */
+    inline bool solveExplicitly(size_t i, size_t j, CGBase& solution) {
+        Node* expression = res_[i].getOperationNode();
+        Node* var = indep_[j].getOperationNode();
+
+        if (expression == var) {
+            solution = CGBase(Base(0.0));  // 0 = x
+            return true;
+        }
+
+        try {
+            if (!handler_.isSolvable(*expression, *var)) return false;
+            solution = handler_.solveFor(*expression, *var);
+            return true;
+        } catch (const CGException& ex) {
+            if (this->verbosity_ >= Verbosity::High)
+                log() << "unable to solve equation " << i << " for variable " << varInfo_[j].getName() << ": "
+                      << ex.what() << std::endl;
+            return false;
+        }
+    }
+
+    inline std::string generateBlockInfoSource(const std::string& name, const std::string& baseTypeName) const {
+        std::ostringstream ss;
+
+        ss << "// algebraic loops:";
+        std::vector<size_t> loops = getAlgebraicLoops();
+        if (loops.empty()) ss << " none";
+        for (size_t b : loops) ss << " " << b << "[" << blocks_[b].size() << "]";
+        ss << "\n\n";
+
+        ss << LanguageC<Base>::ATOMICFUN_STRUCT_DEFINITION << "\n\n";
+
+        std::vector<std::string> argsDcl{baseTypeName + " const *const * in", baseTypeName + "*const * out",
+                                         "struct LangCAtomicFun atomicFun"};
+
+        for (size_t b = 0; b < blocks_.size(); ++b) {
+            LanguageC<Base>::printFunctionDeclaration(ss, "void", name + "_block" + std::to_string(b), argsDcl);
+            ss << ";\n";
+        }
+        ss << "\n";
+
+        // dispatcher
+        LanguageC<Base>::printFunctionDeclaration(ss, "int", name + "_block", {"unsigned long pos"}, argsDcl);
+        ss << " {\n"
+              "   switch(pos) {\n";
+        for (size_t b = 0; b < blocks_.size(); ++b) {
+            ss << "      case " << b << ":\n"
+               << "         " << name << "_block" << b << "(in, out, atomicFun);\n"
+               << "         return 0; // done\n";
+        }
+        ss << "      default:\n"
+              "         return 1; // error\n"
+              "   };\n"
+              "}\n\n";
+
+        // block sizes and types
+        std::vector<size_t> sizes(blocks_.size());
+        std::vector<size_t> explicitBlocks(blocks_.size());
+        for (size_t b = 0; b < blocks_.size(); ++b) {
+            sizes[b] = blocks_[b].size();
+            explicitBlocks[b] = blocks_[b].isExplicit() ? 1 : 0;
+        }
+
+        LanguageC<Base>::printFunctionDeclaration(
+                ss, "void", name + "_blocks_info",
+                {"unsigned long* nBlocks", "unsigned long const** sizes", "unsigned long const** explicitBlocks"});
+        ss << " {\n"
+              "   ";
+        LanguageC<Base>::printStaticIndexArray(ss, "blockSizes", sizes);
+        ss << "   ";
+        LanguageC<Base>::printStaticIndexArray(ss, "blockExplicit", explicitBlocks);
+        ss << "   *nBlocks = " << blocks_.size() << ";\n"
+           << "   *sizes = blockSizes;\n"
+              "   *explicitBlocks = blockExplicit;\n"
+              "}\n\n";
+
+        // equations and variables in each block
+        LanguageC<Base>::printFunctionDeclaration(
+                ss, "int", name + "_block_sparsity",
+                {"unsigned long pos", "unsigned long const** equations", "unsigned long const** variables",
+                 "unsigned long* size"});
+        ss << " {\n";
+        for (size_t b = 0; b < blocks_.size(); ++b) {
+            ss << "   ";
+            LanguageC<Base>::printStaticIndexArray(ss, "eqs" + std::to_string(b), blocks_[b].getEquations());
+            ss << "   ";
+            LanguageC<Base>::printStaticIndexArray(ss, "vars" + std::to_string(b), blocks_[b].getVariables());
+        }
+        ss << "\n"
+              "   switch(pos) {\n";
+        for (size_t b = 0; b < blocks_.size(); ++b) {
+            ss << "      case " << b << ":\n"
+               << "         *equations = eqs" << b << ";\n"
+               << "         *variables = vars" << b << ";\n"
+               << "         *size = " << blocks_[b].size() << ";\n"
+               << "         return 0; // done\n";
+        }
+        ss << "      default:\n"
+              "         return 1; // error\n"
+              "   };\n"
+              "}\n";
+
+        return ss.str();
+    }
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
@@ -69,6 +69,20 @@ public:
      */
     inline bool isPreserveNames() const { return graph_.isPreserveNames(); }
 
+    /**
+     * Defines whether or not the time derivatives of the equations are
+     * determined by differentiating an operation graph with the original
+     * equations (the default) instead of re-taping the model for each
+     * differentiation order.
+     */
+    inline void setSymbolicTimeDerivatives(bool symbolic) { graph_.setSymbolicTimeDerivatives(symbolic); }
+
+    /**
+     * Whether or not the time derivatives of the equations are determined
+     * by differentiating an operation graph with the original equations.
+     */
+    inline bool isSymbolicTimeDerivatives() const { return graph_.isSymbolicTimeDerivatives(); }
+
     /**
      * Provides the structural index which is typically a good approximation of
      * the differentiation index.
@@ -23,6 +23,7 @@
 
 #include <cppad/cg/dae_index_reduction/pantelides.hpp>
 #include <cppad/cg/dae_index_reduction/dummy_deriv_util.hpp>
+#include <cppad/cg/dae_index_reduction/dae_block_lower_triangular.hpp>
 
 namespace CppAD {
 namespace cg {
@@ -99,6 +100,14 @@ protected:
      * Avoid using these variables as dummy derivatives
      */
     std::set<std::string> avoidAsDummy_;
+    /**
+     * Determine the block lower triangular form of the reduced model
+     */
+    bool generateBlockLowerTriangular_;
+    /**
+     * Block lower triangular form of the reduced model
+     */
+    std::unique_ptr<DaeBlockLowerTriangular<Base>> blt_;
 
 public:
     /**
@@ -126,7 +135,8 @@ public:
           reduceEquations_(true),
           generateSemiExplicitDae_(false),
           reorder_(true),
-          avoidConvertAlg2DifVars_(true) {
+          avoidConvertAlg2DifVars_(true),
+          generateBlockLowerTriangular_(false) {
         for (Vnode<Base>* jj : idxIdentify.getGraph().variables()) {
             if (jj->antiDerivative() != nullptr) {
                 diffVarStart_ = jj->index();
@@ -217,6 +227,26 @@ public:
      */
     inline const std::set<std::string>& getAvoidVarsAsDummies() const { return avoidAsDummy_; }
 
+    /**
+     * Whether or not the block lower triangular form of the reduced model
+     * is determined.
+     */
+    inline bool isGenerateBlockLowerTriangular() const { return generateBlockLowerTriangular_; }
+
+    /**
+     * Defines whether or not to determine the block lower triangular (BLT)
+     * form of the reduced model.
+     * The BLT form can then be used to generate source code that solves
+     * the system block by block (see getBlockLowerTriangular()).
+     */
+    inline void setGenerateBlockLowerTriangular(bool generate) { generateBlockLowerTriangular_ = generate; }
+
+    /**
+     * Provides the block lower triangular form of the last reduced model
+     * (null if it was not requested with setGenerateBlockLowerTriangular()).
+     */
+    inline DaeBlockLowerTriangular<Base>* getBlockLowerTriangular() const { return blt_.get(); }
+
     inline std::unique_ptr<ADFun<CG<Base>>> reduceIndex(std::vector<DaeVarInfo>& newVarInfo,
                                                         std::vector<DaeEquationInfo>& newEqInfo) override {
         /**
@@ -263,6 +293,13 @@ public:
             reducedFun_.swap(reorderedFun);
         }
 
+        if (generateBlockLowerTriangular_) {
+            blt_.reset(new DaeBlockLowerTriangular<Base>(*reducedFun_, newVarInfo, newEqInfo));
+            blt_->setLog(log());
+            blt_->setVerbosity(this->verbosity_);
+            blt_->decompose();
+        }
+
         return std::unique_ptr<ADFun<CG<Base>>>(reducedFun_.release());
     }
 
@@ -707,7 +744,7 @@ protected:
 
         vector<CGBase> res0 = graph.forward0(*reducedFun_, indep0);
 
-        vector<bool> jacSparsity = jacobianSparsity<vector<bool>>(*reducedFun_);
+        vector<bool> jacSparsity = reducedModelSparsity();
 
         vector<Vnode<Base>*> diffVariables;
         vector<Vnode<Base>*> dummyVariables;
@@ -1263,6 +1300,19 @@ protected:
         return new ADFun<CGBase>(indepNewOrder, depNewOrder);
     }
 
+    /**
+     * Provides the Jacobian sparsity of the model created by the index
+     * reduction (reducedFun_) which is determined from the operation graph
+     * of the differentiated equations whenever possible.
+     */
+    inline std::vector<bool> reducedModelSparsity() const {
+        const std::vector<bool>& sparsity = idxIdentify_->getGraph().getReducedModelSparsity();
+        if (sparsity.size() == reducedFun_->Domain() * reducedFun_->Range()) {
+            return sparsity;
+        }
+        return jacobianReverseSparsity<std::vector<bool>, CGBase>(*reducedFun_);
+    }
+
     /**
      * Determines the Jacobian relative to the differential variables
      * (e.g. dxdt)
@@ -1278,7 +1328,7 @@ protected:
         auto& vnodes = graph.variables();
         auto& enodes = graph.equations();
 
-        jacSparsity_ = jacobianReverseSparsity<vector<bool>, CGBase>(*reducedFun_);  // in the original variable order
+        jacSparsity_ = reducedModelSparsity();  // in the original variable order
 
         vector<size_t> row, col;
         row.reserve((vnodes.size() - diffVarStart_) * (m - diffEqStart_));
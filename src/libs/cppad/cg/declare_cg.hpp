@@ -71,6 +71,21 @@ class BidirGraph;
 template <class Base>
 class ScopePathElement;
 
+template <class Base>
+class OutlinedFunction;
+
+template <class Base>
+class SubgraphOutliner;
+
+template <class Base>
+class LazyBranchLowering;
+
+template <class Base>
+class AlgebraicSimplifier;
+
+template <class Base>
+class ReverseDifferentiator;
+
 /***************************************************************************
  * Nodes
  **************************************************************************/
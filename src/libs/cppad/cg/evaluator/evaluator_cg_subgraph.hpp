@@ -0,0 +1,120 @@
+#ifndef CPPAD_CG_EVALUATOR_CG_SUBGRAPH_INCLUDED
+#define CPPAD_CG_EVALUATOR_CG_SUBGRAPH_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * An evaluator which recreates only a part of an operation graph in a new
+ * CodeHandler: some operations (the boundary) are replaced by new values
+ * (typically new independent variables) and the operations they depend on
+ * are not evaluated.
+ */
+template <class ScalarIn, class ScalarOut>
+class SubgraphEvaluator : public EvaluatorCG<ScalarIn, ScalarOut, SubgraphEvaluator<ScalarIn, ScalarOut>> {
+    /**
+     * must be friends with its super classes since there is a cast to
+     * this type due to the curiously recurring template pattern (CRTP)
+     */
+    friend EvaluatorBase<ScalarIn, ScalarOut, CG<ScalarOut>, SubgraphEvaluator<ScalarIn, ScalarOut>>;
+    friend EvaluatorOperations<ScalarIn, ScalarOut, CG<ScalarOut>, SubgraphEvaluator<ScalarIn, ScalarOut>>;
+
+public:
+    using ActiveIn = CG<ScalarIn>;
+    using ActiveOut = CG<ScalarOut>;
+    using NodeIn = OperationNode<ScalarIn>;
+
+protected:
+    using Super = EvaluatorCG<ScalarIn, ScalarOut, SubgraphEvaluator<ScalarIn, ScalarOut>>;
+
+protected:
+    /**
+     * The operations replaced by new values in the current evaluation
+     */
+    const std::vector<NodeIn*>* boundary_;
+    /**
+     * The values of the replaced operations in the current evaluation
+     */
+    const std::vector<ActiveOut>* boundaryNew_;
+
+public:
+    inline SubgraphEvaluator(CodeHandler<ScalarIn>& handler)
+        : Super(handler), boundary_(nullptr), boundaryNew_(nullptr) {}
+
+    using Super::evaluate;
+
+    /**
+     * Performs the operations required to calculate the dependent variables
+     * where some of the original operations are replaced by new values.
+     *
+     * @param indepNew The new independent variables.
+     * @param boundary The original operations which are not evaluated.
+     * @param boundaryNew The values used for the operations in boundary.
+     * @param depOld Dependent variable vector representing the operations
+     *               that are going to be executed to determine the new
+     *               variables
+     * @return The dependent variable values
+     * @throws CGException on error (such as different sizes of boundary and
+     *         boundaryNew)
+     */
+    inline std::vector<ActiveOut> evaluate(ArrayView<const ActiveOut> indepNew,
+                                           const std::vector<NodeIn*>& boundary,
+                                           const std::vector<ActiveOut>& boundaryNew,
+                                           ArrayView<const ActiveIn> depOld) {
+        if (boundary.size() != boundaryNew.size()) {
+            throw CGException("Invalid number of values for the replaced operations. Expected ", boundary.size(),
+                              " but got ", boundaryNew.size(), ".");
+        }
+
+        boundary_ = &boundary;
+        boundaryNew_ = &boundaryNew;
+
+        std::vector<ActiveOut> depNew;
+        try {
+            depNew = Super::evaluate(indepNew, depOld);
+        } catch (...) {
+            boundary_ = nullptr;
+            boundaryNew_ = nullptr;
+            throw;
+        }
+
+        boundary_ = nullptr;
+        boundaryNew_ = nullptr;
+
+        return depNew;
+    }
+
+protected:
+    /**
+     * @note overrides the default prepareNewEvaluation() even though this
+     *       method is not virtual (hides a method in EvaluatorBase)
+     */
+    inline void prepareNewEvaluation() {
+        Super::prepareNewEvaluation();
+
+        if (boundary_ == nullptr) return;
+
+        for (size_t i = 0; i < boundary_->size(); ++i) {
+            this->saveEvaluation(*(*boundary_)[i], ActiveOut((*boundaryNew_)[i]));
+        }
+    }
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
@@ -269,6 +269,27 @@ inline void generateSparsityIndexes(const VectorSet& sparsity, VectorSize& row,
     }
 }
 
+/**
+ * Determines the row and column indexes of the elements of a sparsity
+ * pattern (sorted by row and then by column).
+ */
+template <class VectorSize>
+inline void generateSparsityIndexes(const CsrSparsity& sparsity, VectorSize& row, VectorSize& col) {
+    size_t nnz = sparsity.nnz();
+
+    row.resize(nnz);
+    col.resize(nnz);
+    if (nnz == 0) return;
+
+    nnz = 0;
+    for (size_t i = 0; i < sparsity.rows(); i++) {
+        size_t rowNnz = sparsity.rowSize(i);
+        std::fill(&row[0] + nnz, &row[0] + nnz + rowNnz, i);
+        std::copy(sparsity.rowBegin(i), sparsity.rowEnd(i), &col[0] + nnz);
+        nnz += rowNnz;
+    }
+}
+
 template <class VectorSet, class VectorSize>
 inline void generateSparsitySet(const VectorSize& row, const VectorSize& col, VectorSet& sparsity) {
     assert(row.size() == col.size());
@@ -123,10 +123,23 @@ private:
      * Whether or not there are/were other jobs inside
      */
     bool _nestedJobs;
+    /**
+     * Peak resident set size (bytes) when the job started (only determined
+     * when tracing)
+     */
+    size_t _beginPeakMemory;
+    /**
+     * Values associated with the job (e.g. number of operation nodes)
+     */
+    std::vector<std::pair<std::string, size_t>> _counters;
 
 public:
     inline Job(const JobType& type, const std::string& name)
-        : _type(&type), _name(name), _beginTime(std::chrono::steady_clock::now()), _nestedJobs(false) {}
+        : _type(&type),
+          _name(name),
+          _beginTime(std::chrono::steady_clock::now()),
+          _nestedJobs(false),
+          _beginPeakMemory(0) {}
 
     inline const JobType& getType() const { return *_type; }
 
@@ -134,6 +147,8 @@ public:
 
     inline std::chrono::steady_clock::time_point beginTime() const { return _beginTime; }
 
+    inline const std::vector<std::pair<std::string, size_t>>& counters() const { return _counters; }
+
     inline virtual ~Job() {}
 
     friend class JobTimer;
@@ -151,6 +166,44 @@ public:
     virtual void jobEndended(const std::vector<Job>& job, duration elapsed) = 0;
 };
 
+/**
+ * A job which has been completed and recorded while tracing
+ */
+class JobTraceEvent {
+public:
+    /**
+     * job name (including the action)
+     */
+    std::string name;
+    /**
+     * the action of the job type
+     */
+    std::string category;
+    /**
+     * the thread which executed the job (sequential number starting at 0)
+     */
+    size_t thread;
+    /**
+     * the number of running jobs in the same thread when the job started
+     */
+    size_t depth;
+    std::chrono::steady_clock::time_point begin;
+    std::chrono::steady_clock::duration elapsed;
+    /**
+     * peak resident set size (bytes) of the process when the job ended
+     */
+    size_t peakMemory;
+    /**
+     * increase of the peak resident set size (bytes) during the job
+     */
+    size_t peakMemoryDelta;
+    /**
+     * Values associated with the job (e.g. number of operation nodes or
+     * bytes of source code)
+     */
+    std::vector<std::pair<std::string, size_t>> counters;
+};
+
 /**
  * Utility class used to print elapsed times of jobs
  */
@@ -191,9 +244,30 @@ private:
      *
      */
     std::set<JobListener*> _listeners;
+    /**
+     * Whether or not to record the completed jobs (read without locking by
+     * the threads which execute jobs)
+     */
+    std::atomic<bool> _tracing;
+    /**
+     * The time when tracing was enabled
+     */
+    std::chrono::steady_clock::time_point _traceBegin;
+    /**
+     * The recorded jobs
+     */
+    std::vector<JobTraceEvent> _traceEvents;
+    /**
+     * Sequential numbers assigned to the threads which executed jobs
+     */
+    std::map<std::thread::id, size_t> _traceThreads;
+    /**
+     * Used to record jobs from several threads
+     */
+    std::mutex _traceMutex;
 
 public:
-    JobTimer() : _verbose(false), _maxLineWidth(80), _indent(2) {}
+    JobTimer() : _verbose(false), _maxLineWidth(80), _indent(2), _tracing(false) {}
 
     inline bool isVerbose() const { return _verbose; }
 
@@ -214,10 +288,158 @@ public:
 
     inline bool removeListener(JobListener& l) { return _listeners.erase(&l) > 0; }
 
+    inline bool isTracing() const { return _tracing; }
+
+    /**
+     * Defines whether or not to record the completed jobs (with their
+     * thread, counters and memory usage) so that they can be exported
+     * (see writeChromeTrace()).
+     * Enabling tracing removes previously recorded jobs.
+     */
+    inline void setTracing(bool tracing) {
+        std::lock_guard<std::mutex> lock(_traceMutex);
+        if (tracing && !_tracing) {
+            _traceEvents.clear();
+            _traceThreads.clear();
+            _traceThreads.emplace(std::this_thread::get_id(), 0);  // main thread
+            _traceBegin = std::chrono::steady_clock::now();
+        }
+        _tracing = tracing;
+    }
+
+    /**
+     * Provides the recorded jobs.
+     * It should not be used while jobs are being recorded by other threads.
+     */
+    inline const std::vector<JobTraceEvent>& getTraceEvents() const { return _traceEvents; }
+
+    inline void clearTrace() {
+        std::lock_guard<std::mutex> lock(_traceMutex);
+        _traceEvents.clear();
+    }
+
+    /**
+     * Associates a value with the current job (e.g. the number of operation
+     * nodes or bytes of source code).
+     * Values with the same name are added.
+     */
+    inline void addJobCounter(const std::string& name, size_t value) {
+        if (_jobs.empty()) return;
+
+        std::vector<std::pair<std::string, size_t>>& counters = _jobs.back()._counters;
+        for (auto& c : counters) {
+            if (c.first == name) {
+                c.second += value;
+                return;
+            }
+        }
+        counters.emplace_back(name, value);
+    }
+
+    /**
+     * Records a job which was not started with startingJob() such as a job
+     * executed by another thread.
+     * This method can be called from several threads at the same time.
+     *
+     * @param jobName the job name
+     * @param type the job type
+     * @param begin when the job started
+     * @param beginPeakMemory the peak resident set size when the job started
+     *                        (see system::getPeakResidentSetSize())
+     * @param counters values associated with the job
+     */
+    inline void traceJob(const std::string& jobName,
+                         const JobType& type,
+                         std::chrono::steady_clock::time_point begin,
+                         size_t beginPeakMemory,
+                         std::vector<std::pair<std::string, size_t>> counters = {}) {
+        if (!_tracing) return;
+
+        auto end = std::chrono::steady_clock::now();
+        size_t peakMemory = system::getPeakResidentSetSize();
+
+        std::lock_guard<std::mutex> lock(_traceMutex);
+        recordTraceEvent(type.getActionName() + " " + jobName, type, 0, begin, end - begin, beginPeakMemory,
+                         peakMemory, std::move(counters));
+    }
+
+    /**
+     * Writes the recorded jobs using the Chrome trace event format (JSON)
+     * which can be opened with chrome://tracing or Perfetto.
+     * Each job is a complete event in the thread which executed it and
+     * the peak memory usage is provided as a counter.
+     */
+    inline void writeChromeTrace(std::ostream& out) {
+        using namespace std::chrono;
+
+        std::lock_guard<std::mutex> lock(_traceMutex);
+
+        OStreamConfigRestore osr(out);
+
+        auto micro = [this](steady_clock::time_point t) {
+            return duration_cast<microseconds>(t - _traceBegin).count();
+        };
+
+        out << "{\"traceEvents\": [";
+        bool first = true;
+        auto next = [&]() {
+            if (!first) out << ",";
+            out << "\n";
+            first = false;
+        };
+
+        for (const auto& t : _traceThreads) {
+            next();
+            out << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << t.second
+                << ", \"args\": {\"name\": \"" << (t.second == 0 ? "main" : "worker " + std::to_string(t.second))
+                << "\"}}";
+        }
+
+        for (const JobTraceEvent& e : _traceEvents) {
+            next();
+            out << "{\"name\": \"" << escapeJson(e.name) << "\", \"cat\": \"" << escapeJson(e.category)
+                << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << e.thread << ", \"ts\": " << micro(e.begin)
+                << ", \"dur\": " << duration_cast<microseconds>(e.elapsed).count() << ", \"args\": {\"depth\": "
+                << e.depth << ", \"peak_rss\": " << e.peakMemory << ", \"peak_rss_delta\": " << e.peakMemoryDelta;
+            for (const auto& c : e.counters) {
+                out << ", \"" << escapeJson(c.first) << "\": " << c.second;
+            }
+            out << "}}";
+
+            next();
+            out << "{\"name\": \"peak RSS (MiB)\", \"ph\": \"C\", \"pid\": 1, \"ts\": " << micro(e.begin + e.elapsed)
+                << ", \"args\": {\"peak_rss\": " << std::fixed << std::setprecision(1)
+                << double(e.peakMemory) / (1024.0 * 1024.0) << "}}";
+        }
+
+        out << "\n],\n\"displayTimeUnit\": \"ms\"}\n";
+    }
+
+    /**
+     * Saves the recorded jobs to a file using the Chrome trace event format
+     * (see writeChromeTrace()).
+     *
+     * @param fileName the path to the JSON file
+     * @throws CGException if the file cannot be created
+     */
+    inline void saveChromeTrace(const std::string& fileName) {
+        std::ofstream file(fileName);
+        if (!file) {
+            throw CGException("Failed to create file '", fileName, "'");
+        }
+        writeChromeTrace(file);
+        if (!file) {
+            throw CGException("Failed to write to file '", fileName, "'");
+        }
+    }
+
     inline void startingJob(const std::string& jobName,
                             const JobType& type = JobTypeHolder<>::DEFAULT,
                             const std::string& prefix = "") {
         _jobs.push_back(Job(type, jobName));
+        if (_tracing) {
+            _jobs.back()._beginPeakMemory = system::getPeakResidentSetSize();
+        }
 
         if (_verbose) {
             OStreamConfigRestore osr(std::cout);
@@ -282,8 +504,70 @@ public:
             l->jobEndended(_jobs, elapsed);
         }
 
+        if (_tracing) {
+            size_t peakMemory = system::getPeakResidentSetSize();
+
+            std::lock_guard<std::mutex> lock(_traceMutex);
+            recordTraceEvent(job.getType().getActionName() + " " + job.name(), job.getType(), _jobs.size() - 1,
+                             job.beginTime(), elapsed, job._beginPeakMemory, peakMemory, std::move(job._counters));
+        }
+
         _jobs.pop_back();
     }
+
+private:
+    /**
+     * must be called while holding _traceMutex
+     */
+    inline void recordTraceEvent(std::string name,
+                                 const JobType& type,
+                                 size_t depth,
+                                 std::chrono::steady_clock::time_point begin,
+                                 std::chrono::steady_clock::duration elapsed,
+                                 size_t beginPeakMemory,
+                                 size_t peakMemory,
+                                 std::vector<std::pair<std::string, size_t>> counters) {
+        auto itThread = _traceThreads.emplace(std::this_thread::get_id(), _traceThreads.size()).first;
+
+        _traceEvents.emplace_back();
+        JobTraceEvent& e = _traceEvents.back();
+        e.name = std::move(name);
+        e.category = type.getActionName();
+        e.thread = itThread->second;
+        e.depth = depth;
+        e.begin = begin;
+        e.elapsed = elapsed;
+        e.peakMemory = peakMemory;
+        e.peakMemoryDelta = peakMemory > beginPeakMemory ? peakMemory - beginPeakMemory : 0;
+        e.counters = std::move(counters);
+    }
+
+    static inline std::string escapeJson(const std::string& text) {
+        std::ostringstream os;
+        for (char c : text) {
+            switch (c) {
+                case '"':
+                    os << "\\\"";
+                    break;
+                case '\\':
+                    os << "\\\\";
+                    break;
+                case '\n':
+                    os << "\\n";
+                    break;
+                case '\t':
+                    os << "\\t";
+                    break;
+                default:
+                    if ((unsigned char) c < 0x20) {
+                        os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec;
+                    } else {
+                        os << c;
+                    }
+            }
+        }
+        return os.str();
+    }
 };
 
 }  // namespace cg
@@ -0,0 +1,223 @@
+#ifndef CPPAD_CG_LANG_C_CLUSTER_VAR_NAME_GEN_INCLUDED
+#define CPPAD_CG_LANG_C_CLUSTER_VAR_NAME_GEN_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Creates variables names for the source code of a job which evaluates a
+ * part of a function (see LevelClustering).
+ * The independent variables are considered to have been registered first as
+ * variables in the code generation handler followed by the values computed
+ * by other jobs, which are read from a shared array.
+ * The dependent variables assign either a subset of the original dependent
+ * variables or values saved in the shared array for other jobs.
+ *
+ * @author Feng Yang
+ */
+template <class Base>
+class LangCClusterVarNameGenerator : public VariableNameGenerator<Base> {
+protected:
+    VariableNameGenerator<Base>* _nameGen;
+    // the lowest variable ID used for the values read from the shared array
+    const size_t _minInputID;
+    // the position in the shared array of each value computed by other jobs
+    const std::vector<size_t> _inputSlots;
+    // the index in the original dependent vector of each dependent variable
+    const std::vector<size_t> _depIndexes;
+    // the position in the shared array of each value computed for other jobs
+    const std::vector<size_t> _outputSlots;
+    // array name of the values computed by other jobs
+    const std::string _inName;
+    // array name of the values computed for other jobs
+    const std::string _outName;
+    // auxiliary string stream
+    std::stringstream _ss;
+
+public:
+    /**
+     * @param nameGen the name generator of the complete function
+     * @param n the number of independent variables of the complete function
+     * @param inputSlots the position in the shared array of the values
+     *                   computed by other jobs (independents after n)
+     * @param depIndexes the index in the original dependent vector of the
+     *                   first dependent variables
+     * @param outputSlots the position in the shared array of the values
+     *                    computed for other jobs (the last dependent
+     *                    variables)
+     * @param inName array name of the values computed by other jobs
+     * @param outName array name of the values computed for other jobs
+     */
+    LangCClusterVarNameGenerator(VariableNameGenerator<Base>* nameGen,
+                                 size_t n,
+                                 std::vector<size_t> inputSlots,
+                                 std::vector<size_t> depIndexes,
+                                 std::vector<size_t> outputSlots,
+                                 std::string inName = "sx",
+                                 std::string outName = "sy")
+        : _nameGen(nameGen),
+          _minInputID(n + 1),
+          _inputSlots(std::move(inputSlots)),
+          _depIndexes(std::move(depIndexes)),
+          _outputSlots(std::move(outputSlots)),
+          _inName(std::move(inName)),
+          _outName(std::move(outName)) {
+        CPPADCG_ASSERT_KNOWN(_nameGen != nullptr, "The name generator must not be null")
+        CPPADCG_ASSERT_KNOWN(!_inName.empty() && !_outName.empty(), "The names of the shared arrays must not be empty")
+
+        initialize();
+    }
+
+    inline virtual ~LangCClusterVarNameGenerator() = default;
+
+    const std::vector<FuncArgument>& getTemporary() const override { return _nameGen->getTemporary(); }
+
+    size_t getMinTemporaryVariableID() const override { return _nameGen->getMinTemporaryVariableID(); }
+
+    size_t getMaxTemporaryVariableID() const override { return _nameGen->getMaxTemporaryVariableID(); }
+
+    size_t getMaxTemporaryArrayVariableID() const override { return _nameGen->getMaxTemporaryArrayVariableID(); }
+
+    size_t getMaxTemporarySparseArrayVariableID() const override {
+        return _nameGen->getMaxTemporarySparseArrayVariableID();
+    }
+
+    std::string generateDependent(size_t index) override {
+        if (index < _depIndexes.size()) {
+            return _nameGen->generateDependent(_depIndexes[index]);
+        }
+
+        _ss.clear();
+        _ss.str("");
+        _ss << _outName << "[" << _outputSlots[index - _depIndexes.size()] << "]";
+        return _ss.str();
+    }
+
+    std::string generateIndependent(const OperationNode<Base>& independent, size_t id) override {
+        if (id < _minInputID) {
+            return _nameGen->generateIndependent(independent, id);
+        }
+
+        _ss.clear();
+        _ss.str("");
+        _ss << _inName << "[" << _inputSlots[id - _minInputID] << "]";
+        return _ss.str();
+    }
+
+    std::string generateTemporary(const OperationNode<Base>& variable, size_t id) override {
+        return _nameGen->generateTemporary(variable, id);
+    }
+
+    std::string generateTemporaryArray(const OperationNode<Base>& variable, size_t id) override {
+        return _nameGen->generateTemporaryArray(variable, id);
+    }
+
+    std::string generateTemporarySparseArray(const OperationNode<Base>& variable, size_t id) override {
+        return _nameGen->generateTemporarySparseArray(variable, id);
+    }
+
+    std::string generateIndexedDependent(const OperationNode<Base>& var, size_t id, const IndexPattern& ip) override {
+        return _nameGen->generateIndexedDependent(var, id, ip);
+    }
+
+    std::string generateIndexedIndependent(const OperationNode<Base>& indexedIndep,
+                                           size_t id,
+                                           const IndexPattern& ip) override {
+        return _nameGen->generateIndexedIndependent(indexedIndep, id, ip);
+    }
+
+    const std::string& getIndependentArrayName(const OperationNode<Base>& indep, size_t id) override {
+        if (id < _minInputID)
+            return _nameGen->getIndependentArrayName(indep, id);
+        else
+            return _inName;
+    }
+
+    size_t getIndependentArrayIndex(const OperationNode<Base>& indep, size_t id) override {
+        if (id < _minInputID)
+            return _nameGen->getIndependentArrayIndex(indep, id);
+        else
+            return _inputSlots[id - _minInputID];
+    }
+
+    bool isConsecutiveInIndepArray(const OperationNode<Base>& indepFirst,
+                                   size_t id1,
+                                   const OperationNode<Base>& indepSecond,
+                                   size_t id2) override {
+        if ((id1 < _minInputID) != (id2 < _minInputID)) return false;
+
+        if (id1 < _minInputID)
+            return _nameGen->isConsecutiveInIndepArray(indepFirst, id1, indepSecond, id2);
+        else
+            return _inputSlots[id1 - _minInputID] + 1 == _inputSlots[id2 - _minInputID];
+    }
+
+    bool isInSameIndependentArray(const OperationNode<Base>& indep1,
+                                  size_t id1,
+                                  const OperationNode<Base>& indep2,
+                                  size_t id2) override {
+        if ((id1 < _minInputID) != (id2 < _minInputID)) return false;
+
+        if (id1 < _minInputID)
+            return _nameGen->isInSameIndependentArray(indep1, id1, indep2, id2);
+        else
+            return true;
+    }
+
+    void setTemporaryVariableID(size_t minTempID,
+                                size_t maxTempID,
+                                size_t maxTempArrayID,
+                                size_t maxTempSparseArrayID) override {
+        _nameGen->setTemporaryVariableID(minTempID, maxTempID, maxTempArrayID, maxTempSparseArrayID);
+    }
+
+    const std::string& getTemporaryVarArrayName(const OperationNode<Base>& var, size_t id) override {
+        return _nameGen->getTemporaryVarArrayName(var, id);
+    }
+
+    size_t getTemporaryVarArrayIndex(const OperationNode<Base>& var, size_t id) override {
+        return _nameGen->getTemporaryVarArrayIndex(var, id);
+    }
+
+    bool isConsecutiveInTemporaryVarArray(const OperationNode<Base>& varFirst,
+                                          size_t idFirst,
+                                          const OperationNode<Base>& varSecond,
+                                          size_t idSecond) override {
+        return _nameGen->isConsecutiveInTemporaryVarArray(varFirst, idFirst, varSecond, idSecond);
+    }
+
+    bool isInSameTemporaryVarArray(const OperationNode<Base>& var1,
+                                   size_t id1,
+                                   const OperationNode<Base>& var2,
+                                   size_t id2) override {
+        return _nameGen->isInSameTemporaryVarArray(var1, id1, var2, id2);
+    }
+
+private:
+    inline void initialize() {
+        this->_independent = _nameGen->getIndependent();  // copy
+        this->_independent.push_back(FuncArgument(_inName));
+
+        this->_dependent = _nameGen->getDependent();  // copy
+        this->_dependent.push_back(FuncArgument(_outName));
+    }
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
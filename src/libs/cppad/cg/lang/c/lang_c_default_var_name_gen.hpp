@@ -73,6 +73,23 @@ public:
 
     inline virtual ~LangCDefaultVariableNameGenerator() = default;
 
+    /**
+     * Defines whether or not temporary variables are declared as individual
+     * scalar local variables (e.g. v1, v2, ...) instead of elements of a
+     * single array (e.g. v[1], v[2], ...).
+     * Compilers can keep scalar locals in registers which is not usually
+     * the case for the elements of a large stack array.
+     * Scalar temporary variables cannot be shared by several functions,
+     * thus the generated source is not split into multiple functions.
+     */
+    inline void setTemporaryScalars(bool scalars) { this->_temporary[0].array = !scalars; }
+
+    /**
+     * Whether or not temporary variables are declared as individual scalar
+     * local variables.
+     */
+    inline bool isTemporaryScalars() const { return !this->_temporary[0].array; }
+
     inline size_t getMinTemporaryVariableID() const override { return _minTemporaryID; }
 
     inline size_t getMaxTemporaryVariableID() const override { return _maxTemporaryID; }
@@ -205,14 +222,14 @@ public:
                                           size_t idFirst,
                                           const OperationNode<Base>& varSecond,
                                           size_t idSecond) override {
-        return idFirst + 1 == idSecond;
+        return this->_temporary[0].array && idFirst + 1 == idSecond;
     }
 
     bool isInSameTemporaryVarArray(const OperationNode<Base>& var1,
                                    size_t id1,
                                    const OperationNode<Base>& var2,
                                    size_t id2) override {
-        return true;
+        return this->_temporary[0].array;
     }
 
 protected:
@@ -49,6 +49,7 @@ protected:
     static const std::string _C_COMP_OP_NE;
     static const std::string _C_STATIC_INDEX_ARRAY;
     static const std::string _C_SPARSE_INDEX_ARRAY;
+    static const std::string _C_GATHER_ARRAY;
     static const std::string _ATOMIC_TX;
     static const std::string _ATOMIC_TY;
     static const std::string _ATOMIC_PX;
@@ -90,6 +91,8 @@ protected:
     const ArrayView<CG<Base>>* _dependent;
     // the temporary variables that may require a declaration
     std::map<size_t, Node*> _temporary;
+    // the IDs of the temporary variables which hold (at least) one value with the original precision
+    std::set<size_t> _temporaryFullPrecision;
     // the operator used for assignment of dependent variables
     std::string _depAssignOperation;
     // whether or not to ignore assignment of constant zero values to dependent variables
@@ -113,6 +116,26 @@ protected:
     std::vector<const LoopStartOperationNode<Base>*> _currentLoops;
     // the maximum precision used to print values
     size_t _parameterPrecision;
+    // the source code of the functions shared by repeated subgraphs
+    std::vector<std::string> _outlinedFunctionSources;
+    // the number of operations in each outlined function (accounted as assignments of the file defining it)
+    std::vector<size_t> _outlinedFunctionAssignments;
+    // the outlined functions used by the current function
+    std::set<size_t> _outlinedFunctionsUsed;
+    // the number of assignments in outlined functions which were not yet added to the current function
+    size_t _outlinedAssignments;
+    // the operations evaluated with a reduced floating-point precision
+    std::set<const Node*> _reducedPrecisionNodes;
+    // the type name used by operations with a reduced precision (e.g. float)
+    std::string _reducedPrecisionTypeName;
+    // whether or not to generate loops which can be vectorized by the C compiler
+    bool _simdLoops;
+    // the maximum number of elements of the local arrays used to gather indexed independents before a loop
+    size_t _maxSimdGatherSize;
+    // whether or not an additional block was opened for each of the current loops
+    std::vector<bool> _loopBlocks;
+    // the local arrays with the values of indexed independents gathered before the current loop
+    std::map<const Node*, std::string> _gatheredIndependents;
 
 private:
     std::vector<std::string> funcArgDcl_;
@@ -144,7 +167,11 @@ public:
           _maxAssignmentsPerFunction(0),
           _maxOperationsPerAssignment((std::numeric_limits<size_t>::max)()),
           _sources(nullptr),
-          _parameterPrecision(std::numeric_limits<Base>::digits10) {}
+          _parameterPrecision(std::numeric_limits<Base>::digits10),
+          _outlinedAssignments(0),
+          _reducedPrecisionTypeName("float"),
+          _simdLoops(false),
+          _maxSimdGatherSize(4096) {}
 
     inline virtual ~LanguageC() = default;
 
@@ -213,6 +240,52 @@ public:
      */
     virtual void setParameterPrecision(size_t p) { _parameterPrecision = p; }
 
+    inline const std::set<const Node*>& getReducedPrecisionNodes() const { return _reducedPrecisionNodes; }
+
+    inline const std::string& getReducedPrecisionTypeName() const { return _reducedPrecisionTypeName; }
+
+    /**
+     * Defines the operations which are evaluated with a reduced
+     * floating-point precision (see MixedPrecisionSelector).
+     * Their arguments are converted to the reduced type and the single
+     * precision variants of the C99 math functions are used (e.g. expf).
+     * Temporary variables only use the reduced type if they are declared as
+     * scalar variables and all the operations which reuse their IDs also
+     * use a reduced precision.
+     *
+     * @param nodes the operations which use a reduced precision
+     * @param typeName the reduced precision type name
+     */
+    inline void setReducedPrecision(std::set<const Node*> nodes, std::string typeName = "float") {
+        _reducedPrecisionNodes = std::move(nodes);
+        _reducedPrecisionTypeName = std::move(typeName);
+    }
+
+    inline bool isSimdLoops() const { return _simdLoops; }
+
+    /**
+     * Defines whether or not to generate loops which can be vectorized by
+     * the C compiler.
+     * The input and output arrays are declared with the restrict qualifier
+     * (the callers must never provide overlapping arrays) and loops without dependencies between iterations are preceded by
+     * compiler hints (GCC ivdep or clang vectorize(assume_safety)).
+     * Indexed independents which are not accessed with an affine index
+     * (e.g. random or sectioned index patterns) are copied into contiguous
+     * local arrays before the loop.
+     * Loops are only marked when the temporary variables are scalar
+     * variables and the dependents are assigned using non-overlapping
+     * linear index patterns.
+     *
+     * @param simdLoops whether or not to generate vectorizable loops
+     * @param maxGatherSize the maximum number of iterations of a loop for
+     *                      which indexed independents are gathered into
+     *                      local arrays (allocated on the stack)
+     */
+    inline void setSimdLoops(bool simdLoops, size_t maxGatherSize = 4096) {
+        _simdLoops = simdLoops;
+        _maxSimdGatherSize = maxGatherSize;
+    }
+
     /**
      * Defines the maximum number of assignment per generated function.
      * Zero means it is disabled (no limit).
@@ -220,6 +293,7 @@ public:
      * instead of a very large one.
      * Note that it is not possible to split some function (e.g., containing loops) and, therefore, this
      * limit can be violated.
+     * Functions are never split when the temporary variables are not saved in an array.
      *
      * @param maxAssignmentsPerFunction the maximum number of assignments per file/function
      * @param sources A map where the file names are associated with their contents.
@@ -303,15 +377,19 @@ public:
                 }
             }
 
-            Node* var1 = _temporary.begin()->second;
-            const std::string& varName1 = *var1->getName();
-            _ss << _spaces << _baseTypeName << " " << varName1;
+            // a variable ID can be reused by operations with different precisions
+            auto printDeclaration = [this](const std::string& type, bool reduced) {
+                bool first = true;
+                for (const auto& p : _temporary) {
+                    if ((_temporaryFullPrecision.count(p.first) == 0) != reduced) continue;
+                    _ss << (first ? _spaces + type + " " : ", ") << *p.second->getName();
+                    first = false;
+                }
+                if (!first) _ss << ";\n";
+            };
 
-            typename std::map<size_t, Node*>::const_iterator it = _temporary.begin();
-            for (it++; it != _temporary.end(); ++it) {
-                _ss << ", " << *it->second->getName();
-            }
-            _ss << ";\n";
+            printDeclaration(_baseTypeName, false);
+            printDeclaration(_reducedPrecisionTypeName, true);
         }
 
         /**
@@ -387,7 +465,7 @@ public:
 
         _ss << _spaces << "//dependent variables\n";
         for (size_t i = 0; i < depArg.size(); i++) {
-            _ss << _spaces << argumentDeclaration(depArg[i]) << " = " << _outArgName << "[" << i << "];\n";
+            _ss << _spaces << localArrayDeclaration(depArg[i]) << " = " << _outArgName << "[" << i << "];\n";
         }
 
         std::string code = _ss.str();
@@ -401,7 +479,7 @@ public:
 
         _ss << _spaces << "//independent variables\n";
         for (size_t i = 0; i < indArg.size(); i++) {
-            _ss << _spaces << "const " << argumentDeclaration(indArg[i]) << " = " << _inArgName << "[" << i << "];\n";
+            _ss << _spaces << "const " << localArrayDeclaration(indArg[i]) << " = " << _inArgName << "[" << i << "];\n";
         }
 
         std::string code = _ss.str();
@@ -604,21 +682,30 @@ public:
 protected:
     void generateSourceCode(std::ostream& out, std::unique_ptr<LanguageGenerationData<Base>> info) override {
         const bool createFunction = !_functionName.empty();
-        const bool multiFunction = createFunction && _maxAssignmentsPerFunction > 0 && _sources != nullptr;
+        // scalar temporary variables cannot be shared among several functions
+        const bool multiFunction = createFunction && _maxAssignmentsPerFunction > 0 && _sources != nullptr &&
+                                   info->nameGen.getTemporary()[0].array;
 
         // clean up
         _code.str("");
         _ss.str("");
         _temporary.clear();
+        _temporaryFullPrecision.clear();
         _indentation = _spaces;
         funcArgDcl_.clear();
         localFuncArgDcl_.clear();
         localFuncArgs_ = "";
         auxArrayName_ = "";
         _currentLoops.clear();
+        _loopBlocks.clear();
+        _gatheredIndependents.clear();
         _atomicFuncArrays.clear();
         _streamStack.clear();
         _dependentIDs.clear();
+        _outlinedFunctionSources.clear();
+        _outlinedFunctionAssignments.clear();
+        _outlinedFunctionsUsed.clear();
+        _outlinedAssignments = 0;
 
         // save some info
         _info = std::move(info);
@@ -634,6 +721,16 @@ protected:
         _tmpSparseArrayValues.resize(_nameGen->getMaxTemporarySparseArrayVariableID());
         std::fill(_tmpSparseArrayValues.begin(), _tmpSparseArrayValues.end(), nullptr);
 
+        /**
+         * functions shared by repeated subgraphs
+         */
+        if (!_info->outlinedFunctions.empty()) {
+            if (!createFunction) {
+                throw CGException("Outlined functions can only be used when a function is generated");
+            }
+            generateOutlinedFunctionSources();
+        }
+
         /**
          * generate index array names (might be used for variable names)
          */
@@ -779,7 +876,10 @@ protected:
                     continue;  // nothing to do (this operation is right hand side only)
                 } else if (node.getOperationType() ==
                            CGOpCode::TmpDcl) {  // temporary variable declaration does not need any source code here
-                    continue;                   // nothing to do (bogus operation)
+                    if (!tmpArg[0].array) {
+                        addTemporary(node);  // must be declared as a scalar
+                    }
+                    continue;  // nothing to do (bogus operation)
                 } else if (node.getOperationType() == CGOpCode::LoopIndexedDep) {
                     // try to detect a pattern and use a loop instead of individual assignments
                     i = printLoopIndexDeps(variableOrder, i);
@@ -787,6 +887,8 @@ protected:
                 }
 
                 assignCount += printAssignment(node);
+                assignCount += _outlinedAssignments;  // outlined functions are defined in the same file
+                _outlinedAssignments = 0;
 
                 CPPAD_ASSERT_KNOWN(_streamStack.empty(), "Error writing all operations to output stream")
             }
@@ -871,6 +973,7 @@ protected:
                 _ss << "#include <math.h>\n"
                        "#include <stdio.h>\n\n"
                     << ATOMICFUN_STRUCT_DEFINITION << "\n\n";
+                printOutlinedFunctions(_ss);
                 printFunctionDeclaration(_ss, "void", _functionName, funcArgDcl_);
                 _ss << " {\n";
                 _nameGen->customFunctionVariableDeclarations(_ss);
@@ -950,7 +1053,7 @@ protected:
 
     inline virtual void pushAssignmentStart(Node& node, const std::string& varName, bool isDep) {
         if (!isDep) {
-            _temporary[getVariableID(node)] = &node;
+            addTemporary(node);
         }
 
         _streamStack << _indentation << varName << " ";
@@ -977,6 +1080,16 @@ protected:
         return dcl + " " + funcArg.name;
     }
 
+    /**
+     * Declaration of the local variables pointing to the input and output
+     * arrays (restrict qualified when vectorizable loops are generated).
+     */
+    inline std::string localArrayDeclaration(const FuncArgument& funcArg) const {
+        if (!_simdLoops || !funcArg.array) return argumentDeclaration(funcArg);
+
+        return _baseTypeName + "* restrict " + funcArg.name;
+    }
+
     virtual void saveLocalFunction(std::vector<std::string>& localFuncNames, bool zeroDependentArray) {
         _ss << _functionName << "__" << (localFuncNames.size() + 1);
         std::string funcName = _ss.str();
@@ -985,6 +1098,7 @@ protected:
         _ss << "#include <math.h>\n"
                "#include <stdio.h>\n\n"
             << ATOMICFUN_STRUCT_DEFINITION << "\n\n";
+        printOutlinedFunctions(_ss);
         printFunctionDeclaration(_ss, "void", funcName, localFuncArgDcl_);
         _ss << " {\n";
         _nameGen->customFunctionVariableDeclarations(_ss);
@@ -1019,7 +1133,9 @@ protected:
 
     bool createsNewVariable(const Node& var, size_t totalUseCount, size_t opCount) const override {
         CGOpCode op = var.getOperationType();
-        if (totalUseCount > 1) {
+        if (isBranchCondition(var)) {
+            return false;  // printed by the if
+        } else if (totalUseCount > 1) {
             return op != CGOpCode::ArrayElement && op != CGOpCode::Index && op != CGOpCode::IndexDeclaration &&
                    op != CGOpCode::Tmp;
         } else {
@@ -1027,7 +1143,8 @@ protected:
                     op == CGOpCode::AtomicForward || op == CGOpCode::AtomicReverse || op == CGOpCode::ComLt ||
                     op == CGOpCode::ComLe || op == CGOpCode::ComEq || op == CGOpCode::ComGe || op == CGOpCode::ComGt ||
                     op == CGOpCode::ComNe || op == CGOpCode::LoopIndexedDep || op == CGOpCode::LoopIndexedTmp ||
-                    op == CGOpCode::IndexAssign || op == CGOpCode::Assign || opCount >= _maxOperationsPerAssignment) &&
+                    op == CGOpCode::IndexAssign || op == CGOpCode::Assign || op == CGOpCode::OutlinedCall ||
+                    opCount >= _maxOperationsPerAssignment) &&
                    op != CGOpCode::CondResult;
         }
     }
@@ -1320,6 +1437,9 @@ protected:
             case CGOpCode::UserCustom:
                 pushUserCustom(node);
                 break;
+            case CGOpCode::OutlinedCall:
+                pushOutlinedCall(node);
+                break;
             default:
                 throw CGException("Unknown operation code '", op, "'.");
         }
@@ -1401,19 +1521,26 @@ protected:
             default:
                 throw CGException("Unknown function name for operation code '", op.getOperationType(), "'.");
         }
+        if (isReducedPrecision(op)) {
+            _streamStack << "f";  // C99 single precision variant
+        }
 
         _streamStack << "(";
-        push(op.getArguments()[0]);
+        pushOperand(op, op.getArguments()[0]);
         _streamStack << ")";
     }
 
     virtual void pushPowFunction(Node& op) {
         CPPADCG_ASSERT_KNOWN(op.getArguments().size() == 2, "Invalid number of arguments for pow() function")
 
-        _streamStack << powFuncName() << "(";
-        push(op.getArguments()[0]);
+        _streamStack << powFuncName();
+        if (isReducedPrecision(op)) {
+            _streamStack << "f";  // C99 single precision variant
+        }
+        _streamStack << "(";
+        pushOperand(op, op.getArguments()[0]);
         _streamStack << ", ";
-        push(op.getArguments()[1]);
+        pushOperand(op, op.getArguments()[1]);
         _streamStack << ")";
     }
 
@@ -1451,14 +1578,14 @@ protected:
         const Arg& right = op.getArguments()[1];
 
         if (right.getParameter() == nullptr || (*right.getParameter() >= 0)) {
-            push(left);
+            pushOperand(op, left);
             _streamStack << " + ";
-            push(right);
+            pushOperand(op, right);
         } else {
             // right has a negative parameter so we would get v0 + -v1
-            push(left);
+            pushOperand(op, left);
             _streamStack << " - ";
-            pushParameter(-*right.getParameter());  // make it positive
+            pushOperandParameter(op, -*right.getParameter());  // make it positive
         }
     }
 
@@ -1471,20 +1598,20 @@ protected:
         if (right.getParameter() == nullptr || (*right.getParameter() >= 0)) {
             bool encloseRight = encloseInParenthesesMul(right.getOperation());
 
-            push(left);
+            pushOperand(op, left);
             _streamStack << " - ";
             if (encloseRight) {
                 _streamStack << "(";
             }
-            push(right);
+            pushOperand(op, right);
             if (encloseRight) {
                 _streamStack << ")";
             }
         } else {
             // right has a negative parameter so we would get v0 - -v1
-            push(left);
+            pushOperand(op, left);
             _streamStack << " + ";
-            pushParameter(-*right.getParameter());  // make it positive
+            pushOperandParameter(op, -*right.getParameter());  // make it positive
         }
     }
 
@@ -1550,7 +1677,7 @@ protected:
         if (encloseLeft) {
             _streamStack << "(";
         }
-        push(left);
+        pushOperand(op, left);
         if (encloseLeft) {
             _streamStack << ")";
         }
@@ -1558,7 +1685,7 @@ protected:
         if (encloseRight) {
             _streamStack << "(";
         }
-        push(right);
+        pushOperand(op, right);
         if (encloseRight) {
             _streamStack << ")";
         }
@@ -1577,12 +1704,63 @@ protected:
         } else {
             _streamStack << " ";  // there may be several - together -> space required
         }
-        push(arg);
+        pushOperand(op, arg);
         if (enclose) {
             _streamStack << ")";
         }
     }
 
+    /**
+     * Whether or not an operation is evaluated with a reduced precision
+     */
+    inline bool isReducedPrecision(const Node& node) const {
+        return !_reducedPrecisionNodes.empty() &&
+               MixedPrecisionSelector<Base>::isReducibleOperation(node.getOperationType()) &&
+               _reducedPrecisionNodes.find(&node) != _reducedPrecisionNodes.end();
+    }
+
+    /**
+     * Registers a temporary variable which may require a declaration
+     */
+    inline void addTemporary(Node& node) {
+        size_t id = getVariableID(node);
+        _temporary[id] = &node;
+        if (!isReducedPrecision(node)) {
+            _temporaryFullPrecision.insert(id);
+        }
+    }
+
+    /**
+     * Prints an argument of an operation converting it to the reduced
+     * precision type if required
+     */
+    virtual unsigned pushOperand(const Node& op, const Arg& arg) {
+        if (!isReducedPrecision(op)) {
+            return push(arg);
+        } else if (arg.getOperation() == nullptr) {
+            pushOperandParameter(op, *arg.getParameter());
+            return 1;
+        } else if (isReducedPrecision(*arg.getOperation()) && getVariableID(*arg.getOperation()) == 0) {
+            return push(arg);  // an expression which already uses the reduced precision
+        }
+
+        _streamStack << "(" << _reducedPrecisionTypeName << ") ";
+        if (getVariableID(*arg.getOperation()) > 0) {
+            return push(arg);
+        }
+        _streamStack << "(";
+        unsigned lines = push(arg);
+        _streamStack << ")";
+        return lines;
+    }
+
+    virtual void pushOperandParameter(const Node& op, const Base& value) {
+        if (isReducedPrecision(op)) {
+            _streamStack << "(" << _reducedPrecisionTypeName << ") ";
+        }
+        pushParameter(value);
+    }
+
     virtual void pushPrintOperation(const Node& node) {
         CPPADCG_ASSERT_KNOWN(node.getOperationType() == CGOpCode::Pri, "Invalid node type")
         CPPADCG_ASSERT_KNOWN(node.getArguments().size() >= 1, "Invalid number of arguments for print operation")
@@ -1805,7 +1983,50 @@ protected:
             iterationCount = oss.str();
         }
 
-        _streamStack << _spaces << "for(" << jj << " = 0; " << jj << " < " << iterationCount << "; " << jj << "++) {\n";
+        bool vectorize = false;
+        std::vector<Node*> gather;
+        if (_simdLoops) {
+            std::vector<Node*> body = findLoopBody(lnode);
+            vectorize = isVectorizableLoop(lnode, body);
+            if (vectorize && lnode.getIterationCountNode() == nullptr &&
+                lnode.getIterationCount() <= _maxSimdGatherSize) {
+                gather = findGatherIndependents(lnode, body);
+            }
+        }
+
+        std::string loopSpaces = _spaces;
+        _loopBlocks.push_back(!gather.empty());
+        if (!gather.empty()) {
+            // copy the values into contiguous arrays (a block limits their scope)
+            _streamStack << _spaces << "{\n";
+            _indentation += _spaces;
+            loopSpaces += _spaces;
+
+            for (size_t g = 0; g < gather.size(); ++g) {
+                _streamStack << loopSpaces << _baseTypeName << " " << _C_GATHER_ARRAY << g << "[" << iterationCount
+                             << "];\n";
+            }
+            for (size_t g = 0; g < gather.size(); ++g) {
+                Node& indep = *gather[g];
+                const IndexPattern* ip = _info->loopIndependentIndexPatterns[indep.getInfo()[1]];
+                std::string name = _C_GATHER_ARRAY + std::to_string(g);
+                _streamStack << loopSpaces << "for(" << jj << " = 0; " << jj << " < " << iterationCount << "; " << jj
+                             << "++) " << name << "[" << jj << "] = "
+                             << _nameGen->generateIndexedIndependent(indep, getVariableID(indep), *ip) << ";\n";
+                _gatheredIndependents[&indep] = name;
+            }
+        }
+
+        if (vectorize) {
+            _streamStack << "#if defined(__clang__)\n"
+                            "#pragma clang loop vectorize(assume_safety)\n"
+                            "#elif defined(__GNUC__)\n"
+                            "#pragma GCC ivdep\n"
+                            "#endif\n";
+        }
+
+        _streamStack << loopSpaces << "for(" << jj << " = 0; " << jj << " < " << iterationCount << "; " << jj
+                     << "++) {\n";
         _indentation += _spaces;
     }
 
@@ -1816,9 +2037,43 @@ protected:
 
         _streamStack << _indentation << "}\n";
 
+        if (_loopBlocks.back()) {
+            _indentation.resize(_indentation.size() - _spaces.size());
+            _streamStack << _indentation << "}\n";
+            _gatheredIndependents.clear();
+        }
+
+        _loopBlocks.pop_back();
         _currentLoops.pop_back();
     }
 
+    /**
+     * Provides the operations evaluated inside a loop (in the evaluation
+     * order) excluding the loop start and end.
+     */
+    virtual std::vector<Node*> findLoopBody(const LoopStartOperationNode<Base>& loopStart) const;
+
+    /**
+     * Determines whether or not the iterations of a loop can be evaluated
+     * concurrently with SIMD instructions.
+     *
+     * @param loopStart the loop start operation
+     * @param body the operations evaluated inside the loop
+     */
+    virtual bool isVectorizableLoop(const LoopStartOperationNode<Base>& loopStart,
+                                    const std::vector<Node*>& body) const;
+
+    /**
+     * Determines the indexed independents of a loop which are not accessed
+     * with an affine index and should be copied into contiguous arrays
+     * before the loop.
+     *
+     * @param loopStart the loop start operation
+     * @param body the operations evaluated inside the loop
+     */
+    virtual std::vector<Node*> findGatherIndependents(const LoopStartOperationNode<Base>& loopStart,
+                                                      const std::vector<Node*>& body) const;
+
     virtual size_t printLoopIndexDeps(const std::vector<Node*>& variableOrder, size_t pos);
 
     virtual size_t printLoopIndexedDepsUsingLoop(const std::vector<Node*>& variableOrder, size_t starti);
@@ -1831,6 +2086,12 @@ protected:
                              "Invalid number of information elements for loop indexed independent operation")
 
         // CGLoopIndexedIndepOp
+        auto itGather = _gatheredIndependents.find(&node);
+        if (itGather != _gatheredIndependents.end()) {
+            _streamStack << itGather->second << "[" << *_currentLoops.back()->getIndex().getName() << "]";
+            return;
+        }
+
         size_t pos = node.getInfo()[1];
         const IndexPattern* ip = _info->loopIndependentIndexPatterns[pos];
         _streamStack << _nameGen->generateIndexedIndependent(node, getVariableID(node), *ip);
@@ -1898,12 +2159,37 @@ protected:
                              "Invalid argument for an 'if start' operation")
 
         _streamStack << _indentation << "if(";
-        pushIndexCondExprOp(*node.getArguments()[0].getOperation());
+        Node& cond = *node.getArguments()[0].getOperation();
+        if (isBranchCondition(cond)) {
+            push(cond.getArguments()[0]);
+            _streamStack << " " << getComparison(cond.getOperationType()) << " ";
+            push(cond.getArguments()[1]);
+        } else {
+            pushIndexCondExprOp(cond);
+        }
         _streamStack << ") {\n";
 
         _indentation += _spaces;
     }
 
+    /**
+     * Whether or not a node is a comparison used as the condition of an if
+     * (see LazyBranchLowering)
+     */
+    static inline bool isBranchCondition(const Node& node) {
+        switch (node.getOperationType()) {
+            case CGOpCode::ComLt:
+            case CGOpCode::ComLe:
+            case CGOpCode::ComEq:
+            case CGOpCode::ComGe:
+            case CGOpCode::ComGt:
+            case CGOpCode::ComNe:
+                return node.getArguments().size() == 2;
+            default:
+                return false;
+        }
+    }
+
     virtual void pushElseIf(Node& node) {
         /**
          * the first argument is the condition, the second argument is the
@@ -1969,6 +2255,88 @@ protected:
         throw CGException("Unable to generate C source code for user custom operation nodes.");
     }
 
+    virtual void pushOutlinedCall(Node& node) {
+        CPPADCG_ASSERT_KNOWN(node.getOperationType() == CGOpCode::OutlinedCall, "Invalid node type")
+        CPPADCG_ASSERT_KNOWN(node.getInfo().size() == 1, "Invalid number of information elements for an outlined call")
+
+        size_t index = node.getInfo()[0];
+        CPPADCG_ASSERT_KNOWN(index < _outlinedFunctionSources.size(), "Invalid outlined function index")
+
+        if (_outlinedFunctionsUsed.insert(index).second) {
+            _outlinedAssignments += _outlinedFunctionAssignments[index];
+        }
+
+        const std::vector<Arg>& args = node.getArguments();
+        _streamStack << outlinedFunctionName(index) << "(";
+        for (size_t a = 0; a < args.size(); a++) {
+            if (a > 0) _streamStack << ", ";
+            push(args[a]);
+        }
+        _streamStack << ")";
+    }
+
+    virtual std::string outlinedFunctionName(size_t index) const {
+        return _functionName + "__outlined" + std::to_string(index);
+    }
+
+    /**
+     * Generates the source code for the functions shared by repeated
+     * subgraphs.
+     * Each function returns the value of its subgraph and receives each
+     * subgraph input as a scalar argument.
+     */
+    virtual void generateOutlinedFunctionSources() {
+        const auto& functions = _info->outlinedFunctions;
+        _outlinedFunctionSources.resize(functions.size());
+        _outlinedFunctionAssignments.resize(functions.size());
+
+        for (size_t f = 0; f < functions.size(); ++f) {
+            OutlinedFunction<Base>& fun = *functions[f];
+
+            std::vector<std::string> argNames(fun.getArgumentCount());
+            std::vector<std::string> argDcl(fun.getArgumentCount());
+            for (size_t j = 0; j < argNames.size(); ++j) {
+                argNames[j] = "x" + std::to_string(j);
+                argDcl[j] = _baseTypeName + " " + argNames[j];
+            }
+
+            LangCCustomVariableNameGenerator<Base> nameGen({"y"}, argNames);
+            LanguageC<Base> lang(_baseTypeName, _spaces.size());
+            lang.setParameterPrecision(_parameterPrecision);
+            lang.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
+
+            std::ostringstream body;
+            std::vector<CG<Base>> y{fun.getResult()};
+            fun.getHandler().generateCode(body, lang, y, nameGen);
+
+            std::string code = body.str();
+            // the definition of the function accounts for the operations of the outlined subgraph
+            _outlinedFunctionAssignments[f] = fun.getOperationCount();
+
+            std::ostringstream os;
+            printFunctionDeclaration(os, "static " + _baseTypeName, outlinedFunctionName(f), argDcl);
+            os << " {\n" << _spaces << _baseTypeName << " y;\n";
+            size_t nTmp = nameGen.getMaxTemporaryVariableID() + 1 - nameGen.getMinTemporaryVariableID();
+            if (nTmp > 0) {
+                os << _spaces << _baseTypeName << " v[" << nTmp << "];\n";
+            }
+            os << "\n" << code << "\n" << _spaces << "return y;\n}\n\n";
+
+            _outlinedFunctionSources[f] = os.str();
+        }
+    }
+
+    /**
+     * Prints the definition of the outlined functions used by the current
+     * function.
+     */
+    virtual void printOutlinedFunctions(std::ostream& out) {
+        for (size_t index : _outlinedFunctionsUsed) {
+            out << _outlinedFunctionSources[index];
+        }
+        _outlinedFunctionsUsed.clear();
+    }
+
     inline bool isDependent(const Node& arg) const {
         if (arg.getOperationType() == CGOpCode::LoopIndexedDep) {
             return true;
@@ -2110,6 +2478,9 @@ const std::string LanguageC<Base>::_C_STATIC_INDEX_ARRAY = "index";  // NOLINT(c
 template <class Base>
 const std::string LanguageC<Base>::_C_SPARSE_INDEX_ARRAY = "idx";  // NOLINT(cert-err58-cpp)
 
+template <class Base>
+const std::string LanguageC<Base>::_C_GATHER_ARRAY = "gx";  // NOLINT(cert-err58-cpp)
+
 template <class Base>
 const std::string LanguageC<Base>::_ATOMIC_TX = "atx";  // NOLINT(cert-err58-cpp)
 
@@ -169,6 +169,147 @@ inline size_t LanguageC<Base>::printLoopIndexedDepsUsingLoop(const std::vector<O
     return i - 1;
 }
 
+template <class Base>
+std::vector<OperationNode<Base>*> LanguageC<Base>::findLoopBody(const LoopStartOperationNode<Base>& loopStart) const {
+    const std::vector<Node*>& variableOrder = _info->variableOrder;
+
+    std::vector<Node*> body;
+    auto it = std::find(variableOrder.begin(), variableOrder.end(), &loopStart);
+    if (it == variableOrder.end()) return body;
+
+    for (++it; it != variableOrder.end(); ++it) {
+        Node* node = *it;
+        if (node->getOperationType() == CGOpCode::LoopEnd && node->getArguments()[0].getOperation() == &loopStart) {
+            return body;
+        }
+        body.push_back(node);
+    }
+
+    return std::vector<Node*>();  // the loop end was not found
+}
+
+template <class Base>
+bool LanguageC<Base>::isVectorizableLoop(const LoopStartOperationNode<Base>& loopStart,
+                                         const std::vector<Node*>& body) const {
+    // temporary variables saved in an array would be shared by all iterations
+    if (body.empty() || _nameGen->getTemporary()[0].array) return false;
+
+    const Node& index = loopStart.getIndex();
+
+    /**
+     * dependents assigned inside the loop: y[dy * j + c]
+     */
+    long dy = 0;
+    std::vector<long> constants;
+
+    for (const Node* node : body) {
+        switch (node->getOperationType()) {
+            case CGOpCode::ArrayCreation:
+            case CGOpCode::SparseArrayCreation:
+            case CGOpCode::AtomicForward:
+            case CGOpCode::AtomicReverse:
+            case CGOpCode::DependentMultiAssign:
+            case CGOpCode::LoopStart:
+            case CGOpCode::Pri:
+                return false;
+
+            case CGOpCode::LoopIndexedDep: {
+                const std::vector<Arg>& args = node->getArguments();
+                if (args.size() != 2) return false;
+                const Node* idx = args[1].getOperation();
+                if (idx == nullptr || idx->getOperationType() != CGOpCode::Index ||
+                    &static_cast<const IndexOperationNode<Base>*>(idx)->getIndex() != &index) {
+                    return false;
+                }
+
+                const IndexPattern* ip = _info->loopDependentIndexPatterns[node->getInfo()[0]];
+                if (ip->getType() != IndexPatternType::Linear) return false;
+
+                const auto& lip = static_cast<const LinearIndexPattern&>(*ip);
+                if (lip.getLinearSlopeDx() != 1 || lip.getLinearSlopeDy() == 0) return false;
+                if (dy == 0) {
+                    dy = lip.getLinearSlopeDy();
+                } else if (dy != lip.getLinearSlopeDy()) {
+                    return false;
+                }
+                constants.push_back(lip.getLinearConstantTerm() - dy * lip.getXOffset());
+                break;
+            }
+
+            default:
+                if (isDependent(*node)) return false;  // the same element would be assigned by all iterations
+        }
+    }
+
+    if (constants.size() < 2) return true;
+
+    /**
+     * elements assigned by different iterations must not overlap:
+     *   dy * j1 + c1 != dy * j2 + c2  for all j1 != j2
+     */
+    const long step = std::abs(dy);
+    const bool knownIterations = loopStart.getIterationCountNode() == nullptr;
+    const long span = step * long(loopStart.getIterationCount());
+
+    auto residue = [step](long c) { return ((c % step) + step) % step; };
+
+    std::sort(constants.begin(), constants.end(), [&](long c1, long c2) {
+        long r1 = residue(c1);
+        long r2 = residue(c2);
+        return r1 < r2 || (r1 == r2 && c1 < c2);
+    });
+    constants.erase(std::unique(constants.begin(), constants.end()), constants.end());
+
+    for (size_t k = 1; k < constants.size(); ++k) {
+        if (residue(constants[k - 1]) != residue(constants[k])) continue;
+        if (!knownIterations || constants[k] - constants[k - 1] < span) return false;
+    }
+
+    return true;
+}
+
+template <class Base>
+std::vector<OperationNode<Base>*> LanguageC<Base>::findGatherIndependents(
+        const LoopStartOperationNode<Base>& loopStart,
+        const std::vector<Node*>& body) const {
+    const Node& index = loopStart.getIndex();
+
+    std::vector<Node*> gather;
+    std::set<const Node*> visited;
+    std::vector<Node*> work(body.rbegin(), body.rend());
+
+    while (!work.empty()) {
+        Node* node = work.back();
+        work.pop_back();
+        if (!visited.insert(node).second) continue;
+
+        CGOpCode op = node->getOperationType();
+        if (op == CGOpCode::LoopIndexedIndep) {
+            const std::vector<Arg>& args = node->getArguments();
+            const Node* idx = args.size() == 1 ? args[0].getOperation() : nullptr;
+            if (idx == nullptr || idx->getOperationType() != CGOpCode::Index ||
+                &static_cast<const IndexOperationNode<Base>*>(idx)->getIndex() != &index) {
+                continue;  // not indexed directly by the loop iteration index
+            }
+
+            const IndexPattern* ip = _info->loopIndependentIndexPatterns[node->getInfo()[1]];
+            if (ip->getType() == IndexPatternType::Linear &&
+                static_cast<const LinearIndexPattern*>(ip)->getLinearSlopeDx() == 1) {
+                continue;  // affine access
+            }
+
+            gather.push_back(node);
+
+        } else if (op != CGOpCode::LoopStart && op != CGOpCode::LoopEnd && op != CGOpCode::IndexDeclaration) {
+            for (const Arg& a : node->getArguments()) {
+                if (a.getOperation() != nullptr) work.push_back(a.getOperation());
+            }
+        }
+    }
+
+    return gather;
+}
+
 }  // namespace cg
 }  // namespace CppAD
 
@@ -107,6 +107,10 @@ public:
      * executing the operation graph
      */
     const bool zeroDependents;
+    /**
+     * functions shared by repeated subgraphs (called by CGOpCode::OutlinedCall nodes)
+     */
+    const std::vector<std::unique_ptr<OutlinedFunction<Base>>>& outlinedFunctions;
 
 public:
     LanguageGenerationData(const std::vector<Node*>& ind,
@@ -128,7 +132,8 @@ public:
                            const CodeHandlerVector<Base, size_t>& totalUseCount,
                            const CodeHandlerVector<Base, ScopeIDType>& scope,
                            IndexOperationNode<Base>& auxIterationIndexOp,
-                           bool zero)
+                           bool zero,
+                           const std::vector<std::unique_ptr<OutlinedFunction<Base>>>& outlined)
         : independent(ind),
           dependent(dep),
           minTemporaryVarID(minTempVID),
@@ -148,7 +153,8 @@ public:
           totalUseCount(totalUseCount),
           scope(scope),
           auxIterationIndexOp(auxIterationIndexOp),
-          zeroDependents(zero) {}
+          zeroDependents(zero),
+          outlinedFunctions(outlined) {}
 };
 
 /**
@@ -0,0 +1,751 @@
+#ifndef CPPAD_CG_LANGUAGE_LLVM_INCLUDED
+#define CPPAD_CG_LANGUAGE_LLVM_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Generates LLVM IR directly from the operation graph (no C source code is
+ * created and parsed).
+ *
+ * A function with the same signature as the functions of a model library
+ * generated by LanguageC
+ * @code
+ * void name(Base const *const * in, Base * const * out, struct LangCAtomicFun atomicFun)
+ * @endcode
+ * is added to an LLVM module (the atomic function context follows the C
+ * calling convention of the host process).
+ * The independent variables are read from the arrays in @p in following the
+ * order of the independent arrays of the variable name generator
+ * (VariableNameGenerator::getIndependent()), while the dependent variable
+ * @c i is saved in @c out[0][i].
+ * Atomic functions are called through @c atomicFun with the indexes defined
+ * by the list of atomic function names given to the code handler.
+ *
+ * Loops, if/else branches and outlined functions are rejected with a
+ * CGException.
+ *
+ * @author Feng Yang
+ */
+template <class Base>
+class LanguageLlvm : public Language<Base> {
+public:
+    using Node = OperationNode<Base>;
+    using Arg = Argument<Base>;
+
+protected:
+    /**
+     * the module where the function is created
+     */
+    llvm::Module& _module;
+    /**
+     * the name of the generated function
+     */
+    std::string _functionName;
+    /**
+     * the maximum number of operations in an expression before a value is
+     * reused (limits the recursion depth)
+     */
+    size_t _maxOperationsPerValue;
+    /**
+     * the created function (the last one)
+     */
+    llvm::Function* _function;
+    /**
+     * information from the code handler (not owned)
+     */
+    LanguageGenerationData<Base>* _info;
+    /**
+     * the floating point type
+     */
+    llvm::Type* _baseType;
+    /**
+     * the value of each operation which was already emitted
+     */
+    std::unordered_map<const Node*, llvm::Value*> _values;
+    /**
+     * the pointer to the first element of each independent array
+     */
+    std::vector<llvm::Value*> _inArrays;
+    /**
+     * the C unsigned long type (array sizes and indexes)
+     */
+    llvm::IntegerType* _indexType;
+    /**
+     * the C Array structure used by atomic functions
+     */
+    llvm::StructType* _arrayType;
+    /**
+     * the C LangCAtomicFun structure
+     */
+    llvm::StructType* _atomicFunType;
+    llvm::FunctionType* _atomicForwardType;
+    llvm::FunctionType* _atomicReverseType;
+    /**
+     * the pointer to the atomic function context (function argument)
+     */
+    llvm::Value* _atomicFun;
+    /**
+     * the indexes of the non-zero elements of each sparse array
+     */
+    std::unordered_map<const Node*, llvm::Value*> _sparseIndexes;
+    /**
+     * the array with the values of an output array after an atomic function
+     * call (the atomic function operation and the output array)
+     */
+    std::map<std::pair<const Node*, const Node*>, llvm::Value*> _atomicOutputs;
+
+public:
+    /**
+     * @param module the LLVM module where the function is added
+     * @param functionName the name of the function to create
+     */
+    inline LanguageLlvm(llvm::Module& module, std::string functionName)
+        : _module(module),
+          _functionName(std::move(functionName)),
+          _maxOperationsPerValue(1000),
+          _function(nullptr),
+          _info(nullptr),
+          _baseType(nullptr),
+          _indexType(nullptr),
+          _arrayType(nullptr),
+          _atomicFunType(nullptr),
+          _atomicForwardType(nullptr),
+          _atomicReverseType(nullptr),
+          _atomicFun(nullptr) {
+        CPPADCG_ASSERT_KNOWN(!_functionName.empty(), "Invalid function name")
+    }
+
+    inline virtual ~LanguageLlvm() = default;
+
+    inline const std::string& getFunctionName() const { return _functionName; }
+
+    inline void setFunctionName(const std::string& functionName) { _functionName = functionName; }
+
+    inline size_t getMaxOperationsPerValue() const { return _maxOperationsPerValue; }
+
+    inline void setMaxOperationsPerValue(size_t maxOperations) { _maxOperationsPerValue = maxOperations; }
+
+    /**
+     * @return the last function created by this object (owned by the module)
+     */
+    inline llvm::Function* getFunction() const { return _function; }
+
+protected:
+    void generateSourceCode(std::ostream& out, std::unique_ptr<LanguageGenerationData<Base>> info) override {
+        _info = info.get();
+        clearGenerationState();
+
+        if (!_info->loopDependentIndexPatterns.empty() || !_info->loopIndependentIndexPatterns.empty()) {
+            throw CGException("LanguageLlvm does not support loops");
+        } else if (!_info->outlinedFunctions.empty()) {
+            throw CGException("LanguageLlvm does not support outlined functions");
+        }
+
+        if (_module.getFunction(_functionName) != nullptr) {
+            throw CGException("A function named '", _functionName, "' already exists in the LLVM module");
+        }
+
+        llvm::LLVMContext& context = _module.getContext();
+        _baseType = std::is_same<Base, float>::value ? llvm::Type::getFloatTy(context)
+                                                     : llvm::Type::getDoubleTy(context);
+        createAtomicTypes(context);
+
+        llvm::PointerType* ptrType = llvm::PointerType::getUnqual(_baseType);
+        llvm::PointerType* ptrPtrType = llvm::PointerType::getUnqual(ptrType);
+        llvm::PointerType* atomicFunPtrType = llvm::PointerType::getUnqual(_atomicFunType);
+
+        llvm::FunctionType* funcType = llvm::FunctionType::get(llvm::Type::getVoidTy(context),
+                                                               {ptrPtrType, ptrPtrType, atomicFunPtrType}, false);
+        _function = llvm::Function::Create(funcType, llvm::Function::ExternalLinkage, _functionName, &_module);
+        _function->addFnAttr(llvm::Attribute::NoUnwind);
+
+        auto argIt = _function->arg_begin();
+        llvm::Argument* inArg = &*argIt++;
+        llvm::Argument* outArg = &*argIt++;
+        llvm::Argument* atomicArg = &*argIt;
+        inArg->setName("in");
+        outArg->setName("out");
+        atomicArg->setName("atomicFun");
+        if (isAtomicFunPassedByValue()) {
+            // the struct is copied to the stack by the caller
+            _function->addParamAttr(2, llvm::Attribute::getWithByValType(context, _atomicFunType));
+        }
+        _atomicFun = atomicArg;
+
+        llvm::IRBuilder<> builder(llvm::BasicBlock::Create(context, "entry", _function));
+
+        try {
+            /**
+             * independent arrays
+             */
+            const std::vector<FuncArgument>& indArg = _info->nameGen.getIndependent();
+            for (size_t a = 0; a < indArg.size(); a++) {
+                llvm::Value* p = builder.CreateInBoundsGEP(ptrType, inArg, builder.getInt64(a));
+                _inArrays.push_back(builder.CreateLoad(ptrType, p, indArg[a].name));
+            }
+
+            for (Node* node : _info->independent) {
+                _values[node] = loadIndependent(builder, *node);
+            }
+
+            /**
+             * operations in the evaluation order
+             */
+            for (Node* node : _info->variableOrder) {
+                emit(builder, *node);
+            }
+
+            /**
+             * dependent variables
+             */
+            llvm::Value* yp = builder.CreateInBoundsGEP(ptrType, outArg, builder.getInt64(0));
+            llvm::Value* y = builder.CreateLoad(ptrType, yp, "y");
+            const ArrayView<CG<Base>>& dependent = _info->dependent;
+            for (size_t i = 0; i < dependent.size(); i++) {
+                llvm::Value* value;
+                if (dependent[i].getOperationNode() != nullptr) {
+                    value = emit(builder, *dependent[i].getOperationNode());
+                } else {
+                    value = llvm::ConstantFP::get(_baseType, double(dependent[i].getValue()));
+                }
+                builder.CreateStore(value, builder.CreateInBoundsGEP(_baseType, y, builder.getInt64(i)));
+            }
+
+            builder.CreateRetVoid();
+
+            std::string errors;
+            llvm::raw_string_ostream errorStream(errors);
+            if (llvm::verifyFunction(*_function, &errorStream)) {
+                throw CGException("Invalid LLVM function '", _functionName, "': ", errorStream.str());
+            }
+        } catch (...) {
+            _function->eraseFromParent();
+            _function = nullptr;
+            _info = nullptr;
+            clearGenerationState();
+            throw;
+        }
+
+        // print the IR (useful for debugging)
+        llvm::raw_os_ostream os(out);
+        _function->print(os);
+
+        _info = nullptr;
+        clearGenerationState();
+    }
+
+    inline void clearGenerationState() {
+        _values.clear();
+        _inArrays.clear();
+        _sparseIndexes.clear();
+        _atomicOutputs.clear();
+        _atomicFun = nullptr;
+    }
+
+    /**
+     * Creates the types of the C structures used to call atomic functions
+     * (Array and LangCAtomicFun defined in LanguageC::ATOMICFUN_STRUCT_DEFINITION).
+     */
+    virtual void createAtomicTypes(llvm::LLVMContext& context) {
+        _indexType = llvm::Type::getIntNTy(context, 8 * sizeof(unsigned long));
+        llvm::IntegerType* intType = llvm::Type::getIntNTy(context, 8 * sizeof(int));
+        llvm::PointerType* voidPtrType = llvm::PointerType::getUnqual(llvm::Type::getInt8Ty(context));
+
+        _arrayType = llvm::StructType::getTypeByName(context, "struct.Array");
+        if (_arrayType == nullptr) {
+            _arrayType = llvm::StructType::create(
+                    context,
+                    {voidPtrType, _indexType, intType, llvm::PointerType::getUnqual(_indexType), _indexType},
+                    "struct.Array");
+        }
+        llvm::PointerType* arrayPtrType = llvm::PointerType::getUnqual(_arrayType);
+
+        _atomicForwardType = llvm::FunctionType::get(
+                intType, {voidPtrType, intType, intType, intType, arrayPtrType, arrayPtrType}, false);
+        _atomicReverseType = llvm::FunctionType::get(
+                intType, {voidPtrType, intType, intType, arrayPtrType, arrayPtrType, arrayPtrType}, false);
+
+        _atomicFunType = llvm::StructType::getTypeByName(context, "struct.LangCAtomicFun");
+        if (_atomicFunType == nullptr) {
+            _atomicFunType = llvm::StructType::create(context,
+                                                      {voidPtrType, llvm::PointerType::getUnqual(_atomicForwardType),
+                                                       llvm::PointerType::getUnqual(_atomicReverseType)},
+                                                      "struct.LangCAtomicFun");
+        }
+    }
+
+    /**
+     * Whether or not the C calling convention passes the LangCAtomicFun
+     * structure in the stack (byval pointer) instead of a pointer to a copy
+     * created by the caller.
+     */
+    virtual bool isAtomicFunPassedByValue() const {
+#if LLVM_VERSION_MAJOR >= 21
+        llvm::Triple triple = _module.getTargetTriple();
+        if (triple.str().empty()) triple = llvm::Triple(llvm::sys::getProcessTriple());
+#else
+        std::string tripleName = _module.getTargetTriple();
+        llvm::Triple triple(tripleName.empty() ? llvm::sys::getProcessTriple() : tripleName);
+#endif
+        return (triple.getArch() == llvm::Triple::x86_64 || triple.getArch() == llvm::Triple::x86) &&
+               !triple.isOSWindows();
+    }
+
+    bool createsNewVariable(const Node& var, size_t totalUseCount, size_t opCount) const override {
+        CGOpCode op = var.getOperationType();
+        return (totalUseCount > 1 || opCount >= _maxOperationsPerValue) && op != CGOpCode::Pri;
+    }
+
+    bool requiresVariableArgument(enum CGOpCode op, size_t argIndex) const override { return false; }
+
+    bool requiresVariableDependencies() const override { return false; }
+
+    virtual llvm::Value* loadIndependent(llvm::IRBuilder<>& builder, const Node& node) {
+        VariableNameGenerator<Base>& nameGen = _info->nameGen;
+        size_t id = _info->varId[node];
+
+        const std::string& arrayName = nameGen.getIndependentArrayName(node, id);
+        size_t index = nameGen.getIndependentArrayIndex(node, id);
+
+        const std::vector<FuncArgument>& indArg = nameGen.getIndependent();
+        for (size_t a = 0; a < indArg.size(); a++) {
+            if (indArg[a].name == arrayName) {
+                llvm::Value* p = builder.CreateInBoundsGEP(_baseType, _inArrays[a], builder.getInt64(index));
+                return builder.CreateLoad(_baseType, p);
+            }
+        }
+
+        throw CGException("Unknown independent variable array '", arrayName, "'");
+    }
+
+    virtual llvm::Value* emit(llvm::IRBuilder<>& builder, const Arg& arg) {
+        if (arg.getOperation() != nullptr) {
+            return emit(builder, *arg.getOperation());
+        } else {
+            return llvm::ConstantFP::get(_baseType, double(*arg.getParameter()));
+        }
+    }
+
+    virtual llvm::Value* emit(llvm::IRBuilder<>& builder, const Node& node) {
+        auto it = _values.find(&node);
+        if (it != _values.end()) return it->second;
+
+        llvm::Value* v = emitOperation(builder, node);
+        _values[&node] = v;
+        return v;
+    }
+
+    virtual llvm::Value* emitOperation(llvm::IRBuilder<>& builder, const Node& node) {
+        const std::vector<Arg>& args = node.getArguments();
+        CGOpCode op = node.getOperationType();
+
+        switch (op) {
+            case CGOpCode::Alias:
+            case CGOpCode::Assign:
+            case CGOpCode::Pri:
+                CPPADCG_ASSERT_KNOWN(!args.empty(), "Invalid number of arguments")
+                return emit(builder, args[0]);
+
+            case CGOpCode::Add:
+                return builder.CreateFAdd(emit(builder, args[0]), emit(builder, args[1]));
+            case CGOpCode::Sub:
+                return builder.CreateFSub(emit(builder, args[0]), emit(builder, args[1]));
+            case CGOpCode::Mul:
+                return builder.CreateFMul(emit(builder, args[0]), emit(builder, args[1]));
+            case CGOpCode::Div:
+                return builder.CreateFDiv(emit(builder, args[0]), emit(builder, args[1]));
+            case CGOpCode::UnMinus:
+                return builder.CreateFNeg(emit(builder, args[0]));
+
+            case CGOpCode::Abs:
+                return callIntrinsic(builder, llvm::Intrinsic::fabs, {emit(builder, args[0])});
+            case CGOpCode::Sqrt:
+                return callIntrinsic(builder, llvm::Intrinsic::sqrt, {emit(builder, args[0])});
+            case CGOpCode::Exp:
+                return callIntrinsic(builder, llvm::Intrinsic::exp, {emit(builder, args[0])});
+            case CGOpCode::Log:
+                return callIntrinsic(builder, llvm::Intrinsic::log, {emit(builder, args[0])});
+            case CGOpCode::Sin:
+                return callIntrinsic(builder, llvm::Intrinsic::sin, {emit(builder, args[0])});
+            case CGOpCode::Cos:
+                return callIntrinsic(builder, llvm::Intrinsic::cos, {emit(builder, args[0])});
+            case CGOpCode::Pow:
+                return callIntrinsic(builder, llvm::Intrinsic::pow, {emit(builder, args[0]), emit(builder, args[1])});
+
+            case CGOpCode::Acos:
+            case CGOpCode::Acosh:
+            case CGOpCode::Asin:
+            case CGOpCode::Asinh:
+            case CGOpCode::Atan:
+            case CGOpCode::Atanh:
+            case CGOpCode::Cosh:
+            case CGOpCode::Erf:
+            case CGOpCode::Erfc:
+            case CGOpCode::Expm1:
+            case CGOpCode::Log1p:
+            case CGOpCode::Sinh:
+            case CGOpCode::Tan:
+            case CGOpCode::Tanh:
+                return callMathFunction(builder, op, emit(builder, args[0]));
+
+            case CGOpCode::Sign: {
+                llvm::Value* x = emit(builder, args[0]);
+                llvm::Value* zero = llvm::ConstantFP::get(_baseType, 0.0);
+                llvm::Value* neg = builder.CreateSelect(builder.CreateFCmpOLT(x, zero),
+                                                        llvm::ConstantFP::get(_baseType, -1.0), zero);
+                return builder.CreateSelect(builder.CreateFCmpOGT(x, zero), llvm::ConstantFP::get(_baseType, 1.0), neg);
+            }
+
+            case CGOpCode::ComLt:
+            case CGOpCode::ComLe:
+            case CGOpCode::ComEq:
+            case CGOpCode::ComGe:
+            case CGOpCode::ComGt:
+            case CGOpCode::ComNe: {
+                CPPADCG_ASSERT_KNOWN(args.size() == 4, "Invalid number of arguments for a conditional expression")
+                llvm::Value* cond = compare(builder, op, emit(builder, args[0]), emit(builder, args[1]));
+                return builder.CreateSelect(cond, emit(builder, args[2]), emit(builder, args[3]));
+            }
+
+            case CGOpCode::ArrayCreation:
+                return createArray(builder, node);
+            case CGOpCode::SparseArrayCreation:
+                return createSparseArray(builder, node);
+            case CGOpCode::ArrayElement:
+                return loadArrayElement(builder, node);
+            case CGOpCode::AtomicForward:
+                return callAtomicForward(builder, node);
+            case CGOpCode::AtomicReverse:
+                return callAtomicReverse(builder, node);
+
+            default:
+                std::ostringstream ss;
+                ss << op;
+                throw CGException("LanguageLlvm does not support the operation '", ss.str(), "'");
+        }
+    }
+
+    /**
+     * Creates a stack array in the entry block of the function (so that it
+     * can be promoted to registers).
+     *
+     * @return a pointer to the first element
+     */
+    inline llvm::Value* createEntryArray(llvm::Type* type, size_t size) {
+        llvm::BasicBlock& entry = _function->getEntryBlock();
+        llvm::IRBuilder<> builder(&entry, entry.begin());
+        llvm::AllocaInst* alloca = builder.CreateAlloca(type, builder.getInt64(size));
+        return alloca;
+    }
+
+    /**
+     * Creates a new array with the values of the arguments of an array
+     * creation operation.
+     *
+     * @return a pointer to the first element (nullptr for empty arrays)
+     */
+    virtual llvm::Value* createArray(llvm::IRBuilder<>& builder, const Node& array) {
+        const std::vector<Arg>& args = array.getArguments();
+        if (args.empty()) return llvm::ConstantPointerNull::get(llvm::PointerType::getUnqual(_baseType));
+
+        llvm::Value* data = createEntryArray(_baseType, args.size());
+        for (size_t i = 0; i < args.size(); i++) {
+            llvm::Value* value = emit(builder, args[i]);
+            builder.CreateStore(value, builder.CreateInBoundsGEP(_baseType, data, builder.getInt64(i)));
+        }
+        return data;
+    }
+
+    /**
+     * Creates the array with the non-zero values of a sparse array creation
+     * operation (the indexes are saved in a constant global array).
+     *
+     * @return a pointer to the first non-zero value (nullptr for empty arrays)
+     */
+    virtual llvm::Value* createSparseArray(llvm::IRBuilder<>& builder, const Node& array) {
+        const std::vector<size_t>& info = array.getInfo();
+        const std::vector<Arg>& args = array.getArguments();
+        CPPADCG_ASSERT_KNOWN(info.size() == args.size() + 1,
+                             "Invalid number of arguments for sparse array creation operation")
+
+        if (args.empty()) {
+            _sparseIndexes[&array] = llvm::ConstantPointerNull::get(llvm::PointerType::getUnqual(_indexType));
+            return llvm::ConstantPointerNull::get(llvm::PointerType::getUnqual(_baseType));
+        }
+
+        std::vector<llvm::Constant*> indexes(args.size());
+        for (size_t i = 0; i < args.size(); i++) {
+            indexes[i] = llvm::ConstantInt::get(_indexType, info[i + 1]);
+        }
+        llvm::ArrayType* idxArrayType = llvm::ArrayType::get(_indexType, indexes.size());
+        auto* idx = new llvm::GlobalVariable(_module, idxArrayType, true, llvm::GlobalValue::PrivateLinkage,
+                                             llvm::ConstantArray::get(idxArrayType, indexes), "sparse_idx");
+        idx->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+        _sparseIndexes[&array] = builder.CreateConstInBoundsGEP2_64(idxArrayType, idx, 0, 0);
+
+        return createArray(builder, array);
+    }
+
+    virtual llvm::Value* loadArrayElement(llvm::IRBuilder<>& builder, const Node& op) {
+        const std::vector<Arg>& args = op.getArguments();
+        CPPADCG_ASSERT_KNOWN(args.size() == 2, "Invalid number of arguments for array element operation")
+        CPPADCG_ASSERT_KNOWN(args[0].getOperation() != nullptr, "Invalid argument for array element operation")
+        CPPADCG_ASSERT_KNOWN(op.getInfo().size() == 1,
+                             "Invalid number of information indexes for array element operation")
+
+        const Node& array = *args[0].getOperation();
+
+        llvm::Value* data = nullptr;
+        if (args[1].getOperation() != nullptr) {
+            // the array might have been changed by an atomic function
+            const Node& atomic = *args[1].getOperation();
+            emit(builder, atomic);
+            auto it = _atomicOutputs.find(std::make_pair(&atomic, &array));
+            if (it != _atomicOutputs.end()) data = it->second;
+        }
+        if (data == nullptr) data = emit(builder, array);
+
+        llvm::Value* p = builder.CreateInBoundsGEP(_baseType, data, builder.getInt64(op.getInfo()[0]));
+        return builder.CreateLoad(_baseType, p);
+    }
+
+    /**
+     * Saves the description of an array in a C Array structure.
+     *
+     * @param arrayStruct the pointer to the structure
+     * @param array the array creation operation
+     * @param data the pointer to the array values
+     */
+    virtual void storeArrayStruct(llvm::IRBuilder<>& builder,
+                                  llvm::Value* arrayStruct,
+                                  const Node& array,
+                                  llvm::Value* data) {
+        llvm::LLVMContext& context = _module.getContext();
+        llvm::PointerType* voidPtrType = llvm::PointerType::getUnqual(llvm::Type::getInt8Ty(context));
+        llvm::PointerType* idxPtrType = llvm::PointerType::getUnqual(_indexType);
+        llvm::Type* intType = _arrayType->getElementType(2);
+
+        bool sparse = array.getOperationType() == CGOpCode::SparseArrayCreation;
+        size_t nnz = array.getArguments().size();
+        size_t size = sparse ? array.getInfo()[0] : nnz;
+        llvm::Value* idx = sparse ? _sparseIndexes.at(&array) : llvm::ConstantPointerNull::get(idxPtrType);
+
+        builder.CreateStore(builder.CreateBitCast(data, voidPtrType),
+                            builder.CreateStructGEP(_arrayType, arrayStruct, 0));
+        builder.CreateStore(llvm::ConstantInt::get(_indexType, size), builder.CreateStructGEP(_arrayType, arrayStruct, 1));
+        builder.CreateStore(llvm::ConstantInt::get(intType, sparse ? 1 : 0),
+                            builder.CreateStructGEP(_arrayType, arrayStruct, 2));
+        builder.CreateStore(idx, builder.CreateStructGEP(_arrayType, arrayStruct, 3));
+        builder.CreateStore(llvm::ConstantInt::get(_indexType, sparse ? nnz : 0),
+                            builder.CreateStructGEP(_arrayType, arrayStruct, 4));
+    }
+
+    /**
+     * Creates the C Array structures for several arrays.
+     *
+     * @return a pointer to the first structure
+     */
+    inline llvm::Value* createArrayStructs(llvm::IRBuilder<>& builder, const std::vector<const Node*>& arrays) {
+        llvm::Value* structs = createEntryArray(_arrayType, arrays.size());
+        for (size_t k = 0; k < arrays.size(); k++) {
+            llvm::Value* data = emit(builder, *arrays[k]);
+            llvm::Value* s = builder.CreateInBoundsGEP(_arrayType, structs, builder.getInt64(k));
+            storeArrayStruct(builder, s, *arrays[k], data);
+        }
+        return structs;
+    }
+
+    /**
+     * Creates the C Array structure for an array modified by an atomic
+     * function (its initial values are copied to a new array so that the
+     * original array is not changed).
+     */
+    inline llvm::Value* createOutputArrayStruct(llvm::IRBuilder<>& builder, const Node& atomic, const Node& array) {
+        CPPADCG_ASSERT_KNOWN(array.getOperationType() == CGOpCode::ArrayCreation, "Invalid array type")
+
+        llvm::Value* data = createArray(builder, array);
+        _atomicOutputs[std::make_pair(&atomic, &array)] = data;
+
+        llvm::Value* s = createEntryArray(_arrayType, 1);
+        storeArrayStruct(builder, s, array, data);
+        return s;
+    }
+
+    inline llvm::Value* loadAtomicFunField(llvm::IRBuilder<>& builder, unsigned field) {
+        llvm::Value* p = builder.CreateStructGEP(_atomicFunType, _atomicFun, field);
+        return builder.CreateLoad(_atomicFunType->getElementType(field), p);
+    }
+
+    inline llvm::Value* atomicIndex(size_t id) {
+        llvm::Type* intType = _arrayType->getElementType(2);
+        return llvm::ConstantInt::get(intType, _info->atomicFunctionId2Index.at(id));
+    }
+
+    virtual llvm::Value* callAtomicForward(llvm::IRBuilder<>& builder, const Node& atomicFor) {
+        CPPADCG_ASSERT_KNOWN(atomicFor.getInfo().size() == 3,
+                             "Invalid number of information elements for atomic forward operation")
+        size_t id = atomicFor.getInfo()[0];
+        int q = atomicFor.getInfo()[1];
+        int p = atomicFor.getInfo()[2];
+        size_t p1 = p + 1;
+        const std::vector<Arg>& opArgs = atomicFor.getArguments();
+        CPPADCG_ASSERT_KNOWN(opArgs.size() == p1 * 2, "Invalid number of arguments for atomic forward operation")
+
+        std::vector<const Node*> tx(p1);
+        for (size_t k = 0; k < p1; k++) {
+            tx[k] = opArgs[0 * p1 + k].getOperation();
+        }
+        const Node& ty = *opArgs[1 * p1 + p].getOperation();
+
+        llvm::Value* txStructs = createArrayStructs(builder, tx);
+        llvm::Value* tyStruct = createOutputArrayStruct(builder, atomicFor, ty);
+
+        llvm::Type* intType = _arrayType->getElementType(2);
+        llvm::Value* libModel = loadAtomicFunField(builder, 0);
+        llvm::Value* forward = loadAtomicFunField(builder, 1);
+        return builder.CreateCall(_atomicForwardType, forward,
+                                  {libModel, atomicIndex(id), llvm::ConstantInt::get(intType, q),
+                                   llvm::ConstantInt::get(intType, p), txStructs, tyStruct});
+    }
+
+    virtual llvm::Value* callAtomicReverse(llvm::IRBuilder<>& builder, const Node& atomicRev) {
+        CPPADCG_ASSERT_KNOWN(atomicRev.getInfo().size() == 2,
+                             "Invalid number of information elements for atomic reverse operation")
+        size_t id = atomicRev.getInfo()[0];
+        int p = atomicRev.getInfo()[1];
+        size_t p1 = p + 1;
+        const std::vector<Arg>& opArgs = atomicRev.getArguments();
+        CPPADCG_ASSERT_KNOWN(opArgs.size() == p1 * 4, "Invalid number of arguments for atomic reverse operation")
+
+        std::vector<const Node*> tx(p1), py(p1);
+        for (size_t k = 0; k < p1; k++) {
+            tx[k] = opArgs[0 * p1 + k].getOperation();
+            py[k] = opArgs[3 * p1 + k].getOperation();
+        }
+        const Node& px = *opArgs[2 * p1].getOperation();
+
+        llvm::Value* txStructs = createArrayStructs(builder, tx);
+        llvm::Value* pyStructs = createArrayStructs(builder, py);
+        llvm::Value* pxStruct = createOutputArrayStruct(builder, atomicRev, px);
+
+        llvm::Type* intType = _arrayType->getElementType(2);
+        llvm::Value* libModel = loadAtomicFunField(builder, 0);
+        llvm::Value* reverse = loadAtomicFunField(builder, 2);
+        return builder.CreateCall(_atomicReverseType, reverse,
+                                  {libModel, atomicIndex(id), llvm::ConstantInt::get(intType, p), txStructs, pxStruct,
+                                   pyStructs});
+    }
+
+    virtual llvm::Value* compare(llvm::IRBuilder<>& builder, CGOpCode op, llvm::Value* left, llvm::Value* right) {
+        // same semantics as the C comparison operators
+        switch (op) {
+            case CGOpCode::ComLt:
+                return builder.CreateFCmpOLT(left, right);
+            case CGOpCode::ComLe:
+                return builder.CreateFCmpOLE(left, right);
+            case CGOpCode::ComEq:
+                return builder.CreateFCmpOEQ(left, right);
+            case CGOpCode::ComGe:
+                return builder.CreateFCmpOGE(left, right);
+            case CGOpCode::ComGt:
+                return builder.CreateFCmpOGT(left, right);
+            case CGOpCode::ComNe:
+                return builder.CreateFCmpUNE(left, right);
+            default:
+                CPPADCG_ASSERT_UNKNOWN(false)
+                throw CGException("Unknown comparison operation");
+        }
+    }
+
+    inline llvm::Value* callIntrinsic(llvm::IRBuilder<>& builder,
+                                      llvm::Intrinsic::ID id,
+                                      std::initializer_list<llvm::Value*> args) {
+#if LLVM_VERSION_MAJOR >= 20
+        llvm::Function* f = llvm::Intrinsic::getOrInsertDeclaration(&_module, id, {_baseType});
+#else
+        llvm::Function* f = llvm::Intrinsic::getDeclaration(&_module, id, {_baseType});
+#endif
+        return builder.CreateCall(f, args);
+    }
+
+    /**
+     * Calls a function from the C math library (libm)
+     */
+    inline llvm::Value* callMathFunction(llvm::IRBuilder<>& builder, CGOpCode op, llvm::Value* x) {
+        std::string name;
+        switch (op) {
+            case CGOpCode::Acos:
+                name = "acos";
+                break;
+            case CGOpCode::Acosh:
+                name = "acosh";
+                break;
+            case CGOpCode::Asin:
+                name = "asin";
+                break;
+            case CGOpCode::Asinh:
+                name = "asinh";
+                break;
+            case CGOpCode::Atan:
+                name = "atan";
+                break;
+            case CGOpCode::Atanh:
+                name = "atanh";
+                break;
+            case CGOpCode::Cosh:
+                name = "cosh";
+                break;
+            case CGOpCode::Erf:
+                name = "erf";
+                break;
+            case CGOpCode::Erfc:
+                name = "erfc";
+                break;
+            case CGOpCode::Expm1:
+                name = "expm1";
+                break;
+            case CGOpCode::Log1p:
+                name = "log1p";
+                break;
+            case CGOpCode::Sinh:
+                name = "sinh";
+                break;
+            case CGOpCode::Tan:
+                name = "tan";
+                break;
+            case CGOpCode::Tanh:
+                name = "tanh";
+                break;
+            default:
+                CPPADCG_ASSERT_UNKNOWN(false)
+                throw CGException("Unknown math function");
+        }
+        if (std::is_same<Base, float>::value) name += "f";
+
+        llvm::FunctionType* funcType = llvm::FunctionType::get(_baseType, {_baseType}, false);
+        llvm::FunctionCallee f = _module.getOrInsertFunction(name, funcType);
+        llvm::CallInst* call = builder.CreateCall(f, {x});
+        call->setDoesNotThrow();
+        return call;
+    }
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
@@ -0,0 +1,249 @@
+#ifndef CPPAD_CG_LAZY_BRANCH_LOWERING_INCLUDED
+#define CPPAD_CG_LAZY_BRANCH_LOWERING_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Replaces conditional expressions (CGOpCode::ComLt, CGOpCode::ComGt, ...)
+ * with expensive true or false cases by if/else branches so that only the
+ * selected case is evaluated.
+ *
+ * A conditional expression
+ * @code
+ * c = CondExpLt(left, right, trueCase, falseCase)
+ * @endcode
+ * becomes a temporary variable assigned inside the branches of
+ * @code
+ * if(left < right) tmp = trueCase; else tmp = falseCase;
+ * @endcode
+ * The condition is a comparison operation with only two arguments (left
+ * and right). The operations used exclusively by one of the cases are then
+ * placed inside the corresponding branch by the scope analysis of the
+ * CodeHandler.
+ *
+ * @author Feng Yang
+ */
+template <class Base>
+class LazyBranchLowering {
+public:
+    using Node = OperationNode<Base>;
+    using Arg = Argument<Base>;
+    using CGB = CG<Base>;
+
+protected:
+    /**
+     * The handler which owns the operation graph
+     */
+    CodeHandler<Base>& handler_;
+    /**
+     * The minimum number of operations used exclusively by a case for the
+     * conditional expression to be replaced
+     */
+    size_t minOperations_;
+    /**
+     * The number of times each node is used (by node position in the handler)
+     */
+    std::vector<size_t> useCount_;
+    /**
+     * The number of uses of each node by operations exclusive to the case
+     * being analysed (by node position in the handler)
+     */
+    std::vector<size_t> internalUses_;
+
+public:
+    /**
+     * @param handler the handler which owns the operation graph
+     * @param minOperations the minimum number of operations used only by the
+     *                      true or the false case of a conditional
+     *                      expression for it to be replaced
+     */
+    inline LazyBranchLowering(CodeHandler<Base>& handler, size_t minOperations)
+        : handler_(handler), minOperations_(std::max<size_t>(minOperations, 1)) {}
+
+    LazyBranchLowering(const LazyBranchLowering&) = delete;
+
+    LazyBranchLowering& operator=(const LazyBranchLowering&) = delete;
+
+    /**
+     * Replaces the conditional expressions with expensive cases used by the
+     * dependent variables with if/else branches.
+     *
+     * @param dependent the dependent variables
+     * @param originals pairs with the replaced nodes and a copy of their
+     *                  original operation (can be used to restore the graph)
+     * @return the number of replaced conditional expressions
+     */
+    inline size_t lower(ArrayView<CGB>& dependent, std::list<std::pair<Node*, Node*>>& originals) {
+        size_t nNodes = handler_.getManagedNodesCount();
+        useCount_.assign(nNodes, 0);
+        internalUses_.assign(nNodes, 0);
+
+        /**
+         * determine usages and the post-order of the nodes
+         */
+        std::vector<Node*> order;
+        order.reserve(nNodes);
+        std::vector<bool> visited(nNodes, false);
+        std::vector<std::pair<Node*, size_t>> stack;
+
+        for (size_t i = 0; i < dependent.size(); ++i) {
+            Node* root = dependent[i].getOperationNode();
+            if (root == nullptr) continue;
+
+            useCount_[root->getHandlerPosition()]++;
+            if (visited[root->getHandlerPosition()]) continue;
+
+            visited[root->getHandlerPosition()] = true;
+            stack.emplace_back(root, 0);
+
+            while (!stack.empty()) {
+                Node* node = stack.back().first;
+                size_t a = stack.back().second;
+                const std::vector<Arg>& args = node->getArguments();
+                if (a < args.size()) {
+                    stack.back().second++;
+                    Node* arg = args[a].getOperation();
+                    if (arg != nullptr) {
+                        useCount_[arg->getHandlerPosition()]++;
+                        if (!visited[arg->getHandlerPosition()]) {
+                            visited[arg->getHandlerPosition()] = true;
+                            stack.emplace_back(arg, 0);
+                        }
+                    }
+                } else {
+                    order.push_back(node);
+                    stack.pop_back();
+                }
+            }
+        }
+
+        /**
+         * select the conditional expressions (using the original graph)
+         */
+        std::vector<Node*> selected;
+        for (Node* node : order) {
+            if (!isConditionalExpression(*node)) continue;
+
+            const std::vector<Arg>& args = node->getArguments();
+            if (std::max(exclusiveOperations(args[2]), exclusiveOperations(args[3])) >= minOperations_) {
+                selected.push_back(node);
+            }
+        }
+
+        for (Node* node : selected) {
+            replace(*node, originals);
+        }
+
+        return selected.size();
+    }
+
+    inline virtual ~LazyBranchLowering() = default;
+
+    static inline bool isConditionalExpression(const Node& node) {
+        switch (node.getOperationType()) {
+            case CGOpCode::ComLt:
+            case CGOpCode::ComLe:
+            case CGOpCode::ComEq:
+            case CGOpCode::ComGe:
+            case CGOpCode::ComGt:
+            case CGOpCode::ComNe:
+                return node.getArguments().size() == 4;
+            default:
+                return false;
+        }
+    }
+
+protected:
+    /**
+     * Whether or not an operation can be evaluated inside a branch
+     */
+    static inline bool isMovable(const Node& node) {
+        CGOpCode op = node.getOperationType();
+        return SubgraphOutliner<Base>::isOutlinable(op) || op == CGOpCode::Alias || op == CGOpCode::OutlinedCall;
+    }
+
+    /**
+     * Determines the number of operations which are only used (directly or
+     * indirectly) by a case of a conditional expression.
+     */
+    inline size_t exclusiveOperations(const Arg& branchCase) {
+        Node* root = branchCase.getOperation();
+        if (root == nullptr || !isMovable(*root) || useCount_[root->getHandlerPosition()] != 1) return 0;
+
+        size_t count = 0;
+        std::vector<Node*> touched;
+        std::vector<Node*> work{root};
+        while (!work.empty()) {
+            Node* node = work.back();
+            work.pop_back();
+            count++;
+
+            for (const Arg& a : node->getArguments()) {
+                Node* arg = a.getOperation();
+                if (arg == nullptr || !isMovable(*arg)) continue;
+
+                size_t pos = arg->getHandlerPosition();
+                if (internalUses_[pos] == 0) touched.push_back(arg);
+                // all the uses of an exclusive operation come from exclusive operations
+                if (++internalUses_[pos] == useCount_[pos]) work.push_back(arg);
+            }
+        }
+
+        for (Node* node : touched) {
+            internalUses_[node->getHandlerPosition()] = 0;
+        }
+
+        return count;
+    }
+
+    inline void replace(Node& node, std::list<std::pair<Node*, Node*>>& originals) {
+        Node* opClone = handler_.cloneNode(node);
+
+        const std::vector<Arg>& args = opClone->getArguments();
+
+        Node* tmpDclVar = handler_.makeNode(CGOpCode::TmpDcl);
+        Arg tmpArg(*tmpDclVar);
+
+        Node* cond = handler_.makeNode(node.getOperationType(), {args[0], args[1]});
+
+        // if
+        Node* ifStart = handler_.makeNode(CGOpCode::StartIf, *cond);
+
+        Node* tmpAssign1 = handler_.makeNode(CGOpCode::LoopIndexedTmp, {tmpArg, args[2]});
+        Node* ifAssign = handler_.makeNode(CGOpCode::CondResult, {*ifStart, *tmpAssign1});
+
+        // else
+        Node* elseStart = handler_.makeNode(CGOpCode::Else, {*ifStart, *ifAssign});
+
+        Node* tmpAssign2 = handler_.makeNode(CGOpCode::LoopIndexedTmp, {tmpArg, args[3]});
+        Node* elseAssign = handler_.makeNode(CGOpCode::CondResult, {*elseStart, *tmpAssign2});
+
+        // end if
+        Node* endIf = handler_.makeNode(CGOpCode::EndIf, {*elseStart, *elseAssign});
+
+        node.setOperation(CGOpCode::Tmp, {tmpArg, *endIf});
+        node.getInfo().clear();
+
+        originals.emplace_back(&node, opClone);
+    }
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
@@ -0,0 +1,445 @@
+#ifndef CPPAD_CG_LEVEL_CLUSTERING_INCLUDED
+#define CPPAD_CG_LEVEL_CLUSTERING_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * A group of operations which can be evaluated by a single job.
+ */
+template <class Base>
+class OperationCluster {
+public:
+    /**
+     * The indexes of the dependent variables assigned by this cluster
+     * (only used in the last level)
+     */
+    std::vector<size_t> dependents;
+    /**
+     * The values computed by this cluster which are used by clusters in
+     * the following levels
+     */
+    std::vector<OperationNode<Base>*> outputs;
+    /**
+     * The values computed by clusters in previous levels which are used by
+     * this cluster
+     */
+    std::vector<OperationNode<Base>*> inputs;
+    /**
+     * The number of operations evaluated by this cluster
+     */
+    size_t operations;
+
+    inline OperationCluster() : operations(0) {}
+};
+
+/**
+ * Partitions the operations required to evaluate a set of dependent variables
+ * into levels of clusters.
+ * The clusters in the same level are independent from each other and can be
+ * evaluated concurrently, while a level can only start once all clusters of
+ * the previous levels have finished (a barrier).
+ *
+ * The dependent variables are split into consecutive groups with a similar
+ * number of operations (following the evaluation order so that related
+ * operations tend to stay together). The operations used by a single group
+ * belong to its cluster while the operations shared by several groups are
+ * moved to previous levels, which are partitioned using the same approach.
+ *
+ * @author Feng Yang
+ */
+template <class Base>
+class LevelClustering {
+public:
+    using Node = OperationNode<Base>;
+    using Arg = Argument<Base>;
+    using CGB = CG<Base>;
+    using Cluster = OperationCluster<Base>;
+
+protected:
+    static const int NO_OWNER = -1;
+    static const int SHARED = -2;
+
+    /**
+     * The handler which owns the operation graph
+     */
+    CodeHandler<Base>& handler_;
+    /**
+     * The maximum number of clusters in each level
+     */
+    size_t maxClusters_;
+    /**
+     * The minimum number of operations of a cluster
+     */
+    size_t minOperations_;
+    /**
+     * The maximum number of levels
+     */
+    size_t maxLevels_;
+    /**
+     * The position of each node in the post-order (by node position in the
+     * handler)
+     */
+    std::vector<size_t> orderPos_;
+    /**
+     * The nodes in post-order
+     */
+    std::vector<Node*> order_;
+    /**
+     * Whether or not a node belongs to the region being partitioned (by
+     * node position in the handler)
+     */
+    std::vector<bool> inRegion_;
+    /**
+     * The cluster which uses a node (by node position in the handler)
+     */
+    std::vector<int> owner_;
+
+public:
+    /**
+     * @param handler the handler which owns the operation graph
+     * @param maxClusters the maximum number of clusters in each level
+     *                    (e.g. the number of threads)
+     * @param minOperations the minimum number of operations of a cluster
+     *                      (a level is only split when there are enough
+     *                      operations)
+     * @param maxLevels the maximum number of levels
+     */
+    inline LevelClustering(CodeHandler<Base>& handler,
+                           size_t maxClusters,
+                           size_t minOperations,
+                           size_t maxLevels = 8)
+        : handler_(handler),
+          maxClusters_(std::max<size_t>(maxClusters, 1)),
+          minOperations_(std::max<size_t>(minOperations, 1)),
+          maxLevels_(std::max<size_t>(maxLevels, 1)) {}
+
+    LevelClustering(const LevelClustering&) = delete;
+
+    LevelClustering& operator=(const LevelClustering&) = delete;
+
+    inline virtual ~LevelClustering() = default;
+
+    /**
+     * Partitions the operations used by the dependent variables.
+     *
+     * @param dependent the dependent variables
+     * @return the levels with their clusters (in evaluation order)
+     */
+    inline std::vector<std::vector<Cluster>> partition(const ArrayView<CGB>& dependent) {
+        size_t nNodes = handler_.getManagedNodesCount();
+        orderPos_.assign(nNodes, 0);
+        inRegion_.assign(nNodes, false);
+        owner_.assign(nNodes, NO_OWNER);
+        order_.clear();
+
+        determineOrder(dependent);
+
+        /**
+         * the last level assigns the dependent variables
+         */
+        std::vector<Node*> targets;
+        std::map<Node*, std::vector<size_t>> target2Deps;
+        for (size_t i = 0; i < dependent.size(); ++i) {
+            Node* node = dependent[i].getOperationNode();
+            if (node == nullptr || node->getOperationType() == CGOpCode::Inv) continue;
+
+            std::vector<size_t>& deps = target2Deps[node];
+            if (deps.empty()) targets.push_back(node);
+            deps.push_back(i);
+        }
+
+        for (Node* node : order_) {
+            inRegion_[node->getHandlerPosition()] = true;
+        }
+
+        std::vector<std::vector<Cluster>> levels;
+
+        while (true) {
+            std::vector<std::vector<Node*>> groups;
+            std::vector<Node*> shared;
+            bool split = levels.size() + 1 < maxLevels_ && splitRegion(targets, groups, shared);
+
+            if (!split) {
+                groups.assign(1, targets);
+                shared.clear();
+            }
+
+            levels.emplace_back(createClusters(groups, shared, levels.empty() ? &target2Deps : nullptr));
+
+            if (shared.empty()) break;
+
+            /**
+             * the shared operations are evaluated in the previous levels
+             */
+            for (Node* node : order_) {
+                size_t p = node->getHandlerPosition();
+                inRegion_[p] = inRegion_[p] && owner_[p] == SHARED;
+            }
+
+            targets.clear();
+            for (const Cluster& c : levels.back()) {
+                targets.insert(targets.end(), c.inputs.begin(), c.inputs.end());
+            }
+            std::sort(targets.begin(), targets.end(),
+                      [this](const Node* n1, const Node* n2) { return pos(*n1) < pos(*n2); });
+            targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+        }
+
+        // dependent variables without operations are assigned by the first cluster of the last level
+        Cluster& first = levels.front().front();
+        for (size_t i = 0; i < dependent.size(); ++i) {
+            Node* node = dependent[i].getOperationNode();
+            if (node == nullptr || node->getOperationType() == CGOpCode::Inv) first.dependents.push_back(i);
+        }
+        std::sort(first.dependents.begin(), first.dependents.end());
+
+        std::reverse(levels.begin(), levels.end());
+
+        return levels;
+    }
+
+protected:
+    inline size_t pos(const Node& node) const { return orderPos_[node.getHandlerPosition()]; }
+
+    /**
+     * Determines the post-order of the operations used by the dependents
+     * (independent variables are not included)
+     */
+    inline void determineOrder(const ArrayView<CGB>& dependent) {
+        std::vector<bool> visited(handler_.getManagedNodesCount(), false);
+        std::vector<std::pair<Node*, size_t>> stack;
+
+        for (size_t i = 0; i < dependent.size(); ++i) {
+            Node* root = dependent[i].getOperationNode();
+            if (root == nullptr || visited[root->getHandlerPosition()]) continue;
+
+            visited[root->getHandlerPosition()] = true;
+            stack.emplace_back(root, 0);
+
+            while (!stack.empty()) {
+                Node* node = stack.back().first;
+                size_t a = stack.back().second;
+                const std::vector<Arg>& args = node->getArguments();
+                if (a < args.size()) {
+                    stack.back().second++;
+                    Node* arg = args[a].getOperation();
+                    if (arg != nullptr && !visited[arg->getHandlerPosition()]) {
+                        visited[arg->getHandlerPosition()] = true;
+                        stack.emplace_back(arg, 0);
+                    }
+                } else {
+                    if (node->getOperationType() != CGOpCode::Inv) {
+                        orderPos_[node->getHandlerPosition()] = order_.size();
+                        order_.push_back(node);
+                    }
+                    stack.pop_back();
+                }
+            }
+        }
+    }
+
+    /**
+     * Splits the targets of the current region into groups with a similar
+     * number of operations and determines the owner of each operation.
+     *
+     * @param targets the operations whose values are required
+     * @param groups the targets of each group
+     * @param shared the operations used by more than one group
+     * @return true if the region was split into more than one group
+     */
+    inline bool splitRegion(const std::vector<Node*>& targets,
+                            std::vector<std::vector<Node*>>& groups,
+                            std::vector<Node*>& shared) {
+        /**
+         * the number of operations first reached by each target
+         */
+        std::vector<size_t> weight(targets.size(), 0);
+        std::vector<bool> visited(handler_.getManagedNodesCount(), false);
+        std::vector<Node*> work;
+        size_t total = 0;
+
+        for (size_t t = 0; t < targets.size(); ++t) {
+            work.push_back(targets[t]);
+            while (!work.empty()) {
+                Node* node = work.back();
+                work.pop_back();
+                size_t p = node->getHandlerPosition();
+                if (visited[p] || !inRegion_[p]) continue;
+                visited[p] = true;
+                weight[t]++;
+
+                for (const Arg& a : node->getArguments()) {
+                    if (a.getOperation() != nullptr) work.push_back(a.getOperation());
+                }
+            }
+            total += weight[t];
+        }
+
+        size_t nGroups = std::min(maxClusters_, total / minOperations_);
+        if (nGroups < 2 || targets.size() < 2) return false;
+
+        /**
+         * consecutive groups of targets with similar weights
+         */
+        groups.assign(1, std::vector<Node*>());
+        size_t accumulated = 0;
+        for (size_t t = 0; t < targets.size(); ++t) {
+            if (!groups.back().empty() && accumulated >= total * groups.size() / nGroups) {
+                groups.emplace_back();
+            }
+            groups.back().push_back(targets[t]);
+            accumulated += weight[t];
+        }
+
+        if (groups.size() < 2) return false;
+
+        /**
+         * determine the owner of each operation (users are visited before
+         * their arguments in the reversed post-order)
+         */
+        for (Node* node : order_) {
+            owner_[node->getHandlerPosition()] = NO_OWNER;
+        }
+
+        for (size_t g = 0; g < groups.size(); ++g) {
+            for (Node* node : groups[g]) {
+                owner_[node->getHandlerPosition()] = int(g);
+            }
+        }
+
+        for (auto it = order_.rbegin(); it != order_.rend(); ++it) {
+            Node* node = *it;
+            size_t p = node->getHandlerPosition();
+            if (!inRegion_[p]) continue;
+
+            int o = owner_[p];
+            CPPADCG_ASSERT_UNKNOWN(o != NO_OWNER)
+
+            for (const Arg& a : node->getArguments()) {
+                Node* arg = a.getOperation();
+                if (arg == nullptr || !inRegion_[arg->getHandlerPosition()]) continue;
+
+                int& oa = owner_[arg->getHandlerPosition()];
+                if (oa == NO_OWNER) {
+                    oa = o;
+                } else if (oa != o) {
+                    oa = SHARED;
+                }
+            }
+        }
+
+        /**
+         * a level is only useful if at least two groups do some work
+         */
+        std::vector<size_t> operations(groups.size(), 0);
+        for (Node* node : order_) {
+            size_t p = node->getHandlerPosition();
+            if (!inRegion_[p]) continue;
+
+            if (owner_[p] == SHARED) {
+                shared.push_back(node);
+            } else {
+                operations[owner_[p]]++;
+            }
+        }
+
+        size_t working = 0;
+        for (size_t ops : operations) {
+            if (ops >= minOperations_) working++;
+        }
+
+        if (working < 2) {
+            shared.clear();
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * Creates the clusters of a level.
+     *
+     * @param groups the targets of each cluster
+     * @param shared the operations used by more than one cluster (evaluated
+     *               in previous levels)
+     * @param target2Deps maps the targets to the dependent variable indexes
+     *                    (only for the last level)
+     */
+    inline std::vector<Cluster> createClusters(const std::vector<std::vector<Node*>>& groups,
+                                               const std::vector<Node*>& shared,
+                                               const std::map<Node*, std::vector<size_t>>* target2Deps) {
+        std::vector<Cluster> clusters(groups.size());
+
+        if (groups.size() == 1) {
+            for (Node* node : order_) {
+                owner_[node->getHandlerPosition()] = 0;  // the complete region
+            }
+        }
+
+        std::vector<int> inputOf(handler_.getManagedNodesCount(), NO_OWNER);
+
+        for (size_t g = 0; g < groups.size(); ++g) {
+            Cluster& c = clusters[g];
+
+            for (Node* node : groups[g]) {
+                bool sharedTarget = owner_[node->getHandlerPosition()] == SHARED;  // evaluated in a previous level
+
+                if (target2Deps != nullptr) {
+                    const std::vector<size_t>& deps = target2Deps->at(node);
+                    c.dependents.insert(c.dependents.end(), deps.begin(), deps.end());
+                    if (sharedTarget) c.inputs.push_back(node);
+                } else if (!sharedTarget) {
+                    c.outputs.push_back(node);
+                }
+            }
+            std::sort(c.dependents.begin(), c.dependents.end());
+        }
+
+        for (Node* node : order_) {
+            size_t p = node->getHandlerPosition();
+            if (!inRegion_[p] || owner_[p] == SHARED) continue;
+
+            Cluster& c = clusters[owner_[p]];
+            c.operations++;
+
+            for (const Arg& a : node->getArguments()) {
+                Node* arg = a.getOperation();
+                if (arg == nullptr) continue;
+
+                size_t pa = arg->getHandlerPosition();
+                if (inRegion_[pa] && owner_[pa] == SHARED && inputOf[pa] != owner_[p]) {
+                    inputOf[pa] = owner_[p];
+                    c.inputs.push_back(arg);
+                }
+            }
+        }
+
+        for (Cluster& c : clusters) {
+            std::sort(c.inputs.begin(), c.inputs.end(),
+                      [this](const Node* n1, const Node* n2) { return pos(*n1) < pos(*n2); });
+            c.inputs.erase(std::unique(c.inputs.begin(), c.inputs.end()), c.inputs.end());
+        }
+
+        return clusters;
+    }
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
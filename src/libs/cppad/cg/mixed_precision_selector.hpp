@@ -0,0 +1,492 @@
+#ifndef CPPAD_CG_MIXED_PRECISION_SELECTOR_INCLUDED
+#define CPPAD_CG_MIXED_PRECISION_SELECTOR_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Determines which operations of an operation graph can be evaluated with
+ * a reduced floating-point precision (e.g. float instead of double) without
+ * exceeding a relative error in the dependent variables.
+ *
+ * The graph is evaluated at typical values of the independent variables
+ * while propagating a first order estimate of the relative rounding error
+ * of each operation (using the condition number of each operation).
+ * Only elementwise operations are candidates. Divisions, accumulations
+ * (sums of sums), dependent variable assignments and operations which
+ * cannot be evaluated by this class (loops, atomic functions, conditional
+ * operations, ...) and their arguments always keep the original precision.
+ * The estimates are only valid close to the provided typical values.
+ *
+ * @author Feng Yang
+ */
+template <class Base>
+class MixedPrecisionSelector {
+public:
+    using Node = OperationNode<Base>;
+    using Arg = Argument<Base>;
+    using CGB = CG<Base>;
+
+protected:
+    /**
+     * The handler which owns the operation graph
+     */
+    CodeHandler<Base>& handler_;
+    /**
+     * The maximum relative error of the dependent variables
+     */
+    double tolerance_;
+    /**
+     * The fraction of the tolerance which can be used by a single operation
+     * evaluated with a reduced precision
+     */
+    double safetyFactor_;
+    /**
+     * The unit roundoff of the reduced precision type
+     */
+    double reducedEpsilon_;
+    /**
+     * The unit roundoff of the original type
+     */
+    double baseEpsilon_;
+    /**
+     * The value of each node at the typical point (by handler position)
+     */
+    std::vector<double> value_;
+    /**
+     * The estimated relative error of each node (by handler position)
+     */
+    std::vector<double> error_;
+    /**
+     * Whether or not each node can be evaluated (by handler position)
+     */
+    std::vector<bool> known_;
+
+public:
+    /**
+     * @param handler the handler which owns the operation graph
+     * @param tolerance the maximum relative error of the dependent variables
+     * @param reducedEpsilon the unit roundoff of the reduced precision type
+     */
+    inline MixedPrecisionSelector(CodeHandler<Base>& handler,
+                                  double tolerance = 1e-6,
+                                  double reducedEpsilon = std::numeric_limits<float>::epsilon() / 2)
+        : handler_(handler),
+          tolerance_(tolerance),
+          safetyFactor_(0.1),
+          reducedEpsilon_(reducedEpsilon),
+          baseEpsilon_(double(std::numeric_limits<Base>::epsilon()) / 2) {}
+
+    MixedPrecisionSelector(const MixedPrecisionSelector&) = delete;
+
+    MixedPrecisionSelector& operator=(const MixedPrecisionSelector&) = delete;
+
+    inline double getTolerance() const { return tolerance_; }
+
+    inline double getSafetyFactor() const { return safetyFactor_; }
+
+    /**
+     * Defines the fraction of the tolerance which can be consumed by a
+     * single reduced precision operation (errors accumulate along the
+     * graph).
+     */
+    inline void setSafetyFactor(double safetyFactor) { safetyFactor_ = safetyFactor; }
+
+    /**
+     * Selects the operations which can be evaluated with a reduced
+     * precision.
+     *
+     * @param dependent the dependent variables
+     * @param independent the independent variables which must have values
+     *                    (typical values)
+     * @return the operations which can use a reduced precision
+     */
+    inline std::set<const Node*> select(const std::vector<CGB>& dependent, const std::vector<CGB>& independent) {
+        std::set<const Node*> reduced;
+
+        for (const CGB& i : independent) {
+            if (!i.isValueDefined()) return reduced;  // typical values are required
+        }
+
+        size_t nNodes = handler_.getManagedNodesCount();
+        if (nNodes == 0) return reduced;
+
+        value_.assign(nNodes, 0.0);
+        error_.assign(nNodes, 0.0);
+        known_.assign(nNodes, false);
+        std::vector<bool> pinned(nNodes, false);  // must keep the original precision
+        std::vector<bool> isReduced(nNodes, false);
+
+        for (const CGB& i : independent) {
+            Node* node = i.getOperationNode();
+            if (node == nullptr) continue;
+            value_[node->getHandlerPosition()] = double(i.getValue());
+            known_[node->getHandlerPosition()] = true;
+        }
+
+        /**
+         * post-order of the nodes
+         */
+        std::vector<Node*> order;
+        order.reserve(nNodes);
+        std::vector<bool> visited(nNodes, false);
+        std::vector<std::pair<Node*, size_t>> stack;
+
+        for (const CGB& d : dependent) {
+            Node* root = d.getOperationNode();
+            if (root == nullptr) continue;
+
+            pinned[root->getHandlerPosition()] = true;  // dependent assignments keep the original precision
+            if (visited[root->getHandlerPosition()]) continue;
+
+            visited[root->getHandlerPosition()] = true;
+            stack.emplace_back(root, 0);
+
+            while (!stack.empty()) {
+                Node* node = stack.back().first;
+                size_t a = stack.back().second;
+                const std::vector<Arg>& args = node->getArguments();
+                if (a < args.size()) {
+                    stack.back().second++;
+                    Node* arg = args[a].getOperation();
+                    if (arg != nullptr && !visited[arg->getHandlerPosition()]) {
+                        visited[arg->getHandlerPosition()] = true;
+                        stack.emplace_back(arg, 0);
+                    }
+                } else {
+                    order.push_back(node);
+                    stack.pop_back();
+                }
+            }
+        }
+
+        /**
+         * the arguments of operations which are not understood keep the
+         * original precision
+         */
+        for (Node* node : order) {
+            if (node->getOperationType() == CGOpCode::Inv || isEvaluable(*node)) continue;
+            for (const Arg& a : node->getArguments()) {
+                if (a.getOperation() != nullptr) pinned[a.getOperation()->getHandlerPosition()] = true;
+            }
+        }
+
+        /**
+         * evaluate the values and the errors (greedy selection)
+         */
+        for (Node* node : order) {
+            size_t pos = node->getHandlerPosition();
+            CGOpCode op = node->getOperationType();
+            if (op == CGOpCode::Inv) continue;
+
+            if (!isEvaluable(*node) || !argumentsKnown(*node)) {
+                // unknown value (only the errors of the arguments are kept)
+                known_[pos] = false;
+                double e = 0;
+                for (const Arg& a : node->getArguments()) {
+                    if (a.getOperation() != nullptr) e = std::max(e, error_[a.getOperation()->getHandlerPosition()]);
+                }
+                error_[pos] = e + baseEpsilon_;
+                continue;
+            }
+
+            known_[pos] = true;
+            value_[pos] = evaluate(*node);
+
+            double eBase = propagate(*node, isReduced, false) + baseEpsilon_;
+
+            if (!pinned[pos] && isReducible(*node) && std::isfinite(value_[pos])) {
+                double eReduced = propagate(*node, isReduced, true) + reducedEpsilon_;
+                if (eReduced <= safetyFactor_ * tolerance_) {
+                    isReduced[pos] = true;
+                    error_[pos] = eReduced;
+                    continue;
+                }
+            }
+
+            error_[pos] = eBase;
+        }
+
+        /**
+         * the dependents which exceed the tolerance (due to the accumulation
+         * of errors) use the original precision in all their operations
+         */
+        for (const CGB& d : dependent) {
+            Node* root = d.getOperationNode();
+            if (root == nullptr || error_[root->getHandlerPosition()] <= tolerance_) continue;
+
+            std::vector<Node*> nodes{root};
+            std::vector<bool> visited2(nNodes, false);
+            visited2[root->getHandlerPosition()] = true;
+            while (!nodes.empty()) {
+                Node* node = nodes.back();
+                nodes.pop_back();
+                isReduced[node->getHandlerPosition()] = false;
+                for (const Arg& a : node->getArguments()) {
+                    Node* arg = a.getOperation();
+                    if (arg != nullptr && !visited2[arg->getHandlerPosition()]) {
+                        visited2[arg->getHandlerPosition()] = true;
+                        nodes.push_back(arg);
+                    }
+                }
+            }
+        }
+
+        for (Node* node : order) {
+            if (isReduced[node->getHandlerPosition()]) reduced.insert(node);
+        }
+
+        return reduced;
+    }
+
+    inline virtual ~MixedPrecisionSelector() = default;
+
+    /**
+     * Whether or not an operation type can be evaluated with a reduced
+     * precision.
+     */
+    static inline bool isReducibleOperation(CGOpCode op) {
+        switch (op) {
+            case CGOpCode::Abs:
+            case CGOpCode::Add:
+            case CGOpCode::Cos:
+            case CGOpCode::Cosh:
+            case CGOpCode::Exp:
+            case CGOpCode::Log:
+            case CGOpCode::Mul:
+            case CGOpCode::Pow:
+            case CGOpCode::Sin:
+            case CGOpCode::Sinh:
+            case CGOpCode::Sqrt:
+            case CGOpCode::Sub:
+            case CGOpCode::Tan:
+            case CGOpCode::Tanh:
+            case CGOpCode::UnMinus:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+protected:
+    inline virtual bool isReducible(const Node& node) const {
+        CGOpCode op = node.getOperationType();
+        if (!isReducibleOperation(op)) return false;
+
+        if (op == CGOpCode::Add || op == CGOpCode::Sub) {
+            // accumulations keep the original precision
+            for (const Arg& a : node.getArguments()) {
+                const Node* arg = a.getOperation();
+                if (arg != nullptr && (arg->getOperationType() == CGOpCode::Add ||
+                                       arg->getOperationType() == CGOpCode::Sub)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    static inline bool isEvaluable(const Node& node) {
+        switch (node.getOperationType()) {
+            case CGOpCode::Abs:
+            case CGOpCode::Acos:
+            case CGOpCode::Add:
+            case CGOpCode::Alias:
+            case CGOpCode::Asin:
+            case CGOpCode::Atan:
+            case CGOpCode::Cos:
+            case CGOpCode::Cosh:
+            case CGOpCode::Div:
+            case CGOpCode::Exp:
+            case CGOpCode::Log:
+            case CGOpCode::Mul:
+            case CGOpCode::Pow:
+            case CGOpCode::Sin:
+            case CGOpCode::Sinh:
+            case CGOpCode::Sqrt:
+            case CGOpCode::Sub:
+            case CGOpCode::Tan:
+            case CGOpCode::Tanh:
+            case CGOpCode::UnMinus:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    inline bool argumentsKnown(const Node& node) const {
+        for (const Arg& a : node.getArguments()) {
+            if (a.getOperation() != nullptr && !known_[a.getOperation()->getHandlerPosition()]) return false;
+        }
+        return true;
+    }
+
+    inline double argValue(const Arg& a) const {
+        if (a.getOperation() != nullptr) return value_[a.getOperation()->getHandlerPosition()];
+        return double(*a.getParameter());
+    }
+
+    /**
+     * The relative error of an argument of an operation
+     *
+     * @param reducedOp whether or not the operation uses a reduced precision
+     */
+    inline double argError(const Arg& a, const std::vector<bool>& isReduced, bool reducedOp) const {
+        if (a.getOperation() != nullptr) {
+            size_t pos = a.getOperation()->getHandlerPosition();
+            // conversion to the reduced precision
+            return error_[pos] + ((reducedOp && !isReduced[pos]) ? reducedEpsilon_ : 0.0);
+        }
+
+        double p = argValue(a);
+        if (reducedOp && double(float(p)) != p) return reducedEpsilon_;
+        return 0.0;
+    }
+
+    inline double evaluate(const Node& node) const {
+        const std::vector<Arg>& args = node.getArguments();
+        double a = argValue(args[0]);
+        switch (node.getOperationType()) {
+            case CGOpCode::Abs:
+                return std::abs(a);
+            case CGOpCode::Acos:
+                return std::acos(a);
+            case CGOpCode::Add:
+                return a + argValue(args[1]);
+            case CGOpCode::Alias:
+                return a;
+            case CGOpCode::Asin:
+                return std::asin(a);
+            case CGOpCode::Atan:
+                return std::atan(a);
+            case CGOpCode::Cos:
+                return std::cos(a);
+            case CGOpCode::Cosh:
+                return std::cosh(a);
+            case CGOpCode::Div:
+                return a / argValue(args[1]);
+            case CGOpCode::Exp:
+                return std::exp(a);
+            case CGOpCode::Log:
+                return std::log(a);
+            case CGOpCode::Mul:
+                return a * argValue(args[1]);
+            case CGOpCode::Pow:
+                return std::pow(a, argValue(args[1]));
+            case CGOpCode::Sin:
+                return std::sin(a);
+            case CGOpCode::Sinh:
+                return std::sinh(a);
+            case CGOpCode::Sqrt:
+                return std::sqrt(a);
+            case CGOpCode::Sub:
+                return a - argValue(args[1]);
+            case CGOpCode::Tan:
+                return std::tan(a);
+            case CGOpCode::Tanh:
+                return std::tanh(a);
+            case CGOpCode::UnMinus:
+                return -a;
+            default:
+                throw CGException("Unable to evaluate operation ", node.getOperationType());
+        }
+    }
+
+    /**
+     * Estimates the relative error of an operation due to the errors of its
+     * arguments (excluding the rounding of its own result).
+     *
+     * @param reducedOp whether or not the operation uses a reduced precision
+     */
+    inline double propagate(const Node& node, const std::vector<bool>& isReduced, bool reducedOp) const {
+        const std::vector<Arg>& args = node.getArguments();
+        CGOpCode op = node.getOperationType();
+
+        double a = argValue(args[0]);
+        double ea = argError(args[0], isReduced, reducedOp);
+        double v = value_[node.getHandlerPosition()];
+
+        switch (op) {
+            case CGOpCode::Add:
+            case CGOpCode::Sub: {
+                double b = argValue(args[1]);
+                double eb = argError(args[1], isReduced, reducedOp);
+                double num = std::abs(a) * ea + std::abs(b) * eb;
+                if (num == 0) return 0;
+                return num / std::abs(v);  // cancellation -> large (or infinite) error
+            }
+            case CGOpCode::Mul:
+            case CGOpCode::Div:
+                return ea + argError(args[1], isReduced, reducedOp);
+            case CGOpCode::Abs:
+            case CGOpCode::Alias:
+            case CGOpCode::UnMinus:
+                return ea;
+            case CGOpCode::Pow: {
+                double b = argValue(args[1]);
+                double eb = argError(args[1], isReduced, reducedOp);
+                return condition(std::abs(b), 1.0) * ea + condition(std::abs(b * std::log(std::abs(a))), 1.0) * eb;
+            }
+            default:
+                // unary functions: |a f'(a) / f(a)|
+                return condition(std::abs(a * derivative(op, a, v)), std::abs(v)) * ea;
+        }
+    }
+
+    static inline double condition(double num, double den) {
+        if (num == 0) return 0;
+        double c = num / den;
+        if (std::isnan(c)) return 1;  // 0/0 (e.g. sin(x)/x at x=0)
+        return c;
+    }
+
+    static inline double derivative(CGOpCode op, double a, double v) {
+        switch (op) {
+            case CGOpCode::Acos:
+                return -1 / std::sqrt(1 - a * a);
+            case CGOpCode::Asin:
+                return 1 / std::sqrt(1 - a * a);
+            case CGOpCode::Atan:
+                return 1 / (1 + a * a);
+            case CGOpCode::Cos:
+                return -std::sin(a);
+            case CGOpCode::Cosh:
+                return std::sinh(a);
+            case CGOpCode::Exp:
+                return v;
+            case CGOpCode::Log:
+                return 1 / a;
+            case CGOpCode::Sin:
+                return std::cos(a);
+            case CGOpCode::Sinh:
+                return std::cosh(a);
+            case CGOpCode::Sqrt:
+                return 0.5 / v;
+            case CGOpCode::Tan:
+                return 1 + v * v;
+            case CGOpCode::Tanh:
+                return 1 - v * v;
+            default:
+                return 1;
+        }
+    }
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
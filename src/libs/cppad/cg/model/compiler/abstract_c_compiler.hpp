@@ -38,6 +38,14 @@ protected:
     std::vector<std::string> _linkFlags;
     bool _verbose;
     bool _saveToDiskFirst;
+    /**
+     * maximum number of compiler processes running at the same time
+     */
+    size_t _maxParallelJobs;
+    /**
+     * the threads used to launch compiler processes (reused across calls)
+     */
+    std::unique_ptr<CompilerJobPool> _jobPool;
 
 public:
     AbstractCCompiler(const std::string& compilerPath)
@@ -45,7 +53,8 @@ public:
           _tmpFolder("cppadcg_tmp"),
           _sourcesFolder("cppadcg_sources"),
           _verbose(false),
-          _saveToDiskFirst(false) {}
+          _saveToDiskFirst(false),
+          _maxParallelJobs(1) {}
 
     AbstractCCompiler(const AbstractCCompiler& orig) = delete;
     AbstractCCompiler& operator=(const AbstractCCompiler& rhs) = delete;
@@ -92,6 +101,28 @@ public:
 
     void setVerbose(bool verbose) override { _verbose = verbose; }
 
+    /**
+     * @return the maximum number of source files compiled at the same time
+     */
+    size_t getMaxParallelJobs() const { return _maxParallelJobs; }
+
+    /**
+     * Defines the maximum number of compiler processes which can run at the
+     * same time when compiling several source files.
+     * The threads launching these processes are created once and reused for
+     * all subsequent compilations (across files and libraries).
+     *
+     * @param maxParallelJobs the maximum number of concurrent compiler
+     *                        processes (1 compiles one file at a time)
+     */
+    void setMaxParallelJobs(size_t maxParallelJobs) {
+        if (maxParallelJobs == 0) maxParallelJobs = 1;
+        if (_maxParallelJobs != maxParallelJobs) {
+            _maxParallelJobs = maxParallelJobs;
+            _jobPool.reset();
+        }
+    }
+
     /**
      * Compiles the provided C source code.
      *
@@ -143,6 +174,11 @@ public:
             system::createFolder(_sourcesFolder);
         }
 
+        if (_maxParallelJobs > 1 && sources.size() > 1) {
+            compileSourcesInParallel(sources, posIndepCode, timer, outputExtension, outputFiles);
+            return;
+        }
+
         // compile each source code file into a different object file
         for (it = sources.begin(); it != sources.end(); ++it) {
             count++;
@@ -185,6 +221,8 @@ public:
             }
 
             if (timer != nullptr) {
+                timer->addJobCounter("source_bytes", it->second.size());
+                timer->addJobCounter("compiler_peak_rss", system::getLastExecutablePeakResidentSetSize());
                 timer->finishedJob();
             } else if (_verbose) {
                 steady_clock::time_point endTime = steady_clock::now();
@@ -215,6 +253,88 @@ public:
     virtual ~AbstractCCompiler() { cleanup(); }
 
 protected:
+    /**
+     * Compiles each source file into a different output file using up to
+     * _maxParallelJobs compiler processes at the same time.
+     * The batch is reported as a single job since the files do not finish
+     * in order.
+     */
+    virtual void compileSourcesInParallel(const std::map<std::string, std::string>& sources,
+                                          bool posIndepCode,
+                                          JobTimer* timer,
+                                          const std::string& outputExtension,
+                                          std::set<std::string>& outputFiles) {
+        using namespace std::chrono;
+
+        if (_jobPool == nullptr) {
+            _jobPool.reset(new CompilerJobPool(_maxParallelJobs));
+        }
+
+        std::ostringstream os;
+        os << sources.size() << " source files with " << _jobPool->size() << " processes";
+
+        steady_clock::time_point beginTime;
+        if (timer != nullptr) {
+            timer->startingJob(os.str(), JobTypeHolder<>::COMPILING);
+        } else if (_verbose) {
+            beginTime = steady_clock::now();
+            std::cout << " compiling " << os.str() << " ... ";
+            std::cout.flush();
+        }
+
+        // each file is traced as a separate job in the thread which launched the compiler
+        JobTimer* tracer = timer != nullptr && timer->isTracing() ? timer : nullptr;
+
+        for (const auto& it : sources) {
+            std::string file = system::createPath(this->_tmpFolder, it.first + outputExtension);
+            outputFiles.insert(file);
+            size_t bytes = it.second.size();
+
+            if (_saveToDiskFirst) {
+                // save a new source file to disk
+                std::string srcfile = system::createPath(_sourcesFolder, it.first);
+                std::ofstream sourceFile;
+                sourceFile.open(srcfile.c_str());
+                sourceFile << it.second;
+                sourceFile.close();
+
+                _jobPool->submit([this, srcfile, file, posIndepCode, tracer, bytes]() {
+                    steady_clock::time_point begin = steady_clock::now();
+                    size_t memory = tracer != nullptr ? system::getPeakResidentSetSize() : 0;
+                    compileFile(srcfile, file, posIndepCode);
+                    if (tracer != nullptr) {
+                        tracer->traceJob("'" + file + "'", JobTypeHolder<>::COMPILING, begin, memory,
+                                         {{"source_bytes", bytes},
+                                          {"compiler_peak_rss", system::getLastExecutablePeakResidentSetSize()}});
+                    }
+                });
+            } else {
+                const std::string* source = &it.second;
+                _jobPool->submit([this, source, file, posIndepCode, tracer, bytes]() {
+                    steady_clock::time_point begin = steady_clock::now();
+                    size_t memory = tracer != nullptr ? system::getPeakResidentSetSize() : 0;
+                    compileSource(*source, file, posIndepCode);
+                    if (tracer != nullptr) {
+                        tracer->traceJob("'" + file + "'", JobTypeHolder<>::COMPILING, begin, memory,
+                                         {{"source_bytes", bytes},
+                                          {"compiler_peak_rss", system::getLastExecutablePeakResidentSetSize()}});
+                    }
+                });
+            }
+        }
+
+        _jobPool->wait();
+
+        if (timer != nullptr) {
+            timer->addJobCounter("source_files", sources.size());
+            timer->finishedJob();
+        } else if (_verbose) {
+            steady_clock::time_point endTime = steady_clock::now();
+            duration<float> dt = endTime - beginTime;
+            std::cout << "done [" << std::fixed << std::setprecision(3) << dt.count() << "]" << std::endl;
+        }
+    }
+
     /**
      * Compiles a single source file into an object file.
      *
@@ -109,6 +109,7 @@ public:
         system::callExecutable(this->_path, args);
 
         if (timer != nullptr) {
+            timer->addJobCounter("linker_peak_rss", system::getLastExecutablePeakResidentSetSize());
             timer->finishedJob();
         }
     }
@@ -0,0 +1,140 @@
+#ifndef CPPAD_CG_COMPILER_JOB_POOL_INCLUDED
+#define CPPAD_CG_COMPILER_JOB_POOL_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * A small set of persistent threads which launch and wait for external
+ * executables (e.g. compiler processes) so that several of them can run at
+ * the same time.
+ * The threads are kept alive between batches so that they can be reused
+ * across source files and libraries.
+ *
+ * @author Feng Yang
+ */
+class CompilerJobPool {
+private:
+    std::vector<std::thread> threads_;
+    std::deque<std::function<void()>> jobs_;
+    std::mutex mutex_;
+    std::condition_variable jobAvailable_;
+    std::condition_variable jobsFinished_;
+    /**
+     * number of submitted jobs which have not finished yet
+     */
+    size_t pending_;
+    /**
+     * the first error thrown by a job since the last call to wait()
+     */
+    std::exception_ptr error_;
+    bool stop_;
+
+public:
+    /**
+     * @param threads the maximum number of jobs running at the same time
+     */
+    inline explicit CompilerJobPool(size_t threads) : pending_(0), stop_(false) {
+        if (threads == 0) threads = 1;
+        threads_.reserve(threads);
+        for (size_t i = 0; i < threads; ++i) {
+            threads_.emplace_back([this]() { work(); });
+        }
+    }
+
+    CompilerJobPool(const CompilerJobPool&) = delete;
+    CompilerJobPool& operator=(const CompilerJobPool&) = delete;
+
+    inline size_t size() const { return threads_.size(); }
+
+    /**
+     * Queues a new job.
+     * Jobs submitted after an error are ignored until wait() is called.
+     */
+    inline void submit(std::function<void()> job) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            jobs_.push_back(std::move(job));
+            pending_++;
+        }
+        jobAvailable_.notify_one();
+    }
+
+    /**
+     * Waits for all the submitted jobs to finish.
+     *
+     * @throws the first exception thrown by a job
+     */
+    inline void wait() {
+        std::exception_ptr error;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            jobsFinished_.wait(lock, [this]() { return pending_ == 0; });
+            std::swap(error, error_);
+        }
+        if (error) std::rethrow_exception(error);
+    }
+
+    inline virtual ~CompilerJobPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        jobAvailable_.notify_all();
+        for (std::thread& t : threads_) {
+            t.join();
+        }
+    }
+
+private:
+    inline void work() {
+        while (true) {
+            std::function<void()> job;
+            bool skip;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                jobAvailable_.wait(lock, [this]() { return stop_ || !jobs_.empty(); });
+                if (jobs_.empty()) return;  // stopping
+                job = std::move(jobs_.front());
+                jobs_.pop_front();
+                skip = bool(error_);
+            }
+
+            std::exception_ptr error;
+            if (!skip) {
+                try {
+                    job();
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            }
+
+            bool finished;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (error && !error_) error_ = error;
+                finished = --pending_ == 0;
+            }
+            if (finished) jobsFinished_.notify_all();
+        }
+    }
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
@@ -40,6 +40,11 @@ protected:
      * System dependent custom options
      */
     std::map<std::string, std::string> _options;
+    /**
+     * whether or not the dynamic library only exports the function tables
+     * (the other symbols are hidden)
+     */
+    bool _exportTablesOnly;
 
 public:
     /**
@@ -52,7 +57,7 @@ public:
      */
     inline explicit DynamicModelLibraryProcessor(ModelLibraryCSourceGen<Base>& modelLibGen,
                                                  std::string libraryName = "cppad_cg_model")
-        : ModelLibraryProcessor<Base>(modelLibGen), _libraryName(std::move(libraryName)) {}
+        : ModelLibraryProcessor<Base>(modelLibGen), _libraryName(std::move(libraryName)), _exportTablesOnly(false) {}
 
     virtual ~DynamicModelLibraryProcessor() = default;
 
@@ -102,6 +107,26 @@ public:
      */
     inline const std::map<std::string, std::string>& getOptions() const { return _options; }
 
+    /**
+     * Whether or not the created dynamic libraries only export the model
+     * and library function tables.
+     */
+    inline bool isExportFunctionTablesOnly() const { return _exportTablesOnly; }
+
+    /**
+     * Defines whether or not the created dynamic libraries only export the
+     * model and library function tables.
+     * All the other symbols are compiled with hidden visibility which
+     * reduces the size of the dynamic symbol table and the relocation work
+     * when the library is loaded. The library can then only be loaded
+     * through the function tables (e.g. with LinuxDynamicLib).
+     * This option is only used with compilers derived from AbstractCCompiler.
+     *
+     * @param exportTablesOnly true to hide all symbols except for the
+     *                         function tables
+     */
+    inline void setExportFunctionTablesOnly(bool exportTablesOnly) { _exportTablesOnly = exportTablesOnly; }
+
     /**
      * Compiles all models and generates a dynamic library.
      *
@@ -116,6 +141,14 @@ public:
 
         this->modelLibraryHelper_->startingJob("", JobTimer::DYNAMIC_MODEL_LIBRARY);
 
+        // hide all symbols except for the function tables
+        auto* cCompiler = _exportTablesOnly ? dynamic_cast<AbstractCCompiler<Base>*>(&compiler) : nullptr;
+        const std::vector<std::string> compileFlags =
+                cCompiler != nullptr ? cCompiler->getCompileFlags() : std::vector<std::string>();
+        if (cCompiler != nullptr) {
+            cCompiler->addCompileFlag("-fvisibility=hidden");
+        }
+
         const std::map<std::string, ModelCSourceGen<Base>*>& models = this->modelLibraryHelper_->getModels();
         try {
             for (const auto& p : models) {
@@ -141,9 +174,11 @@ public:
             compiler.buildDynamic(libname, this->modelLibraryHelper_);
 
         } catch (...) {
+            if (cCompiler != nullptr) cCompiler->setCompileFlags(compileFlags);
             compiler.cleanup();
             throw;
         }
+        if (cCompiler != nullptr) cCompiler->setCompileFlags(compileFlags);
         compiler.cleanup();
 
         this->modelLibraryHelper_->finishedJob();
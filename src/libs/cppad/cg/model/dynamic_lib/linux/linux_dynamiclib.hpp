@@ -86,6 +86,8 @@ public:
     }
 
     void* loadFunction(const std::string& functionName, bool required = true) override {
+        dlerror();  // clear errors from previous (optional) lookups
+
         void* functor = dlsym(_dynLibHandle, functionName.c_str());
 
         if (required) {
@@ -55,6 +55,10 @@ protected:
     void (*_zero)(Base const* const*, Base* const*, LangCAtomicFun);
     // first order forward mode
     int (*_forwardOne)(Base const tx[], Base ty[], LangCAtomicFun);
+    // forward mode up to an arbitrary order
+    void (*_forwardTaylor)(Base const* const*, Base* const*, LangCAtomicFun);
+    // the highest order of the Taylor coefficients of the forward mode
+    unsigned long (*_forwardTaylorOrder)();
     // first order reverse mode
     int (*_reverseOne)(Base const tx[], Base const ty[], Base px[], Base const py[], LangCAtomicFun);
     // second order reverse mode
@@ -73,6 +77,10 @@ protected:
     void (*_sparseJacobian)(Base const* const*, Base* const*, LangCAtomicFun);
     // sparse hessian function in the dynamic library
     void (*_sparseHessian)(Base const* const*, Base* const*, LangCAtomicFun);
+    // Hessian-vector product function in the dynamic library
+    void (*_hessianVectorProduct)(Base const* const*, Base* const*, LangCAtomicFun);
+    // the number of directions of the Hessian-vector product function
+    unsigned long (*_hessianVectorProductDirections)();
     //
     void (*_forwardOneSparsity)(unsigned long, unsigned long const**, unsigned long*);
     //
@@ -105,6 +113,8 @@ public:
           _missingAtomicFunctions(other._missingAtomicFunctions),
           _zero(other._zero),
           _forwardOne(other._forwardOne),
+          _forwardTaylor(other._forwardTaylor),
+          _forwardTaylorOrder(other._forwardTaylorOrder),
           _reverseOne(other._reverseOne),
           _reverseTwo(other._reverseTwo),
           _jacobian(other._jacobian),
@@ -114,6 +124,8 @@ public:
           _sparseReverseTwo(other._sparseReverseTwo),
           _sparseJacobian(other._sparseJacobian),
           _sparseHessian(other._sparseHessian),
+          _hessianVectorProduct(other._hessianVectorProduct),
+          _hessianVectorProductDirections(other._hessianVectorProductDirections),
           _forwardOneSparsity(other._forwardOneSparsity),
           _reverseOneSparsity(other._reverseOneSparsity),
           _reverseTwoSparsity(other._reverseTwoSparsity),
@@ -147,6 +159,14 @@ public:
                                                                                                   atomic.getName());
     }
 
+    /**
+     * Provides the context for atomic functions which must be passed to the
+     * generated functions of this model when they are called directly
+     * (e.g. through function pointers obtained from the model library).
+     * It remains valid while this model object exists.
+     */
+    inline const LangCAtomicFun& getAtomicFunctionContext() const { return _atomicFuncArg; }
+
     // Jacobian sparsity
     bool isJacobianSparsityAvailable() override { return _jacobianSparsity != nullptr; }
 
@@ -323,6 +343,7 @@ public:
                              " please use the variable size methods")
         CPPADCG_ASSERT_KNOWN(dep.size() == _m, "Invalid dependent array size")
         CPPADCG_ASSERT_KNOWN(x.size() == _n, "Invalid independent array size")
+        CPPADCG_ASSERT_KNOWN(!isOverlapping(x, dep), "The independent and dependent arrays must not overlap")
         CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0,
                              "Some atomic functions used by the compiled model have not been specified yet")
 
@@ -356,6 +377,7 @@ public:
                              " please use the variable size methods")
         CPPADCG_ASSERT_KNOWN(tx.size() == _n, "Invalid independent array size")
         CPPADCG_ASSERT_KNOWN(ty.size() == _m, "Invalid dependent array size")
+        CPPADCG_ASSERT_KNOWN(!isOverlapping(tx, ty), "The independent and dependent arrays must not overlap")
         CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0,
                              "Some atomic functions used by the compiled model have not been specified yet")
 
@@ -390,6 +412,7 @@ public:
                              " please use the variable size methods")
         CPPADCG_ASSERT_KNOWN(x.size() == _n, "Invalid independent array size")
         CPPADCG_ASSERT_KNOWN(jac.size() == _m * _n, "Invalid Jacobian array size")
+        CPPADCG_ASSERT_KNOWN(!isOverlapping(x, jac), "The independent and Jacobian arrays must not overlap")
         CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0,
                              "Some atomic functions used by the compiled model have not been specified yet")
 
@@ -411,6 +434,8 @@ public:
         CPPADCG_ASSERT_KNOWN(x.size() == _n, "Invalid independent array size")
         CPPADCG_ASSERT_KNOWN(w.size() == _m, "Invalid multiplier array size")
         CPPADCG_ASSERT_KNOWN(hess.size() == _n * _n, "Invalid Hessian size")
+        CPPADCG_ASSERT_KNOWN(!isOverlapping(x, hess) && !isOverlapping(w, hess),
+                             "The input and Hessian arrays must not overlap")
         CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0,
                              "Some atomic functions used by the compiled model have not been specified yet")
 
@@ -484,6 +509,36 @@ public:
         }
     }
 
+    bool isForwardTaylorAvailable() override { return _forwardTaylor != nullptr; }
+
+    size_t getForwardTaylorOrder() override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, ERROR_LIBRARY_NOT_READY)
+        CPPADCG_ASSERT_KNOWN(_forwardTaylorOrder != nullptr,
+                             "No forward Taylor function defined in the dynamic library")
+
+        return (*_forwardTaylorOrder)();
+    }
+
+    void ForwardTaylor(ArrayView<const Base> tx, ArrayView<Base> ty) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, ERROR_LIBRARY_NOT_READY)
+        CPPADCG_ASSERT_KNOWN(_forwardTaylor != nullptr, "No forward Taylor function defined in the dynamic library")
+        CPPADCG_ASSERT_KNOWN(_in.size() == 1,
+                             "The number of independent variable arrays is higher than 1,"
+                             " please use the variable size methods")
+
+        const size_t p = (*_forwardTaylorOrder)();
+
+        CPPADCG_ASSERT_KNOWN(tx.size() >= (p + 1) * _n, "Invalid tx size")
+        CPPADCG_ASSERT_KNOWN(ty.size() >= (p + 1) * _m, "Invalid ty size")
+        CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0,
+                             "Some atomic functions used by the compiled model have not been specified yet")
+
+        _in[0] = tx.data();
+        _out[0] = ty.data();
+
+        (*_forwardTaylor)(&_in[0], &_out[0], _atomicFuncArg);
+    }
+
     bool isReverseOneAvailable() override { return _reverseOne != nullptr; }
 
     void ReverseOne(ArrayView<const Base> tx,
@@ -863,6 +918,74 @@ public:
         }
     }
 
+    /// calculate Hessian-vector products
+
+    bool isHessianVectorProductAvailable() override { return _hessianVectorProduct != nullptr; }
+
+    size_t getHessianVectorProductDirections() override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, ERROR_LIBRARY_NOT_READY)
+        CPPADCG_ASSERT_KNOWN(_hessianVectorProductDirections != nullptr,
+                             "No Hessian-vector product function defined in the dynamic library")
+
+        return (*_hessianVectorProductDirections)();
+    }
+
+    void HessianVectorProduct(ArrayView<const Base> x,
+                              ArrayView<const Base> w,
+                              ArrayView<const Base> v,
+                              ArrayView<Base> hv) override {
+        CPPADCG_ASSERT_KNOWN(_isLibraryReady, ERROR_LIBRARY_NOT_READY)
+        CPPADCG_ASSERT_KNOWN(_hessianVectorProduct != nullptr,
+                             "No Hessian-vector product function defined in the dynamic library")
+        CPPADCG_ASSERT_KNOWN(x.size() == _n, "Invalid independent array size")
+        CPPADCG_ASSERT_KNOWN(w.size() == _m, "Invalid multiplier array size")
+        CPPADCG_ASSERT_KNOWN(_n == 0 ? v.size() == 0 : v.size() % _n == 0, "Invalid direction array size")
+        CPPADCG_ASSERT_KNOWN(hv.size() == v.size(), "Invalid Hessian-vector product array size")
+        CPPADCG_ASSERT_KNOWN(!isOverlapping(x, hv) && !isOverlapping(w, hv) && !isOverlapping(v, hv),
+                             "The input and Hessian-vector product arrays must not overlap")
+        CPPADCG_ASSERT_KNOWN(_in.size() == 1,
+                             "The number of independent variable arrays is higher than 1,"
+                             " please use the variable size methods")
+        CPPADCG_ASSERT_KNOWN(_missingAtomicFunctions == 0,
+                             "Some atomic functions used by the compiled model have not been specified yet")
+
+        if (v.size() == 0) return;
+
+        const size_t directions = (*_hessianVectorProductDirections)();
+        const size_t blockSize = directions * _n;
+        if (blockSize == 0) {
+            // the blocks below would never advance
+            throw CGException("Invalid Hessian-vector product block: ", directions, " directions and ", _n,
+                              " independent variables");
+        }
+
+        const Base* in[3] = {x.data(), w.data(), nullptr};
+        Base* out[1];
+
+        // complete blocks of directions are evaluated directly
+        size_t e = 0;
+        for (; e + blockSize <= v.size(); e += blockSize) {
+            in[2] = &v[e];
+            out[0] = &hv[e];
+            (*_hessianVectorProduct)(in, out, _atomicFuncArg);
+        }
+
+        if (e < v.size()) {
+            // the last block is padded with zero directions
+            _tx.resize(blockSize);
+            _ty.resize(blockSize);
+            size_t rest = v.size() - e;
+            std::copy(&v[e], &v[e] + rest, &_tx[0]);
+            std::fill(&_tx[0] + rest, &_tx[0] + blockSize, Base(0));
+
+            in[2] = &_tx[0];
+            out[0] = &_ty[0];
+            (*_hessianVectorProduct)(in, out, _atomicFuncArg);
+
+            std::copy(&_ty[0], &_ty[0] + rest, &hv[e]);
+        }
+    }
+
 protected:
     /**
      * Creates a new model
@@ -878,6 +1001,8 @@ protected:
           _missingAtomicFunctions(0),
           _zero(nullptr),
           _forwardOne(nullptr),
+          _forwardTaylor(nullptr),
+          _forwardTaylorOrder(nullptr),
           _reverseOne(nullptr),
           _reverseTwo(nullptr),
           _jacobian(nullptr),
@@ -887,6 +1012,8 @@ protected:
           _sparseReverseTwo(nullptr),
           _sparseJacobian(nullptr),
           _sparseHessian(nullptr),
+          _hessianVectorProduct(nullptr),
+          _hessianVectorProductDirections(nullptr),
           _forwardOneSparsity(nullptr),
           _reverseOneSparsity(nullptr),
           _reverseTwoSparsity(nullptr),
@@ -942,6 +1069,10 @@ protected:
                 loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_FORWAD_ZERO, false));
         _forwardOne = reinterpret_cast<decltype(_forwardOne)>(
                 loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_FORWARD_ONE, false));
+        _forwardTaylor = reinterpret_cast<decltype(_forwardTaylor)>(
+                loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_FORWARD_TAYLOR, false));
+        _forwardTaylorOrder = reinterpret_cast<decltype(_forwardTaylorOrder)>(
+                loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_FORWARD_TAYLOR_ORDER, false));
         _reverseOne = reinterpret_cast<decltype(_reverseOne)>(
                 loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_REVERSE_ONE, false));
         _reverseTwo = reinterpret_cast<decltype(_reverseTwo)>(
@@ -960,6 +1091,10 @@ protected:
                 loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_SPARSE_JACOBIAN, false));
         _sparseHessian = reinterpret_cast<decltype(_sparseHessian)>(
                 loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_SPARSE_HESSIAN, false));
+        _hessianVectorProduct = reinterpret_cast<decltype(_hessianVectorProduct)>(
+                loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_HESSIAN_VECTOR_PRODUCT, false));
+        _hessianVectorProductDirections = reinterpret_cast<decltype(_hessianVectorProductDirections)>(
+                loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_HESSIAN_VECTOR_PRODUCT_DIRECTIONS, false));
         _forwardOneSparsity = reinterpret_cast<decltype(_forwardOneSparsity)>(
                 loadFunction(_name + "_" + ModelCSourceGen<Base>::FUNCTION_FORWARD_ONE_SPARSITY, false));
         _reverseOneSparsity = reinterpret_cast<decltype(_reverseOneSparsity)>(
@@ -991,6 +1126,10 @@ protected:
                              "Missing functions in the dynamic library")
         CPPADCG_ASSERT_KNOWN((_sparseHessian == nullptr) || (_hessianSparsity != nullptr),
                              "Missing functions in the dynamic library")
+        CPPADCG_ASSERT_KNOWN((_hessianVectorProduct == nullptr) == (_hessianVectorProductDirections == nullptr),
+                             "Missing functions in the dynamic library")
+        CPPADCG_ASSERT_KNOWN((_forwardTaylor == nullptr) == (_forwardTaylorOrder == nullptr),
+                             "Missing functions in the dynamic library")
 
         /**
          * Prepare the atomic functions argument
@@ -1057,10 +1196,24 @@ protected:
         }
     }
 
+    /**
+     * Whether or not an input array shares memory with an output array.
+     * The generated functions assume that the input and output arrays never
+     * overlap (they are restrict qualified when vectorizable loops are
+     * generated).
+     */
+    static inline bool isOverlapping(ArrayView<const Base> in, ArrayView<Base> out) {
+        if (in.size() == 0 || out.size() == 0) return false;
+        std::less<const Base*> before;
+        return before(in.data(), out.data() + out.size()) && before(out.data(), in.data() + in.size());
+    }
+
     virtual void modelLibraryClosed() {
         _isLibraryReady = false;
         _zero = nullptr;
         _forwardOne = nullptr;
+        _forwardTaylor = nullptr;
+        _forwardTaylorOrder = nullptr;
         _reverseOne = nullptr;
         _reverseTwo = nullptr;
         _jacobian = nullptr;
@@ -1070,6 +1223,8 @@ protected:
         _sparseReverseTwo = nullptr;
         _sparseJacobian = nullptr;
         _sparseHessian = nullptr;
+        _hessianVectorProduct = nullptr;
+        _hessianVectorProductDirections = nullptr;
         _forwardOneSparsity = nullptr;
         _reverseOneSparsity = nullptr;
         _reverseTwoSparsity = nullptr;
@@ -29,6 +29,10 @@ class FunctorModelLibrary : public ModelLibrary<Base> {
 protected:
     std::set<std::string> _modelNames;
     unsigned long _version;  // API version
+    /// the exported library descriptor (nullptr if it is not available)
+    const CppADCGLibraryTable* _libraryTable;
+    /// the exported descriptor of each model
+    std::map<std::string, const CppADCGModelTable*> _modelTables;
     void (*_onClose)();
     void (*_setThreadPoolDisabled)(int);
     int (*_isThreadPoolDisabled)();
@@ -42,11 +46,15 @@ protected:
     float (*_getThreadPoolGuidedMaxWork)();
     void (*_setThreadPoolNumberOfTimeMeas)(unsigned int n);
     unsigned int (*_getThreadPoolNumberOfTimeMeas)();
+    void (*_setThreadPoolNumaAware)(int numaAware);
+    int (*_isThreadPoolNumaAware)();
 
 public:
     inline FunctorModelLibrary(FunctorModelLibrary&& other) noexcept
         : _modelNames(std::move(other._modelNames)),
           _version(other._version),
+          _libraryTable(other._libraryTable),
+          _modelTables(std::move(other._modelTables)),
           _onClose(other._onClose),
           _setThreadPoolDisabled(other._setThreadPoolDisabled),
           _isThreadPoolDisabled(other._isThreadPoolDisabled),
@@ -59,7 +67,9 @@ public:
           _setThreadPoolGuidedMaxWork(other._setThreadPoolGuidedMaxWork),
           _getThreadPoolGuidedMaxWork(other._getThreadPoolGuidedMaxWork),
           _setThreadPoolNumberOfTimeMeas(other._setThreadPoolNumberOfTimeMeas),
-          _getThreadPoolNumberOfTimeMeas(other._getThreadPoolNumberOfTimeMeas) {
+          _getThreadPoolNumberOfTimeMeas(other._getThreadPoolNumberOfTimeMeas),
+          _setThreadPoolNumaAware(other._setThreadPoolNumaAware),
+          _isThreadPoolNumaAware(other._isThreadPoolNumaAware) {
         other._onClose = nullptr;
     }
 
@@ -101,6 +111,29 @@ public:
      */
     virtual void* loadFunction(const std::string& functionName, bool required = true) = 0;
 
+    /**
+     * Provides a pointer to a function of a model in the model library.
+     * The exported model descriptor is used when available which avoids
+     * a symbol lookup for each function.
+     *
+     * @param modelName The model name
+     * @param functionName The name of the function in the dynamic library
+     * @param required Whether or not the function must exist in the library
+     * @return A pointer to the function if it exists, nullptr otherwise.
+     * @throws CGException If the function is required and it does not exist
+     */
+    virtual void* loadModelFunction(const std::string& modelName,
+                                    const std::string& functionName,
+                                    bool required = true) {
+        auto it = _modelTables.find(modelName);
+        if (it == _modelTables.end()) {
+            return loadFunction(functionName, required);
+        }
+
+        const CppADCGModelTable& table = *it->second;
+        return findTableFunction(table.n_functions, table.function_names, table.functions, functionName, required);
+    }
+
     void setThreadPoolDisabled(bool disabled) override {
         if (_setThreadPoolDisabled != nullptr) {
             (*_setThreadPoolDisabled)(disabled);
@@ -179,11 +212,25 @@ public:
         return 0;
     }
 
+    void setThreadPoolNumaAware(bool numaAware) override {
+        if (_setThreadPoolNumaAware != nullptr) {
+            (*_setThreadPoolNumaAware)(int(numaAware));
+        }
+    }
+
+    bool isThreadPoolNumaAware() const override {
+        if (_isThreadPoolNumaAware != nullptr) {
+            return bool((*_isThreadPoolNumaAware)());
+        }
+        return false;
+    }
+
     inline virtual ~FunctorModelLibrary() = default;
 
 protected:
     FunctorModelLibrary()
         : _version(0),  // not really required (but it avoids warnings)
+          _libraryTable(nullptr),
           _onClose(nullptr),
           _setThreadPoolDisabled(nullptr),
           _isThreadPoolDisabled(nullptr),
@@ -196,17 +243,29 @@ protected:
           _setThreadPoolGuidedMaxWork(nullptr),
           _getThreadPoolGuidedMaxWork(nullptr),
           _setThreadPoolNumberOfTimeMeas(nullptr),
-          _getThreadPoolNumberOfTimeMeas(nullptr) {}
+          _getThreadPoolNumberOfTimeMeas(nullptr),
+          _setThreadPoolNumaAware(nullptr),
+          _isThreadPoolNumaAware(nullptr) {}
 
     inline void validate() {
         /**
-         * Check the version
+         * The library descriptor (a single lookup for all the library and model functions)
          */
-        unsigned long (*versionFunc)();
-        versionFunc =
-                reinterpret_cast<decltype(versionFunc)>(loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_VERSION));
+        _libraryTable = reinterpret_cast<const CppADCGLibraryTable*>(
+                loadFunction(ModelLibraryCSourceGen<Base>::LIBRARY_TABLE, false));
 
-        _version = (*versionFunc)();
+        /**
+         * Check the version
+         */
+        if (_libraryTable != nullptr) {
+            _version = _libraryTable->version;
+        } else {
+            unsigned long (*versionFunc)();
+            versionFunc = reinterpret_cast<decltype(versionFunc)>(
+                    loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_VERSION));
+
+            _version = (*versionFunc)();
+        }
         if (ModelLibraryCSourceGen<Base>::API_VERSION != _version)
             throw CGException("The API version of the dynamic library (", _version,
                               ") is incompatible with the current version (", ModelLibraryCSourceGen<Base>::API_VERSION,
@@ -214,57 +273,99 @@ protected:
 
         /**
          * Load the list of models
+         * (the model functions are only resolved when a model is created)
          */
-        void (*modelsFunc)(char const* const**, int*);
-        modelsFunc =
-                reinterpret_cast<decltype(modelsFunc)>(loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_MODELS));
-
-        char const* const* model_names = nullptr;
-        int model_count;
-        (*modelsFunc)(&model_names, &model_count);
-
-        for (int i = 0; i < model_count; i++) {
-            _modelNames.insert(model_names[i]);
+        if (_libraryTable != nullptr) {
+            for (unsigned long i = 0; i < _libraryTable->n_models; i++) {
+                const CppADCGModelTable* table = _libraryTable->models[i];
+                _modelNames.insert(table->name);
+                _modelTables[table->name] = table;
+            }
+        } else {
+            void (*modelsFunc)(char const* const**, int*);
+            modelsFunc = reinterpret_cast<decltype(modelsFunc)>(
+                    loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_MODELS));
+
+            char const* const* model_names = nullptr;
+            int model_count;
+            (*modelsFunc)(&model_names, &model_count);
+
+            for (int i = 0; i < model_count; i++) {
+                _modelNames.insert(model_names[i]);
+            }
         }
 
         /**
          * Load the the on close function
          */
         _onClose = reinterpret_cast<decltype(_onClose)>(
-                loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_ONCLOSE, false));
+                loadLibraryFunction(ModelLibraryCSourceGen<Base>::FUNCTION_ONCLOSE, false));
 
         /**
          * Thread pool related functions
          */
         _setThreadPoolDisabled = reinterpret_cast<decltype(_setThreadPoolDisabled)>(
-                loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLDISABLED, false));
+                loadLibraryFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLDISABLED, false));
         _isThreadPoolDisabled = reinterpret_cast<decltype(_isThreadPoolDisabled)>(
-                loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_ISTHREADPOOLDISABLED, false));
+                loadLibraryFunction(ModelLibraryCSourceGen<Base>::FUNCTION_ISTHREADPOOLDISABLED, false));
         _setThreads = reinterpret_cast<decltype(_setThreads)>(
-                loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADS, false));
+                loadLibraryFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADS, false));
         _getThreads = reinterpret_cast<decltype(_getThreads)>(
-                loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADS, false));
+                loadLibraryFunction(ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADS, false));
         _setSchedulerStrategy = reinterpret_cast<decltype(_setSchedulerStrategy)>(
-                this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADSCHEDULERSTRAT, false));
+                loadLibraryFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADSCHEDULERSTRAT, false));
         _getSchedulerStrategy = reinterpret_cast<decltype(_getSchedulerStrategy)>(
-                this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADSCHEDULERSTRAT, false));
+                loadLibraryFunction(ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADSCHEDULERSTRAT, false));
         _setThreadPoolVerbose = reinterpret_cast<decltype(_setThreadPoolVerbose)>(
-                this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLVERBOSE, false));
+                loadLibraryFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLVERBOSE, false));
         _isThreadPoolVerbose = reinterpret_cast<decltype(_isThreadPoolVerbose)>(
-                this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_ISTHREADPOOLVERBOSE, false));
+                loadLibraryFunction(ModelLibraryCSourceGen<Base>::FUNCTION_ISTHREADPOOLVERBOSE, false));
         _setThreadPoolGuidedMaxWork = reinterpret_cast<decltype(_setThreadPoolGuidedMaxWork)>(
-                this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLGUIDEDMAXGROUPWORK, false));
+                loadLibraryFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLGUIDEDMAXGROUPWORK, false));
         _getThreadPoolGuidedMaxWork = reinterpret_cast<decltype(_getThreadPoolGuidedMaxWork)>(
-                this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLGUIDEDMAXGROUPWORK, false));
+                loadLibraryFunction(ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLGUIDEDMAXGROUPWORK, false));
         _setThreadPoolNumberOfTimeMeas = reinterpret_cast<decltype(_setThreadPoolNumberOfTimeMeas)>(
-                this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLNUMBEROFTIMEMEAS, false));
+                loadLibraryFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLNUMBEROFTIMEMEAS, false));
         _getThreadPoolNumberOfTimeMeas = reinterpret_cast<decltype(_getThreadPoolNumberOfTimeMeas)>(
-                this->loadFunction(ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLNUMBEROFTIMEMEAS, false));
+                loadLibraryFunction(ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLNUMBEROFTIMEMEAS, false));
+        _setThreadPoolNumaAware = reinterpret_cast<decltype(_setThreadPoolNumaAware)>(
+                loadLibraryFunction(ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLNUMAAWARE, false));
+        _isThreadPoolNumaAware = reinterpret_cast<decltype(_isThreadPoolNumaAware)>(
+                loadLibraryFunction(ModelLibraryCSourceGen<Base>::FUNCTION_ISTHREADPOOLNUMAAWARE, false));
 
         if (_setThreads != nullptr) {
             (*_setThreads)(std::thread::hardware_concurrency());
         }
     }
+
+    /**
+     * Provides a pointer to a library level function using the library
+     * descriptor when it is available.
+     */
+    inline void* loadLibraryFunction(const std::string& functionName, bool required = true) {
+        if (_libraryTable == nullptr) {
+            return loadFunction(functionName, required);
+        }
+
+        return findTableFunction(_libraryTable->n_functions, _libraryTable->function_names, _libraryTable->functions,
+                                 functionName, required);
+    }
+
+    static inline void* findTableFunction(unsigned long n,
+                                          const char* const* names,
+                                          void* const* functions,
+                                          const std::string& functionName,
+                                          bool required) {
+        for (unsigned long i = 0; i < n; i++) {
+            if (functionName == names[i]) {
+                return functions[i];
+            }
+        }
+
+        if (required) throw CGException("Failed to load function '", functionName, "' from the function table");
+
+        return nullptr;
+    }
 };
 
 }  // namespace cg
@@ -453,6 +453,56 @@ public:
     virtual void ForwardOne(
             ArrayView<const Base> x, size_t tx1Nnz, const size_t idx[], const Base tx1[], ArrayView<Base> ty1) = 0;
 
+    /***********************************************************************
+     *                        Forward Taylor
+     **********************************************************************/
+
+    /**
+     * Determines whether or not the forward mode of an arbitrary order
+     * (all Taylor coefficients up to a given order) can be evaluated.
+     *
+     * @return true if it is possible to evaluate the Taylor coefficients
+     *         up to getForwardTaylorOrder()
+     */
+    virtual bool isForwardTaylorAvailable() = 0;
+
+    /**
+     * Provides the highest order (p) of the Taylor coefficients determined
+     * by ForwardTaylor().
+     *
+     * @return the highest order of the Taylor coefficients
+     */
+    virtual size_t getForwardTaylorOrder() = 0;
+
+    /**
+     * Computes the Taylor coefficients of the dependent variables from
+     * order zero up to order p = getForwardTaylorOrder() in a single
+     * call (as CppAD::ADFun::Forward(p, tx)).
+     *
+     * @param tx The Taylor coefficients of the independent variables
+     *           (tx[j * (p + 1) + k])
+     * @return The Taylor coefficients of the dependent variables
+     *         (ty[i * (p + 1) + k])
+     */
+    template <typename VectorBase>
+    inline VectorBase ForwardTaylor(const VectorBase& tx) {
+        VectorBase ty((getForwardTaylorOrder() + 1) * Range());
+        this->ForwardTaylor(ArrayView<const Base>(&tx[0], tx.size()), ArrayView<Base>(&ty[0], ty.size()));
+        return ty;
+    }
+
+    /**
+     * Computes the Taylor coefficients of the dependent variables from
+     * order zero up to order p = getForwardTaylorOrder() in a single
+     * call (as CppAD::ADFun::Forward(p, tx)).
+     *
+     * @param tx The Taylor coefficients of the independent variables
+     *           (tx[j * (p + 1) + k])
+     * @param ty The Taylor coefficients of the dependent variables
+     *           (ty[i * (p + 1) + k])
+     */
+    virtual void ForwardTaylor(ArrayView<const Base> tx, ArrayView<Base> ty) = 0;
+
     /***********************************************************************
      *                        Reverse one
      **********************************************************************/
@@ -823,6 +873,59 @@ public:
                                size_t const** row,
                                size_t const** col) = 0;
 
+    /***********************************************************************
+     *                        Hessian-vector products
+     **********************************************************************/
+
+    /**
+     * Determines whether or not the Hessian-vector product methods can be
+     * called.
+     *
+     * @return true if it is possible to evaluate products of the weighted
+     *         sum of the Hessians with vectors
+     */
+    virtual bool isHessianVectorProductAvailable() = 0;
+
+    /**
+     * Provides the number of directions evaluated by each call to the
+     * compiled Hessian-vector product function.
+     * Any number of directions can be provided to HessianVectorProduct(),
+     * however it is more efficient to use multiples of this value.
+     *
+     * @return the number of directions of each compiled evaluation
+     */
+    virtual size_t getHessianVectorProductDirections() = 0;
+
+    /**
+     * Determines the products of the weighted sum of the Hessians with
+     * several vectors (directions).
+     * \f[ hv_d = \frac{\rm d^2  }{{\rm d} x^2 } \left( \sum_{i} w_i F_i (x) \right) v_d \f]
+     *
+     * @param x The independent variables
+     * @param w The equation multipliers
+     * @param v The directions (direction d is v[d * n + j]); its size must
+     *          be a multiple of the number of independent variables
+     * @return The products (the product for direction d is hv[d * n + j])
+     */
+    template <typename VectorBase>
+    inline VectorBase HessianVectorProduct(const VectorBase& x, const VectorBase& w, const VectorBase& v) {
+        VectorBase hv(v.size());
+        HessianVectorProduct(ArrayView<const Base>(&x[0], x.size()), ArrayView<const Base>(&w[0], w.size()),
+                             ArrayView<const Base>(&v[0], v.size()), ArrayView<Base>(&hv[0], hv.size()));
+        return hv;
+    }
+
+    /**
+     * @copydoc GenericModel::HessianVectorProduct(const VectorBase&, const VectorBase&, const VectorBase&)
+     *
+     * @param hv The products (the product for direction d is hv[d * n + j]);
+     *           it must have the same size as v
+     */
+    virtual void HessianVectorProduct(ArrayView<const Base> x,
+                                      ArrayView<const Base> w,
+                                      ArrayView<const Base> v,
+                                      ArrayView<Base> hv) = 0;
+
     /**
      * Provides a wrapper for this compiled model allowing it to be used as
      * an atomic function. The model must not be deleted while the atomic
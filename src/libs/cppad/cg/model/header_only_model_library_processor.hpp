@@ -0,0 +1,285 @@
+#ifndef CPPAD_CG_HEADER_ONLY_MODEL_LIBRARY_PROCESSOR_INCLUDED
+#define CPPAD_CG_HEADER_ONLY_MODEL_LIBRARY_PROCESSOR_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Generates a self-contained C++ header for the models of a model library.
+ *
+ * Each model is placed in its own namespace with its dimensions as
+ * constexpr constants and with inline functions templated on the scalar
+ * type (and std::array overloads) which can be inlined into the caller:
+ *  - forward_zero(x, y)
+ *  - jacobian(x, jac) (dense, row-major)
+ *  - hessian(x, w, hess) (dense, of the weighted sum of the equations)
+ *
+ * The functions are created according to the model options (sparse
+ * Jacobians and Hessians are also provided as dense matrices).
+ * Atomic functions and loops are not supported since they require the
+ * runtime of a compiled model library.
+ * This is intended for small models evaluated in tight loops.
+ *
+ * @author Feng Yang
+ */
+template <class Base>
+class HeaderOnlyModelLibraryProcessor : public ModelLibraryProcessor<Base> {
+public:
+    using CGBase = CG<Base>;
+
+protected:
+    /**
+     * the namespace where all models are placed
+     */
+    std::string namespace_;
+
+public:
+    inline explicit HeaderOnlyModelLibraryProcessor(ModelLibraryCSourceGen<Base>& modelLibraryHelper,
+                                                    std::string libraryNamespace = "cppadcg_models")
+        : ModelLibraryProcessor<Base>(modelLibraryHelper), namespace_(std::move(libraryNamespace)) {}
+
+    inline virtual ~HeaderOnlyModelLibraryProcessor() = default;
+
+    /**
+     * @return the namespace where all models are placed
+     */
+    inline const std::string& getNamespace() const { return namespace_; }
+
+    /**
+     * Defines the namespace where all models are placed.
+     *
+     * @param libraryNamespace a valid C++ identifier
+     */
+    inline void setNamespace(const std::string& libraryNamespace) { namespace_ = libraryNamespace; }
+
+    /**
+     * Generates the C++ header with all the models of the library.
+     *
+     * @return the header source code
+     */
+    inline std::string generateHeader() {
+        std::string guard = namespace_;
+        std::transform(guard.begin(), guard.end(), guard.begin(), ::toupper);
+        guard += "_INCLUDED";
+
+        std::ostringstream out;
+        out << "#ifndef " << guard << "\n"
+            << "#define " << guard << "\n"
+            << "/* generated by CppADCodeGen */\n"
+               "\n"
+               "#include <array>\n"
+               "#include <cmath>\n"
+               "#include <cstddef>\n"
+               "#include <cstdio>\n"
+               "\n"
+               "namespace "
+            << namespace_ << " {\n";
+
+        for (const auto& itm : this->modelLibraryHelper_->getModels()) {
+            generateModel(out, *itm.second);
+        }
+
+        out << "}  // namespace " << namespace_ << "\n"
+            << "\n"
+               "#endif\n";
+
+        return out.str();
+    }
+
+    /**
+     * Saves the C++ header with all the models of the library.
+     *
+     * @param file the path of the header
+     */
+    inline void saveHeader(const std::string& file) {
+        std::ofstream headerFile;
+        headerFile.open(file.c_str());
+        if (!headerFile) {
+            throw CGException("Failed to create the header file '", file, "'");
+        }
+        headerFile << generateHeader();
+        headerFile.close();
+    }
+
+    inline static void saveLibraryHeaderTo(ModelLibraryCSourceGen<Base>& modelLibraryHelper,
+                                           const std::string& file) {
+        HeaderOnlyModelLibraryProcessor p(modelLibraryHelper);
+        p.saveHeader(file);
+    }
+
+protected:
+    virtual void generateModel(std::ostringstream& out, ModelCSourceGen<Base>& model) {
+        using std::vector;
+
+        ADFun<CGBase>& fun = this->getFunction(model);
+        const std::string& name = model.getName();
+        const size_t m = fun.Range();
+        const size_t n = fun.Domain();
+
+        out << "\n"
+               "namespace "
+            << name
+            << " {\n"
+               "\n"
+               "constexpr std::size_t n = "
+            << n
+            << ";  // number of independent variables\n"
+               "constexpr std::size_t m = "
+            << m << ";  // number of dependent variables\n";
+
+        /**
+         * zero order forward mode
+         */
+        if (model.isCreateForwardZero()) {
+            CodeHandler<Base> handler;
+            vector<CGBase> indVars(n);
+            handler.makeVariables(indVars);
+
+            vector<CGBase> dep = fun.Forward(0, indVars);
+
+            LangCDefaultVariableNameGenerator<Base> nameGen("y", "x");
+            std::string body = generateBody(model, handler, dep, nameGen, "forward zero");
+
+            out << "\n"
+                   "template <class Scalar>\n"
+                   "inline void forward_zero(const Scalar* x, Scalar* y) {\n"
+                << body
+                << "}\n"
+                   "\n"
+                   "template <class Scalar>\n"
+                   "inline std::array<Scalar, m> forward_zero(const std::array<Scalar, n>& x) {\n"
+                   "    std::array<Scalar, m> y;\n"
+                   "    forward_zero(x.data(), y.data());\n"
+                   "    return y;\n"
+                   "}\n";
+        }
+
+        /**
+         * dense Jacobian
+         */
+        if (model.isCreateJacobian() || model.isCreateSparseJacobian()) {
+            CodeHandler<Base> handler;
+            vector<CGBase> indVars(n);
+            handler.makeVariables(indVars);
+
+            vector<CGBase> jac = fun.Jacobian(indVars);
+
+            LangCDefaultVariableNameGenerator<Base> nameGen("jac", "x");
+            std::string body = generateBody(model, handler, jac, nameGen, "Jacobian");
+
+            out << "\n"
+                   "template <class Scalar>\n"
+                   "inline void jacobian(const Scalar* x, Scalar* jac) {\n"
+                << body
+                << "}\n"
+                   "\n"
+                   "template <class Scalar>\n"
+                   "inline std::array<Scalar, m * n> jacobian(const std::array<Scalar, n>& x) {\n"
+                   "    std::array<Scalar, m * n> jac;\n"
+                   "    jacobian(x.data(), jac.data());\n"
+                   "    return jac;\n"
+                   "}\n";
+        }
+
+        /**
+         * dense Hessian
+         */
+        if (model.isCreateHessian() || model.isCreateSparseHessian()) {
+            CodeHandler<Base> handler;
+            vector<CGBase> indVars(n);
+            handler.makeVariables(indVars);
+            vector<CGBase> w(m);
+            handler.makeVariables(w);
+
+            vector<CGBase> hess = fun.Hessian(indVars, w);
+
+            // make use of the symmetry of the Hessian in order to reduce operations
+            for (size_t i = 0; i < n; i++) {
+                for (size_t j = 0; j < i; j++) {
+                    hess[i * n + j] = hess[j * n + i];
+                }
+            }
+
+            LangCDefaultVariableNameGenerator<Base> nameGen("hess", "x");
+            LangCDefaultHessianVarNameGenerator<Base> nameGenHess(&nameGen, "w", n);
+            std::string body = generateBody(model, handler, hess, nameGenHess, "Hessian");
+
+            out << "\n"
+                   "template <class Scalar>\n"
+                   "inline void hessian(const Scalar* x, const Scalar* w, Scalar* hess) {\n"
+                << body
+                << "}\n"
+                   "\n"
+                   "template <class Scalar>\n"
+                   "inline std::array<Scalar, n * n> hessian(const std::array<Scalar, n>& x,\n"
+                   "                                         const std::array<Scalar, m>& w) {\n"
+                   "    std::array<Scalar, n * n> hess;\n"
+                   "    hessian(x.data(), w.data(), hess.data());\n"
+                   "    return hess;\n"
+                   "}\n";
+        }
+
+        out << "\n"
+               "}  // namespace "
+            << name << "\n";
+    }
+
+    /**
+     * Creates the body of a function with the operations of an operation
+     * graph using the scalar type 'Scalar'.
+     */
+    static inline std::string generateBody(ModelCSourceGen<Base>& model,
+                                           CodeHandler<Base>& handler,
+                                           std::vector<CGBase>& dep,
+                                           VariableNameGenerator<Base>& nameGen,
+                                           const std::string& jobName) {
+        if (!handler.getAtomicFunctions().empty()) {
+            throw CGException("Model '", model.getName(),
+                              "' uses atomic functions which are not supported in header-only models");
+        }
+
+        // no function name: only the operations are printed
+        LanguageC<Base> langC("Scalar", 4);
+        langC.setParameterPrecision(model.getParameterPrecision());
+
+        std::ostringstream code;
+        handler.generateCode(code, langC, dep, nameGen, jobName);
+
+        if (!handler.getLoops().empty() || nameGen.getMaxTemporaryArrayVariableID() > 0 ||
+            nameGen.getMaxTemporarySparseArrayVariableID() > 0) {
+            throw CGException("Model '", model.getName(), "' uses loops or arrays which are not supported in "
+                              "header-only models");
+        }
+
+        std::ostringstream body;
+        // the overloads from <cmath> are used for the standard floating point types
+        body << "    using namespace std;\n";
+
+        size_t size = nameGen.getMaxTemporaryVariableID() + 1 - nameGen.getMinTemporaryVariableID();
+        if (size > 0) {
+            body << "    Scalar v[" << size << "];\n";
+        }
+        body << "\n" << code.str();
+
+        return body.str();
+    }
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
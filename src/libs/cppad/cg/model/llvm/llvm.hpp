@@ -40,6 +40,8 @@
 #include <cppad/cg/model/llvm/v9_0/llvm9_0.hpp>
 #elif LLVM_VERSION_MAJOR == 10 && LLVM_VERSION_MINOR == 0
 #include <cppad/cg/model/llvm/v10_0/llvm10_0.hpp>
+#elif LLVM_VERSION_MAJOR >= 14
+#include <cppad/cg/model/llvm/v14_0/llvm14_0.hpp>
 #endif
 
 #endif
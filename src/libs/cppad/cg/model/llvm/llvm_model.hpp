@@ -54,7 +54,7 @@ protected:
     }
 
     void* loadFunction(const std::string& functionName, bool required = true) override {
-        return _dynLib->loadFunction(functionName, required);
+        return _dynLib->loadModelFunction(this->_name, functionName, required);
     }
 
     void modelLibraryClosed() override {
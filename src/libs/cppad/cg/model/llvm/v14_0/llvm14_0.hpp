@@ -0,0 +1,91 @@
+#ifndef CPPAD_CG_LLVM14_0_INCLUDED
+#define CPPAD_CG_LLVM14_0_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2020 Joao Leal
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Joao Leal
+ */
+
+/**
+ * LLVM requires the use of it own flags which can make it difficult to compile
+ * libraries not using NDEBUG often required by LLVM.
+ * The define LLVM_CPPFLAG_NDEBUG can be used to apply NDEBUG only to LLVM
+ * headers.
+ */
+#ifdef LLVM_WITH_NDEBUG
+
+// save the original NDEBUG definition
+#ifdef NDEBUG
+#define _OUTER_NDEBUG_DEFINED
+#endif
+
+#if LLVM_WITH_NDEBUG == 1
+#define NDEBUG
+#else
+#undef NDEBUG
+#endif
+
+#endif
+
+#include <clang/Basic/DiagnosticOptions.h>
+#include <clang/CodeGen/CodeGenAction.h>
+#include <clang/Frontend/CompilerInstance.h>
+#include <clang/Frontend/CompilerInvocation.h>
+#include <clang/Frontend/TextDiagnosticPrinter.h>
+#include <clang/Frontend/Utils.h>
+#include <clang/Lex/PreprocessorOptions.h>
+
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Intrinsics.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Verifier.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Support/raw_os_ostream.h>
+#if LLVM_VERSION_MAJOR >= 17
+#include <llvm/TargetParser/Host.h>
+#include <llvm/TargetParser/Triple.h>
+#else
+#include <llvm/ADT/Triple.h>
+#include <llvm/Support/Host.h>
+#endif
+
+#ifdef LLVM_WITH_NDEBUG
+
+// recover the original NDEBUG
+#ifdef _OUTER_NDEBUG_DEFINED
+#define NDEBUG
+#else
+#undef NDEBUG
+#endif
+
+// no need for this anymore
+#undef _OUTER_NDEBUG_DEFINED
+
+#endif
+
+#include <cppad/cg/lang/llvm/language_llvm.hpp>
+#include <cppad/cg/model/compiler/clang_compiler.hpp>
+#include <cppad/cg/model/llvm/llvm_model_library.hpp>
+#include <cppad/cg/model/llvm/llvm_model.hpp>
+#include <cppad/cg/model/llvm/v14_0/llvm_model_data_functions.hpp>
+#include <cppad/cg/model/llvm/v14_0/llvm_model_library_impl.hpp>
+#include <cppad/cg/model/llvm/v14_0/llvm_model_library_processor.hpp>
+
+#endif
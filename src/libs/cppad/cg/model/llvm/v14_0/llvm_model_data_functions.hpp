@@ -0,0 +1,288 @@
+#ifndef CPPAD_CG_LLVM_MODEL_DATA_FUNCTIONS_INCLUDED
+#define CPPAD_CG_LLVM_MODEL_DATA_FUNCTIONS_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Creates the model functions which only provide constant data (model
+ * information, atomic function names and sparsity patterns) directly as
+ * LLVM IR.
+ * The functions have the same signatures as the C functions created by
+ * ModelCSourceGen, and the arrays they return are constant global
+ * variables of the module.
+ *
+ * @author Feng Yang
+ */
+class LlvmModelDataFunctions {
+protected:
+    /**
+     * the module where the functions are created
+     */
+    llvm::Module& _module;
+    /**
+     * unsigned long
+     */
+    llvm::IntegerType* _indexType;
+    /**
+     * unsigned long const*
+     */
+    llvm::PointerType* _indexPtrType;
+
+public:
+    explicit LlvmModelDataFunctions(llvm::Module& module)
+        : _module(module),
+          _indexType(llvm::Type::getIntNTy(module.getContext(), 8 * sizeof(unsigned long))),
+          _indexPtrType(llvm::PointerType::getUnqual(_indexType)) {}
+
+    /**
+     * Creates the function
+     * @code
+     * void name(const char** baseName, unsigned long* m, unsigned long* n,
+     *           unsigned int* indCount, unsigned int* depCount)
+     * @endcode
+     */
+    llvm::Function* createInfo(const std::string& name,
+                               const std::string& baseName,
+                               size_t m,
+                               size_t n,
+                               size_t indCount,
+                               size_t depCount) {
+        llvm::LLVMContext& context = _module.getContext();
+        llvm::IntegerType* uintType = llvm::Type::getIntNTy(context, 8 * sizeof(unsigned int));
+        llvm::PointerType* charPtrType = llvm::PointerType::getUnqual(llvm::Type::getInt8Ty(context));
+
+        llvm::Function* function = createFunction(name, llvm::Type::getVoidTy(context),
+                                                  {llvm::PointerType::getUnqual(charPtrType),
+                                                   llvm::PointerType::getUnqual(_indexType),
+                                                   llvm::PointerType::getUnqual(_indexType),
+                                                   llvm::PointerType::getUnqual(uintType),
+                                                   llvm::PointerType::getUnqual(uintType)});
+        llvm::IRBuilder<> builder(&function->getEntryBlock());
+
+        auto arg = function->arg_begin();
+        builder.CreateStore(createString(baseName), &*arg++);
+        builder.CreateStore(llvm::ConstantInt::get(_indexType, m), &*arg++);
+        builder.CreateStore(llvm::ConstantInt::get(_indexType, n), &*arg++);
+        builder.CreateStore(llvm::ConstantInt::get(uintType, indCount), &*arg++);
+        builder.CreateStore(llvm::ConstantInt::get(uintType, depCount), &*arg);
+        builder.CreateRetVoid();
+
+        return function;
+    }
+
+    /**
+     * Creates the function
+     * @code
+     * void name(const char*** names, unsigned long* n)
+     * @endcode
+     */
+    llvm::Function* createAtomicFunctionNames(const std::string& name, const std::vector<std::string>& atomicNames) {
+        llvm::LLVMContext& context = _module.getContext();
+        llvm::PointerType* charPtrType = llvm::PointerType::getUnqual(llvm::Type::getInt8Ty(context));
+
+        llvm::Function* function = createFunction(
+                name, llvm::Type::getVoidTy(context),
+                {llvm::PointerType::getUnqual(llvm::PointerType::getUnqual(charPtrType)),
+                 llvm::PointerType::getUnqual(_indexType)});
+        llvm::IRBuilder<> builder(&function->getEntryBlock());
+
+        std::vector<llvm::Constant*> names;
+        names.reserve(atomicNames.size());
+        for (const std::string& atomicName : atomicNames) names.push_back(createString(atomicName));
+
+        auto arg = function->arg_begin();
+        builder.CreateStore(createArray(name + "_atomic", charPtrType, names), &*arg++);
+        builder.CreateStore(llvm::ConstantInt::get(_indexType, atomicNames.size()), &*arg);
+        builder.CreateRetVoid();
+
+        return function;
+    }
+
+    /**
+     * Creates the function
+     * @code
+     * void name(unsigned long const** row, unsigned long const** col, unsigned long* nnz)
+     * @endcode
+     */
+    llvm::Function* createSparsity(const std::string& name,
+                                   const std::vector<size_t>& rows,
+                                   const std::vector<size_t>& cols) {
+        CPPADCG_ASSERT_UNKNOWN(rows.size() == cols.size());
+
+        llvm::Function* function = createFunction(
+                name, llvm::Type::getVoidTy(_module.getContext()),
+                {llvm::PointerType::getUnqual(_indexPtrType), llvm::PointerType::getUnqual(_indexPtrType),
+                 llvm::PointerType::getUnqual(_indexType)});
+        llvm::IRBuilder<> builder(&function->getEntryBlock());
+
+        auto arg = function->arg_begin();
+        builder.CreateStore(createIndexArray(name + "_rows", rows), &*arg++);
+        builder.CreateStore(createIndexArray(name + "_cols", cols), &*arg++);
+        builder.CreateStore(llvm::ConstantInt::get(_indexType, rows.size()), &*arg);
+        builder.CreateRetVoid();
+
+        return function;
+    }
+
+    /**
+     * Creates the function (a sparsity pattern for each value of i)
+     * @code
+     * void name(unsigned long i, unsigned long const** row, unsigned long const** col, unsigned long* nnz)
+     * @endcode
+     * Empty patterns are returned for values of i without a pattern.
+     */
+    llvm::Function* createSparsities(const std::string& name,
+                                     const std::vector<std::vector<size_t>>& rows,
+                                     const std::vector<std::vector<size_t>>& cols) {
+        CPPADCG_ASSERT_UNKNOWN(rows.size() == cols.size());
+
+        llvm::LLVMContext& context = _module.getContext();
+
+        llvm::Function* function = createFunction(
+                name, llvm::Type::getVoidTy(context),
+                {_indexType, llvm::PointerType::getUnqual(_indexPtrType), llvm::PointerType::getUnqual(_indexPtrType),
+                 llvm::PointerType::getUnqual(_indexType)});
+        llvm::IRBuilder<> builder(&function->getEntryBlock());
+
+        auto arg = function->arg_begin();
+        llvm::Argument* i = &*arg++;
+        llvm::Argument* rowArg = &*arg++;
+        llvm::Argument* colArg = &*arg++;
+        llvm::Argument* nnzArg = &*arg;
+
+        // the patterns after the last non-empty pattern are not saved
+        size_t count = rows.size();
+        while (count > 0 && rows[count - 1].empty()) count--;
+
+        llvm::Constant* nullIndexes = llvm::ConstantPointerNull::get(_indexPtrType);
+        if (count == 0) {
+            builder.CreateStore(nullIndexes, rowArg);
+            builder.CreateStore(nullIndexes, colArg);
+            builder.CreateStore(llvm::ConstantInt::get(_indexType, 0), nnzArg);
+            builder.CreateRetVoid();
+            return function;
+        }
+
+        std::vector<llvm::Constant*> rowArrays(count), colArrays(count), nnzs(count);
+        for (size_t e = 0; e < count; e++) {
+            CPPADCG_ASSERT_UNKNOWN(rows[e].size() == cols[e].size());
+            rowArrays[e] = createIndexArray(name + "_rows" + std::to_string(e), rows[e]);
+            colArrays[e] = createIndexArray(name + "_cols" + std::to_string(e), cols[e]);
+            nnzs[e] = llvm::ConstantInt::get(_indexType, rows[e].size());
+        }
+
+        llvm::ArrayType* ptrArrayType = llvm::ArrayType::get(_indexPtrType, count);
+        llvm::ArrayType* nnzArrayType = llvm::ArrayType::get(_indexType, count);
+        auto* rowTable = createGlobal(name + "_rows", llvm::ConstantArray::get(ptrArrayType, rowArrays));
+        auto* colTable = createGlobal(name + "_cols", llvm::ConstantArray::get(ptrArrayType, colArrays));
+        auto* nnzTable = createGlobal(name + "_nnzs", llvm::ConstantArray::get(nnzArrayType, nnzs));
+
+        llvm::BasicBlock* found = llvm::BasicBlock::Create(context, "found", function);
+        llvm::BasicBlock* notFound = llvm::BasicBlock::Create(context, "notFound", function);
+        builder.CreateCondBr(builder.CreateICmpULT(i, llvm::ConstantInt::get(_indexType, count)), found, notFound);
+
+        builder.SetInsertPoint(found);
+        llvm::Value* zero = llvm::ConstantInt::get(_indexType, 0);
+        llvm::Value* row = builder.CreateInBoundsGEP(ptrArrayType, rowTable, {zero, i});
+        llvm::Value* col = builder.CreateInBoundsGEP(ptrArrayType, colTable, {zero, i});
+        llvm::Value* nnz = builder.CreateInBoundsGEP(nnzArrayType, nnzTable, {zero, i});
+        builder.CreateStore(builder.CreateLoad(_indexPtrType, row), rowArg);
+        builder.CreateStore(builder.CreateLoad(_indexPtrType, col), colArg);
+        builder.CreateStore(builder.CreateLoad(_indexType, nnz), nnzArg);
+        builder.CreateRetVoid();
+
+        builder.SetInsertPoint(notFound);
+        builder.CreateStore(nullIndexes, rowArg);
+        builder.CreateStore(nullIndexes, colArg);
+        builder.CreateStore(zero, nnzArg);
+        builder.CreateRetVoid();
+
+        return function;
+    }
+
+protected:
+    /**
+     * Creates an external function with an empty entry block.
+     */
+    llvm::Function* createFunction(const std::string& name,
+                                   llvm::Type* returnType,
+                                   const std::vector<llvm::Type*>& argTypes) {
+        if (_module.getFunction(name) != nullptr) {
+            throw CGException("A function named '", name, "' already exists in the LLVM module");
+        }
+
+        llvm::FunctionType* funcType = llvm::FunctionType::get(returnType, argTypes, false);
+        llvm::Function* function = llvm::Function::Create(funcType, llvm::Function::ExternalLinkage, name, &_module);
+        function->addFnAttr(llvm::Attribute::NoUnwind);
+        llvm::BasicBlock::Create(_module.getContext(), "entry", function);
+        return function;
+    }
+
+    llvm::GlobalVariable* createGlobal(const std::string& name, llvm::Constant* value) {
+        auto* global = new llvm::GlobalVariable(_module, value->getType(), true, llvm::GlobalValue::PrivateLinkage,
+                                                value, name);
+        global->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
+        return global;
+    }
+
+    /**
+     * A pointer to the first element of a new constant array
+     * (a null pointer for empty arrays).
+     */
+    llvm::Constant* createArray(const std::string& name,
+                                llvm::Type* elementType,
+                                const std::vector<llvm::Constant*>& values) {
+        llvm::PointerType* ptrType = llvm::PointerType::getUnqual(elementType);
+        if (values.empty()) return llvm::ConstantPointerNull::get(ptrType);
+
+        llvm::ArrayType* arrayType = llvm::ArrayType::get(elementType, values.size());
+        llvm::GlobalVariable* global = createGlobal(name, llvm::ConstantArray::get(arrayType, values));
+
+        llvm::Constant* zero = llvm::ConstantInt::get(_indexType, 0);
+        llvm::Constant* indexes[] = {zero, zero};
+        llvm::Constant* first = llvm::ConstantExpr::getInBoundsGetElementPtr(arrayType, global, indexes);
+        return llvm::ConstantExpr::getPointerCast(first, ptrType);
+    }
+
+    llvm::Constant* createIndexArray(const std::string& name, const std::vector<size_t>& values) {
+        std::vector<llvm::Constant*> constants;
+        constants.reserve(values.size());
+        for (size_t v : values) constants.push_back(llvm::ConstantInt::get(_indexType, v));
+        return createArray(name, _indexType, constants);
+    }
+
+    /**
+     * A pointer to a new null terminated constant string.
+     */
+    llvm::Constant* createString(const std::string& value) {
+        llvm::LLVMContext& context = _module.getContext();
+        llvm::Constant* data = llvm::ConstantDataArray::getString(context, value, true);
+        llvm::GlobalVariable* global = createGlobal(".str", data);
+
+        llvm::Constant* zero = llvm::ConstantInt::get(_indexType, 0);
+        llvm::Constant* indexes[] = {zero, zero};
+        llvm::Constant* first = llvm::ConstantExpr::getInBoundsGetElementPtr(data->getType(), global, indexes);
+        return llvm::ConstantExpr::getPointerCast(first,
+                                                  llvm::PointerType::getUnqual(llvm::Type::getInt8Ty(context)));
+    }
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
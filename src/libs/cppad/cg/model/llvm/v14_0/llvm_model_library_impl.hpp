@@ -0,0 +1,158 @@
+#ifndef CPPAD_CG_LLVM_MODEL_LIBRARY_IMPL_INCLUDED
+#define CPPAD_CG_LLVM_MODEL_LIBRARY_IMPL_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+template <class Base>
+class LlvmModel;
+
+/**
+ * Class used to load JIT'ed models by LLVM 14 or later.
+ *
+ * The modules are compiled with ORC (LLLazyJIT): the functions are only
+ * optimized and compiled when they are first called, and several functions
+ * can be compiled concurrently.
+ *
+ * @author Feng Yang
+ */
+template <class Base>
+class LlvmModelLibraryImpl : public LlvmModelLibrary<Base> {
+protected:
+    std::unique_ptr<llvm::orc::LLLazyJIT> _jit;
+    /**
+     * the optimization level used for the JIT'ed functions
+     */
+    llvm::OptimizationLevel _optLevel;
+
+public:
+    /**
+     * @param modules the modules with the functions of the model library
+     *                (there is no need to link them together)
+     * @param compileThreads the number of threads used to compile functions
+     *                       concurrently (0 means that functions are
+     *                       compiled by the thread which first calls them)
+     */
+    LlvmModelLibraryImpl(std::vector<llvm::orc::ThreadSafeModule> modules, unsigned compileThreads)
+        : _optLevel(llvm::OptimizationLevel::O2) {
+        llvm::InitializeNativeTarget();
+        llvm::InitializeNativeTargetAsmPrinter();
+
+        llvm::Expected<std::unique_ptr<llvm::orc::LLLazyJIT>> jit =
+                llvm::orc::LLLazyJITBuilder().setNumCompileThreads(compileThreads).create();
+        if (!jit) {
+            throw CGException("Could not create the LLVM JIT: ", llvm::toString(jit.takeError()));
+        }
+        _jit = std::move(*jit);
+
+        // symbols not defined in the modules (e.g. the math library) are taken from the process
+        auto generator = llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
+                _jit->getDataLayout().getGlobalPrefix());
+        if (!generator) {
+            throw CGException("Could not create the LLVM JIT symbol generator: ",
+                              llvm::toString(generator.takeError()));
+        }
+        _jit->getMainJITDylib().addGenerator(std::move(*generator));
+
+        _jit->getIRTransformLayer().setTransform(
+                [this](llvm::orc::ThreadSafeModule tsm,
+                       const llvm::orc::MaterializationResponsibility&) -> llvm::Expected<llvm::orc::ThreadSafeModule> {
+                    tsm.withModuleDo([this](llvm::Module& module) { optimizeModule(module); });
+                    return std::move(tsm);
+                });
+
+        for (llvm::orc::ThreadSafeModule& m : modules) {
+            addModule(std::move(m));
+        }
+
+        /**
+         *
+         */
+        this->validate();
+    }
+
+    LlvmModelLibraryImpl(const LlvmModelLibraryImpl&) = delete;
+    LlvmModelLibraryImpl& operator=(const LlvmModelLibraryImpl&) = delete;
+
+    inline virtual ~LlvmModelLibraryImpl() { this->cleanUp(); }
+
+    /**
+     * Adds a new module to the library (e.g. with functions created by
+     * LanguageLlvm).
+     * Its functions are only compiled when they are first used.
+     */
+    virtual void addModule(llvm::orc::ThreadSafeModule module) {
+        llvm::Error error = _jit->addLazyIRModule(std::move(module));
+        if (error) {
+            throw CGException("Failed to add module to the LLVM JIT: ", llvm::toString(std::move(error)));
+        }
+    }
+
+    inline llvm::OptimizationLevel getOptimizationLevel() const { return _optLevel; }
+
+    /**
+     * Defines the optimization level of the functions which have not been
+     * compiled yet.
+     */
+    inline void setOptimizationLevel(llvm::OptimizationLevel level) { _optLevel = level; }
+
+    void* loadFunction(const std::string& functionName, bool required = true) override {
+        auto symbol = _jit->lookup(functionName);
+        if (!symbol) {
+            std::string error = llvm::toString(symbol.takeError());
+            if (required) throw CGException("Unable to find function '", functionName, "' in LLVM module: ", error);
+            return nullptr;
+        }
+
+#if LLVM_VERSION_MAJOR >= 15
+        return symbol->toPtr<void*>();
+#else
+        return (void*) symbol->getAddress();
+#endif
+    }
+
+protected:
+    /**
+     * Optimizes a module before it is compiled (might be called from
+     * several threads at the same time for different modules)
+     */
+    virtual void optimizeModule(llvm::Module& module) {
+        if (_optLevel == llvm::OptimizationLevel::O0) return;
+
+        llvm::LoopAnalysisManager lam;
+        llvm::FunctionAnalysisManager fam;
+        llvm::CGSCCAnalysisManager cgam;
+        llvm::ModuleAnalysisManager mam;
+
+        llvm::PassBuilder builder;
+        builder.registerModuleAnalyses(mam);
+        builder.registerCGSCCAnalyses(cgam);
+        builder.registerFunctionAnalyses(fam);
+        builder.registerLoopAnalyses(lam);
+        builder.crossRegisterProxies(lam, fam, cgam, mam);
+
+        llvm::ModulePassManager mpm = builder.buildPerModuleDefaultPipeline(_optLevel);
+        mpm.run(module, mam);
+    }
+
+    friend class LlvmModel<Base>;
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
@@ -0,0 +1,496 @@
+#ifndef CPPAD_CG_LLVM_MODEL_LIBRARY_PROCESSOR_INCLUDED
+#define CPPAD_CG_LLVM_MODEL_LIBRARY_PROCESSOR_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+#include <cppad/cg/model/llvm/llvm_base_model_library_processor.hpp>
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Useful class for generating a JIT evaluated model library (LLVM 14 or
+ * later).
+ *
+ * The zero order forward mode, the dense Jacobian and the dense Hessian
+ * functions of each model are created directly as LLVM IR by LanguageLlvm
+ * from the same operation graphs used for the C sources.
+ * The C source is still used for these functions when they contain
+ * operations which are not supported by LanguageLlvm (e.g. loops).
+ * The model information, the atomic function names and the Jacobian and
+ * Hessian sparsity patterns are also created directly as LLVM IR
+ * (LlvmModelDataFunctions).
+ * The remaining source files are still converted into their own LLVM module
+ * by the embedded Clang (several files at the same time): the sparse
+ * Jacobian and Hessian, the directional functions (forward one, reverse
+ * one and two, Hessian vector product, forward Taylor) and their sparsity
+ * patterns, the model function table, the library functions, the thread
+ * pool and any custom source.
+ * The modules are given directly to ORC without being linked together.
+ *
+ * @author Feng Yang
+ */
+template <class Base>
+class LlvmModelLibraryProcessor : public LlvmBaseModelLibraryProcessor<Base> {
+protected:
+    const std::string _version;
+    std::vector<std::string> _includePaths;
+    /**
+     * the maximum number of files converted at the same time and the number
+     * of threads used by the JIT to compile functions
+     */
+    size_t _maxParallelJobs;
+    /**
+     * whether or not the model functions defined by a single operation
+     * graph and the constant data functions are created directly as LLVM IR
+     */
+    bool _irModelFunctions;
+    std::vector<llvm::orc::ThreadSafeModule> _modules;
+    std::mutex _mutex;
+
+public:
+    /**
+     * Creates a LLVM model library processor.
+     *
+     * @param librarySourceGen
+     */
+    explicit LlvmModelLibraryProcessor(ModelLibraryCSourceGen<Base>& librarySourceGen)
+        : LlvmBaseModelLibraryProcessor<Base>(librarySourceGen),
+          _version(std::to_string(LLVM_VERSION_MAJOR)),
+          _maxParallelJobs(std::max<size_t>(std::thread::hardware_concurrency(), 1)),
+          _irModelFunctions(true) {}
+
+    virtual ~LlvmModelLibraryProcessor() = default;
+
+    /**
+     * @return The version of LLVM (and Clang).
+     */
+    inline const std::string& getVersion() const { return _version; }
+
+    /**
+     * Define additional header paths.
+     */
+    inline void setIncludePaths(const std::vector<std::string>& includePaths) { _includePaths = includePaths; }
+
+    /**
+     * User defined header paths.
+     */
+    inline const std::vector<std::string>& getIncludePaths() const { return _includePaths; }
+
+    inline size_t getMaxParallelJobs() const { return _maxParallelJobs; }
+
+    /**
+     * Defines the maximum number of source files converted at the same time
+     * and the number of threads used by the JIT to compile functions.
+     */
+    inline void setMaxParallelJobs(size_t jobs) { _maxParallelJobs = std::max<size_t>(jobs, 1); }
+
+    /**
+     * Whether or not the zero order forward mode, the dense Jacobian, the
+     * dense Hessian and the constant data functions (model information,
+     * atomic function names and sparsity patterns) are created directly as
+     * LLVM IR (instead of converting their C source code with Clang).
+     */
+    inline bool isCreateIrModelFunctions() const { return _irModelFunctions; }
+
+    /**
+     * Defines whether or not the zero order forward mode, the dense
+     * Jacobian, the dense Hessian and the constant data functions (model
+     * information, atomic function names and sparsity patterns) are created
+     * directly as LLVM IR (instead of converting their C source code with
+     * Clang).
+     * It is only used by create() without an external compiler.
+     */
+    inline void setCreateIrModelFunctions(bool irModelFunctions) { _irModelFunctions = irModelFunctions; }
+
+    /**
+     *
+     * @return a model library
+     */
+    std::unique_ptr<LlvmModelLibrary<Base>> create() {
+        // backup output format so that it can be restored
+        OStreamConfigRestore coutb(std::cout);
+
+        _modules.clear();
+
+        this->modelLibraryHelper_->startingJob("", JobTimer::JIT_MODEL_LIBRARY);
+
+        llvm::InitializeNativeTarget();
+        llvm::InitializeNativeTargetAsmPrinter();
+
+        /**
+         * generate the sources (not thread-safe)
+         */
+        std::vector<const std::pair<const std::string, std::string>*> sources;
+
+        const std::map<std::string, ModelCSourceGen<Base>*>& models = this->modelLibraryHelper_->getModels();
+        for (const auto& p : models) {
+            const std::map<std::string, std::string>& modelSources = this->getSources(*p.second);
+
+            // C sources replaced by IR functions
+            std::set<std::string> replaced;
+            if (_irModelFunctions) {
+                createIrModelFunctions(*p.second, modelSources, replaced);
+            }
+
+            for (const auto& s : modelSources) {
+                if (replaced.find(s.first) == replaced.end()) sources.push_back(&s);
+            }
+        }
+
+        for (const auto& s : this->getLibrarySources()) sources.push_back(&s);
+
+        for (const auto& s : this->modelLibraryHelper_->getCustomSources()) sources.push_back(&s);
+
+        /**
+         * convert the sources into modules
+         */
+        {
+            CompilerJobPool pool(std::min(_maxParallelJobs, sources.size()));
+            for (const auto* s : sources) {
+                pool.submit([this, s]() { addModule(createLlvmModule(s->first, s->second)); });
+            }
+            pool.wait();
+        }
+
+        std::unique_ptr<LlvmModelLibrary<Base>> lib(
+                new LlvmModelLibraryImpl<Base>(std::move(_modules), unsigned(_maxParallelJobs)));
+        _modules.clear();
+
+        this->modelLibraryHelper_->finishedJob();
+
+        return lib;
+    }
+
+    /**
+     * Creates a LLVM model library using an external Clang compiler to
+     * generate the bitcode.
+     *
+     * @param clang  the external compiler
+     * @return  a model library
+     */
+    std::unique_ptr<LlvmModelLibrary<Base>> create(ClangCompiler<Base>& clang) {
+        // backup output format so that it can be restored
+        OStreamConfigRestore coutb(std::cout);
+
+        _modules.clear();
+
+        std::unique_ptr<LlvmModelLibrary<Base>> lib;
+
+        this->modelLibraryHelper_->startingJob("", JobTimer::JIT_MODEL_LIBRARY);
+
+        try {
+            /**
+             * generate bit code
+             */
+            const std::set<std::string>& bcFiles = this->createBitCode(clang, _version);
+
+            /**
+             * Load bit code (a module for each file)
+             */
+            for (const std::string& itbc : bcFiles) {
+                llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffer = llvm::MemoryBuffer::getFile(itbc);
+                if (!buffer) {
+                    throw CGException(buffer.getError().message());
+                }
+
+                auto context = std::make_unique<llvm::LLVMContext>();
+                llvm::Expected<std::unique_ptr<llvm::Module>> moduleOrError =
+                        llvm::parseBitcodeFile(buffer.get()->getMemBufferRef(), *context);
+                if (!moduleOrError) {
+                    throw CGException(llvm::toString(moduleOrError.takeError()));
+                }
+
+                addModule(llvm::orc::ThreadSafeModule(std::move(moduleOrError.get()),
+                                                      llvm::orc::ThreadSafeContext(std::move(context))));
+            }
+
+            lib.reset(new LlvmModelLibraryImpl<Base>(std::move(_modules), unsigned(_maxParallelJobs)));
+            _modules.clear();
+
+        } catch (...) {
+            _modules.clear();
+            clang.cleanup();
+            throw;
+        }
+        clang.cleanup();
+
+        this->modelLibraryHelper_->finishedJob();
+
+        return lib;
+    }
+
+    static inline std::unique_ptr<LlvmModelLibrary<Base>> create(ModelLibraryCSourceGen<Base>& modelLibraryHelper) {
+        LlvmModelLibraryProcessor<Base> p(modelLibraryHelper);
+        return p.create();
+    }
+
+protected:
+    inline void addModule(llvm::orc::ThreadSafeModule module) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _modules.push_back(std::move(module));
+    }
+
+    /**
+     * Creates the model functions which are defined by a single operation
+     * graph and the constant data functions directly as LLVM IR (in a new
+     * module).
+     * It must be called after the C sources of the model are generated
+     * (which define the indexes of the atomic functions).
+     *
+     * @param model the model
+     * @param sources the C sources of the model
+     * @param replaced the C source files which are no longer needed (output)
+     */
+    virtual void createIrModelFunctions(ModelCSourceGen<Base>& model,
+                                        const std::map<std::string, std::string>& sources,
+                                        std::set<std::string>& replaced) {
+        using CGBase = CG<Base>;
+
+        auto context = std::make_unique<llvm::LLVMContext>();
+        auto module = std::make_unique<llvm::Module>(model.getName() + "_ir", *context);
+
+        const size_t n = this->getFunction(model).Domain();
+
+        /**
+         * zero order forward mode
+         * (the C source might have been split into concurrent jobs)
+         */
+        bool zeroMultiThreaded = this->modelLibraryHelper_->getMultiThreading() != MultiThreadingType::NONE &&
+                                 model.isZeroMultiThreadingEnabled();
+        if (model.isCreateForwardZero() && !zeroMultiThreaded) {
+            CodeHandler<Base> handler;
+            std::vector<CGBase> indVars;
+            std::vector<CGBase> dep = this->prepareForward0(model, handler, indVars);
+
+            LangCDefaultVariableNameGenerator<Base> nameGen("y", "x");
+            createIrFunction(*module, model, ModelCSourceGen<Base>::FUNCTION_FORWAD_ZERO, handler, dep, nameGen,
+                             sources, replaced);
+        }
+
+        /**
+         * dense Jacobian
+         */
+        if (model.isCreateJacobian()) {
+            CodeHandler<Base> handler;
+            std::vector<CGBase> indVars;
+            std::vector<CGBase> jac = this->prepareJacobian(model, handler, indVars);
+
+            LangCDefaultVariableNameGenerator<Base> nameGen("jac", "x");
+            createIrFunction(*module, model, ModelCSourceGen<Base>::FUNCTION_JACOBIAN, handler, jac, nameGen, sources,
+                             replaced);
+        }
+
+        /**
+         * dense Hessian
+         */
+        if (model.isCreateHessian()) {
+            CodeHandler<Base> handler;
+            std::vector<CGBase> indVars;
+            std::vector<CGBase> w;
+            std::vector<CGBase> hess = this->prepareHessian(model, handler, indVars, w);
+
+            LangCDefaultVariableNameGenerator<Base> nameGen("hess", "x");
+            LangCDefaultHessianVarNameGenerator<Base> nameGenHess(&nameGen, n);
+            createIrFunction(*module, model, ModelCSourceGen<Base>::FUNCTION_HESSIAN, handler, hess, nameGenHess,
+                             sources, replaced);
+        }
+
+        /**
+         * model information, atomic function names and sparsity patterns
+         */
+        createIrDataFunctions(*module, model, sources, replaced);
+
+        if (!module->empty()) {
+            addModule(llvm::orc::ThreadSafeModule(std::move(module), llvm::orc::ThreadSafeContext(std::move(context))));
+        }
+    }
+
+    /**
+     * Creates the model functions which only provide constant data (model
+     * information, atomic function names and the Jacobian and Hessian
+     * sparsity patterns) directly as LLVM IR.
+     * It must be called after the C sources of the model are generated.
+     *
+     * @param module the module where the functions are added
+     * @param model the model
+     * @param sources the C sources of the model (only the functions with a
+     *                C source are created)
+     * @param replaced the C source files which are no longer needed (output)
+     */
+    virtual void createIrDataFunctions(llvm::Module& module,
+                                       ModelCSourceGen<Base>& model,
+                                       const std::map<std::string, std::string>& sources,
+                                       std::set<std::string>& replaced) {
+        using Model = ModelCSourceGen<Base>;
+
+        LlvmModelDataFunctions data(module);
+        auto create = [&](const std::string& function) {
+            std::string file = model.getName() + "_" + function + ".c";
+            if (sources.find(file) == sources.end()) return false;
+            replaced.insert(file);
+            return true;
+        };
+
+        if (create(Model::FUNCTION_INFO)) {
+            ADFun<CG<Base>>& fun = this->getFunction(model);
+            std::unique_ptr<VariableNameGenerator<Base>> nameGen = this->createVariableNameGenerator(model);
+            data.createInfo(model.getName() + "_" + Model::FUNCTION_INFO,
+                            Model::baseTypeName() + "  " + typeid(Base).name(), fun.Range(), fun.Domain(),
+                            nameGen->getIndependent().size(), nameGen->getDependent().size());
+        }
+
+        if (create(Model::FUNCTION_ATOMIC_FUNC_NAMES)) {
+            data.createAtomicFunctionNames(model.getName() + "_" + Model::FUNCTION_ATOMIC_FUNC_NAMES,
+                                           this->getAtomicFunctions(model));
+        }
+
+        if (create(Model::FUNCTION_JACOBIAN_SPARSITY)) {
+            const auto& sparsity = this->getJacobianSparsity(model);
+            data.createSparsity(model.getName() + "_" + Model::FUNCTION_JACOBIAN_SPARSITY, sparsity.rows,
+                                sparsity.cols);
+        }
+
+        if (create(Model::FUNCTION_HESSIAN_SPARSITY)) {
+            const auto& sparsity = this->getHessianSparsity(model);
+            data.createSparsity(model.getName() + "_" + Model::FUNCTION_HESSIAN_SPARSITY, sparsity.rows,
+                                sparsity.cols);
+        }
+
+        if (create(Model::FUNCTION_HESSIAN_SPARSITY2)) {
+            const auto& sparsities = this->getHessianSparsities(model);
+            std::vector<std::vector<size_t>> rows(sparsities.size());
+            std::vector<std::vector<size_t>> cols(sparsities.size());
+            for (size_t i = 0; i < sparsities.size(); i++) {
+                rows[i] = sparsities[i].rows;
+                cols[i] = sparsities[i].cols;
+            }
+            data.createSparsities(model.getName() + "_" + Model::FUNCTION_HESSIAN_SPARSITY2, rows, cols);
+        }
+    }
+
+    /**
+     * Creates a model function directly as LLVM IR.
+     *
+     * @param module the module where the function is added
+     * @param model the model
+     * @param function the function name (without the model name)
+     * @param handler the code handler with the operation graph
+     * @param dep the dependent variables
+     * @param nameGen the variable name generator used for the C source
+     * @param sources the C sources of the model
+     * @param replaced the C source files which are no longer needed (output)
+     * @return true if the function was created, false if it uses operations
+     *         not supported by LanguageLlvm (the C source is used instead)
+     */
+    virtual bool createIrFunction(llvm::Module& module,
+                                  ModelCSourceGen<Base>& model,
+                                  const std::string& function,
+                                  CodeHandler<Base>& handler,
+                                  std::vector<CG<Base>>& dep,
+                                  VariableNameGenerator<Base>& nameGen,
+                                  const std::map<std::string, std::string>& sources,
+                                  std::set<std::string>& replaced) {
+        const std::string functionName = model.getName() + "_" + function;
+
+        LanguageLlvm<Base> langLlvm(module, functionName);
+        std::ostringstream code;
+        try {
+            handler.generateCode(code, langLlvm, dep, nameGen, this->getAtomicFunctions(model), function);
+        } catch (const CGException&) {
+            return false;
+        }
+
+        // the C source (and the functions it was split into)
+        const std::string splitPrefix = functionName + "__";
+        replaced.insert(functionName + ".c");
+        for (const auto& s : sources) {
+            if (s.first.compare(0, splitPrefix.size(), splitPrefix) == 0) replaced.insert(s.first);
+        }
+
+        return true;
+    }
+
+    /**
+     * Converts a C source file into a LLVM module with its own context
+     * (can be called from several threads at the same time).
+     */
+    virtual llvm::orc::ThreadSafeModule createLlvmModule(const std::string& filename, const std::string& source) {
+        using namespace llvm;
+        using namespace clang;
+
+        auto context = std::make_unique<LLVMContext>();
+
+        IntrusiveRefCntPtr<DiagnosticOptions> diagOpts = new DiagnosticOptions();
+        auto* diagClient = new TextDiagnosticPrinter(llvm::errs(), &*diagOpts);  // will be owned by diags
+        IntrusiveRefCntPtr<DiagnosticIDs> diagID(new DiagnosticIDs());
+        IntrusiveRefCntPtr<DiagnosticsEngine> diags(new DiagnosticsEngine(diagID, &*diagOpts, diagClient));
+
+        std::vector<const char*> args{"-Wall", "-x", "c", "string-input"};
+#if LLVM_VERSION_MAJOR >= 15
+        CreateInvocationOptions invocationOptions;
+        invocationOptions.Diags = diags;
+        std::shared_ptr<CompilerInvocation> invocation(createInvocation(args, std::move(invocationOptions)));
+#else
+        std::shared_ptr<CompilerInvocation> invocation(createInvocationFromCommandLine(args, diags));
+#endif
+        if (invocation == nullptr) throw CGException("Failed to create compiler invocation for '", filename, "'");
+
+        invocation->getFrontendOpts().DisableFree = false;  // make sure we free memory (by default it does not)
+
+        // Create a compiler instance to handle the actual work.
+        CompilerInstance compiler;
+        compiler.setInvocation(invocation);
+
+        // Create the compilers actual diagnostics engine.
+#if LLVM_VERSION_MAJOR >= 20
+        compiler.createDiagnostics(*llvm::vfs::getRealFileSystem());
+#else
+        compiler.createDiagnostics();
+#endif
+        if (!compiler.hasDiagnostics()) throw CGException("No diagnostics");
+
+        // Create memory buffer with source text
+        std::unique_ptr<MemoryBuffer> buffer = MemoryBuffer::getMemBufferCopy(source, filename);
+        if (buffer == nullptr) throw CGException("Failed to create memory buffer");
+
+        // Remap auxiliary name "string-input" to memory buffer
+        PreprocessorOptions& po = compiler.getInvocation().getPreprocessorOpts();
+        po.addRemappedFile("string-input", buffer.release());
+
+        HeaderSearchOptions& hso = compiler.getInvocation().getHeaderSearchOpts();
+        std::string iClangHeaders = this->findInternalClangCHeaders(_version, hso.ResourceDir);
+        if (!iClangHeaders.empty()) {
+            hso.AddPath(StringRef(iClangHeaders), frontend::Angled, false, false);
+        }
+
+        for (const std::string& path : _includePaths)
+            hso.AddPath(StringRef(path), frontend::Angled, false, false);
+
+        // Create and execute the frontend to generate an LLVM bitcode module.
+        EmitLLVMOnlyAction action(context.get());
+        if (!compiler.ExecuteAction(action)) throw CGException("Failed to emit LLVM bitcode for '", filename, "'");
+
+        std::unique_ptr<Module> module = action.takeModule();
+        if (module == nullptr) throw CGException("No module");
+
+        return orc::ThreadSafeModule(std::move(module), orc::ThreadSafeContext(std::move(context)));
+    }
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
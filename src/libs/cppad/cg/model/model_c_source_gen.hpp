@@ -60,6 +60,16 @@ public:
     static const std::string FUNCTION_REVERSE_TWO_SPARSITY;
     static const std::string FUNCTION_INFO;
     static const std::string FUNCTION_ATOMIC_FUNC_NAMES;
+    static const std::string FUNCTION_HESSIAN_VECTOR_PRODUCT;
+    static const std::string FUNCTION_HESSIAN_VECTOR_PRODUCT_DIRECTIONS;
+    static const std::string FUNCTION_FORWARD_TAYLOR;
+    static const std::string FUNCTION_FORWARD_TAYLOR_ORDER;
+    static const std::string FUNCTION_TABLE;
+    /**
+     * The C definitions of the exported function tables
+     * (see CppADCGModelTable and CppADCGLibraryTable)
+     */
+    static const std::string FUNCTION_TABLE_STRUCT_DEFINITION;
 
 protected:
     static const std::string CONST;
@@ -178,6 +188,15 @@ protected:
     bool _sparseJacobian;
     /// generate source code for a sparse Hessian
     bool _sparseHessian;
+    /// generate source code for Hessian-vector products
+    bool _hessianVectorProduct;
+    /// the number of directions of each Hessian-vector product evaluation
+    size_t _hvpDirections;
+    /**
+     * the number of directions evaluated by each concurrent job of a
+     * Hessian-vector product (zero means a single job)
+     */
+    size_t _hvpJobDirections;
     /**
      * generate source-code for the Hessian sparsity pattern for each
      * equation/dependent
@@ -185,6 +204,10 @@ protected:
     bool _hessianByEquation;
     /// generate source code for forward first order mode
     bool _forwardOne;
+    /// generate source code for forward mode up to _taylorOrder
+    bool _forwardTaylor;
+    /// the highest order of the Taylor coefficients of forward_taylor
+    size_t _taylorOrder;
     /// generate source code for reverse first order mode
     bool _reverseOne;
     /// generate source code for reverse second order mode
@@ -200,6 +223,11 @@ protected:
      */
     bool _sparseHessianReusesRev2;
     JacobianADMode _jacMode;
+    /**
+     * whether or not Jacobian and Hessian source code is created by
+     * differentiating the operation graph directly (without CppAD sweeps)
+     */
+    bool _symbolicDerivatives;
     /**
      * Custom Jacobian element indexes
      */
@@ -234,6 +262,56 @@ protected:
      * the maximum number of operations per variable assignment
      */
     size_t _maxOperationsPerAssignment;
+    /**
+     * the maximum number of threads used to combine sparsity patterns
+     */
+    size_t _maxSparsityThreads;
+    /**
+     * whether or not algebraically equivalent operations are simplified
+     * during source code generation
+     */
+    bool _algebraicSimplification;
+    /**
+     * whether or not to generate source code which reduces register pressure
+     * (scheduling of temporary variables and scalar temporary variables)
+     */
+    bool _registerPressureAware;
+    /**
+     * the minimum number of operations in repeated subgraphs for them to be
+     * replaced by calls to a shared function (zero means disabled)
+     */
+    size_t _minOutlineOperations;
+    /**
+     * the minimum number of operations used only by a case of a conditional
+     * expression for it to be evaluated inside an if/else (zero means
+     * disabled)
+     */
+    size_t _minLazyBranchOperations;
+    /**
+     * whether or not some operations may be evaluated with a single
+     * floating-point precision (float)
+     */
+    bool _mixedPrecision;
+    /**
+     * the maximum estimated relative error of the dependent variables when
+     * operations are evaluated with a reduced precision
+     */
+    double _mixedPrecisionTolerance;
+    /**
+     * whether or not to generate loops which can be vectorized by the C
+     * compiler
+     */
+    bool _simdLoops;
+    /**
+     * the maximum number of concurrent jobs used to evaluate the zero order
+     * model (values lower than 2 disable the parallel evaluation)
+     */
+    size_t _zeroParallelJobs;
+    /**
+     * the minimum number of operations of each concurrent job used to
+     * evaluate the zero order model
+     */
+    size_t _zeroParallelMinOperations;
     /**
      *
      */
@@ -298,16 +376,32 @@ public:
           _hessian(false),
           _sparseJacobian(false),
           _sparseHessian(false),
+          _hessianVectorProduct(false),
+          _hvpDirections(1),
+          _hvpJobDirections(0),
           _hessianByEquation(false),
           _forwardOne(false),
+          _forwardTaylor(false),
+          _taylorOrder(2),
           _reverseOne(false),
           _reverseTwo(false),
           _sparseJacobianReusesOne(true),
           _sparseHessianReusesRev2(true),
           _jacMode(JacobianADMode::Automatic),
+          _symbolicDerivatives(false),
           _atomicsInfo(nullptr),
           _maxAssignPerFunc(20000),
           _maxOperationsPerAssignment(1000),
+          _maxSparsityThreads(1),
+          _algebraicSimplification(false),
+          _registerPressureAware(false),
+          _minOutlineOperations(0),
+          _minLazyBranchOperations(0),
+          _mixedPrecision(false),
+          _mixedPrecisionTolerance(1e-6),
+          _simdLoops(false),
+          _zeroParallelJobs(0),
+          _zeroParallelMinOperations(10000),
           _jobTimer(nullptr) {
         CPPADCG_ASSERT_KNOWN(!_name.empty(), "Model name cannot be empty")
         CPPADCG_ASSERT_KNOWN((_name[0] >= 'a' && _name[0] <= 'z') || (_name[0] >= 'A' && _name[0] <= 'Z'),
@@ -406,6 +500,15 @@ public:
         return _multiThreading && _loopTapes.empty() && _sparseHessian && _sparseHessianReusesRev2 && _reverseTwo;
     }
 
+    inline bool isZeroMultiThreadingEnabled() const {
+        return _multiThreading && _loopTapes.empty() && _zero && _zeroParallelJobs > 1;
+    }
+
+    inline bool isHessianVectorProductMultiThreadingEnabled() const {
+        return _multiThreading && _hessianVectorProduct && _hvpJobDirections > 0 &&
+               _hvpJobDirections < _hvpDirections;
+    }
+
     /**
      * Determines whether or not to generate source-code for a function
      * that evaluates a dense Hessian.
@@ -440,6 +543,33 @@ public:
      */
     inline void setJacobianADMode(JacobianADMode mode) { _jacMode = mode; }
 
+    /**
+     * Whether or not the source code for the Jacobian and the Hessian is
+     * created by differentiating the operation graph directly.
+     *
+     * @return true if symbolic reverse mode is used on the operation graph
+     */
+    inline bool isSymbolicDerivatives() const { return _symbolicDerivatives; }
+
+    /**
+     * Defines whether or not the source code for the Jacobian, the Hessian
+     * (dense and sparse), the Hessian-vector products and the sparse
+     * forward one, reverse one and reverse two functions is created by
+     * differentiating the operation graph of the model directly (see
+     * ReverseDifferentiator) instead of using CppAD forward/reverse sweeps
+     * with CG scalars.
+     * The local partial derivatives are then shared by all rows and no
+     * operations are created for structurally zero partial derivatives,
+     * which can considerably reduce the time and memory required to
+     * generate the source code of large models.
+     * Models with loops or with operations which cannot be differentiated
+     * (e.g. atomic functions) still use CppAD.
+     *
+     * @param symbolic true to use symbolic reverse mode on the operation
+     *                 graph
+     */
+    inline void setSymbolicDerivatives(bool symbolic) { _symbolicDerivatives = symbolic; }
+
     /**
      * Determines whether or not to generate source-code for a function
      * that evaluates a dense Jacobian.
@@ -498,6 +628,61 @@ public:
      */
     inline void setCreateSparseHessian(bool create) { _sparseHessian = create; }
 
+    /**
+     * Determines whether or not to generate source-code for a function
+     * that evaluates Hessian-vector products.
+     *
+     * @return true if source-code for Hessian-vector products should be
+     *         created, false otherwise
+     */
+    inline bool isCreateHessianVectorProduct() const { return _hessianVectorProduct; }
+
+    /**
+     * Defines whether or not to generate source-code for a function that
+     * evaluates the product of the weighted sum of the Hessians with
+     * several vectors (forward-over-reverse) without creating the Hessian:
+     * \f[ hv_d = \frac{\rm d^2  }{{\rm d} x^2 } \left( \sum_{i} w_i F_i (x) \right) v_d \f]
+     * The zero order forward sweep is shared by all the directions
+     * evaluated in the same call.
+     *
+     * @see setHessianVectorProductDirections()
+     *
+     * @param create true if source-code for Hessian-vector products should
+     *               be created, false otherwise
+     */
+    inline void setCreateHessianVectorProduct(bool create) { _hessianVectorProduct = create; }
+
+    /**
+     * The number of directions (vectors) evaluated by each call to the
+     * generated Hessian-vector product function.
+     */
+    inline size_t getHessianVectorProductDirections() const { return _hvpDirections; }
+
+    /**
+     * The number of directions evaluated by each concurrent job of the
+     * generated Hessian-vector product function (zero means that all
+     * directions are evaluated by the same thread).
+     */
+    inline size_t getHessianVectorProductJobDirections() const { return _hvpJobDirections; }
+
+    /**
+     * Defines the number of directions (vectors) evaluated by each call to
+     * the generated Hessian-vector product function.
+     * If multithreading is requested by the model library, the directions
+     * can be split into jobs evaluated concurrently by the thread pool (or
+     * OpenMP); each job repeats the zero order forward sweep and the number
+     * of directions is rounded up to a multiple of the directions per job.
+     *
+     * @param directions the number of directions of each evaluation
+     * @param jobDirections the number of directions evaluated by each
+     *                      concurrent job (zero disables multithreading)
+     */
+    inline void setHessianVectorProductDirections(size_t directions, size_t jobDirections = 0) {
+        CPPADCG_ASSERT_KNOWN(directions > 0, "The number of directions must be positive")
+        _hvpDirections = directions;
+        _hvpJobDirections = jobDirections;
+    }
+
     /**
      * Determines whether or not the sparse Hessian should reuse functions
      * generated for the reverse two pass.
@@ -651,6 +836,45 @@ public:
      */
     inline void setCreateForwardOne(bool create) { _forwardOne = create; }
 
+    /**
+     * Determines whether or not to generate source-code for a function
+     * that evaluates all the Taylor coefficients of the dependents up to
+     * a given order (forward mode of an arbitrary order).
+     *
+     * @return true if the generation of the source for the Taylor
+     *         coefficients is enabled, false otherwise.
+     */
+    inline bool isCreateForwardTaylor() const { return _forwardTaylor; }
+
+    /**
+     * Defines whether or not to generate source-code for a function that
+     * evaluates all the Taylor coefficients of the dependents from order
+     * zero up to getForwardTaylorOrder() in a single call.
+     * This can be used, for instance, by Taylor series ODE integrators.
+     * The coefficients use the same layout as CppAD::ADFun::Forward():
+     * tx[j * (p + 1) + k] and ty[i * (p + 1) + k].
+     *
+     * @see setForwardTaylorOrder()
+     *
+     * @param create true to enable the generation of the source for the
+     *               Taylor coefficients, false otherwise.
+     */
+    inline void setCreateForwardTaylor(bool create) { _forwardTaylor = create; }
+
+    /**
+     * @return the highest order of the Taylor coefficients determined by
+     *         the forward Taylor function
+     */
+    inline size_t getForwardTaylorOrder() const { return _taylorOrder; }
+
+    /**
+     * Defines the highest order (p) of the Taylor coefficients determined
+     * by the forward Taylor function.
+     *
+     * @param order the highest order of the Taylor coefficients
+     */
+    inline void setForwardTaylorOrder(size_t order) { _taylorOrder = order; }
+
     /**
      * Determines whether or not to generate source-code for the
      * first-order reverse mode that is used for the evaluation of the
@@ -818,6 +1042,203 @@ public:
         _maxOperationsPerAssignment = maxOperationsPerAssignment;
     }
 
+    /**
+     * The maximum number of threads used to combine the sparsity patterns
+     * of the loops of a model.
+     *
+     * @return The maximum number of threads (zero for the number of hardware
+     *         threads)
+     */
+    inline size_t getMaxSparsityThreads() const { return _maxSparsityThreads; }
+
+    /**
+     * Defines the maximum number of threads used to combine the sparsity
+     * patterns of the loops of a model (see CsrSparsity).
+     * Only large patterns are split among several threads.
+     *
+     * @param maxThreads The maximum number of threads (zero for the number of
+     *                   hardware threads). The default is 1.
+     */
+    inline void setMaxSparsityThreads(size_t maxThreads) { _maxSparsityThreads = maxThreads; }
+
+    /**
+     * Whether or not algebraically equivalent operations are simplified in
+     * the generated source code.
+     *
+     * @return true if the operations are simplified
+     */
+    inline bool isAlgebraicSimplification() const { return _algebraicSimplification; }
+
+    /**
+     * Defines whether or not algebraically equivalent operations are
+     * simplified in the generated source code (see
+     * CodeHandler::setAlgebraicSimplification()).
+     * Integer powers become multiplications, divisions by the same variable
+     * use a single reciprocal, inverse functions cancel out, and sign
+     * changes and constants are folded.
+     * The results can differ in rounding from the original model.
+     *
+     * @param simplify whether or not to simplify the operations
+     */
+    inline void setAlgebraicSimplification(bool simplify) { _algebraicSimplification = simplify; }
+
+    /**
+     * Whether or not the generated source code is optimized to reduce
+     * register pressure.
+     *
+     * @return true if temporary variables are scheduled close to their usage
+     *         and declared as scalar local variables
+     */
+    inline bool isRegisterPressureAware() const { return _registerPressureAware; }
+
+    /**
+     * Defines whether or not the generated source code should be optimized
+     * to reduce register pressure.
+     * Operations are reordered so that the temporary variables are
+     * evaluated right before their first usage and the temporary variables
+     * are declared as scalar local variables instead of elements of a large
+     * array which compilers are usually unable to keep in registers.
+     * Since scalar temporary variables cannot be shared by several
+     * functions, the maximum number of assignments per function is not
+     * used when this option is enabled.
+     *
+     * @param registerPressureAware whether or not to reduce register pressure
+     */
+    inline void setRegisterPressureAware(bool registerPressureAware) {
+        _registerPressureAware = registerPressureAware;
+    }
+
+    /**
+     * The minimum number of operations of repeated subgraphs for them to be
+     * replaced by calls to a shared function in the generated source code.
+     *
+     * @return the minimum number of operations (zero means disabled)
+     */
+    inline size_t getMinOutlineOperations() const { return _minOutlineOperations; }
+
+    /**
+     * Defines the minimum number of operations of repeated (isomorphic)
+     * subgraphs for them to be replaced by calls to a shared static
+     * function in the generated source code.
+     * Each source file which is created due to the maximum number of
+     * assignments per function contains its own copy of the used functions
+     * and their assignments are accounted for in that limit.
+     *
+     * @param minOperations the minimum number of operations in a subgraph
+     *                      (zero disables outlining)
+     */
+    inline void setMinOutlineOperations(size_t minOperations) { _minOutlineOperations = minOperations; }
+
+    /**
+     * The minimum number of operations used only by the true or the false
+     * case of a conditional expression for it to be replaced by an if/else.
+     *
+     * @return the minimum number of operations (zero means disabled)
+     */
+    inline size_t getMinLazyBranchOperations() const { return _minLazyBranchOperations; }
+
+    /**
+     * Defines the minimum number of operations used only by the true or the
+     * false case of a conditional expression (CondExpLt, CondExpGt, ...)
+     * for it to be replaced by an if/else in the generated source code.
+     * Only the operations of the selected case are then evaluated, which
+     * can significantly reduce the cost of models with large piecewise
+     * expressions (e.g. contact and friction models).
+     *
+     * @param minOperations the minimum number of operations of a case
+     *                      (zero disables it)
+     */
+    inline void setMinLazyBranchOperations(size_t minOperations) { _minLazyBranchOperations = minOperations; }
+
+    /**
+     * Whether or not elementwise operations may be evaluated in single
+     * precision (float).
+     *
+     * @return true if mixed precision source code is generated
+     */
+    inline bool isMixedPrecision() const { return _mixedPrecision; }
+
+    /**
+     * Defines whether or not elementwise operations of the zero order model
+     * and of the Jacobian (dense and sparse) may be evaluated in single
+     * precision (float) allowing compilers to vectorize them with twice as
+     * many elements.
+     * The operations are selected by an error estimation at the typical
+     * independent variable values (see setTypicalIndependentValues() and
+     * MixedPrecisionSelector); nothing changes if these values are not
+     * defined. Accumulations, divisions, dependent variable assignments and
+     * ill-conditioned operations keep the original precision.
+     * Temporary variables are declared as scalar variables (as in
+     * setRegisterPressureAware()) and the maximum number of assignments per
+     * function is not used.
+     *
+     * @param mixedPrecision whether or not to use mixed precision
+     * @param tolerance the maximum estimated relative error of the
+     *                  dependent variables
+     */
+    inline void setMixedPrecision(bool mixedPrecision, double tolerance = 1e-6) {
+        _mixedPrecision = mixedPrecision;
+        _mixedPrecisionTolerance = tolerance;
+    }
+
+    inline double getMixedPrecisionTolerance() const { return _mixedPrecisionTolerance; }
+
+    /**
+     * Whether or not the loops created for equation patterns are generated
+     * so that they can be vectorized by the C compiler.
+     *
+     * @return true if vectorizable loops are generated
+     */
+    inline bool isSimdLoops() const { return _simdLoops; }
+
+    /**
+     * Defines whether or not the loops created for equation patterns (see
+     * setRelatedDependents()) are generated so that they can be vectorized
+     * by the C compiler (see LanguageC::setSimdLoops()).
+     * Temporary variables are declared as scalar variables (as in
+     * setRegisterPressureAware()) and the maximum number of assignments per
+     * function is not used.
+     * The generated functions require input and output arrays which do not
+     * overlap (the model checks the arrays it receives).
+     *
+     * @param simdLoops whether or not to generate vectorizable loops
+     */
+    inline void setSimdLoops(bool simdLoops) { _simdLoops = simdLoops; }
+
+    /**
+     * The maximum number of concurrent jobs used to evaluate the zero order
+     * model.
+     *
+     * @return the maximum number of jobs (a value lower than 2 means that
+     *         the zero order model is evaluated by a single thread)
+     */
+    inline size_t getZeroParallelJobs() const { return _zeroParallelJobs; }
+
+    /**
+     * The minimum number of operations of each concurrent job used to
+     * evaluate the zero order model.
+     */
+    inline size_t getZeroParallelMinOperations() const { return _zeroParallelMinOperations; }
+
+    /**
+     * Defines whether or not the zero order model is split into several jobs
+     * which are evaluated concurrently by the thread pool (or OpenMP).
+     * The operations are partitioned into levels of independent jobs and a
+     * level only starts after the previous one has finished.
+     * Multithreaded code is only generated if requested by the model library,
+     * if multithreading is enabled for this model, loop detection is disabled,
+     * no atomic functions are used, and the model has enough operations.
+     *
+     * @param maxJobs the maximum number of concurrent jobs in each level
+     *                (typically the number of threads); values lower than 2
+     *                disable the parallel evaluation
+     * @param minJobOperations the minimum number of operations of each job
+     */
+    inline void setZeroParallelJobs(size_t maxJobs, size_t minJobOperations = 10000) {
+        _zeroParallelJobs = maxJobs;
+        _zeroParallelMinOperations = minJobOperations;
+    }
+
     inline virtual ~ModelCSourceGen() {
         delete _funNoLoops;
         delete _atomicsInfo;
@@ -843,6 +1264,15 @@ protected:
                                                                      const std::string& tmpName = "v",
                                                                      const std::string& tmpArrayName = "array");
 
+    /**
+     * Selects the operations which can be evaluated with a reduced
+     * precision when mixed precision is enabled.
+     */
+    virtual void selectReducedPrecision(CodeHandler<Base>& handler,
+                                        LanguageC<Base>& langC,
+                                        const std::vector<CGBase>& dependent,
+                                        const std::vector<CGBase>& independent);
+
     const std::map<std::string, std::string>& getSources(MultiThreadingType multiThreadingType, JobTimer* timer);
 
     virtual void generateSources(MultiThreadingType multiThreadingType, JobTimer* timer = nullptr);
@@ -853,6 +1283,12 @@ protected:
 
     virtual void generateAtomicFuncNames();
 
+    /**
+     * Generates the exported descriptor with all the functions of this
+     * model (it must be the last source to be generated).
+     */
+    virtual void generateFunctionTableSource();
+
     virtual bool isAtomicsUsed();
 
     virtual const std::map<size_t, AtomicUseInfo<Base>>& getAtomicsInfo();
@@ -861,7 +1297,29 @@ protected:
      * zero order (the original model)
      **********************************************************************/
 
-    virtual void generateZeroSource();
+    virtual void generateZeroSource(MultiThreadingType multiThreadingType);
+
+    /**
+     * Generates the source code for the zero order model split into jobs
+     * which are evaluated concurrently.
+     *
+     * @return false if the model could not be partitioned into concurrent
+     *         jobs (no source code is generated)
+     */
+    virtual bool generateZeroMultiThreadSource(const std::string& functionName,
+                                               CodeHandler<Base>& handler,
+                                               std::vector<CGBase>& indVars,
+                                               std::vector<CGBase>& dep,
+                                               MultiThreadingType multiThreadingType);
+
+    /**
+     * Creates the operation graph for the zero order model.
+     *
+     * @param handler the code handler where the graph is created
+     * @param indVars the independent variables (output)
+     * @return the dependent variables
+     */
+    virtual std::vector<CGBase> prepareForward0(CodeHandler<Base>& handler, std::vector<CGBase>& indVars);
 
     /**
      * Generates the operation graph for the zero order model with loops
@@ -874,6 +1332,15 @@ protected:
 
     virtual void generateJacobianSource();
 
+    /**
+     * Creates the operation graph for the dense Jacobian (row-major).
+     *
+     * @param handler the code handler where the graph is created
+     * @param indVars the independent variables (output)
+     * @return the Jacobian elements
+     */
+    virtual std::vector<CGBase> prepareJacobian(CodeHandler<Base>& handler, std::vector<CGBase>& indVars);
+
     virtual void generateSparseJacobianSource(MultiThreadingType multiThreadingType);
 
     virtual void generateSparseJacobianSource(bool forward);
@@ -972,6 +1439,19 @@ protected:
 
     virtual void generateHessianSource();
 
+    /**
+     * Creates the operation graph for the dense Hessian of the weighted
+     * sum of the equations (row-major).
+     *
+     * @param handler the code handler where the graph is created
+     * @param indVars the independent variables (output)
+     * @param w the equation multipliers (output)
+     * @return the Hessian elements
+     */
+    virtual std::vector<CGBase> prepareHessian(CodeHandler<Base>& handler,
+                                               std::vector<CGBase>& indVars,
+                                               std::vector<CGBase>& w);
+
     virtual void generateSparseHessianSource(MultiThreadingType multiThreadingType);
 
     virtual void generateSparseHessianSourceDirectly();
@@ -993,6 +1473,20 @@ protected:
 
     virtual void determineSecondOrderElements4Eval(std::vector<size_t>& userRows, std::vector<size_t>& userCols);
 
+    /***********************************************************************
+     * Hessian-vector products
+     **********************************************************************/
+
+    virtual void generateHessianVectorProductSource(MultiThreadingType multiThreadingType);
+
+    virtual void generateHessianVectorProductKernel(const std::string& functionName, size_t nDirections);
+
+    virtual std::string generateHessianVectorProductMultiThreadSource(const std::string& functionName,
+                                                                      const std::string& kernelName,
+                                                                      size_t jobDirections,
+                                                                      size_t nJobs,
+                                                                      MultiThreadingType multiThreadingType);
+
     /**
      * Loops
      */
@@ -1062,6 +1556,12 @@ protected:
     virtual void generateSparsity1DSource2(const std::string& function,
                                            const std::map<size_t, std::vector<size_t>>& rows);
 
+    /***********************************************************************
+     * Forward mode (arbitrary order)
+     **********************************************************************/
+
+    virtual void generateForwardTaylorSource();
+
     /***********************************************************************
      * Forward 1 mode
      **********************************************************************/
@@ -1187,12 +1687,66 @@ protected:
     /**
      *
      */
-    static void printFileStartPThreads(std::ostringstream& cache, const std::string& baseTypeName);
+    static void printFileStartPThreads(std::ostringstream& cache,
+                                       const std::string& baseTypeName,
+                                       size_t outSize = 1);
+
+    /**
+     * The maximum number of jobs of a PThreads dispatcher whose arguments
+     * are kept in the stack (the arguments of more jobs are allocated in
+     * the heap).
+     */
+    static constexpr size_t PTHREADS_MAX_STACK_JOBS = 256;
 
     static void printFunctionStartPThreads(std::ostringstream& cache, size_t size);
 
+    /**
+     * Prints the start of the body of the loop which defines the argument
+     * of each job (variable i) of a PThreads dispatcher.
+     */
+    static void printJobArgumentStartPThreads(std::ostringstream& cache, size_t size);
+
+    /**
+     * Prints the end of the body of the loop which defines the argument of
+     * each job of a PThreads dispatcher (the job is evaluated immediately
+     * if its argument could not be allocated).
+     */
+    static void printJobArgumentEndPThreads(std::ostringstream& cache, size_t size);
+
     static void printFunctionEndPThreads(std::ostringstream& cache, size_t size);
 
+    /**
+     * Declares the function which provides scratch buffers owned by each
+     * thread (PThreads only).
+     */
+    static void printScratchDeclaration(std::ostringstream& cache, MultiThreadingType multiThreadingType);
+
+    /**
+     * The maximum number of elements of the temporary array of a wrapper of
+     * compressed Jacobian/Hessian rows and columns which is kept in the
+     * stack (the stack is only used by the thread evaluating the wrapper and
+     * it is therefore already placed in its NUMA node).
+     */
+    static constexpr size_t PTHREADS_MAX_STACK_COMPRESSED = 4096;
+
+    /**
+     * Prints the declaration of the temporary array used by the wrappers of
+     * compressed Jacobian/Hessian rows and columns.
+     * With PThreads, arrays too large for the stack are a scratch buffer
+     * owned by the thread evaluating the wrapper (the wrapper returns
+     * without results if the buffer cannot be allocated).
+     * It must be the last declaration of the wrapper.
+     *
+     * @param cache the stream where the declaration is printed
+     * @param functionName the name of the wrapper
+     * @param size the number of elements in the array
+     * @param multiThreadingType the type of multithreading
+     */
+    void printCompressedArrayDcl(std::ostringstream& cache,
+                                 const std::string& functionName,
+                                 size_t size,
+                                 MultiThreadingType multiThreadingType) const;
+
     static void printFileStartOpenMP(std::ostringstream& cache);
 
     static void printFunctionStartOpenMP(std::ostringstream& cache, size_t size);
@@ -1201,6 +1755,29 @@ protected:
 
     static void printLoopEndOpenMP(std::ostringstream& cache, size_t size);
 
+    /**
+     * Applies the source generation options of this model (job timer,
+     * scheduling, outlining and lazy branches) to a new code handler.
+     *
+     * @param handler the code handler used to create the operation graph
+     */
+    inline void configureHandler(CodeHandler<Base>& handler) const;
+
+    /**
+     * Creates a differentiator for the operation graph of the model if
+     * symbolic derivatives were requested and all the operations used by
+     * the model can be differentiated.
+     *
+     * @param handler the handler where the model and its derivatives are
+     *                created
+     * @param x the independent variables (variables of handler)
+     * @param dep where the dependent variables are saved
+     * @return the differentiator or null if CppAD must be used
+     */
+    inline std::unique_ptr<ReverseDifferentiator<Base>> createSymbolicDifferentiator(CodeHandler<Base>& handler,
+                                                                                    const std::vector<CGBase>& x,
+                                                                                    std::vector<CGBase>& dep);
+
     /**
      *
      */
@@ -19,15 +19,41 @@ namespace CppAD {
 namespace cg {
 
 template <class Base>
-void ModelCSourceGen<Base>::generateZeroSource() {
+void ModelCSourceGen<Base>::generateZeroSource(MultiThreadingType multiThreadingType) {
     const std::string jobName = "model (zero-order forward)";
+    const std::string functionName = _name + "_" + FUNCTION_FORWAD_ZERO;
 
     startingJob("'" + jobName + "'", JobTimer::GRAPH);
 
     CodeHandler<Base> handler;
-    handler.setJobTimer(_jobTimer);
+    std::vector<CGBase> indVars;
+    std::vector<CGBase> dep = prepareForward0(handler, indVars);
 
-    std::vector<CGBase> indVars(_fun.Domain());
+    finishedJob();
+
+    if (multiThreadingType != MultiThreadingType::NONE && isZeroMultiThreadingEnabled()) {
+        if (generateZeroMultiThreadSource(functionName, handler, indVars, dep, multiThreadingType)) return;
+    }
+
+    LanguageC<Base> langC(_baseTypeName);
+    langC.setSimdLoops(_simdLoops);
+    langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+    langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
+    langC.setParameterPrecision(_parameterPrecision);
+    langC.setGenerateFunction(functionName);
+    selectReducedPrecision(handler, langC, dep, indVars);
+
+    std::ostringstream code;
+    std::unique_ptr<VariableNameGenerator<Base>> nameGen(createVariableNameGenerator());
+
+    handler.generateCode(code, langC, dep, *nameGen, _atomicFunctions, jobName);
+}
+
+template <class Base>
+std::vector<CG<Base>> ModelCSourceGen<Base>::prepareForward0(CodeHandler<Base>& handler, std::vector<CGBase>& indVars) {
+    configureHandler(handler);
+
+    indVars.resize(_fun.Domain());
     handler.makeVariables(indVars);
     if (_x.size() > 0) {
         for (size_t i = 0; i < indVars.size(); i++) {
@@ -35,29 +61,294 @@ void ModelCSourceGen<Base>::generateZeroSource() {
         }
     }
 
-    std::vector<CGBase> dep;
-
     if (_loopTapes.empty()) {
-        dep = _fun.Forward(0, indVars);
+        return _fun.Forward(0, indVars);
     } else {
         /**
          * Contains loops
          */
-        dep = prepareForward0WithLoops(handler, indVars);
+        return prepareForward0WithLoops(handler, indVars);
     }
+}
+
+template <class Base>
+bool ModelCSourceGen<Base>::generateZeroMultiThreadSource(const std::string& functionName,
+                                                          CodeHandler<Base>& handler,
+                                                          std::vector<CGBase>& indVars,
+                                                          std::vector<CGBase>& dep,
+                                                          MultiThreadingType multiThreadingType) {
+    using Node = OperationNode<Base>;
+
+    /**
+     * atomic functions use work arrays which are shared by all the
+     * operations of a function
+     */
+    if (isAtomicsUsed()) return false;
+
+    startingJob("'model (zero-order forward) partition'", JobTimer::GRAPH);
+
+    LevelClustering<Base> clustering(handler, _zeroParallelJobs, _zeroParallelMinOperations);
+    std::vector<std::vector<OperationCluster<Base>>> levels = clustering.partition(dep);
 
     finishedJob();
 
-    LanguageC<Base> langC(_baseTypeName);
-    langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
-    langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
-    langC.setParameterPrecision(_parameterPrecision);
-    langC.setGenerateFunction(_name + "_" + FUNCTION_FORWAD_ZERO);
+    /**
+     * remove clusters without any work
+     */
+    bool parallel = false;
+    for (auto& level : levels) {
+        level.erase(std::remove_if(level.begin(), level.end(),
+                                   [](const OperationCluster<Base>& c) {
+                                       return c.dependents.empty() && c.outputs.empty();
+                                   }),
+                    level.end());
+        parallel |= level.size() > 1;
+    }
 
-    std::ostringstream code;
+    if (!parallel) return false;
+
+    /**
+     * the values computed in one level and used in the following levels are
+     * saved in a shared array
+     */
+    std::map<const Node*, size_t> slots;
+    for (const auto& level : levels) {
+        for (const OperationCluster<Base>& c : level) {
+            for (const Node* node : c.outputs) {
+                slots.emplace(node, slots.size());
+            }
+        }
+    }
+
+    const size_t n = indVars.size();
     std::unique_ptr<VariableNameGenerator<Base>> nameGen(createVariableNameGenerator());
+    SubgraphEvaluator<Base, Base> evaluator(handler);
 
-    handler.generateCode(code, langC, dep, *nameGen, _atomicFunctions, jobName);
+    std::vector<std::vector<std::string>> jobNames(levels.size());
+
+    /**
+     * create a function for each job
+     */
+    for (size_t l = 0; l < levels.size(); ++l) {
+        for (size_t c = 0; c < levels[l].size(); ++c) {
+            const OperationCluster<Base>& cluster = levels[l][c];
+
+            std::string jobFunctionName = functionName + "_level" + std::to_string(l) + "_job" + std::to_string(c);
+            jobNames[l].push_back(jobFunctionName);
+
+            const std::string jobName = "model (zero-order forward) level " + std::to_string(l) + " job " +
+                                        std::to_string(c);
+
+            startingJob("'" + jobName + "'", JobTimer::GRAPH);
+
+            CodeHandler<Base> jobHandler;
+            configureHandler(jobHandler);
+
+            // the original independents followed by the values computed in previous levels
+            std::vector<CGBase> x(n + cluster.inputs.size());
+            jobHandler.makeVariables(x);
+            if (_x.size() > 0) {
+                for (size_t i = 0; i < n; i++) {
+                    x[i].setValue(_x[i]);
+                }
+            }
+
+            std::vector<CGBase> boundaryNew(x.begin() + n, x.end());
+
+            // the original dependents followed by the values used by the next levels
+            std::vector<CGBase> depOld;
+            depOld.reserve(cluster.dependents.size() + cluster.outputs.size());
+            for (size_t i : cluster.dependents) {
+                depOld.push_back(dep[i]);
+            }
+            for (Node* node : cluster.outputs) {
+                depOld.push_back(CGBase(*node));
+            }
+
+            std::vector<CGBase> jobDep = evaluator.evaluate(ArrayView<const CGBase>(x.data(), n), cluster.inputs,
+                                                            boundaryNew, depOld);
+
+            finishedJob();
+
+            std::vector<size_t> inputSlots(cluster.inputs.size());
+            for (size_t i = 0; i < cluster.inputs.size(); ++i) {
+                inputSlots[i] = slots.at(cluster.inputs[i]);
+            }
+            std::vector<size_t> outputSlots(cluster.outputs.size());
+            for (size_t i = 0; i < cluster.outputs.size(); ++i) {
+                outputSlots[i] = slots.at(cluster.outputs[i]);
+            }
+
+            LanguageC<Base> langC(_baseTypeName);
+            langC.setSimdLoops(_simdLoops);
+            langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+            langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
+            langC.setParameterPrecision(_parameterPrecision);
+            langC.setGenerateFunction(jobFunctionName);
+
+            LangCClusterVarNameGenerator<Base> jobNameGen(nameGen.get(), n, inputSlots, cluster.dependents,
+                                                          outputSlots);
+
+            std::ostringstream code;
+            jobHandler.generateCode(code, langC, jobDep, jobNameGen, _atomicFunctions, jobName);
+        }
+    }
+
+    /**
+     * create the function which calls the jobs
+     */
+    LanguageC<Base> langC(_baseTypeName);
+    std::string argsDcl = langC.generateDefaultFunctionArgumentsDcl();
+    std::vector<std::string> argsDcl2 = langC.generateDefaultFunctionArgumentsDcl2();
+
+    langC.setArgumentIn("inLocal");
+    langC.setArgumentOut("outLocal");
+    std::string argsLocal = langC.generateDefaultFunctionArguments();
+
+    _cache.str("");
+    _cache << "#include <stdio.h>\n"
+              "#include <stdlib.h>\n"
+              "\n"
+           << LanguageC<Base>::ATOMICFUN_STRUCT_DEFINITION << "\n\n";
+    for (const auto& names : jobNames) {
+        for (const std::string& name : names) {
+            LanguageC<Base>::printFunctionDeclaration(_cache, "void", name, argsDcl2);
+            _cache << ";\n";
+        }
+    }
+
+    _cache << "\n"
+              "typedef void (*cppadcg_function_type) ("
+           << argsDcl << ");\n";
+
+    /**
+     * PThreads pool needs a function with a void pointer argument
+     */
+    if (multiThreadingType == MultiThreadingType::OPENMP) {
+        _cache << "\n";
+        printFileStartOpenMP(_cache);
+        _cache << "\n";
+
+    } else {
+        assert(multiThreadingType == MultiThreadingType::PTHREADS);
+
+        printFileStartPThreads(_cache, _baseTypeName, 2);
+    }
+
+    /**
+     * a function for each level with concurrent jobs
+     * (the shared array is the second input and output array)
+     */
+    for (size_t l = 0; l < levels.size(); ++l) {
+        const std::vector<std::string>& names = jobNames[l];
+        if (names.size() < 2) continue;
+
+        _cache << "\n"
+                  "static void "
+               << functionName << "_level" << l << "(" << argsDcl
+               << ") {\n"
+                  "   static const cppadcg_function_type p["
+               << names.size() << "] = {";
+        for (size_t j = 0; j < names.size(); ++j) {
+            if (j != 0) _cache << ", ";
+            _cache << names[j];
+        }
+        _cache << "};\n"
+                  "   "
+               << _baseTypeName
+               << " const * const * inLocal = in;\n"
+                  "   "
+               << _baseTypeName
+               << " * outLocal[2];\n"
+                  "   long i;\n"
+                  "\n";
+
+        if (multiThreadingType == MultiThreadingType::OPENMP) {
+            printFunctionStartOpenMP(_cache, names.size());
+            _cache << "\n";
+            printLoopStartOpenMP(_cache, names.size());
+            _cache << "      outLocal[0] = out[0];\n"
+                      "      outLocal[1] = out[1];\n"
+                      "      (*p[i])("
+                   << argsLocal << ");\n";
+            printLoopEndOpenMP(_cache, names.size());
+            _cache << "\n";
+
+        } else {
+            printFunctionStartPThreads(_cache, names.size());
+            _cache << "\n"
+                      "   for(i = 0; i < "
+                   << names.size()
+                   << "; ++i) {\n";
+            printJobArgumentStartPThreads(_cache, names.size());
+            _cache << "      args[i]->func = p[i];\n"
+                      "      args[i]->in = inLocal;\n"
+                      "      args[i]->out[0] = out[0];\n"
+                      "      args[i]->out[1] = out[1];\n"
+                      "      args[i]->atomicFun = "
+                   << langC.getArgumentAtomic()
+                   << ";\n";
+            printJobArgumentEndPThreads(_cache, names.size());
+            _cache << "   }\n"
+                      "\n";
+            printFunctionEndPThreads(_cache, names.size());
+        }
+
+        _cache << "\n"
+                  "}\n";
+    }
+
+    /**
+     * zero order function (the levels are evaluated sequentially)
+     */
+    _cache << "\n";
+    LanguageC<Base>::printFunctionDeclaration(_cache, "void", functionName, argsDcl2);
+    _cache << " {\n"
+              "   "
+           << _baseTypeName
+           << " const * inLocal[2];\n"
+              "   "
+           << _baseTypeName
+           << " * outLocal[2];\n";
+    if (slots.empty()) {
+        _cache << "   " << _baseTypeName << " * shared = NULL;\n";
+    } else {
+        _cache << "   " << _baseTypeName << " * shared = (" << _baseTypeName << "*) malloc(" << slots.size()
+               << " * sizeof(" << _baseTypeName << "));\n"
+                  "\n"
+                  "   if (shared == NULL) {\n"
+                  "      fprintf(stderr, \""
+               << functionName
+               << "(): Could not allocate memory for shared values\\n\");\n"
+                  "      return;\n"
+                  "   }\n";
+    }
+    _cache << "\n"
+              "   inLocal[0] = in[0];\n"
+              "   inLocal[1] = shared;\n"
+              "   outLocal[0] = out[0];\n"
+              "   outLocal[1] = shared;\n"
+              "\n";
+
+    for (size_t l = 0; l < levels.size(); ++l) {
+        const std::vector<std::string>& names = jobNames[l];
+        if (names.empty()) continue;
+
+        if (names.size() == 1) {
+            _cache << "   " << names[0] << "(" << argsLocal << ");\n";
+        } else {
+            _cache << "   " << functionName << "_level" << l << "(" << argsLocal << ");\n";
+        }
+    }
+
+    _cache << "\n"
+              "   free(shared);\n"
+              "}\n";
+
+    _sources[functionName + ".c"] = _cache.str();
+    _cache.str("");
+
+    return true;
 }
 
 }  // namespace cg
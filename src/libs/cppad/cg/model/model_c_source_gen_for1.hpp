@@ -81,7 +81,7 @@ void ModelCSourceGen<Base>::generateSparseForwardOneSourcesWithAtomics(
         startingJob("'" + subJobName + "'", JobTimer::GRAPH);
 
         CodeHandler<Base> handler;
-        handler.setJobTimer(_jobTimer);
+        configureHandler(handler);
 
         vector<CGBase> indVars(n);
         handler.makeVariables(indVars);
@@ -112,6 +112,7 @@ void ModelCSourceGen<Base>::generateSparseForwardOneSourcesWithAtomics(
         finishedJob();
 
         LanguageC<Base> langC(_baseTypeName);
+        langC.setSimdLoops(_simdLoops);
         langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
         langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
         langC.setParameterPrecision(_parameterPrecision);
@@ -138,7 +139,7 @@ void ModelCSourceGen<Base>::generateSparseForwardOneSourcesNoAtomics(
     size_t n = _fun.Domain();
 
     CodeHandler<Base> handler;
-    handler.setJobTimer(_jobTimer);
+    configureHandler(handler);
 
     vector<CGBase> x(n);
     handler.makeVariables(x);
@@ -156,8 +157,14 @@ void ModelCSourceGen<Base>::generateSparseForwardOneSourcesNoAtomics(
 
     vector<CGBase> jacFlat(_jacSparsity.rows.size());
 
-    CppAD::sparse_jacobian_work work;  // temporary structure for CPPAD
-    _fun.SparseJacobianForward(x, _jacSparsity.sparsity, _jacSparsity.rows, _jacSparsity.cols, jacFlat, work);
+    vector<CGBase> dep;
+    std::unique_ptr<ReverseDifferentiator<Base>> diff = createSymbolicDifferentiator(handler, x, dep);
+    if (diff != nullptr) {
+        jacFlat = diff->sparseJacobian(dep, _jacSparsity.rows, _jacSparsity.cols);
+    } else {
+        CppAD::sparse_jacobian_work work;  // temporary structure for CPPAD
+        _fun.SparseJacobianForward(x, _jacSparsity.sparsity, _jacSparsity.rows, _jacSparsity.cols, jacFlat, work);
+    }
 
     /**
      * organize results
@@ -200,6 +207,7 @@ void ModelCSourceGen<Base>::generateSparseForwardOneSourcesNoAtomics(
         const std::string subJobName = _cache.str();
 
         LanguageC<Base> langC(_baseTypeName);
+        langC.setSimdLoops(_simdLoops);
         langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
         langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
         langC.setParameterPrecision(_parameterPrecision);
@@ -0,0 +1,88 @@
+#ifndef CPPAD_CG_MODEL_C_SOURCE_GEN_FOR_TAYLOR_INCLUDED
+#define CPPAD_CG_MODEL_C_SOURCE_GEN_FOR_TAYLOR_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+template <class Base>
+void ModelCSourceGen<Base>::generateForwardTaylorSource() {
+    const std::string jobName = "model (forward Taylor)";
+    const std::string functionName = _name + "_" + FUNCTION_FORWARD_TAYLOR;
+
+    const size_t m = _fun.Range();
+    const size_t n = _fun.Domain();
+    const size_t p = _taylorOrder;
+
+    startingJob("'" + jobName + "'", JobTimer::GRAPH);
+
+    CodeHandler<Base> handler;
+    configureHandler(handler);
+
+    // Taylor coefficients of the independents: tx[j * (p + 1) + k]
+    std::vector<CGBase> tx(n * (p + 1));
+    handler.makeVariables(tx);
+    if (_x.size() > 0) {
+        for (size_t j = 0; j < n; j++) {
+            tx[j * (p + 1)].setValue(_x[j]);
+            for (size_t k = 1; k <= p; k++) {
+                tx[j * (p + 1) + k].setValue(Base(0));
+            }
+        }
+    }
+
+    /**
+     * all the orders are determined in a single sweep which uses the
+     * Taylor recurrences of each operation
+     */
+    std::vector<CGBase> ty = _fun.Forward(p, tx);
+    CPPADCG_ASSERT_UNKNOWN(ty.size() == m * (p + 1))
+
+    finishedJob();
+
+    LanguageC<Base> langC(_baseTypeName);
+    langC.setSimdLoops(_simdLoops);
+    langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+    langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
+    langC.setParameterPrecision(_parameterPrecision);
+    langC.setGenerateFunction(functionName);
+
+    std::ostringstream code;
+    std::unique_ptr<VariableNameGenerator<Base>> nameGen(createVariableNameGenerator("ty", "tx"));
+
+    handler.generateCode(code, langC, ty, *nameGen, _atomicFunctions, jobName);
+
+    /**
+     * the highest order of the Taylor coefficients
+     */
+    const std::string orderName = _name + "_" + FUNCTION_FORWARD_TAYLOR_ORDER;
+
+    _cache.str("");
+    LanguageC<Base>::printFunctionDeclaration(_cache, "unsigned long", orderName, {"void"});
+    _cache << " {\n"
+              "   return "
+           << p
+           << ";\n"
+              "}\n\n";
+
+    _sources[orderName + ".c"] = _cache.str();
+    _cache.str("");
+}
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
@@ -27,13 +27,41 @@ void ModelCSourceGen<Base>::generateHessianSource() {
     startingJob("'" + jobName + "'", JobTimer::GRAPH);
 
     CodeHandler<Base> handler;
-    handler.setJobTimer(_jobTimer);
+    vector<CGBase> indVars;
+    vector<CGBase> w;
+    vector<CGBase> hess = prepareHessian(handler, indVars, w);
+
+    size_t n = _fun.Domain();
+
+    finishedJob();
+
+    LanguageC<Base> langC(_baseTypeName);
+    langC.setSimdLoops(_simdLoops);
+    langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+    langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
+    langC.setParameterPrecision(_parameterPrecision);
+    langC.setGenerateFunction(_name + "_" + FUNCTION_HESSIAN);
+
+    std::ostringstream code;
+    std::unique_ptr<VariableNameGenerator<Base>> nameGen(createVariableNameGenerator("hess"));
+    LangCDefaultHessianVarNameGenerator<Base> nameGenHess(nameGen.get(), n);
+
+    handler.generateCode(code, langC, hess, nameGenHess, _atomicFunctions, jobName);
+}
+
+template <class Base>
+std::vector<CG<Base>> ModelCSourceGen<Base>::prepareHessian(CodeHandler<Base>& handler,
+                                                            std::vector<CGBase>& indVars,
+                                                            std::vector<CGBase>& w) {
+    using std::vector;
+
+    configureHandler(handler);
 
     size_t m = _fun.Range();
     size_t n = _fun.Domain();
 
     // independent variables
-    vector<CGBase> indVars(n);
+    indVars.resize(n);
     handler.makeVariables(indVars);
     if (_x.size() > 0) {
         for (size_t i = 0; i < n; i++) {
@@ -42,7 +70,7 @@ void ModelCSourceGen<Base>::generateHessianSource() {
     }
 
     // multipliers
-    vector<CGBase> w(m);
+    w.resize(m);
     handler.makeVariables(w);
     if (_x.size() > 0) {
         for (size_t i = 0; i < m; i++) {
@@ -50,7 +78,15 @@ void ModelCSourceGen<Base>::generateHessianSource() {
         }
     }
 
-    vector<CGBase> hess = _fun.Hessian(indVars, w);
+    vector<CGBase> hess;
+    vector<CGBase> dep;
+    std::unique_ptr<ReverseDifferentiator<Base>> diff = createSymbolicDifferentiator(handler, indVars, dep);
+
+    if (diff != nullptr) {
+        hess = diff->hessian(dep, w);
+    } else {
+        hess = _fun.Hessian(indVars, w);
+    }
 
     // make use of the symmetry of the Hessian in order to reduce operations
     for (size_t i = 0; i < n; i++) {
@@ -59,19 +95,7 @@ void ModelCSourceGen<Base>::generateHessianSource() {
         }
     }
 
-    finishedJob();
-
-    LanguageC<Base> langC(_baseTypeName);
-    langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
-    langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
-    langC.setParameterPrecision(_parameterPrecision);
-    langC.setGenerateFunction(_name + "_" + FUNCTION_HESSIAN);
-
-    std::ostringstream code;
-    std::unique_ptr<VariableNameGenerator<Base>> nameGen(createVariableNameGenerator("hess"));
-    LangCDefaultHessianVarNameGenerator<Base> nameGenHess(nameGen.get(), n);
-
-    handler.generateCode(code, langC, hess, nameGenHess, _atomicFunctions, jobName);
+    return hess;
 }
 
 template <class Base>
@@ -160,7 +184,7 @@ void ModelCSourceGen<Base>::generateSparseHessianSourceDirectly() {
     startingJob("'" + jobName + "'", JobTimer::GRAPH);
 
     CodeHandler<Base> handler;
-    handler.setJobTimer(_jobTimer);
+    configureHandler(handler);
 
     // independent variables
     vector<CGBase> indVars(n);
@@ -182,13 +206,20 @@ void ModelCSourceGen<Base>::generateSparseHessianSourceDirectly() {
 
     vector<CGBase> hess(_hessSparsity.rows.size());
     if (_loopTapes.empty()) {
-        CppAD::sparse_hessian_work work;
-        // "cppad.symmetric" may have missing values for functions using atomic
-        // functions which only provide half of the elements
-        // (some values could be zeroed)
-        work.color_method = "cppad.general";
+        vector<CGBase> dep;
+        std::unique_ptr<ReverseDifferentiator<Base>> diff = createSymbolicDifferentiator(handler, indVars, dep);
+
         vector<CGBase> lowerHess(lowerHessRows.size());
-        _fun.SparseHessian(indVars, w, _hessSparsity.sparsity, lowerHessRows, lowerHessCols, lowerHess, work);
+        if (diff != nullptr) {
+            lowerHess = diff->sparseHessian(dep, w, lowerHessRows, lowerHessCols);
+        } else {
+            CppAD::sparse_hessian_work work;
+            // "cppad.symmetric" may have missing values for functions using atomic
+            // functions which only provide half of the elements
+            // (some values could be zeroed)
+            work.color_method = "cppad.general";
+            _fun.SparseHessian(indVars, w, _hessSparsity.sparsity, lowerHessRows, lowerHessCols, lowerHess, work);
+        }
 
         for (size_t i = 0; i < lowerHessOrder.size(); i++) {
             hess[lowerHessOrder[i]] = lowerHess[i];
@@ -209,6 +240,7 @@ void ModelCSourceGen<Base>::generateSparseHessianSourceDirectly() {
     finishedJob();
 
     LanguageC<Base> langC(_baseTypeName);
+    langC.setSimdLoops(_simdLoops);
     langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
     langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
     langC.setParameterPrecision(_parameterPrecision);
@@ -391,7 +423,10 @@ std::string ModelCSourceGen<Base>::generateSparseHessianRev2MultiThreadSource(
     std::vector<std::string> argsDcl2 = langC.generateDefaultFunctionArgumentsDcl2();
 
     _cache.str("");
-    _cache << "#include <stdlib.h>\n" << LanguageC<Base>::ATOMICFUN_STRUCT_DEFINITION << "\n\n";
+    _cache << "#include <stdio.h>\n"
+              "#include <stdlib.h>\n"
+           << LanguageC<Base>::ATOMICFUN_STRUCT_DEFINITION << "\n\n";
+    printScratchDeclaration(_cache, multiThreadingType);
     generateFunctionDeclarationSource(_cache, functionRev2, rev2Suffix, hessInfo, argsDcl);
 
     langC.setArgumentIn("inLocal");
@@ -425,12 +460,10 @@ std::string ModelCSourceGen<Base>::generateSparseHessianRev2MultiThreadSource(
                << _baseTypeName
                << " * outLocal[1];\n"
                   "   "
-               << _baseTypeName << " compressed[" << it.second.indexes.size()
-               << "];\n"
-                  "   "
                << _baseTypeName
-               << " * hess = out[0];\n"
-                  "\n"
+               << " * hess = out[0];\n";
+        printCompressedArrayDcl(_cache, functionNameWrap, it.second.indexes.size(), multiThreadingType);
+        _cache << "\n"
                   "   inLocal[0] = in[0];\n"
                   "   inLocal[1] = &inLocal1;\n"
                   "   inLocal[2] = in[1];\n"
@@ -524,15 +557,16 @@ std::string ModelCSourceGen<Base>::generateSparseHessianRev2MultiThreadSource(
         _cache << "\n"
                   "   for(i = 0; i < "
                << hessInfo.size()
-               << "; ++i) {\n"
-                  "      args[i] = (ExecArgStruct*) malloc(sizeof(ExecArgStruct));\n"
-                  "      args[i]->func = p[i];\n"
+               << "; ++i) {\n";
+        printJobArgumentStartPThreads(_cache, hessInfo.size());
+        _cache << "      args[i]->func = p[i];\n"
                   "      args[i]->in = inLocal;\n"
                   "      args[i]->out[0] = &hess[offset[i]];\n"
                   "      args[i]->atomicFun = "
                << langC.getArgumentAtomic()
-               << ";\n"
-                  "   }\n"
+               << ";\n";
+        printJobArgumentEndPThreads(_cache, hessInfo.size());
+        _cache << "   }\n"
                   "\n";
         printFunctionEndPThreads(_cache, hessInfo.size());
     }
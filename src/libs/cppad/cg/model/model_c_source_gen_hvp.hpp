@@ -0,0 +1,272 @@
+#ifndef CPPAD_CG_MODEL_C_SOURCE_GEN_HVP_INCLUDED
+#define CPPAD_CG_MODEL_C_SOURCE_GEN_HVP_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+template <class Base>
+void ModelCSourceGen<Base>::generateHessianVectorProductSource(MultiThreadingType multiThreadingType) {
+    const std::string functionName = _name + "_" + FUNCTION_HESSIAN_VECTOR_PRODUCT;
+
+    size_t nDirections = _hvpDirections;
+
+    if (multiThreadingType != MultiThreadingType::NONE && isHessianVectorProductMultiThreadingEnabled()) {
+        /**
+         * the directions are split into jobs which are evaluated concurrently
+         */
+        size_t jobDirections = _hvpJobDirections;
+        size_t nJobs = (_hvpDirections + jobDirections - 1) / jobDirections;
+        nDirections = nJobs * jobDirections;
+
+        const std::string kernelName = functionName + "_block";
+        generateHessianVectorProductKernel(kernelName, jobDirections);
+
+        _sources[functionName + ".c"] = generateHessianVectorProductMultiThreadSource(
+                functionName, kernelName, jobDirections, nJobs, multiThreadingType);
+    } else {
+        generateHessianVectorProductKernel(functionName, nDirections);
+    }
+
+    /**
+     * the number of directions of each evaluation
+     */
+    const std::string directionsName = _name + "_" + FUNCTION_HESSIAN_VECTOR_PRODUCT_DIRECTIONS;
+
+    _cache.str("");
+    LanguageC<Base>::printFunctionDeclaration(_cache, "unsigned long", directionsName, {"void"});
+    _cache << " {\n"
+              "   return "
+           << nDirections
+           << ";\n"
+              "}\n\n";
+
+    _sources[directionsName + ".c"] = _cache.str();
+    _cache.str("");
+}
+
+template <class Base>
+void ModelCSourceGen<Base>::generateHessianVectorProductKernel(const std::string& functionName, size_t nDirections) {
+    using std::vector;
+
+    const size_t m = _fun.Range();
+    const size_t n = _fun.Domain();
+
+    const std::string jobName = "Hessian-vector product";
+
+    startingJob("'" + jobName + "'", JobTimer::GRAPH);
+
+    CodeHandler<Base> handler;
+    configureHandler(handler);
+
+    // independent variables
+    vector<CGBase> indVars(n);
+    handler.makeVariables(indVars);
+    if (_x.size() > 0) {
+        for (size_t i = 0; i < n; i++) {
+            indVars[i].setValue(_x[i]);
+        }
+    }
+
+    // multipliers
+    vector<CGBase> w(m);
+    handler.makeVariables(w);
+    if (_x.size() > 0) {
+        for (size_t i = 0; i < m; i++) {
+            w[i].setValue(Base(1.0));
+        }
+    }
+
+    // directions
+    vector<CGBase> v(nDirections * n);
+    handler.makeVariables(v);
+    if (_x.size() > 0) {
+        for (size_t i = 0; i < v.size(); i++) {
+            v[i].setValue(Base(1.0));
+        }
+    }
+
+    vector<CGBase> hv(nDirections * n);
+
+    vector<CGBase> dep;
+    std::unique_ptr<ReverseDifferentiator<Base>> diff = createSymbolicDifferentiator(handler, indVars, dep);
+
+    if (diff != nullptr) {
+        /**
+         * the gradient of the Lagrangian is only created once and then
+         * differentiated for each direction
+         */
+        auto grad = diff->gradient(dep, w);
+
+        for (size_t d = 0; d < nDirections; d++) {
+            ArrayView<const CGBase> vd(&v[d * n], n);
+            for (auto& e : diff->gradient(grad, vd)) {
+                hv[d * n + e.first] = std::move(e.second);
+            }
+        }
+    } else {
+        /**
+         * forward-over-reverse
+         * (the zero order forward sweep is shared by all directions)
+         */
+        _fun.Forward(0, indVars);
+
+        vector<CGBase> tx1(n);
+        for (size_t d = 0; d < nDirections; d++) {
+            std::copy(v.begin() + d * n, v.begin() + (d + 1) * n, tx1.begin());
+            _fun.Forward(1, tx1);
+
+            vector<CGBase> px = _fun.Reverse(2, w);
+            CPPADCG_ASSERT_UNKNOWN(px.size() == 2 * n)
+
+            for (size_t j = 0; j < n; j++) {
+                hv[d * n + j] = px[j * 2 + 1];
+            }
+        }
+    }
+
+    finishedJob();
+
+    LanguageC<Base> langC(_baseTypeName);
+    langC.setSimdLoops(_simdLoops);
+    langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+    langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
+    langC.setParameterPrecision(_parameterPrecision);
+    langC.setGenerateFunction(functionName);
+
+    std::ostringstream code;
+    std::unique_ptr<VariableNameGenerator<Base>> nameGen(createVariableNameGenerator("hv"));
+    LangCDefaultReverse2VarNameGenerator<Base> nameGenHvp(nameGen.get(), n, "mult", m, "v");
+
+    handler.generateCode(code, langC, hv, nameGenHvp, _atomicFunctions, jobName);
+}
+
+template <class Base>
+std::string ModelCSourceGen<Base>::generateHessianVectorProductMultiThreadSource(
+        const std::string& functionName,
+        const std::string& kernelName,
+        size_t jobDirections,
+        size_t nJobs,
+        MultiThreadingType multiThreadingType) {
+    CPPADCG_ASSERT_UNKNOWN(_multiThreading);
+    CPPADCG_ASSERT_UNKNOWN(multiThreadingType != MultiThreadingType::NONE);
+
+    const size_t n = _fun.Domain();
+    const size_t jobSize = jobDirections * n;
+
+    LanguageC<Base> langC(_baseTypeName);
+    std::string argsDcl = langC.generateDefaultFunctionArgumentsDcl();
+    std::vector<std::string> argsDcl2 = langC.generateDefaultFunctionArgumentsDcl2();
+
+    langC.setArgumentIn("inLocal[i]");
+    langC.setArgumentOut("outLocal");
+    std::string argsLocal = langC.generateDefaultFunctionArguments();
+
+    _cache.str("");
+    _cache << "#include <stdlib.h>\n" << LanguageC<Base>::ATOMICFUN_STRUCT_DEFINITION << "\n\n";
+    LanguageC<Base>::printFunctionDeclaration(_cache, "void", kernelName, argsDcl2);
+    _cache << ";\n"
+              "\n"
+              "typedef void (*cppadcg_function_type) ("
+           << argsDcl << ");\n";
+
+    if (multiThreadingType == MultiThreadingType::OPENMP) {
+        _cache << "\n";
+        printFileStartOpenMP(_cache);
+        _cache << "\n";
+
+    } else {
+        /**
+         * PThreads pool needs a function with a void pointer argument
+         */
+        assert(multiThreadingType == MultiThreadingType::PTHREADS);
+
+        printFileStartPThreads(_cache, _baseTypeName);
+    }
+
+    /**
+     * Hessian-vector product function
+     * (each job receives its own directions and results)
+     */
+    _cache << "\n"
+              "void "
+           << functionName << "(" << argsDcl
+           << ") {\n"
+              "   "
+           << _baseTypeName << " const * inLocal[" << nJobs
+           << "][3];\n"
+              "   "
+           << _baseTypeName << " * outLocal[1];\n";
+    _cache << "   " << _baseTypeName
+           << " * hv = out[0];\n"
+              "   long i;\n"
+              "\n"
+              "   for(i = 0; i < "
+           << nJobs
+           << "; ++i) {\n"
+              "      inLocal[i][0] = in[0];\n"
+              "      inLocal[i][1] = in[1];\n"
+              "      inLocal[i][2] = &in[2][i * "
+           << jobSize
+           << "];\n"
+              "   }\n"
+              "\n";
+
+    if (multiThreadingType == MultiThreadingType::OPENMP) {
+        printFunctionStartOpenMP(_cache, nJobs);
+        _cache << "\n";
+        printLoopStartOpenMP(_cache, nJobs);
+        _cache << "      outLocal[0] = &hv[i * " << jobSize
+               << "];\n"
+                  "      "
+               << kernelName << "(" << argsLocal << ");\n";
+        printLoopEndOpenMP(_cache, nJobs);
+        _cache << "\n";
+
+    } else {
+        assert(multiThreadingType == MultiThreadingType::PTHREADS);
+
+        printFunctionStartPThreads(_cache, nJobs);
+        _cache << "\n"
+                  "   for(i = 0; i < "
+               << nJobs
+               << "; ++i) {\n";
+        printJobArgumentStartPThreads(_cache, nJobs);
+        _cache << "      args[i]->func = "
+               << kernelName
+               << ";\n"
+                  "      args[i]->in = inLocal[i];\n"
+                  "      args[i]->out[0] = &hv[i * "
+               << jobSize
+               << "];\n"
+                  "      args[i]->atomicFun = "
+               << langC.getArgumentAtomic()
+               << ";\n";
+        printJobArgumentEndPThreads(_cache, nJobs);
+        _cache << "   }\n"
+                  "\n";
+        printFunctionEndPThreads(_cache, nJobs);
+    }
+
+    _cache << "\n"
+              "}\n";
+    return _cache.str();
+}
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
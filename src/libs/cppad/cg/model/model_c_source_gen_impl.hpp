@@ -77,6 +77,47 @@ const std::string ModelCSourceGen<Base>::FUNCTION_INFO = "info";
 template <class Base>
 const std::string ModelCSourceGen<Base>::FUNCTION_ATOMIC_FUNC_NAMES = "atomic_functions";
 
+template <class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_HESSIAN_VECTOR_PRODUCT = "hessian_vector_product";
+
+template <class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_HESSIAN_VECTOR_PRODUCT_DIRECTIONS =
+        "hessian_vector_product_directions";
+
+template <class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_FORWARD_TAYLOR = "forward_taylor";
+
+template <class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_FORWARD_TAYLOR_ORDER = "forward_taylor_order";
+
+template <class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_TABLE = "function_table";
+
+template <class Base>
+const std::string ModelCSourceGen<Base>::FUNCTION_TABLE_STRUCT_DEFINITION =  // NOLINT(cert-err58-cpp)
+        "#if defined(__GNUC__) || defined(__clang__)\n"
+        "#define CPPADCG_EXPORT __attribute__((visibility(\"default\")))\n"
+        "#else\n"
+        "#define CPPADCG_EXPORT\n"
+        "#endif\n"
+        "\n"
+        "struct CppADCGModelTable {\n"
+        "    unsigned long version;\n"
+        "    const char* name;\n"
+        "    unsigned long n_functions;\n"
+        "    const char* const* function_names;\n"
+        "    void* const* functions;\n"
+        "};\n"
+        "\n"
+        "struct CppADCGLibraryTable {\n"
+        "    unsigned long version;\n"
+        "    unsigned long n_models;\n"
+        "    const struct CppADCGModelTable* const* models;\n"
+        "    unsigned long n_functions;\n"
+        "    const char* const* function_names;\n"
+        "    void* const* functions;\n"
+        "};\n";
+
 template <class Base>
 const std::string ModelCSourceGen<Base>::CONST = "const";
 
@@ -85,7 +126,20 @@ VariableNameGenerator<Base>* ModelCSourceGen<Base>::createVariableNameGenerator(
                                                                                 const std::string& indepName,
                                                                                 const std::string& tmpName,
                                                                                 const std::string& tmpArrayName) {
-    return new LangCDefaultVariableNameGenerator<Base>(depName, indepName, tmpName, tmpArrayName);
+    auto* nameGen = new LangCDefaultVariableNameGenerator<Base>(depName, indepName, tmpName, tmpArrayName);
+    nameGen->setTemporaryScalars(_registerPressureAware || _mixedPrecision || _simdLoops);
+    return nameGen;
+}
+
+template <class Base>
+void ModelCSourceGen<Base>::selectReducedPrecision(CodeHandler<Base>& handler,
+                                                   LanguageC<Base>& langC,
+                                                   const std::vector<CGBase>& dependent,
+                                                   const std::vector<CGBase>& independent) {
+    if (!_mixedPrecision || _x.empty() || !_loopTapes.empty()) return;
+
+    MixedPrecisionSelector<Base> selector(handler, _mixedPrecisionTolerance);
+    langC.setReducedPrecision(selector.select(dependent, independent));
 }
 
 template <class Base>
@@ -106,7 +160,7 @@ void ModelCSourceGen<Base>::generateSources(MultiThreadingType multiThreadingTyp
     startingJob("'" + _name + "'", JobTimer::SOURCE_FOR_MODEL);
 
     if (_zero) {
-        generateZeroSource();
+        generateZeroSource(multiThreadingType);
         _zeroEvaluated = true;
     }
 
@@ -123,6 +177,10 @@ void ModelCSourceGen<Base>::generateSources(MultiThreadingType multiThreadingTyp
         generateForwardOneSources();
     }
 
+    if (_forwardTaylor) {
+        generateForwardTaylorSource();
+    }
+
     if (_reverseOne) {
         generateSparseReverseOneSources();
         generateReverseOneSources();
@@ -141,6 +199,10 @@ void ModelCSourceGen<Base>::generateSources(MultiThreadingType multiThreadingTyp
         generateSparseHessianSource(multiThreadingType);
     }
 
+    if (_hessianVectorProduct) {
+        generateHessianVectorProductSource(multiThreadingType);
+    }
+
     if (_sparseJacobian || _forwardOne || _reverseOne) {
         generateJacobianSparsitySource();
     }
@@ -153,6 +215,17 @@ void ModelCSourceGen<Base>::generateSources(MultiThreadingType multiThreadingTyp
 
     generateAtomicFuncNames();
 
+    generateFunctionTableSource();
+
+    if (_jobTimer != nullptr && _jobTimer->isTracing()) {
+        size_t bytes = 0;
+        for (const auto& it : _sources) {
+            bytes += it.second.size();
+        }
+        _jobTimer->addJobCounter("source_files", _sources.size());
+        _jobTimer->addJobCounter("source_bytes", bytes);
+    }
+
     finishedJob();
 }
 
@@ -220,6 +293,89 @@ void ModelCSourceGen<Base>::generateInfoSource() {
     _sources[funcName + ".c"] = _cache.str();
 }
 
+template <class Base>
+void ModelCSourceGen<Base>::generateFunctionTableSource() {
+    LanguageC<Base> langC(_baseTypeName);
+    const std::string argsDcl = langC.generateDefaultFunctionArgumentsDcl();
+    const std::string atomicDcl = langC.generateArgumentAtomicDcl();
+    const std::string tx = _baseTypeName + " const tx[]";
+    const std::string ty = _baseTypeName + " ty[]";
+    const std::string elements = "unsigned long pos, unsigned long const** elements, unsigned long* nnz";
+    const std::string rowCol = "unsigned long const** row, unsigned long const** col, unsigned long* nnz";
+
+    // function name, return type, arguments
+    const std::vector<std::array<std::string, 3>> candidates = {
+            {FUNCTION_INFO, "void",
+             "const char** baseName, unsigned long* m, unsigned long* n, unsigned int* indCount, "
+             "unsigned int* depCount"},
+            {FUNCTION_ATOMIC_FUNC_NAMES, "void", "const char*** names, unsigned long* n"},
+            {FUNCTION_FORWAD_ZERO, "void", argsDcl},
+            {FUNCTION_JACOBIAN, "void", argsDcl},
+            {FUNCTION_HESSIAN, "void", argsDcl},
+            {FUNCTION_FORWARD_ONE, "int", tx + ", " + ty + ", " + atomicDcl},
+            {FUNCTION_REVERSE_ONE, "int",
+             tx + ", " + _baseTypeName + " const ty[], " + _baseTypeName + " px[], " + _baseTypeName +
+                     " const py[], " + atomicDcl},
+            {FUNCTION_REVERSE_TWO, "int",
+             tx + ", " + _baseTypeName + " const ty[], " + _baseTypeName + " px[], " + _baseTypeName +
+                     " const py[], " + atomicDcl},
+            {FUNCTION_SPARSE_JACOBIAN, "void", argsDcl},
+            {FUNCTION_SPARSE_HESSIAN, "void", argsDcl},
+            {FUNCTION_JACOBIAN_SPARSITY, "void", rowCol},
+            {FUNCTION_HESSIAN_SPARSITY, "void", rowCol},
+            {FUNCTION_HESSIAN_SPARSITY2, "void", "unsigned long i, " + rowCol},
+            {FUNCTION_SPARSE_FORWARD_ONE, "int", "unsigned long pos, " + argsDcl},
+            {FUNCTION_SPARSE_REVERSE_ONE, "int", "unsigned long pos, " + argsDcl},
+            {FUNCTION_SPARSE_REVERSE_TWO, "int", "unsigned long pos, " + argsDcl},
+            {FUNCTION_FORWARD_ONE_SPARSITY, "void", elements},
+            {FUNCTION_REVERSE_ONE_SPARSITY, "void", elements},
+            {FUNCTION_REVERSE_TWO_SPARSITY, "void", elements},
+            {FUNCTION_HESSIAN_VECTOR_PRODUCT, "void", argsDcl},
+            {FUNCTION_HESSIAN_VECTOR_PRODUCT_DIRECTIONS, "unsigned long", "void"},
+            {FUNCTION_FORWARD_TAYLOR, "void", argsDcl},
+            {FUNCTION_FORWARD_TAYLOR_ORDER, "unsigned long", "void"}};
+
+    // only the functions which were generated
+    std::vector<const std::array<std::string, 3>*> functions;
+    for (const auto& f : candidates) {
+        if (_sources.find(_name + "_" + f[0] + ".c") != _sources.end()) {
+            functions.push_back(&f);
+        }
+    }
+
+    const std::string tableName = _name + "_" + FUNCTION_TABLE;
+
+    _cache.str("");
+    _cache << LanguageC<Base>::ATOMICFUN_STRUCT_DEFINITION << "\n\n" << FUNCTION_TABLE_STRUCT_DEFINITION << "\n";
+    for (const auto* f : functions) {
+        _cache << (*f)[1] << " " << _name << "_" << (*f)[0] << "(" << (*f)[2] << ");\n";
+    }
+
+    _cache << "\n"
+              "static const char* const "
+           << tableName << "_names[] = {";
+    for (size_t i = 0; i < functions.size(); ++i) {
+        if (i != 0) _cache << ",";
+        _cache << "\n   \"" << _name << "_" << (*functions[i])[0] << "\"";
+    }
+    _cache << "};\n"
+              "\n"
+              "static void* const "
+           << tableName << "_functions[] = {";
+    for (size_t i = 0; i < functions.size(); ++i) {
+        if (i != 0) _cache << ",";
+        _cache << "\n   (void*) &" << _name << "_" << (*functions[i])[0];
+    }
+    _cache << "};\n"
+              "\n"
+              "CPPADCG_EXPORT const struct CppADCGModelTable "
+           << tableName << " = {" << ModelLibraryCSourceGen<Base>::API_VERSION << "u, \"" << _name << "\", "
+           << functions.size() << ", " << tableName << "_names, " << tableName << "_functions};\n";
+
+    _sources[tableName + ".c"] = _cache.str();
+    _cache.str("");
+}
+
 template <class Base>
 void ModelCSourceGen<Base>::generateAtomicFuncNames() {
     std::string funcName = _name + "_" + FUNCTION_ATOMIC_FUNC_NAMES;
@@ -658,7 +814,9 @@ inline std::vector<std::set<size_t>> ModelCSourceGen<Base>::determineOrderByRow(
 }
 
 template <class Base>
-void ModelCSourceGen<Base>::printFileStartPThreads(std::ostringstream& cache, const std::string& baseTypeName) {
+void ModelCSourceGen<Base>::printFileStartPThreads(std::ostringstream& cache,
+                                                   const std::string& baseTypeName,
+                                                   size_t outSize) {
     cache << "\n";
     cache << CPPADCG_PTHREAD_POOL_H_FILE << "\n";
     cache << "\n";
@@ -668,15 +826,15 @@ void ModelCSourceGen<Base>::printFileStartPThreads(std::ostringstream& cache, co
           << baseTypeName +
                      " const *const * in;\n"
                      "   "
-          << baseTypeName +
-                     "* out[1];\n"
-                     "   struct LangCAtomicFun atomicFun;\n"
-                     "} ExecArgStruct;\n"
-                     "\n"
-                     "static void exec_func(void* arg) {\n"
-                     "   ExecArgStruct* eArg = (ExecArgStruct*) arg;\n"
-                     "   (*eArg->func)(eArg->in, eArg->out, eArg->atomicFun);\n"
-                     "}\n";
+          << baseTypeName << "* out[" << outSize
+          << "];\n"
+             "   struct LangCAtomicFun atomicFun;\n"
+             "} ExecArgStruct;\n"
+             "\n"
+             "static void exec_func(void* arg) {\n"
+             "   ExecArgStruct* eArg = (ExecArgStruct*) arg;\n"
+             "   (*eArg->func)(eArg->in, eArg->out, eArg->atomicFun);\n"
+             "}\n";
 }
 
 template <class Base>
@@ -690,6 +848,15 @@ void ModelCSourceGen<Base>::printFunctionStartPThreads(std::ostringstream& cache
         cache << "};";
     };
 
+    if (size <= PTHREADS_MAX_STACK_JOBS) {
+        // the jobs are complete before returning: their arguments can be kept in the stack
+        cache << "   ExecArgStruct args_data[" << size << "];\n";
+    } else {
+        // too large for the stack (the jobs are evaluated one by one if there is not enough memory)
+        cache << "   ExecArgStruct args_one;\n"
+                 "   ExecArgStruct* args_data = (ExecArgStruct*) malloc("
+              << size << " * sizeof(ExecArgStruct));\n";
+    }
     cache << "   ExecArgStruct* args[" << size << "];\n";
     cache << "   static cppadcg_thpool_function_type execute_functions[" << size << "] = ";
     repeatFill("exec_func");
@@ -706,44 +873,100 @@ void ModelCSourceGen<Base>::printFunctionStartPThreads(std::ostringstream& cache
         if (i != 0) cache << ", ";
         cache << i;
     }
+    /**
+     * several threads can call this function at the same time:
+     * only one of them measures the elapsed times and updates the job order
+     * while the others use the default order until the measurements are complete
+     */
     cache << "};\n"
-             "   static int job2Thread["
-          << size << "] = ";
-    repeatFill("-1");
-    cache << "\n"
-             "   static int last_elapsed_changed = 1;\n"
-             "   unsigned int nBench = cppadcg_thpool_get_n_time_meas();\n"
              "   static unsigned int n_meas = 0;\n"
+             "   static int benchmarking = 0;\n"
+             "   unsigned int nBench = cppadcg_thpool_get_n_time_meas();\n"
+             "   unsigned int n_meas_cur = __atomic_load_n(&n_meas, __ATOMIC_ACQUIRE);\n"
              "   int do_benchmark = "
-          << (size > 0 ? "(n_meas < nBench && !cppadcg_thpool_is_disabled())" : "0")
+          << (size > 0 ? "(n_meas_cur < nBench && !cppadcg_thpool_is_disabled() && "
+                         "!__atomic_exchange_n(&benchmarking, 1, __ATOMIC_ACQUIRE))"
+                       : "0")
           << ";\n"
-             "   float* elapsed_p = do_benchmark ? elapsed : NULL;\n";
+             "   float* elapsed_p = do_benchmark ? elapsed : NULL;\n"
+             "   const int* order_p = (do_benchmark || n_meas_cur >= nBench) ? order : NULL;\n"
+             "   const float* ref_elapsed_p = n_meas_cur >= nBench ? ref_elapsed : NULL;\n";
+}
+
+template <class Base>
+void ModelCSourceGen<Base>::printJobArgumentStartPThreads(std::ostringstream& cache, size_t size) {
+    if (size <= PTHREADS_MAX_STACK_JOBS) {
+        cache << "      args[i] = &args_data[i];\n";
+    } else {
+        cache << "      args[i] = args_data != NULL ? &args_data[i] : &args_one;\n";
+    }
+}
+
+template <class Base>
+void ModelCSourceGen<Base>::printJobArgumentEndPThreads(std::ostringstream& cache, size_t size) {
+    if (size > PTHREADS_MAX_STACK_JOBS) {
+        cache << "      if(args_data == NULL) exec_func(args[i]);\n";
+    }
 }
 
 template <class Base>
 void ModelCSourceGen<Base>::printFunctionEndPThreads(std::ostringstream& cache, size_t size) {
-    cache << "   cppadcg_thpool_add_jobs(execute_functions, (void**) args, ref_elapsed, elapsed_p, order, job2Thread, "
-          << size << ", last_elapsed_changed"
-          << ");\n"
-             "\n"
-             "   cppadcg_thpool_wait();\n"
-             "\n"
-             "   for(i = 0; i < "
-          << size
-          << "; ++i) {\n"
-             "      free(args[i]);\n"
-             "   }\n"
-             "\n"
+    std::string indent = "   ";
+    if (size > PTHREADS_MAX_STACK_JOBS) {
+        cache << "   if(args_data != NULL) {\n";
+        indent += "   ";
+    }
+    cache << indent << "cppadcg_thpool_job_group* job_group = cppadcg_thpool_group_acquire(" << size << ");\n"
+          << indent
+          << "cppadcg_thpool_group_add_jobs(job_group, execute_functions, (void**) args, ref_elapsed_p, elapsed_p, "
+             "order_p, "
+          << size << ");\n"
+          << "\n"
+          << indent << "cppadcg_thpool_group_wait(job_group);\n"
+          << indent << "cppadcg_thpool_group_release(job_group);\n";
+    if (size > PTHREADS_MAX_STACK_JOBS) {
+        cache << "      free(args_data);\n"
+                 "   }\n";
+    }
+    cache << "\n"
              "   if(do_benchmark) {\n"
-             "      cppadcg_thpool_update_order(ref_elapsed, n_meas, elapsed, order, "
+             "      cppadcg_thpool_update_order(ref_elapsed, n_meas_cur, elapsed, order, "
           << size
           << ");\n"
-             "      n_meas++;\n"
-             "   } else {\n"
-             "      last_elapsed_changed = 0;\n"
+             "      __atomic_store_n(&n_meas, n_meas_cur + 1, __ATOMIC_RELEASE);\n"
+             "      __atomic_store_n(&benchmarking, 0, __ATOMIC_RELEASE);\n"
              "   }\n";
 }
 
+template <class Base>
+void ModelCSourceGen<Base>::printScratchDeclaration(std::ostringstream& cache,
+                                                    MultiThreadingType multiThreadingType) {
+    if (multiThreadingType == MultiThreadingType::PTHREADS) {
+        cache << "void* cppadcg_thpool_scratch(size_t size);\n"
+                 "\n";
+    }
+}
+
+template <class Base>
+void ModelCSourceGen<Base>::printCompressedArrayDcl(std::ostringstream& cache,
+                                                    const std::string& functionName,
+                                                    size_t size,
+                                                    MultiThreadingType multiThreadingType) const {
+    if (multiThreadingType != MultiThreadingType::PTHREADS || size <= PTHREADS_MAX_STACK_COMPRESSED) {
+        cache << "   " << _baseTypeName << " compressed[" << size << "];\n";
+    } else {
+        cache << "   " << _baseTypeName << "* compressed = (" << _baseTypeName << "*) cppadcg_thpool_scratch(" << size
+              << " * sizeof(" << _baseTypeName << "));\n"
+                 "\n"
+                 "   if (compressed == NULL) {\n"
+                 "      fprintf(stderr, \""
+              << functionName
+              << "(): Could not allocate memory for compressed values\\n\");\n"
+                 "      return;\n"
+                 "   }\n";
+    }
+}
+
 template <class Base>
 void ModelCSourceGen<Base>::printFileStartOpenMP(std::ostringstream& cache) {
     cache << CPPADCG_OPENMP_H_FILE
@@ -841,6 +1064,30 @@ void ModelCSourceGen<Base>::printLoopEndOpenMP(std::ostringstream& cache, size_t
              "   }\n";
 }
 
+template <class Base>
+inline void ModelCSourceGen<Base>::configureHandler(CodeHandler<Base>& handler) const {
+    handler.setJobTimer(_jobTimer);
+    handler.setAlgebraicSimplification(_algebraicSimplification);
+    handler.setRegisterPressureScheduling(_registerPressureAware);
+    handler.setMinOutlineOperations(_minOutlineOperations);
+    handler.setMinLazyBranchOperations(_minLazyBranchOperations);
+}
+
+template <class Base>
+inline std::unique_ptr<ReverseDifferentiator<Base>> ModelCSourceGen<Base>::createSymbolicDifferentiator(
+        CodeHandler<Base>& handler,
+        const std::vector<CGBase>& x,
+        std::vector<CGBase>& dep) {
+    if (!_symbolicDerivatives) return nullptr;
+
+    dep = _fun.Forward(0, x);
+
+    std::unique_ptr<ReverseDifferentiator<Base>> diff(new ReverseDifferentiator<Base>(handler, x));
+    if (!diff->isDifferentiable(dep)) return nullptr;
+
+    return diff;
+}
+
 template <class Base>
 void ModelCSourceGen<Base>::startingJob(const std::string& jobName, const JobType& type) {
     if (_jobTimer != nullptr) _jobTimer->startingJob(jobName, type);
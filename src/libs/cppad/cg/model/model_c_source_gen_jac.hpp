@@ -27,9 +27,32 @@ void ModelCSourceGen<Base>::generateJacobianSource() {
     startingJob("'" + jobName + "'", JobTimer::GRAPH);
 
     CodeHandler<Base> handler;
-    handler.setJobTimer(_jobTimer);
+    vector<CGBase> indVars;
+    vector<CGBase> jac = prepareJacobian(handler, indVars);
 
-    vector<CGBase> indVars(_fun.Domain());
+    finishedJob();
+
+    LanguageC<Base> langC(_baseTypeName);
+    langC.setSimdLoops(_simdLoops);
+    langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
+    langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
+    langC.setParameterPrecision(_parameterPrecision);
+    langC.setGenerateFunction(_name + "_" + FUNCTION_JACOBIAN);
+    selectReducedPrecision(handler, langC, jac, indVars);
+
+    std::ostringstream code;
+    std::unique_ptr<VariableNameGenerator<Base>> nameGen(createVariableNameGenerator("jac"));
+
+    handler.generateCode(code, langC, jac, *nameGen, _atomicFunctions, jobName);
+}
+
+template <class Base>
+std::vector<CG<Base>> ModelCSourceGen<Base>::prepareJacobian(CodeHandler<Base>& handler, std::vector<CGBase>& indVars) {
+    using std::vector;
+
+    configureHandler(handler);
+
+    indVars.resize(_fun.Domain());
     handler.makeVariables(indVars);
     if (_x.size() > 0) {
         for (size_t i = 0; i < indVars.size(); i++) {
@@ -41,7 +64,12 @@ void ModelCSourceGen<Base>::generateJacobianSource() {
     size_t n = _fun.Domain();
 
     vector<CGBase> jac(n * m);
-    if (_jacMode == JacobianADMode::Automatic) {
+    vector<CGBase> dep;
+    std::unique_ptr<ReverseDifferentiator<Base>> diff = createSymbolicDifferentiator(handler, indVars, dep);
+
+    if (diff != nullptr) {
+        jac = diff->jacobian(dep);
+    } else if (_jacMode == JacobianADMode::Automatic) {
         jac = _fun.Jacobian(indVars);
     } else if (_jacMode == JacobianADMode::Forward) {
         JacobianFor(_fun, indVars, jac);
@@ -49,18 +77,7 @@ void ModelCSourceGen<Base>::generateJacobianSource() {
         JacobianRev(_fun, indVars, jac);
     }
 
-    finishedJob();
-
-    LanguageC<Base> langC(_baseTypeName);
-    langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
-    langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
-    langC.setParameterPrecision(_parameterPrecision);
-    langC.setGenerateFunction(_name + "_" + FUNCTION_JACOBIAN);
-
-    std::ostringstream code;
-    std::unique_ptr<VariableNameGenerator<Base>> nameGen(createVariableNameGenerator("jac"));
-
-    handler.generateCode(code, langC, jac, *nameGen, _atomicFunctions, jobName);
+    return jac;
 }
 
 template <class Base>
@@ -109,7 +126,7 @@ void ModelCSourceGen<Base>::generateSparseJacobianSource(bool forward) {
     startingJob("'" + jobName + "'", JobTimer::GRAPH);
 
     CodeHandler<Base> handler;
-    handler.setJobTimer(_jobTimer);
+    configureHandler(handler);
 
     vector<CGBase> indVars(n);
     handler.makeVariables(indVars);
@@ -121,9 +138,14 @@ void ModelCSourceGen<Base>::generateSparseJacobianSource(bool forward) {
 
     vector<CGBase> jac(_jacSparsity.rows.size());
     if (_loopTapes.empty()) {
+        vector<CGBase> dep;
+        std::unique_ptr<ReverseDifferentiator<Base>> diff = createSymbolicDifferentiator(handler, indVars, dep);
+
         // printSparsityPattern(_jacSparsity.sparsity, "jac sparsity");
         CppAD::sparse_jacobian_work work;
-        if (forward) {
+        if (diff != nullptr) {
+            jac = diff->sparseJacobian(dep, _jacSparsity.rows, _jacSparsity.cols);
+        } else if (forward) {
             _fun.SparseJacobianForward(indVars, _jacSparsity.sparsity, _jacSparsity.rows, _jacSparsity.cols, jac, work);
         } else {
             _fun.SparseJacobianReverse(indVars, _jacSparsity.sparsity, _jacSparsity.rows, _jacSparsity.cols, jac, work);
@@ -136,10 +158,12 @@ void ModelCSourceGen<Base>::generateSparseJacobianSource(bool forward) {
     finishedJob();
 
     LanguageC<Base> langC(_baseTypeName);
+    langC.setSimdLoops(_simdLoops);
     langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
     langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
     langC.setParameterPrecision(_parameterPrecision);
     langC.setGenerateFunction(_name + "_" + FUNCTION_SPARSE_JACOBIAN);
+    selectReducedPrecision(handler, langC, jac, indVars);
 
     std::ostringstream code;
     std::unique_ptr<VariableNameGenerator<Base>> nameGen(createVariableNameGenerator("jac"));
@@ -338,9 +362,11 @@ std::string ModelCSourceGen<Base>::generateSparseJacobianForRevMultiThreadSource
     std::vector<std::string> argsDcl2 = langC.generateDefaultFunctionArgumentsDcl2();
 
     _cache.str("");
-    _cache << "#include <stdlib.h>\n"
+    _cache << "#include <stdio.h>\n"
+              "#include <stdlib.h>\n"
               "\n"
            << LanguageC<Base>::ATOMICFUN_STRUCT_DEFINITION << "\n\n";
+    printScratchDeclaration(_cache, multiThreadingType);
     generateFunctionDeclarationSource(_cache, functionRevFor, revForSuffix, jacInfo, argsDcl);
 
     langC.setArgumentIn("inLocal");
@@ -374,12 +400,10 @@ std::string ModelCSourceGen<Base>::generateSparseJacobianForRevMultiThreadSource
                << _baseTypeName
                << " * outLocal[1];\n"
                   "   "
-               << _baseTypeName << " compressed[" << it.second.indexes.size()
-               << "];\n"
-                  "   "
                << _baseTypeName
-               << " * jac = out[0];\n"
-                  "\n"
+               << " * jac = out[0];\n";
+        printCompressedArrayDcl(_cache, functionNameWrap, it.second.indexes.size(), multiThreadingType);
+        _cache << "\n"
                   "   inLocal[0] = in[0];\n"
                   "   inLocal[1] = &inLocal1;\n"
                   "   outLocal[0] = compressed;\n";
@@ -475,15 +499,16 @@ std::string ModelCSourceGen<Base>::generateSparseJacobianForRevMultiThreadSource
         _cache << "\n"
                   "   for(i = 0; i < "
                << jacInfo.size()
-               << "; ++i) {\n"
-                  "      args[i] = (ExecArgStruct*) malloc(sizeof(ExecArgStruct));\n"
-                  "      args[i]->func = p[i];\n"
+               << "; ++i) {\n";
+        printJobArgumentStartPThreads(_cache, jacInfo.size());
+        _cache << "      args[i]->func = p[i];\n"
                   "      args[i]->in = inLocal;\n"
                   "      args[i]->out[0] = &jac[offset[i]];\n"
                   "      args[i]->atomicFun = "
                << langC.getArgumentAtomic()
-               << ";\n"
-                  "   }\n"
+               << ";\n";
+        printJobArgumentEndPThreads(_cache, jacInfo.size());
+        _cache << "   }\n"
                   "\n";
         printFunctionEndPThreads(_cache, jacInfo.size());
     }
@@ -85,7 +85,7 @@ void ModelCSourceGen<Base>::generateSparseReverseOneSourcesWithAtomics(
         startingJob("'" + subJobName + "'", JobTimer::GRAPH);
 
         CodeHandler<Base> handler;
-        handler.setJobTimer(_jobTimer);
+        configureHandler(handler);
 
         vector<CGBase> indVars(_fun.Domain());
         handler.makeVariables(indVars);
@@ -117,6 +117,7 @@ void ModelCSourceGen<Base>::generateSparseReverseOneSourcesWithAtomics(
         finishedJob();
 
         LanguageC<Base> langC(_baseTypeName);
+        langC.setSimdLoops(_simdLoops);
         langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
         langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
         langC.setParameterPrecision(_parameterPrecision);
@@ -144,7 +145,7 @@ void ModelCSourceGen<Base>::generateSparseReverseOneSourcesNoAtomics(
     size_t n = _fun.Domain();
 
     CodeHandler<Base> handler;
-    handler.setJobTimer(_jobTimer);
+    configureHandler(handler);
 
     vector<CGBase> x(n);
     handler.makeVariables(x);
@@ -162,8 +163,14 @@ void ModelCSourceGen<Base>::generateSparseReverseOneSourcesNoAtomics(
 
     vector<CGBase> jacFlat(_jacSparsity.rows.size());
 
-    CppAD::sparse_jacobian_work work;  // temporary structure for CPPAD
-    _fun.SparseJacobianReverse(x, _jacSparsity.sparsity, _jacSparsity.rows, _jacSparsity.cols, jacFlat, work);
+    vector<CGBase> dep;
+    std::unique_ptr<ReverseDifferentiator<Base>> diff = createSymbolicDifferentiator(handler, x, dep);
+    if (diff != nullptr) {
+        jacFlat = diff->sparseJacobian(dep, _jacSparsity.rows, _jacSparsity.cols);
+    } else {
+        CppAD::sparse_jacobian_work work;  // temporary structure for CPPAD
+        _fun.SparseJacobianReverse(x, _jacSparsity.sparsity, _jacSparsity.rows, _jacSparsity.cols, jacFlat, work);
+    }
 
     /**
      * organize results
@@ -206,6 +213,7 @@ void ModelCSourceGen<Base>::generateSparseReverseOneSourcesNoAtomics(
         const std::string subJobName = _cache.str();
 
         LanguageC<Base> langC(_baseTypeName);
+        langC.setSimdLoops(_simdLoops);
         langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
         langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
         langC.setParameterPrecision(_parameterPrecision);
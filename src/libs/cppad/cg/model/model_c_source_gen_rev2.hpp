@@ -84,7 +84,7 @@ void ModelCSourceGen<Base>::generateSparseReverseTwoSourcesWithAtomics(
         startingJob("'" + subJobName + "'", JobTimer::GRAPH);
 
         CodeHandler<Base> handler;
-        handler.setJobTimer(_jobTimer);
+        configureHandler(handler);
 
         vector<CGBase> tx0(n);
         handler.makeVariables(tx0);
@@ -124,6 +124,7 @@ void ModelCSourceGen<Base>::generateSparseReverseTwoSourcesWithAtomics(
         finishedJob();
 
         LanguageC<Base> langC(_baseTypeName);
+        langC.setSimdLoops(_simdLoops);
         langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
         langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
         langC.setParameterPrecision(_parameterPrecision);
@@ -164,7 +165,7 @@ void ModelCSourceGen<Base>::generateSparseReverseTwoSourcesNoAtomics(
 
     // we can use a new handler to reduce memory usage
     CodeHandler<Base> handler;
-    handler.setJobTimer(_jobTimer);
+    configureHandler(handler);
 
     vector<CGBase> tx0(n);
     handler.makeVariables(tx0);
@@ -190,11 +191,17 @@ void ModelCSourceGen<Base>::generateSparseReverseTwoSourcesNoAtomics(
 
     vector<CGBase> hessFlat(evalRows.size());
 
-    CppAD::sparse_hessian_work work;  // temporary structure for CPPAD
-    // "cppad.symmetric" may have missing values for functions using atomic
-    // functions which only provide half of the elements, but there is none here
-    work.color_method = "cppad.symmetric";
-    _fun.SparseHessian(tx0, py, _hessSparsity.sparsity, evalRows, evalCols, hessFlat, work);
+    vector<CGBase> dep;
+    std::unique_ptr<ReverseDifferentiator<Base>> diff = createSymbolicDifferentiator(handler, tx0, dep);
+    if (diff != nullptr) {
+        hessFlat = diff->sparseHessian(dep, py, evalRows, evalCols);
+    } else {
+        CppAD::sparse_hessian_work work;  // temporary structure for CPPAD
+        // "cppad.symmetric" may have missing values for functions using atomic
+        // functions which only provide half of the elements, but there is none here
+        work.color_method = "cppad.symmetric";
+        _fun.SparseHessian(tx0, py, _hessSparsity.sparsity, evalRows, evalCols, hessFlat, work);
+    }
 
     std::map<size_t, vector<CGBase>> hess;
     for (const auto& itJ1 : elements) {
@@ -228,6 +235,7 @@ void ModelCSourceGen<Base>::generateSparseReverseTwoSourcesNoAtomics(
         }
 
         LanguageC<Base> langC(_baseTypeName);
+        langC.setSimdLoops(_simdLoops);
         langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
         langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
         langC.setParameterPrecision(_parameterPrecision);
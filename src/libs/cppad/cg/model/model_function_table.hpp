@@ -0,0 +1,80 @@
+#ifndef CPPAD_CG_MODEL_FUNCTION_TABLE_INCLUDED
+#define CPPAD_CG_MODEL_FUNCTION_TABLE_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+extern "C" {
+
+/**
+ * Describes the functions of a compiled model.
+ * A model library exports one of these descriptors per model so that all
+ * the functions of a model can be found with a single symbol lookup.
+ */
+struct CppADCGModelTable {
+    /**
+     * The API version of the model library
+     */
+    unsigned long version;
+    /**
+     * The model name
+     */
+    const char* name;
+    /**
+     * The number of functions in the table
+     */
+    unsigned long n_functions;
+    /**
+     * The (complete) names of the functions
+     */
+    const char* const* function_names;
+    /**
+     * The function pointers (same order as function_names)
+     */
+    void* const* functions;
+};
+
+/**
+ * Describes a compiled model library (library level functions and the
+ * descriptors of all its models).
+ */
+struct CppADCGLibraryTable {
+    /**
+     * The API version of the model library
+     */
+    unsigned long version;
+    /**
+     * The number of models in the library
+     */
+    unsigned long n_models;
+    /**
+     * The descriptor of each model
+     */
+    const struct CppADCGModelTable* const* models;
+    /**
+     * The number of library level functions
+     */
+    unsigned long n_functions;
+    /**
+     * The names of the library level functions
+     */
+    const char* const* function_names;
+    /**
+     * The library level function pointers (same order as function_names)
+     */
+    void* const* functions;
+};
+}
+
+#endif
@@ -134,6 +134,27 @@ public:
      */
     virtual unsigned int getThreadPoolNumberOfTimeMeas() const = 0;
 
+    /**
+     * Defines whether or not the threads used to evaluate models are placed
+     * according to the NUMA nodes of the machine.
+     * Threads are pinned to the CPUs of each node and concurrent tasks are
+     * preferably executed in the same node in every evaluation.
+     * This value is only used by the models if they were compiled with
+     * multithreading support (PThreads).
+     * It should be defined before using the models.
+     *
+     * @param numaAware true to place threads in NUMA nodes
+     */
+    virtual void setThreadPoolNumaAware(bool numaAware) = 0;
+
+    /**
+     * Determines whether or not the threads used to evaluate models are
+     * placed according to the NUMA nodes of the machine.
+     *
+     * @return true if threads are placed in NUMA nodes
+     */
+    virtual bool isThreadPoolNumaAware() const = 0;
+
     inline virtual ~ModelLibrary() = default;
 };
 
@@ -42,6 +42,9 @@ public:
     static const std::string FUNCTION_GETTHREADPOOLGUIDEDMAXGROUPWORK;
     static const std::string FUNCTION_SETTHREADPOOLNUMBEROFTIMEMEAS;
     static const std::string FUNCTION_GETTHREADPOOLNUMBEROFTIMEMEAS;
+    static const std::string FUNCTION_SETTHREADPOOLNUMAAWARE;
+    static const std::string FUNCTION_ISTHREADPOOLNUMAAWARE;
+    static const std::string LIBRARY_TABLE;
     static const unsigned long API_VERSION;
 
 protected:
@@ -178,6 +181,12 @@ protected:
 
     virtual void generateThreadPoolSources(std::map<std::string, std::string>& sources);
 
+    /**
+     * Generates the exported descriptor of the library which contains the
+     * library level functions and the descriptors of all models.
+     */
+    virtual void generateLibraryTableSource(std::map<std::string, std::string>& sources);
+
     static void saveSources(const std::string& sourcesFolder, const std::map<std::string, std::string>& sources);
 
     friend class ModelLibraryProcessor<Base>;
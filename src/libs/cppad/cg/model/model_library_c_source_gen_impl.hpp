@@ -74,6 +74,15 @@ template <class Base>
 const std::string ModelLibraryCSourceGen<Base>::FUNCTION_GETTHREADPOOLNUMBEROFTIMEMEAS =
         "cppad_cg_thpool_get_number_of_time_meas";
 
+template <class Base>
+const std::string ModelLibraryCSourceGen<Base>::FUNCTION_SETTHREADPOOLNUMAAWARE = "cppad_cg_thpool_set_numa_aware";
+
+template <class Base>
+const std::string ModelLibraryCSourceGen<Base>::FUNCTION_ISTHREADPOOLNUMAAWARE = "cppad_cg_thpool_is_numa_aware";
+
+template <class Base>
+const std::string ModelLibraryCSourceGen<Base>::LIBRARY_TABLE = "cppad_cg_library_table";
+
 template <class Base>
 const std::string ModelLibraryCSourceGen<Base>::CONST = "const";
 
@@ -114,11 +123,14 @@ const std::map<std::string, std::string>& ModelLibraryCSourceGen<Base>::getLibra
         generateModelsSource(_libSources);
         generateOnCloseSource(_libSources);
         generateThreadPoolSources(_libSources);
+        generateLibraryTableSource(_libSources);
 
         if (_multiThreading != MultiThreadingType::NONE) {
             bool usingMultiThreading = false;
             for (const auto& it : _models) {
-                if (it.second->isJacobianMultiThreadingEnabled() || it.second->isHessianMultiThreadingEnabled()) {
+                if (it.second->isJacobianMultiThreadingEnabled() || it.second->isHessianMultiThreadingEnabled() ||
+                    it.second->isZeroMultiThreadingEnabled() ||
+                    it.second->isHessianVectorProductMultiThreadingEnabled()) {
                     usingMultiThreading = true;
                     break;
                 }
@@ -177,7 +189,8 @@ void ModelLibraryCSourceGen<Base>::generateOnCloseSource(std::map<std::string, s
     bool pthreads = false;
     if (_multiThreading == MultiThreadingType::PTHREADS) {
         for (const auto& it : _models) {
-            if (it.second->isJacobianMultiThreadingEnabled() || it.second->isHessianMultiThreadingEnabled()) {
+            if (it.second->isJacobianMultiThreadingEnabled() || it.second->isHessianMultiThreadingEnabled() ||
+                it.second->isZeroMultiThreadingEnabled() || it.second->isHessianVectorProductMultiThreadingEnabled()) {
                 pthreads = true;
                 break;
             }
@@ -202,7 +215,8 @@ void ModelLibraryCSourceGen<Base>::generateThreadPoolSources(std::map<std::strin
     bool usingMultiThreading = false;
     if (_multiThreading != MultiThreadingType::NONE) {
         for (const auto& it : _models) {
-            if (it.second->isJacobianMultiThreadingEnabled() || it.second->isHessianMultiThreadingEnabled()) {
+            if (it.second->isJacobianMultiThreadingEnabled() || it.second->isHessianMultiThreadingEnabled() ||
+                it.second->isZeroMultiThreadingEnabled() || it.second->isHessianVectorProductMultiThreadingEnabled()) {
                 usingMultiThreading = true;
                 break;
             }
@@ -261,6 +275,14 @@ void ModelLibraryCSourceGen<Base>::generateThreadPoolSources(std::map<std::strin
         _cache << "   return cppadcg_thpool_get_n_time_meas();\n";
         _cache << "}\n\n";
 
+        _cache << "void " << FUNCTION_SETTHREADPOOLNUMAAWARE << "(int numaAware) {\n";
+        _cache << "   cppadcg_thpool_set_numa_aware(numaAware);\n";
+        _cache << "}\n\n";
+
+        _cache << "int " << FUNCTION_ISTHREADPOOLNUMAAWARE << "() {\n";
+        _cache << "   return cppadcg_thpool_is_numa_aware();\n";
+        _cache << "}\n\n";
+
         sources["thread_pool_access.c"] = _cache.str();
 
     } else if (usingMultiThreading && _multiThreading == MultiThreadingType::OPENMP) {
@@ -314,6 +336,13 @@ void ModelLibraryCSourceGen<Base>::generateThreadPoolSources(std::map<std::strin
         _cache << "   return 0;\n";
         _cache << "}\n\n";
 
+        _cache << "void " << FUNCTION_SETTHREADPOOLNUMAAWARE << "(int numaAware) {\n";
+        _cache << "}\n\n";
+
+        _cache << "int " << FUNCTION_ISTHREADPOOLNUMAAWARE << "() {\n";
+        _cache << "   return 0;\n";
+        _cache << "}\n\n";
+
         sources["thread_pool_access.c"] = _cache.str();
 
     } else {
@@ -362,11 +391,83 @@ void ModelLibraryCSourceGen<Base>::generateThreadPoolSources(std::map<std::strin
         _cache << "   return 0;\n";
         _cache << "}\n\n";
 
+        _cache << "void " << FUNCTION_SETTHREADPOOLNUMAAWARE << "(int numaAware) {\n";
+        _cache << "}\n\n";
+
+        _cache << "int " << FUNCTION_ISTHREADPOOLNUMAAWARE << "() {\n";
+        _cache << "   return 0;\n";
+        _cache << "}\n\n";
+
         sources["thread_pool_access.c"] = _cache.str();
     }
 }
 
+template <class Base>
+void ModelLibraryCSourceGen<Base>::generateLibraryTableSource(std::map<std::string, std::string>& sources) {
+    // function name, return type, arguments
+    const std::vector<std::array<std::string, 3>> functions = {
+            {FUNCTION_VERSION, "unsigned long", "void"},
+            {FUNCTION_MODELS, "void", "char const *const** names, int* count"},
+            {FUNCTION_ONCLOSE, "void", "void"},
+            {FUNCTION_SETTHREADPOOLDISABLED, "void", "int disabled"},
+            {FUNCTION_ISTHREADPOOLDISABLED, "int", "void"},
+            {FUNCTION_SETTHREADS, "void", "unsigned int n"},
+            {FUNCTION_GETTHREADS, "unsigned int", "void"},
+            {FUNCTION_SETTHREADSCHEDULERSTRAT, "void", "enum ScheduleStrategy s"},
+            {FUNCTION_GETTHREADSCHEDULERSTRAT, "enum ScheduleStrategy", "void"},
+            {FUNCTION_SETTHREADPOOLVERBOSE, "void", "int v"},
+            {FUNCTION_ISTHREADPOOLVERBOSE, "int", "void"},
+            {FUNCTION_SETTHREADPOOLGUIDEDMAXGROUPWORK, "void", "float v"},
+            {FUNCTION_GETTHREADPOOLGUIDEDMAXGROUPWORK, "float", "void"},
+            {FUNCTION_SETTHREADPOOLNUMBEROFTIMEMEAS, "void", "unsigned int n"},
+            {FUNCTION_GETTHREADPOOLNUMBEROFTIMEMEAS, "unsigned int", "void"},
+            {FUNCTION_SETTHREADPOOLNUMAAWARE, "void", "int numaAware"},
+            {FUNCTION_ISTHREADPOOLNUMAAWARE, "int", "void"}};
+
+    _cache.str("");
+    _cache << ModelCSourceGen<Base>::FUNCTION_TABLE_STRUCT_DEFINITION
+           << "\n"
+              "enum ScheduleStrategy {SCHED_STATIC = 1, SCHED_DYNAMIC = 2, SCHED_GUIDED = 3};\n"
+              "\n";
+    for (const auto& f : functions) {
+        _cache << f[1] << " " << f[0] << "(" << f[2] << ");\n";
+    }
+    _cache << "\n";
+    for (const auto& it : _models) {
+        _cache << "extern const struct CppADCGModelTable " << it.first << "_" << ModelCSourceGen<Base>::FUNCTION_TABLE
+               << ";\n";
+    }
+
+    _cache << "\n"
+              "static const struct CppADCGModelTable* const models[] = {";
+    for (auto it = _models.begin(); it != _models.end(); ++it) {
+        if (it != _models.begin()) _cache << ",";
+        _cache << "\n   &" << it->first << "_" << ModelCSourceGen<Base>::FUNCTION_TABLE;
+    }
+    _cache << "};\n"
+              "\n"
+              "static const char* const function_names[] = {";
+    for (size_t i = 0; i < functions.size(); ++i) {
+        if (i != 0) _cache << ",";
+        _cache << "\n   \"" << functions[i][0] << "\"";
+    }
+    _cache << "};\n"
+              "\n"
+              "static void* const functions[] = {";
+    for (size_t i = 0; i < functions.size(); ++i) {
+        if (i != 0) _cache << ",";
+        _cache << "\n   (void*) &" << functions[i][0];
+    }
+    _cache << "};\n"
+              "\n"
+              "CPPADCG_EXPORT const struct CppADCGLibraryTable "
+           << LIBRARY_TABLE << " = {" << API_VERSION << "u, " << _models.size() << ", models, " << functions.size()
+           << ", function_names, functions};\n";
+
+    sources[LIBRARY_TABLE + ".c"] = _cache.str();
+}
+
 }  // namespace cg
 }  // namespace CppAD
 
-#endif
\ No newline at end of file
+#endif
@@ -43,6 +43,87 @@ protected:
     inline const std::map<std::string, std::string>& getSources(ModelCSourceGen<Base>& model) {
         return model.getSources(modelLibraryHelper_->getMultiThreading(), modelLibraryHelper_);
     }
+
+    /**
+     * Provides the operation graph (tape) of a model to processors which
+     * generate their own source code.
+     */
+    static inline ADFun<CG<Base>>& getFunction(ModelCSourceGen<Base>& model) { return model._fun; }
+
+    /**
+     * The names of the atomic functions used by a model (the position
+     * defines the index used to call each atomic function).
+     * It is only complete after the model sources are generated.
+     */
+    static inline std::vector<std::string>& getAtomicFunctions(ModelCSourceGen<Base>& model) {
+        return model._atomicFunctions;
+    }
+
+    /**
+     * Creates the same operation graph used for the zero order forward
+     * mode function of a model.
+     */
+    static inline std::vector<CG<Base>> prepareForward0(ModelCSourceGen<Base>& model,
+                                                        CodeHandler<Base>& handler,
+                                                        std::vector<CG<Base>>& indVars) {
+        return model.prepareForward0(handler, indVars);
+    }
+
+    /**
+     * Creates the same operation graph used for the dense Jacobian function
+     * of a model.
+     */
+    static inline std::vector<CG<Base>> prepareJacobian(ModelCSourceGen<Base>& model,
+                                                        CodeHandler<Base>& handler,
+                                                        std::vector<CG<Base>>& indVars) {
+        return model.prepareJacobian(handler, indVars);
+    }
+
+    /**
+     * Creates the same operation graph used for the dense Hessian function
+     * of a model.
+     */
+    static inline std::vector<CG<Base>> prepareHessian(ModelCSourceGen<Base>& model,
+                                                       CodeHandler<Base>& handler,
+                                                       std::vector<CG<Base>>& indVars,
+                                                       std::vector<CG<Base>>& w) {
+        return model.prepareHessian(handler, indVars, w);
+    }
+
+    /**
+     * The variable name generator used by the C sources of a model.
+     */
+    static inline std::unique_ptr<VariableNameGenerator<Base>> createVariableNameGenerator(
+            ModelCSourceGen<Base>& model) {
+        return std::unique_ptr<VariableNameGenerator<Base>>(model.createVariableNameGenerator());
+    }
+
+    /**
+     * The sparsity pattern of the Jacobian of a model.
+     * It is only defined after the model sources are generated.
+     */
+    static inline const typename ModelCSourceGen<Base>::LocalSparsityInfo& getJacobianSparsity(
+            ModelCSourceGen<Base>& model) {
+        return model._jacSparsity;
+    }
+
+    /**
+     * The sparsity pattern of the Hessian of a model.
+     * It is only defined after the model sources are generated.
+     */
+    static inline const typename ModelCSourceGen<Base>::LocalSparsityInfo& getHessianSparsity(
+            ModelCSourceGen<Base>& model) {
+        return model._hessSparsity;
+    }
+
+    /**
+     * The sparsity patterns of the Hessian of each equation of a model.
+     * They are only defined after the model sources are generated.
+     */
+    static inline const std::vector<typename ModelCSourceGen<Base>::LocalSparsityInfo>& getHessianSparsities(
+            ModelCSourceGen<Base>& model) {
+        return model._hessSparsities;
+    }
 };
 
 }  // namespace cg
@@ -31,7 +31,7 @@ void ModelCSourceGen<Base>::prepareSparseForwardOneWithLoops(const std::map<size
     size_t n = _fun.Domain();
 
     CodeHandler<Base> handler;
-    handler.setJobTimer(_jobTimer);
+    configureHandler(handler);
     handler.setZeroDependents(false);
 
     auto& indexJcolDcl = *handler.makeIndexDclrNode("jcol");
@@ -338,6 +338,7 @@ void ModelCSourceGen<Base>::prepareSparseForwardOneWithLoops(const std::map<size
             }
 
             LanguageC<Base> langC(_baseTypeName);
+            langC.setSimdLoops(_simdLoops);
             langC.setFunctionIndexArgument(indexJcolDcl);
             langC.setParameterPrecision(_parameterPrecision);
 
@@ -422,6 +423,7 @@ void ModelCSourceGen<Base>::createForwardOneWithLoopsNL(CodeHandler<Base>& handl
     const std::string jobName = _cache.str();
 
     LanguageC<Base> langC(_baseTypeName);
+    langC.setSimdLoops(_simdLoops);
     langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
     langC.setParameterPrecision(_parameterPrecision);
     _cache.str("");
@@ -64,7 +64,7 @@ void ModelCSourceGen<Base>::analyseSparseHessianWithLoops(
      */
     for (LoopModel<Base>* l : _loopTapes) {
         l->evalJacobianSparsity();
-        l->evalHessianSparsity();
+        l->evalHessianSparsity(_maxSparsityThreads);
     }
 
     if (_funNoLoops != nullptr) {
@@ -655,7 +655,7 @@ std::vector<CG<Base>> ModelCSourceGen<Base>::prepareSparseHessianWithLoops(CodeH
         startingJob("'model (Jacobian + Hessian, temporaries)'", JobTimer::GRAPH);
 
         dzDx = _funNoLoops->calculateJacobianHessianUsedByLoops(handler, loopHessInfo, x, yNL, noLoopEvalJacSparsity,
-                                                                false);
+                                                                false, _maxSparsityThreads);
 
         finishedJob();
 
@@ -37,7 +37,7 @@ void ModelCSourceGen<Base>::prepareSparseReverseOneWithLoops(const std::map<size
     size_t n = _fun.Domain();
 
     CodeHandler<Base> handler;
-    handler.setJobTimer(_jobTimer);
+    configureHandler(handler);
     handler.setZeroDependents(false);
 
     auto& indexJrowDcl = *handler.makeIndexDclrNode("jrow");
@@ -279,6 +279,7 @@ void ModelCSourceGen<Base>::prepareSparseReverseOneWithLoops(const std::map<size
              * Generate the source code
              */
             LanguageC<Base> langC(_baseTypeName);
+            langC.setSimdLoops(_simdLoops);
             langC.setFunctionIndexArgument(indexJrowDcl);
             langC.setParameterPrecision(_parameterPrecision);
 
@@ -363,6 +364,7 @@ void ModelCSourceGen<Base>::createReverseOneWithLoopsNL(CodeHandler<Base>& handl
     const std::string jobName = _cache.str();
 
     LanguageC<Base> langC(_baseTypeName);
+    langC.setSimdLoops(_simdLoops);
     langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
     langC.setParameterPrecision(_parameterPrecision);
     _cache.str("");
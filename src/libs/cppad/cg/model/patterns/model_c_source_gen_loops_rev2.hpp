@@ -69,7 +69,7 @@ void ModelCSourceGen<Base>::prepareSparseReverseTwoWithLoops(const std::map<size
     size_t n = _fun.Domain();
 
     CodeHandler<Base> handler;
-    handler.setJobTimer(_jobTimer);
+    configureHandler(handler);
     handler.setZeroDependents(false);
 
     auto& indexJrowDcl = *handler.makeIndexDclrNode("jrow");
@@ -217,7 +217,7 @@ void ModelCSourceGen<Base>::prepareSparseReverseTwoWithLoops(const std::map<size
         startingJob("'model (Jacobian + Hessian, temporaries)'", JobTimer::GRAPH);
 
         dzDx = _funNoLoops->calculateJacobianHessianUsedByLoops(handler, loopHessInfo, x, yNL, noLoopEvalJacSparsity,
-                                                                hasAtomics);
+                                                                hasAtomics, _maxSparsityThreads);
 
         finishedJob();
 
@@ -378,6 +378,7 @@ void ModelCSourceGen<Base>::prepareSparseReverseTwoWithLoops(const std::map<size
             }
 
             LanguageC<Base> langC(_baseTypeName);
+            langC.setSimdLoops(_simdLoops);
             langC.setFunctionIndexArgument(indexJrowDcl);
             langC.setParameterPrecision(_parameterPrecision);
 
@@ -452,7 +453,7 @@ void ModelCSourceGen<Base>::prepareSparseReverseTwoWithLoops(const std::map<size
 
             // we can use a new handler to reduce memory usage
             CodeHandler<Base> handlerNL;
-            handlerNL.setJobTimer(_jobTimer);
+            configureHandler(handlerNL);
 
             std::vector<CGBase> tx0(n);
             handlerNL.makeVariables(tx0);
@@ -521,6 +522,7 @@ void ModelCSourceGen<Base>::prepareSparseReverseTwoWithLoops(const std::map<size
                 }
 
                 LanguageC<Base> langC(_baseTypeName);
+                langC.setSimdLoops(_simdLoops);
                 langC.setMaxAssignmentsPerFunction(_maxAssignPerFunc, &_sources);
                 langC.setMaxOperationsPerAssignment(_maxOperationsPerAssignment);
                 langC.setParameterPrecision(_parameterPrecision);
@@ -21,6 +21,18 @@
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <sys/stat.h>
+#include <sys/resource.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <spawn.h>
+#ifdef CPPAD_CG_SYSTEM_APPLE
+#include <crt_externs.h>
+#else
+extern char** environ;
+#endif
 
 namespace CppAD {
 namespace cg {
@@ -64,11 +76,30 @@ public:
     FDHandler write;
 
 public:
-    inline void create() {
+    /**
+     * @param closeOnExec whether or not both ends of the pipe should be
+     *                    closed when a new program is executed
+     */
+    inline void create(bool closeOnExec = false) {
         int fd[2]; /** file descriptors used to communicate between processes*/
+#ifndef CPPAD_CG_SYSTEM_APPLE
+        /**
+         * the flag must be set atomically: an executable spawned by another
+         * thread between pipe() and fcntl() would inherit both ends
+         */
+        if (pipe2(fd, closeOnExec ? O_CLOEXEC : 0) < 0) {
+            throw CGException("Failed to create pipe");
+        }
+#else
+        // pipe2() is not available
         if (pipe(fd) < 0) {
             throw CGException("Failed to create pipe");
         }
+        if (closeOnExec) {
+            fcntl(fd[0], F_SETFD, FD_CLOEXEC);
+            fcntl(fd[1], F_SETFD, FD_CLOEXEC);
+        }
+#endif
         read.fd = fd[0];
         read.closed = false;
         write.fd = fd[1];
@@ -76,6 +107,105 @@ public:
     }
 };
 
+/**
+ * Blocks SIGPIPE in the current thread so that writing to a pipe whose
+ * reader has exited fails with EPIPE instead of terminating the process
+ */
+class SigPipeBlocker {
+private:
+    sigset_t pipeSet_;
+    sigset_t oldSet_;
+    bool wasPending_;
+
+public:
+    inline SigPipeBlocker() {
+        sigemptyset(&pipeSet_);
+        sigaddset(&pipeSet_, SIGPIPE);
+        pthread_sigmask(SIG_BLOCK, &pipeSet_, &oldSet_);
+
+        sigset_t pending;
+        sigpending(&pending);
+        wasPending_ = sigismember(&pending, SIGPIPE) == 1;
+    }
+
+    SigPipeBlocker(const SigPipeBlocker&) = delete;
+    SigPipeBlocker& operator=(const SigPipeBlocker&) = delete;
+
+    inline ~SigPipeBlocker() {
+        if (!wasPending_) {
+            // discard a signal raised by a failed write of this thread
+            sigset_t pending;
+            sigpending(&pending);
+            if (sigismember(&pending, SIGPIPE) == 1) {
+                int sig;
+                sigwait(&pipeSet_, &sig);  // does not block (the signal is pending for this thread)
+            }
+        }
+        pthread_sigmask(SIG_SETMASK, &oldSet_, nullptr);
+    }
+};
+
+/**
+ * Utility class which releases the file actions of posix_spawn
+ */
+class SpawnFileActionsHandler {
+public:
+    posix_spawn_file_actions_t actions;
+
+public:
+    inline SpawnFileActionsHandler() {
+        if (posix_spawn_file_actions_init(&actions) != 0) {
+            throw CGException("Failed to initialize the process file actions");
+        }
+    }
+
+    SpawnFileActionsHandler(const SpawnFileActionsHandler&) = delete;
+    SpawnFileActionsHandler& operator=(const SpawnFileActionsHandler&) = delete;
+
+    inline void addDup2(int fd, int newFd) {
+        if (posix_spawn_file_actions_adddup2(&actions, fd, newFd) != 0) {
+            throw CGException("Failed to define the redirection of file descriptor ", newFd);
+        }
+    }
+
+    inline ~SpawnFileActionsHandler() { posix_spawn_file_actions_destroy(&actions); }
+};
+
+/**
+ * Utility class which releases the attributes of posix_spawn
+ */
+class SpawnAttributesHandler {
+public:
+    posix_spawnattr_t attributes;
+
+public:
+    inline SpawnAttributesHandler() {
+        if (posix_spawnattr_init(&attributes) != 0) {
+            throw CGException("Failed to initialize the process attributes");
+        }
+#ifdef POSIX_SPAWN_USEVFORK
+        // older versions of glibc only avoid copying the parent memory if requested
+        posix_spawnattr_setflags(&attributes, POSIX_SPAWN_USEVFORK);
+#endif
+    }
+
+    SpawnAttributesHandler(const SpawnAttributesHandler&) = delete;
+    SpawnAttributesHandler& operator=(const SpawnAttributesHandler&) = delete;
+
+    inline ~SpawnAttributesHandler() { posix_spawnattr_destroy(&attributes); }
+};
+
+/**
+ * @return the environment variables of the current process
+ */
+inline char** getEnvironment() {
+#ifdef CPPAD_CG_SYSTEM_APPLE
+    return *_NSGetEnviron();
+#else
+    return environ;
+#endif
+}
+
 }  // namespace
 
 #ifdef CPPAD_CG_SYSTEM_APPLE
@@ -188,195 +318,216 @@ inline bool isFile(const std::string& path) {
     return false;
 }
 
+inline size_t maxResidentSetSizeBytes(const struct rusage& usage) {
+#ifdef CPPAD_CG_SYSTEM_APPLE
+    return size_t(usage.ru_maxrss);  // bytes
+#else
+    return size_t(usage.ru_maxrss) * 1024;  // kilobytes
+#endif
+}
+
+/**
+ * The peak resident set size of the last executable which terminated in
+ * the current thread (executables can be launched by several threads)
+ */
+inline size_t& lastExecutablePeakResidentSetSize() {
+    static thread_local size_t peak = 0;
+    return peak;
+}
+
 inline void callExecutable(const std::string& executable,
                            const std::vector<std::string>& args,
                            std::string* stdOutErrMessage,
                            const std::string* stdInMessage) {
-    std::string execName = filenameFromPath(executable);
-
-    PipeHandler pipeMsg;  // file descriptors used to communicate between processes
-    pipeMsg.create();
+    auto errorMessage = [](int error) {
+        char buf[512];
+#ifndef CPPAD_CG_SYSTEM_APPLE
+        return std::string(strerror_r(error, buf, 512));  // thread safe
+#else
+        strerror_r(error, buf, 512);  // thread safe
+        return std::string(buf);
+#endif
+    };
 
-    PipeHandler pipeStdOutErr;  // file descriptors used to communicate between processes
+    /**
+     * all pipe ends are closed on exec so that executables launched at the
+     * same time by other threads do not keep them open
+     */
+    PipeHandler pipeStdOutErr;
     if (stdOutErrMessage != nullptr) {
-        pipeStdOutErr.create();
+        pipeStdOutErr.create(true);
     }
 
     PipeHandler pipeSrc;
     if (stdInMessage != nullptr) {
-        // Create pipe for piping source to the compiler
-        pipeSrc.create();
+        // Create pipe for piping source to the executable
+        pipeSrc.create(true);
     }
 
-    // Fork the compiler, pipe source to it, wait for the compiler to exit
-    pid_t pid = fork();
-    if (pid < 0) {
-        throw CGException("Failed to fork process");
+    /**
+     * Prepare the redirections (performed in the child before exec)
+     */
+    SpawnFileActionsHandler actions;
+    if (stdInMessage != nullptr) {
+        actions.addDup2(pipeSrc.read.fd, STDIN_FILENO);
+    }
+    if (stdOutErrMessage != nullptr) {
+        actions.addDup2(pipeStdOutErr.write.fd, STDOUT_FILENO);
+        actions.addDup2(pipeStdOutErr.write.fd, STDERR_FILENO);
     }
 
-    if (pid == 0) {
-        /***********************************************************************
-         * Child process
-         **********************************************************************/
-        pipeMsg.read.close();
-
-        if (stdInMessage != nullptr) {
-            pipeSrc.write.close();  // close write end of pipe
-            // Send pipe input to stdin
-            close(STDIN_FILENO);
-            if (dup2(pipeSrc.read.fd, STDIN_FILENO) == -1) {
-                perror("redirecting stdin");
-                exit(EXIT_FAILURE);
-            }
-        }
-
-        if (stdOutErrMessage != nullptr) {
-            pipeStdOutErr.read.close();  // close read end of pipe
-
-            // redirect stdout
-            if (dup2(pipeStdOutErr.write.fd, STDOUT_FILENO) == -1) {
-                perror("redirecting stdout");
-                exit(EXIT_FAILURE);
-            }
-
-            // redirect stderr
-            if (dup2(pipeStdOutErr.write.fd, STDERR_FILENO) == -1) {
-                perror("redirecting stderr");
-                exit(EXIT_FAILURE);
-            }
-        }
-
-        auto toCharArray = [](const std::string& args) {
-            const size_t s = args.size() + 1;
-            char* args2 = new char[s];
-            for (size_t c = 0; c < s - 1; c++) {
-                args2[c] = args.at(c);
-            }
-            args2[s - 1] = '\0';
-            return args2;
-        };
-
-        std::vector<char*> args2(args.size() + 2);
-        args2[0] = toCharArray(execName);
-        for (size_t i = 0; i < args.size(); i++) {
-            args2[i + 1] = toCharArray(args[i]);
-        }
-        args2.back() = (char*)nullptr;  // END
-
-        int eCode = execv(executable.c_str(), &args2[0]);
+    SpawnAttributesHandler attributes;
 
-        for (size_t i = 0; i < args.size(); i++) {
-            delete[] args2[i];
-        }
-
-        if (stdOutErrMessage != nullptr) {
-            pipeStdOutErr.write.close();
-        }
-
-        if (eCode < 0) {
-            char buf[512];
-#ifndef CPPAD_CG_SYSTEM_APPLE
-            std::string error = executable + ": " + strerror_r(errno, buf, 511);  // thread safe
-#else
-            std::string error = executable + ": ";
-            strerror_r(errno, buf, 511);  // thread safe
-            error += std::string(buf);
-#endif
-            ssize_t size = error.size() + 1;
-            if (write(pipeMsg.write.fd, error.c_str(), size) != size) {
-                std::cerr << "Failed to send message to parent process" << std::endl;
-            }
-            std::cerr << "*** ERROR: exec failed" << std::endl;
-            exit(EXIT_FAILURE);
-        }
+    std::vector<std::string> argsCopy;
+    argsCopy.reserve(args.size() + 1);
+    argsCopy.push_back(filenameFromPath(executable));
+    argsCopy.insert(argsCopy.end(), args.begin(), args.end());
 
-        exit(EXIT_SUCCESS);
+    std::vector<char*> args2(argsCopy.size() + 1);
+    for (size_t i = 0; i < argsCopy.size(); i++) {
+        args2[i] = &argsCopy[i][0];
+    }
+    args2.back() = (char*)nullptr;  // END
+
+    /**
+     * Launch the executable without duplicating the address space of this
+     * process (the cost of fork grows with the memory used by the process)
+     */
+    lastExecutablePeakResidentSetSize() = 0;
+
+    pid_t pid;
+    int eCode = posix_spawn(&pid, executable.c_str(), &actions.actions, &attributes.attributes, &args2[0],
+                            getEnvironment());
+    if (eCode != 0) {
+        throw CGException("Failed to launch '", executable, "': ", errorMessage(eCode));
     }
 
     /***************************************************************************
      * Parent process
      **************************************************************************/
-    pipeMsg.write.close();
     if (stdOutErrMessage != nullptr) {
         pipeStdOutErr.write.close();
     }
 
-    auto readCErrorMsg = []() {
-        int error = errno;
-        errno = 0;
-        char buf[512];
-#ifndef CPPAD_CG_SYSTEM_APPLE
-        return std::string(strerror_r(error, buf, 512));
-#else
-        strerror_r(error, buf, 512);
-        return std::string(buf);
-#endif
-    };
-
-    std::string writeError;
     if (stdInMessage != nullptr) {
         // close read end of pipe
         pipeSrc.read.close();
-        // Pipe source to the executable
-        ssize_t writeFlag = write(pipeSrc.write.fd, stdInMessage->c_str(), stdInMessage->size());
-        if (writeFlag == -1) writeError = readCErrorMsg() + " ";
-        pipeSrc.write.close();
+        // the input is written as the pipe drains (see below)
+        int flags = fcntl(pipeSrc.write.fd, F_GETFL);
+        if (flags < 0 || fcntl(pipeSrc.write.fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+            int error = errno;
+            pipeSrc.write.close();
+            pipeStdOutErr.read.close();
+            waitpid(pid, nullptr, 0);  // the executable ends once its pipes are closed
+            throw CGException("Failed to configure pipe: ", errorMessage(error));
+        }
     }
 
-    // Wait for the executable to exit
-    int status;
-    // Read message from the child
-    std::ostringstream messageErr;
+    /**
+     * Pipe the source to the executable while reading its output (only the
+     * beginning is kept).
+     * Both are done at the same time: the executable could otherwise block
+     * on a full output pipe before reading all of its input (e.g. a compiler
+     * printing many warnings) while this process blocks on a full input pipe.
+     */
+    std::unique_ptr<SigPipeBlocker> sigPipeBlocker;
+    if (stdInMessage != nullptr) {
+        sigPipeBlocker.reset(new SigPipeBlocker());  // the executable might exit without reading everything
+    }
+
+    std::string writeError;
     std::ostringstream messageStdOutErr;
     size_t size = 0;
-    char buffer[128];
-    do {
-        ssize_t n;
-        if (stdOutErrMessage != nullptr) {
-            while ((n = read(pipeStdOutErr.read.fd, buffer, sizeof(buffer))) > 0) {
-                messageStdOutErr.write(buffer, n);
-                size += n;
-                if (size > 1e4) break;
-            }
+    const char* data = stdInMessage != nullptr ? stdInMessage->c_str() : nullptr;
+    size_t remaining = stdInMessage != nullptr ? stdInMessage->size() : 0;
+    if (stdInMessage != nullptr && remaining == 0) {
+        pipeSrc.write.close();
+    }
+
+    char buffer[4096];
+    while (!pipeSrc.write.closed || !pipeStdOutErr.read.closed) {
+        struct pollfd fds[2];
+        nfds_t nfds = 0;
+        if (!pipeSrc.write.closed) {
+            fds[nfds].fd = pipeSrc.write.fd;
+            fds[nfds].events = POLLOUT;
+            fds[nfds].revents = 0;
+            nfds++;
+        }
+        if (!pipeStdOutErr.read.closed) {
+            fds[nfds].fd = pipeStdOutErr.read.fd;
+            fds[nfds].events = POLLIN;
+            fds[nfds].revents = 0;
+            nfds++;
+        }
+
+        if (poll(fds, nfds, -1) < 0) {
+            if (errno == EINTR) continue;
+            writeError = errorMessage(errno);
+            pipeSrc.write.close();
+            pipeStdOutErr.read.close();
+            break;
         }
 
-        while ((n = read(pipeMsg.read.fd, buffer, sizeof(buffer))) > 0) {
-            messageErr.write(buffer, n);
-            size += n;
-            if (size > 1e4) break;
+        for (nfds_t f = 0; f < nfds; f++) {
+            if (fds[f].revents == 0) continue;
+
+            if (fds[f].fd == pipeSrc.write.fd && !pipeSrc.write.closed) {
+                ssize_t n = write(pipeSrc.write.fd, data, remaining);
+                if (n < 0) {
+                    if (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK) continue;
+                    writeError = errorMessage(errno);  // e.g. the executable exited without reading everything
+                    pipeSrc.write.close();
+                    continue;
+                }
+                data += n;
+                remaining -= n;
+                if (remaining == 0) {
+                    pipeSrc.write.close();  // end of input
+                }
+
+            } else if (fds[f].fd == pipeStdOutErr.read.fd && !pipeStdOutErr.read.closed) {
+                ssize_t n = read(pipeStdOutErr.read.fd, buffer, sizeof(buffer));
+                if (n < 0) {
+                    if (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK) continue;
+                    pipeStdOutErr.read.close();
+                } else if (n == 0) {
+                    pipeStdOutErr.read.close();  // the executable closed its output
+                } else if (size <= 1e4) {
+                    messageStdOutErr.write(buffer, n);
+                    size += n;
+                }
+            }
         }
+    }
 
-        if (waitpid(pid, &status, 0) < 0) {
-            throw CGException("Waitpid failed for pid ", pid, " [", readCErrorMsg(), "]");
+    // Wait for the executable to exit (and collect the resources used by it)
+    int status;
+    struct rusage usage;
+    do {
+        if (wait4(pid, &status, 0, &usage) < 0) {
+            if (errno == EINTR) continue;
+            throw CGException("Wait4 failed for pid ", pid, " [", errorMessage(errno), "]");
         }
     } while (!WIFEXITED(status) && !WIFSIGNALED(status));
 
-    pipeMsg.read.close();
-    if (stdOutErrMessage != nullptr) {
-        pipeStdOutErr.read.close();
-    }
+    lastExecutablePeakResidentSetSize() = maxResidentSetSizeBytes(usage);
 
     if (!writeError.empty()) {
-        std::ostringstream s;
-        s << "Failed to write to pipe";
-        if (size > 0)
-            s << ": " << messageErr.str();
-        else
-            s << ": " << writeError;
-        throw CGException(s.str());
+        throw CGException("Failed to write to pipe: ", writeError);
     }
 
     if (WIFEXITED(status)) {
         if (WEXITSTATUS(status) != EXIT_SUCCESS) {
             std::ostringstream s;
             s << "Executable '" << executable << "' (pid " << pid << ") exited with code " << WEXITSTATUS(status);
-            if (size > 0) s << ": " << messageErr.str();
+            if (size > 0) s << ": " << messageStdOutErr.str();
             throw CGException(s.str());
         }
     } else if (WIFSIGNALED(status)) {
         std::ostringstream s;
         s << "Executable '" << executable << "' (pid " << pid << ") terminated by signal " << WTERMSIG(status);
-        if (size > 0) s << ": " << messageErr.str();
+        if (size > 0) s << ": " << messageStdOutErr.str();
         throw CGException(s.str());
     }
 
@@ -385,6 +536,50 @@ inline void callExecutable(const std::string& executable,
     }
 }
 
+inline size_t getPeakResidentSetSize() {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+
+    return maxResidentSetSizeBytes(usage);
+}
+
+inline size_t getLastExecutablePeakResidentSetSize() {
+    return lastExecutablePeakResidentSetSize();
+}
+
+inline const char* mapFile(const std::string& path, size_t& size) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw CGException("Failed to open file '", path, "': ", strerror(errno));
+    }
+
+    struct stat sts;
+    if (fstat(fd, &sts) != 0) {
+        int error = errno;
+        close(fd);
+        throw CGException("Failed to determine the size of file '", path, "': ", strerror(error));
+    }
+
+    size = size_t(sts.st_size);
+    if (size == 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    int error = errno;
+    close(fd);  // the mapping remains valid
+    if (data == MAP_FAILED) {
+        throw CGException("Failed to map file '", path, "' into memory: ", strerror(error));
+    }
+
+    return static_cast<const char*>(data);
+}
+
+inline void unmapFile(const char* data, size_t size) {
+    if (data != nullptr) munmap(const_cast<char*>(data), size);
+}
+
 }  // namespace system
 
 }  // namespace cg
@@ -97,6 +97,9 @@ inline bool isFile(const std::string& path);
 /**
  * Calls an external executable (system dependent).
  * In the case of an error during execution an exception will be thrown.
+ * The executable is launched without duplicating the memory of the current
+ * process (posix_spawn) and it can be called concurrently from several
+ * threads.
  *
  * @param executable the executable path
  * @param args the command line arguments to the executable
@@ -110,6 +113,43 @@ inline void callExecutable(const std::string& executable,
                            std::string* stdOutErrMessage = nullptr,
                            const std::string* stdInMessage = nullptr);
 
+/**
+ * Determines the maximum amount of memory used by the current process so far.
+ *
+ * @return the peak resident set size in bytes (zero if it is not available)
+ */
+inline size_t getPeakResidentSetSize();
+
+/**
+ * Determines the maximum amount of memory used by the last executable
+ * launched with callExecutable() from the current thread.
+ * The memory used by child processes (e.g. compilers) is not included in
+ * getPeakResidentSetSize().
+ *
+ * @return the peak resident set size in bytes (zero if it is not available)
+ */
+inline size_t getLastExecutablePeakResidentSetSize();
+
+/**
+ * Maps the contents of a file into read-only memory.
+ * The pages are only loaded by the operating system when they are accessed.
+ *
+ * @param path the file path
+ * @param size the file size in bytes (output)
+ * @return the address of the first byte of the mapped file (nullptr for an
+ *         empty file)
+ * @throws CGException on failure to map the file
+ */
+inline const char* mapFile(const std::string& path, size_t& size);
+
+/**
+ * Releases the memory created with mapFile().
+ *
+ * @param data the address returned by mapFile()
+ * @param size the file size returned by mapFile()
+ */
+inline void unmapFile(const char* data, size_t size);
+
 }  // namespace system
 
 }  // namespace cg
@@ -18,31 +18,49 @@ const char CPPADCG_PTHREAD_POOL_C_FILE[] = R"*=*(/* ----------------------------
  *  https://github.com/Pithikos/C-Thread-Pool/blob/master/thpool.c
  */
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* required for the CPU affinity of threads (NUMA) */
+#endif
+
 #include <unistd.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <pthread.h>
 #include <errno.h>
+#include <stdint.h>
 #include <time.h>
 #if defined(__linux__)
+#include <sched.h>
 #include <sys/prctl.h>
 #include <time.h>
 #include <sys/time.h>
+#ifndef __USE_GNU
 #define __USE_GNU /* required before including  resource.h */
+#endif
 #include <sys/resource.h>
 #endif
 
+/* the folder describing the NUMA nodes (it can be replaced to emulate other topologies) */
+#ifndef CPPADCG_THPOOL_NUMA_PATH
+#define CPPADCG_THPOOL_NUMA_PATH "/sys/devices/system/node"
+#endif
+
 enum ScheduleStrategy { SCHED_STATIC = 1, SCHED_DYNAMIC = 2, SCHED_GUIDED = 3 };
 
 enum ElapsedTimeReference { ELAPSED_TIME_AVG, ELAPSED_TIME_MIN };
 
 typedef struct ThPool ThPool;
+typedef struct JobGroup JobGroup;
 typedef void (*thpool_function_type)(void*);
 
 static ThPool* volatile cppadcg_pool = NULL;
+static pthread_mutex_t cppadcg_pool_lock = PTHREAD_MUTEX_INITIALIZER; /* used to create/destroy the pool */
+static size_t cppadcg_pool_ring_size = 1024;                           /* must be a power of 2 */
 static int cppadcg_pool_n_threads = 2;
-static int cppadcg_pool_disabled = 0;  // false
-static int cppadcg_pool_verbose = 0;   // false
+static int cppadcg_pool_disabled = 0;    // false
+static int cppadcg_pool_verbose = 0;     // false
+static int cppadcg_pool_numa_aware = 0;  // false
 static enum ElapsedTimeReference cppadcg_pool_time_update = ELAPSED_TIME_MIN;
 static unsigned int cppadcg_pool_time_meas = 10;  // default number of time measurements
 static float cppadcg_pool_guided_maxgroupwork = 0.75;
@@ -65,6 +83,15 @@ static int thpool_add_jobs(ThPool*,
                            int nJobs,
                            int lastElapsedChanged);
 
+static int thpool_add_group_jobs(ThPool*,
+                                 JobGroup* group,
+                                 thpool_function_type functions[],
+                                 void* args[],
+                                 const float avgElapsed[],
+                                 float elapsed[],
+                                 const int order[],
+                                 int nJobs);
+
 static void thpool_wait(ThPool*);
 
 static void thpool_destroy(ThPool*);
@@ -87,8 +114,37 @@ typedef struct Job {
     struct timespec startTime;     /* initial time (verbose only)          */
     struct timespec endTime;       /* final time (verbose only)            */
     int id;                        /* a job identifier used for debugging  */
+    struct JobGroup* group;        /* the job group (job group jobs only)  */
+    struct Job* next;              /* the next job executed by the same thread (job group jobs only) */
 } Job;
 
+/* Job group (independent set of jobs with its own completion latch) */
+typedef struct JobGroup {
+    Job* jobs;                 /* preallocated job storage                  */
+    int capacity;              /* maximum number of jobs                    */
+    volatile int pending;      /* jobs not yet completed (completion latch) */
+    int done;                  /* whether or not all jobs have completed    */
+    pthread_mutex_t mutex;     /* used to wait for the completion           */
+    pthread_cond_t completed;  /* signal to cppadcg_thpool_group_wait       */
+} JobGroup;
+
+/* Cell of the job ring */
+typedef struct JobRingCell {
+    volatile size_t sequence; /* the position which can be written/read next */
+    Job* job;                 /* the job                                       */
+} JobRingCell;
+
+/* Bounded lock-free multi-producer/multi-consumer job queue (job groups only) */
+typedef struct JobRing {
+    JobRingCell* cells;          /* the ring buffer                      */
+    size_t mask;                 /* the ring size minus one              */
+    char pad0[64];               /* avoids false sharing                 */
+    volatile size_t enqueue_pos; /* the next position used for a push    */
+    char pad1[64];               /* avoids false sharing                 */
+    volatile size_t dequeue_pos; /* the next position used for a pop     */
+    char pad2[64];               /* avoids false sharing                 */
+} JobRing;
+
 /* Work group */
 typedef struct WorkGroup {
     struct WorkGroup* prev;    /* pointer to previous WorkGroup  */
@@ -113,6 +169,7 @@ typedef struct JobQueue {
 /* Thread */
 typedef struct Thread {
     int id;                      /* friendly id                          */
+    int node;                    /* the NUMA node of the thread          */
     pthread_t pthread;           /* pointer to actual thread             */
     struct ThPool* thpool;       /* access to ThPool                     */
     WorkGroup* processed_groups; /* processed work groups (verbose only) */
@@ -120,13 +177,19 @@ typedef struct Thread {
 
 /* Threadpool */
 typedef struct ThPool {
-    Thread** threads;                 /* pointer to threads        */
-    int num_threads;                  /* total number of threads   */
-    volatile int num_threads_alive;   /* threads currently alive   */
-    volatile int num_threads_working; /* threads currently working */
-    pthread_mutex_t thcount_lock;     /* used for thread count etc */
-    pthread_cond_t threads_all_idle;  /* signal to thpool_wait     */
-    JobQueue* jobqueue;               /* pointer to the job queue  */
+    Thread** threads;                  /* pointer to threads         */
+    int num_threads;                   /* total number of threads    */
+    volatile int num_threads_alive;    /* threads currently alive    */
+    volatile int num_threads_working;  /* threads currently working  */
+    volatile int num_threads_sleeping; /* threads waiting for jobs   */
+    pthread_mutex_t thcount_lock;      /* used for thread count etc  */
+    pthread_cond_t threads_all_idle;   /* signal to thpool_wait      */
+    JobQueue* jobqueue;                /* pointer to the job queue   */
+    JobRing** jobrings;                /* job group jobs (per node)  */
+    int num_nodes;                     /* number of NUMA nodes used  */
+#if defined(__linux__)
+    cpu_set_t* node_cpus; /* the CPUs of each NUMA node (NULL if threads are not pinned) */
+#endif
     volatile int threads_keepalive;
 } ThPool;
 
@@ -220,9 +283,141 @@ int cppadcg_thpool_is_verbose() {
     return cppadcg_pool_verbose;
 }
 
+void cppadcg_thpool_set_numa_aware(int numaAware) {
+    cppadcg_pool_numa_aware = numaAware;
+}
+
+int cppadcg_thpool_is_numa_aware() {
+    return cppadcg_pool_numa_aware;
+}
+
+/* Data owned by a single thread */
+typedef struct ThreadData {
+    size_t scratch_size;     /* the size of the scratch buffer (in bytes)    */
+    void* scratch;           /* the scratch buffer                           */
+    JobGroup* group;         /* the job group kept for the next call         */
+    struct ThreadData* prev; /* the data of other threads (for the shutdown) */
+    struct ThreadData* next;
+} ThreadData;
+
+/*
+ * The data of each thread is released when the thread exits or by
+ * cppadcg_thpool_shutdown() before the library is unloaded (including the
+ * data of threads which are still running)
+ */
+static pthread_key_t cppadcg_pool_thread_key;
+static volatile int cppadcg_pool_keys_created = 0;  // false
+static ThreadData* cppadcg_pool_thread_data = NULL; /* guarded by cppadcg_pool_lock */
+
+void cppadcg_thpool_group_destroy(JobGroup* group);
+
+static void thread_data_free(ThreadData* data) {
+    free(data->scratch);
+    cppadcg_thpool_group_destroy(data->group);
+    free(data);
+}
+
+/* Called when a thread exits */
+static void thread_data_exit(void* data) {
+    ThreadData* d;
+
+    pthread_mutex_lock(&cppadcg_pool_lock);
+    /* it might have been released by cppadcg_thpool_shutdown() while this thread was exiting */
+    d = cppadcg_pool_thread_data;
+    while (d != NULL && d != data) {
+        d = d->next;
+    }
+    if (d != NULL) {
+        if (d->prev != NULL) {
+            d->prev->next = d->next;
+        } else {
+            cppadcg_pool_thread_data = d->next;
+        }
+        if (d->next != NULL) d->next->prev = d->prev;
+        thread_data_free(d);
+    }
+    pthread_mutex_unlock(&cppadcg_pool_lock);
+}
+
+static void thread_keys_prepare() {
+    if (!__atomic_load_n(&cppadcg_pool_keys_created, __ATOMIC_ACQUIRE)) {
+        pthread_mutex_lock(&cppadcg_pool_lock);
+        if (!cppadcg_pool_keys_created) {
+            pthread_key_create(&cppadcg_pool_thread_key, thread_data_exit);
+            __atomic_store_n(&cppadcg_pool_keys_created, 1, __ATOMIC_RELEASE);
+        }
+        pthread_mutex_unlock(&cppadcg_pool_lock);
+    }
+}
+
+/* Must be called while holding cppadcg_pool_lock */
+static void thread_keys_delete() {
+    ThreadData* data;
+
+    if (!cppadcg_pool_keys_created) return;
+
+    while (cppadcg_pool_thread_data != NULL) {
+        data = cppadcg_pool_thread_data;
+        cppadcg_pool_thread_data = data->next;
+        thread_data_free(data);
+    }
+
+    pthread_key_delete(cppadcg_pool_thread_key);
+    __atomic_store_n(&cppadcg_pool_keys_created, 0, __ATOMIC_RELEASE);
+}
+
+/* The data of the calling thread (it is only created if requested) */
+static ThreadData* thread_data_get(int create) {
+    ThreadData* data;
+
+    thread_keys_prepare();
+
+    data = (ThreadData*)pthread_getspecific(cppadcg_pool_thread_key);
+    if (data == NULL && create) {
+        data = (ThreadData*)calloc(1, sizeof(ThreadData));
+        if (data == NULL) {
+            fprintf(stderr, "thread_data_get(): Could not allocate memory for thread data\n");
+            return NULL;
+        }
+        pthread_mutex_lock(&cppadcg_pool_lock);
+        data->next = cppadcg_pool_thread_data;
+        if (data->next != NULL) data->next->prev = data;
+        cppadcg_pool_thread_data = data;
+        pthread_mutex_unlock(&cppadcg_pool_lock);
+        pthread_setspecific(cppadcg_pool_thread_key, data);
+    }
+
+    return data;
+}
+
+void* cppadcg_thpool_scratch(size_t size) {
+    ThreadData* data = thread_data_get(1);
+    if (data == NULL) return NULL;
+
+    if (data->scratch_size < size) {
+        free(data->scratch);
+        data->scratch = malloc(size);
+        if (data->scratch == NULL) {
+            fprintf(stderr, "cppadcg_thpool_scratch(): Could not allocate memory for scratch buffer\n");
+            data->scratch_size = 0;
+            return NULL;
+        }
+        /* the pages are touched by the owner thread so that they are placed in its NUMA node */
+        memset(data->scratch, 0, size);
+        data->scratch_size = size;
+    }
+
+    return data->scratch;
+}
+
 void cppadcg_thpool_prepare() {
-    if (cppadcg_pool == NULL) {
-        cppadcg_pool = thpool_init(cppadcg_pool_n_threads);
+    if (__atomic_load_n(&cppadcg_pool, __ATOMIC_ACQUIRE) == NULL) {
+        // several threads may try to create the pool at the same time
+        pthread_mutex_lock(&cppadcg_pool_lock);
+        if (cppadcg_pool == NULL) {
+            __atomic_store_n(&cppadcg_pool, thpool_init(cppadcg_pool_n_threads), __ATOMIC_RELEASE);
+        }
+        pthread_mutex_unlock(&cppadcg_pool_lock);
     }
 }
 
@@ -269,6 +464,111 @@ void cppadcg_thpool_wait() {
     }
 }
 
+JobGroup* cppadcg_thpool_group_create(int maxJobs) {
+    JobGroup* group;
+
+    if (maxJobs < 0) {
+        maxJobs = 0;
+    }
+
+    /* the job storage is placed right after the group */
+    group = (JobGroup*)malloc(sizeof(JobGroup) + maxJobs * sizeof(Job));
+    if (group == NULL) {
+        fprintf(stderr, "cppadcg_thpool_group_create(): Could not allocate memory for job group\n");
+        return NULL;
+    }
+
+    group->jobs = (Job*)(group + 1);
+    group->capacity = maxJobs;
+    group->pending = 0;
+    group->done = 1;  // true
+    pthread_mutex_init(&group->mutex, NULL);
+    pthread_cond_init(&group->completed, NULL);
+
+    return group;
+}
+
+void cppadcg_thpool_group_add_jobs(JobGroup* group,
+                                   thpool_function_type functions[],
+                                   void* args[],
+                                   const float avgElapsed[],
+                                   float elapsed[],
+                                   const int order[],
+                                   int nJobs) {
+    ThPool* thpool = NULL;
+    int i;
+
+    if (!cppadcg_pool_disabled) {
+        cppadcg_thpool_prepare();
+        thpool = cppadcg_pool;
+    }
+
+    if (thpool == NULL || group == NULL || nJobs > group->capacity) {
+        if (group != NULL && nJobs > group->capacity) {
+            fprintf(stderr, "cppadcg_thpool_group_add_jobs(): Too many jobs for the job group\n");
+        }
+        // thread pool not used
+        for (i = 0; i < nJobs; ++i) {
+            (*functions[i])(args[i]);
+        }
+        return;
+    }
+
+    thpool_add_group_jobs(thpool, group, functions, args, avgElapsed, elapsed, order, nJobs);
+}
+
+void cppadcg_thpool_group_wait(JobGroup* group) {
+    if (group == NULL) return;
+
+    pthread_mutex_lock(&group->mutex);
+    while (!group->done) {
+        pthread_cond_wait(&group->completed, &group->mutex);
+    }
+    pthread_mutex_unlock(&group->mutex);
+}
+
+void cppadcg_thpool_group_destroy(JobGroup* group) {
+    if (group == NULL) return;
+
+    pthread_mutex_destroy(&group->mutex);
+    pthread_cond_destroy(&group->completed);
+    free(group);
+}
+
+JobGroup* cppadcg_thpool_group_acquire(int maxJobs) {
+    ThreadData* data = thread_data_get(0);
+    JobGroup* group;
+
+    /* the group is not available to nested calls from the same thread until it is released */
+    if (data != NULL && data->group != NULL) {
+        group = data->group;
+        data->group = NULL;
+        if (group->capacity >= maxJobs) {
+            return group;
+        }
+        cppadcg_thpool_group_destroy(group);
+    }
+
+    return cppadcg_thpool_group_create(maxJobs);
+}
+
+void cppadcg_thpool_group_release(JobGroup* group) {
+    ThreadData* data;
+    JobGroup* cached;
+
+    if (group == NULL) return;
+
+    /* the largest group is kept for the next call from this thread */
+    data = thread_data_get(1);
+    if (data != NULL && (data->group == NULL || data->group->capacity < group->capacity)) {
+        cached = data->group;
+        data->group = group;
+        group = cached;
+    }
+
+    cppadcg_thpool_group_destroy(group);
+}
+
 typedef struct pair_double_int {
     float val;
     int index;
@@ -334,10 +634,14 @@ void cppadcg_thpool_update_order(
 }
 
 void cppadcg_thpool_shutdown() {
+    pthread_mutex_lock(&cppadcg_pool_lock);
     if (cppadcg_pool != NULL) {
         thpool_destroy(cppadcg_pool);
-        cppadcg_pool = NULL;
+        __atomic_store_n(&cppadcg_pool, NULL, __ATOMIC_RELEASE);
     }
+    /* the key destructors must not be called after the library is unloaded */
+    thread_keys_delete();
+    pthread_mutex_unlock(&cppadcg_pool_lock);
 }
 
 /* ========================== PROTOTYPES ============================ */
@@ -348,6 +652,11 @@ static int thread_init(ThPool* thpool, Thread** thread, int id);
 static void* thread_do(Thread* thread);
 static void thread_destroy(Thread* thread);
 
+static void job_execute(Job* job);
+static int jobgroup_schedule(ThPool* thpool, Job* jobs, int nJobs, Job* heads[]);
+static void jobgroup_execute(Job* job);
+static void jobgroup_job_done(JobGroup* group);
+
 static int jobqueue_init(ThPool* thpool);
 static void jobqueue_clear(ThPool* thpool);
 static void jobqueue_push(JobQueue* queue, Job* newjob_p);
@@ -357,6 +666,17 @@ static int jobqueue_push_static_jobs(
 static WorkGroup* jobqueue_pull(ThPool* thpool, int id);
 static void jobqueue_destroy(ThPool* thpool);
 
+static int jobring_init(ThPool* thpool, size_t size);
+static int jobring_push(JobRing* ring, Job* job);
+static Job* jobring_pop(JobRing* ring);
+static Job* jobring_pop_node(ThPool* thpool, int node);
+static int jobring_is_empty(ThPool* thpool);
+static void jobring_destroy(ThPool* thpool);
+
+static void numa_init(ThPool* thpool);
+static void numa_pin_thread(Thread* thread);
+static void numa_destroy(ThPool* thpool);
+
 static void bsem_init(BSem* bsem, int value);
 static void bsem_reset(BSem* bsem);
 static void bsem_post(BSem* bsem);
@@ -448,6 +768,7 @@ struct ThPool* thpool_init(int num_threads) {
     thpool->num_threads = num_threads;
     thpool->num_threads_alive = 0;
     thpool->num_threads_working = 0;
+    thpool->num_threads_sleeping = 0;
     thpool->threads_keepalive = 1;
 
     /* Initialize the job queue */
@@ -457,10 +778,25 @@ struct ThPool* thpool_init(int num_threads) {
         return NULL;
     }
 
+    /* Determine the NUMA nodes used by the threads */
+    numa_init(thpool);
+
+    /* Initialize the job rings (used by job groups) */
+    if (jobring_init(thpool, cppadcg_pool_ring_size) == -1) {
+        fprintf(stderr, "thpool_init(): Could not allocate memory for job ring\n");
+        numa_destroy(thpool);
+        jobqueue_destroy(thpool);
+        free(thpool->jobqueue);
+        free(thpool);
+        return NULL;
+    }
+
     /* Make threads in pool */
     thpool->threads = (Thread**)malloc(num_threads * sizeof(Thread*));
     if (thpool->threads == NULL) {
         fprintf(stderr, "thpool_init(): Could not allocate memory for threads\n");
+        jobring_destroy(thpool);
+        numa_destroy(thpool);
         jobqueue_destroy(thpool);
         free(thpool->jobqueue);
         free(thpool);
@@ -577,6 +913,76 @@ static int thpool_add_jobs(ThPool* thpool,
     }
 }
 
+/**
+ * Adds the jobs of a job group to the job ring.
+ *
+ * The job storage of the group is used (no memory is allocated) and no
+ * locks are required unless there are idle threads which must be woken up.
+ * Jobs which do not fit in the ring are executed by the caller.
+ * Jobs are added according to the provided order and, with the static and
+ * guided strategies, they are combined into sequences executed by the same
+ * thread (see jobgroup_schedule()).
+ * Each sequence is assigned to a NUMA node and it is preferably executed by
+ * the threads of that node.
+ */
+static int thpool_add_group_jobs(ThPool* thpool,
+                                 JobGroup* group,
+                                 thpool_function_type functions[],
+                                 void* args[],
+                                 const float avgElapsed[],
+                                 float elapsed[],
+                                 const int order[],
+                                 int nJobs) {
+    int i;
+    int j;
+    int nHeads;
+    int pushed;
+
+    if (nJobs <= 0) {
+        return 0;
+    }
+
+    Job* heads[nJobs];
+
+    for (i = 0; i < nJobs; ++i) {
+        j = order != NULL ? order[i] : i;
+        /* add function and argument */
+        group->jobs[i].function = functions[j];
+        group->jobs[i].arg = args[j];
+        group->jobs[i].id = i;
+        group->jobs[i].avgElapsed = avgElapsed != NULL ? &avgElapsed[j] : NULL;
+        group->jobs[i].elapsed = elapsed != NULL ? &elapsed[j] : NULL;
+        group->jobs[i].group = group;
+        group->jobs[i].next = NULL;
+    }
+
+    nHeads = jobgroup_schedule(thpool, group->jobs, nJobs, heads);
+
+    /* no other thread uses the group until its jobs are published */
+    group->pending = nJobs;
+    group->done = 0;  // false
+
+    /* consecutive sequences are spread across NUMA nodes (the same job is placed in the same node in every call) */
+    for (pushed = 0; pushed < nHeads; ++pushed) {
+        if (jobring_push(thpool->jobrings[pushed % thpool->num_nodes], heads[pushed]) != 0) {
+            break;  // the ring is full
+        }
+    }
+
+    /* wake up idle threads (only required if there are threads waiting for jobs) */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (pushed > 0 && __atomic_load_n(&thpool->num_threads_sleeping, __ATOMIC_SEQ_CST) > 0) {
+        bsem_post_all(thpool->jobqueue->has_jobs);
+    }
+
+    /* the jobs which did not fit in the ring are executed by the caller */
+    for (i = pushed; i < nHeads; ++i) {
+        jobgroup_execute(heads[i]);
+    }
+
+    return 0;
+}
+
 /**
  * Split work among the threads evenly considering the elapsed time of each job.
  */
@@ -875,6 +1281,8 @@ static void thpool_destroy(ThPool* thpool) {
     /* Job queue cleanup */
     jobqueue_destroy(thpool);
     free(thpool->jobqueue);
+    jobring_destroy(thpool);
+    numa_destroy(thpool);
 
     /* Deallocs */
     int n;
@@ -906,6 +1314,7 @@ static int thread_init(ThPool* thpool, Thread** thread, int id) {
 
     (*thread)->thpool = thpool;
     (*thread)->id = id;
+    (*thread)->node = id % thpool->num_nodes;
     (*thread)->processed_groups = NULL;
 
     pthread_create(&(*thread)->pthread, NULL, (void*)thread_do, (*thread));
@@ -922,14 +1331,9 @@ static int thread_init(ThPool* thpool, Thread** thread, int id) {
  * @return nothing
  */
 static void* thread_do(Thread* thread) {
-    float elapsed;
-    int info;
-    struct timespec cputime;
     JobQueue* queue;
     WorkGroup* workGroup;
     Job* job;
-    thpool_function_type func_buff;
-    void* arg_buff;
     int i;
 
     /* Set thread name for profiling and debugging */
@@ -948,6 +1352,9 @@ static void* thread_do(Thread* thread) {
     /* Assure all threads have been created before starting serving */
     ThPool* thpool = thread->thpool;
 
+    /* Place the thread in its NUMA node (before it allocates any memory) */
+    numa_pin_thread(thread);
+
     /* Mark thread as alive (initialized) */
     pthread_mutex_lock(&thpool->thcount_lock);
     thpool->num_threads_alive += 1;
@@ -956,7 +1363,12 @@ static void* thread_do(Thread* thread) {
     queue = thpool->jobqueue;
 
     while (thpool->threads_keepalive) {
-        bsem_wait(queue->has_jobs);
+        /* jobs from job groups are added without posting to the semaphore unless there are sleeping threads */
+        __atomic_add_fetch(&thpool->num_threads_sleeping, 1, __ATOMIC_SEQ_CST);
+        if (jobring_is_empty(thpool)) {
+            bsem_wait(queue->has_jobs);
+        }
+        __atomic_sub_fetch(&thpool->num_threads_sleeping, 1, __ATOMIC_SEQ_CST);
 
         if (!thpool->threads_keepalive) {
             break;
@@ -967,6 +1379,13 @@ static void* thread_do(Thread* thread) {
         pthread_mutex_unlock(&thpool->thcount_lock);
 
         while (thpool->threads_keepalive) {
+            /* Jobs from job groups (lock-free and preferably from the same NUMA node) */
+            job = jobring_pop_node(thpool, thread->node);
+            if (job != NULL) {
+                jobgroup_execute(job);
+                continue;
+            }
+
             /* Read job from queue and execute it */
             pthread_mutex_lock(&queue->rwmutex);
             workGroup = jobqueue_pull(thpool, thread->id);
@@ -979,32 +1398,7 @@ static void* thread_do(Thread* thread) {
             }
 
             for (i = 0; i < workGroup->size; ++i) {
-                job = &workGroup->jobs[i];
-
-                if (cppadcg_pool_verbose) {
-                    get_monotonic_time2(&job->startTime);
-                }
-
-                int do_benchmark = job->elapsed != NULL;
-                if (do_benchmark) {
-                    elapsed = -get_thread_time(&cputime, &info);
-                }
-
-                /* Execute the job */
-                func_buff = job->function;
-                arg_buff = job->arg;
-                func_buff(arg_buff);
-
-                if (do_benchmark && info == 0) {
-                    elapsed += get_thread_time(&cputime, &info);
-                    if (info == 0) {
-                        (*job->elapsed) = elapsed;
-                    }
-                }
-
-                if (cppadcg_pool_verbose) {
-                    get_monotonic_time2(&job->endTime);
-                }
+                job_execute(&workGroup->jobs[i]);
             }
 
             if (cppadcg_pool_verbose) {
@@ -1042,6 +1436,175 @@ static void thread_destroy(Thread* thread) {
     free(thread);
 }
 
+/* Executes a job (and measures the elapsed time if requested) */
+static void job_execute(Job* job) {
+    float elapsed;
+    int info;
+    struct timespec cputime;
+    thpool_function_type func_buff;
+    void* arg_buff;
+
+    if (cppadcg_pool_verbose) {
+        get_monotonic_time2(&job->startTime);
+    }
+
+    int do_benchmark = job->elapsed != NULL;
+    if (do_benchmark) {
+        elapsed = -get_thread_time(&cputime, &info);
+    }
+
+    /* Execute the job */
+    func_buff = job->function;
+    arg_buff = job->arg;
+    func_buff(arg_buff);
+
+    if (do_benchmark && info == 0) {
+        elapsed += get_thread_time(&cputime, &info);
+        if (info == 0) {
+            (*job->elapsed) = elapsed;
+        }
+    }
+
+    if (cppadcg_pool_verbose) {
+        get_monotonic_time2(&job->endTime);
+    }
+}
+
+/**
+ * Links the jobs of a job group which are executed in sequence by the same
+ * thread according to the scheduling strategy:
+ *  - dynamic: each job is executed individually;
+ *  - static: the jobs are split into one sequence per thread with a similar
+ *    expected duration;
+ *  - guided: consecutive jobs are combined into sequences whose expected
+ *    duration decreases as the remaining work decreases.
+ * Jobs are executed individually when there is no timing information.
+ *
+ * @param jobs the jobs (in the order they should be started)
+ * @param nJobs the number of jobs
+ * @param heads the first job of each sequence (output)
+ * @return the number of sequences
+ */
+static int jobgroup_schedule(ThPool* thpool, Job* jobs, int nJobs, Job* heads[]) {
+    enum ScheduleStrategy strategy = schedule_strategy;
+    int num_threads = thpool->num_threads;
+    float total_duration = 0;
+    float target_duration, duration;
+    int i, k, iBest;
+    int nHeads = 0;
+
+    if (strategy != SCHED_DYNAMIC && num_threads > 0) {
+        for (i = 0; i < nJobs; ++i) {
+            if (jobs[i].avgElapsed == NULL) {
+                total_duration = 0;  // no timing information
+                break;
+            }
+            total_duration += *jobs[i].avgElapsed;
+        }
+    }
+
+    if (total_duration <= 0) {
+        // SCHED_DYNAMIC
+        for (i = 0; i < nJobs; ++i) {
+            heads[i] = &jobs[i];
+        }
+        return nJobs;
+    }
+
+    if (strategy == SCHED_STATIC) {
+        int nGroups = nJobs < num_threads ? nJobs : num_threads;
+        Job* tails[nGroups];
+        float durations[nGroups];
+
+        for (k = 0; k < nGroups; ++k) {
+            heads[k] = NULL;
+            durations[k] = 0;
+        }
+
+        /* the first sequence where the job fits or otherwise the sequence which is expected to end sooner */
+        target_duration = total_duration / nGroups;
+        for (i = 0; i < nJobs; ++i) {
+            duration = *jobs[i].avgElapsed;
+            iBest = -1;
+            for (k = 0; k < nGroups; ++k) {
+                if (durations[k] + duration < target_duration) {
+                    iBest = k;
+                    break;
+                }
+            }
+            if (iBest < 0) {
+                iBest = 0;
+                for (k = 1; k < nGroups; ++k) {
+                    if (durations[k] < durations[iBest]) iBest = k;
+                }
+            }
+
+            durations[iBest] += duration;
+            if (heads[iBest] == NULL)
+                heads[iBest] = &jobs[i];
+            else
+                tails[iBest]->next = &jobs[i];
+            tails[iBest] = &jobs[i];
+        }
+
+        for (k = 0; k < nGroups; ++k) {
+            if (heads[k] != NULL) {
+                if (cppadcg_pool_verbose) {
+                    fprintf(stdout, "jobgroup_schedule(): work group %i for %e s\n", nHeads, durations[k]);
+                }
+                heads[nHeads++] = heads[k];
+            }
+        }
+
+    } else {
+        // SCHED_GUIDED
+        i = 0;
+        while (i < nJobs) {
+            target_duration = total_duration * cppadcg_pool_guided_maxgroupwork / num_threads;
+            duration = *jobs[i].avgElapsed;
+            heads[nHeads] = &jobs[i];
+            for (k = i + 1; k < nJobs && duration + *jobs[k].avgElapsed < target_duration; ++k) {
+                duration += *jobs[k].avgElapsed;
+                jobs[k - 1].next = &jobs[k];
+            }
+
+            if (cppadcg_pool_verbose) {
+                fprintf(stdout, "jobgroup_schedule(): work group %i with %i jobs for %e s (target: %e s)\n", nHeads,
+                        k - i, duration, target_duration);
+            }
+
+            total_duration -= duration;
+            nHeads++;
+            i = k;
+        }
+    }
+
+    return nHeads;
+}
+
+/* Executes a job of a job group and the jobs linked to it */
+static void jobgroup_execute(Job* job) {
+    JobGroup* group = job->group;
+    Job* next;
+
+    while (job != NULL) {
+        next = job->next;  // the job might not exist after the group is completed
+        job_execute(job);
+        jobgroup_job_done(group);
+        job = next;
+    }
+}
+
+/* Counts down the completion latch of a job group */
+static void jobgroup_job_done(JobGroup* group) {
+    if (__atomic_sub_fetch(&group->pending, 1, __ATOMIC_ACQ_REL) == 0) {
+        pthread_mutex_lock(&group->mutex);
+        group->done = 1;  // true
+        pthread_cond_broadcast(&group->completed);
+        pthread_mutex_unlock(&group->mutex);
+    }
+}
+
 /* ============================ JOB QUEUE =========================== */
 
 /* Initialize queue */
@@ -1313,6 +1876,307 @@ static void jobqueue_destroy(ThPool* thpool) {
     free(thpool->jobqueue->has_jobs);
 }
 
+/* ============================ JOB RING ============================ */
+
+/*
+ * Bounded multi-producer/multi-consumer queue based on sequence numbers
+ * (D. Vyukov). A cell can be written when its sequence is equal to the
+ * enqueue position and read when it is equal to the dequeue position plus
+ * one, so there are no ABA problems and no locks.
+ */
+
+/* Initialize one ring per NUMA node (size must be a power of 2) */
+static int jobring_init(ThPool* thpool, size_t size) {
+    size_t i;
+    int n;
+    JobRing* ring;
+
+    thpool->jobrings = (JobRing**)calloc(thpool->num_nodes, sizeof(JobRing*));
+    if (thpool->jobrings == NULL) {
+        return -1;
+    }
+
+    for (n = 0; n < thpool->num_nodes; ++n) {
+        ring = (JobRing*)malloc(sizeof(JobRing));
+        if (ring == NULL) {
+            jobring_destroy(thpool);
+            return -1;
+        }
+        thpool->jobrings[n] = ring;
+
+        ring->cells = (JobRingCell*)malloc(size * sizeof(JobRingCell));
+        if (ring->cells == NULL) {
+            jobring_destroy(thpool);
+            return -1;
+        }
+
+        for (i = 0; i < size; ++i) {
+            ring->cells[i].sequence = i;
+            ring->cells[i].job = NULL;
+        }
+        ring->mask = size - 1;
+        ring->enqueue_pos = 0;
+        ring->dequeue_pos = 0;
+    }
+
+    return 0;
+}
+
+/**
+ * Add a job to the ring
+ *
+ * @return 0 on success, -1 if the ring is full
+ */
+static int jobring_push(JobRing* ring, Job* job) {
+    JobRingCell* cell;
+    size_t seq;
+    intptr_t diff;
+    size_t pos = __atomic_load_n(&ring->enqueue_pos, __ATOMIC_RELAXED);
+
+    for (;;) {
+        cell = &ring->cells[pos & ring->mask];
+        seq = __atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE);
+        diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&ring->enqueue_pos, &pos, pos + 1, 1, __ATOMIC_RELAXED,
+                                            __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return -1;  // full
+        } else {
+            pos = __atomic_load_n(&ring->enqueue_pos, __ATOMIC_RELAXED);
+        }
+    }
+
+    cell->job = job;
+    __atomic_store_n(&cell->sequence, pos + 1, __ATOMIC_RELEASE);
+
+    return 0;
+}
+
+/**
+ * Get a job from the ring (removes it from the ring)
+ *
+ * @return the job or NULL if the ring is empty
+ */
+static Job* jobring_pop(JobRing* ring) {
+    JobRingCell* cell;
+    Job* job;
+    size_t seq;
+    intptr_t diff;
+    size_t pos = __atomic_load_n(&ring->dequeue_pos, __ATOMIC_RELAXED);
+
+    for (;;) {
+        cell = &ring->cells[pos & ring->mask];
+        seq = __atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE);
+        diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&ring->dequeue_pos, &pos, pos + 1, 1, __ATOMIC_RELAXED,
+                                            __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return NULL;  // empty
+        } else {
+            pos = __atomic_load_n(&ring->dequeue_pos, __ATOMIC_RELAXED);
+        }
+    }
+
+    job = cell->job;
+    __atomic_store_n(&cell->sequence, pos + ring->mask + 1, __ATOMIC_RELEASE);
+
+    return job;
+}
+
+/**
+ * Get a job from the ring of a NUMA node or, if there are none, from the
+ * rings of the other nodes
+ */
+static Job* jobring_pop_node(ThPool* thpool, int node) {
+    Job* job;
+    int n;
+
+    for (n = 0; n < thpool->num_nodes; ++n) {
+        job = jobring_pop(thpool->jobrings[(node + n) % thpool->num_nodes]);
+        if (job != NULL) {
+            return job;
+        }
+    }
+
+    return NULL;
+}
+
+/* Whether or not there are jobs in the rings */
+static int jobring_is_empty(ThPool* thpool) {
+    JobRing* ring;
+    int n;
+
+    for (n = 0; n < thpool->num_nodes; ++n) {
+        ring = thpool->jobrings[n];
+        if (__atomic_load_n(&ring->enqueue_pos, __ATOMIC_SEQ_CST) !=
+            __atomic_load_n(&ring->dequeue_pos, __ATOMIC_SEQ_CST)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* Free all ring resources back to the system */
+static void jobring_destroy(ThPool* thpool) {
+    int n;
+
+    if (thpool->jobrings == NULL) return;
+
+    for (n = 0; n < thpool->num_nodes; ++n) {
+        if (thpool->jobrings[n] != NULL) {
+            free(thpool->jobrings[n]->cells);
+            free(thpool->jobrings[n]);
+        }
+    }
+    free(thpool->jobrings);
+    thpool->jobrings = NULL;
+}
+
+/* ============================== NUMA ============================== */
+
+#if defined(__linux__)
+/**
+ * Reads a list of CPUs or NUMA nodes (e.g. "0-3,8-11") from a file
+ *
+ * @return 0 on success, -1 otherwise.
+ */
+static int numa_read_list(const char* path, cpu_set_t* set) {
+    FILE* file;
+    char buffer[4096];
+    char* p;
+    char* end;
+    long first, last, i;
+
+    CPU_ZERO(set);
+
+    file = fopen(path, "r");
+    if (file == NULL) {
+        return -1;
+    }
+    p = fgets(buffer, sizeof(buffer), file);
+    fclose(file);
+    if (p == NULL) {
+        return -1;
+    }
+
+    while (*p != '\0' && *p != '\n') {
+        first = strtol(p, &end, 10);
+        if (end == p) return -1;
+        last = first;
+        p = end;
+        if (*p == '-') {
+            p++;
+            last = strtol(p, &end, 10);
+            if (end == p) return -1;
+            p = end;
+        }
+        for (i = first; i <= last && i < CPU_SETSIZE; ++i) {
+            CPU_SET(i, set);
+        }
+        if (*p == ',') p++;
+    }
+
+    return 0;
+}
+#endif
+
+/**
+ * Determines the NUMA nodes (and their CPUs) where threads are placed.
+ * A single node is used when NUMA awareness is disabled or the topology
+ * is not available.
+ */
+static void numa_init(ThPool* thpool) {
+    thpool->num_nodes = 1;
+
+#if defined(__linux__)
+    cpu_set_t nodes;
+    char path[4096];
+    int node;
+    int n;
+    int num_nodes;
+
+    thpool->node_cpus = NULL;
+
+    if (!cppadcg_pool_numa_aware) {
+        return;
+    }
+
+    if (numa_read_list(CPPADCG_THPOOL_NUMA_PATH "/online", &nodes) != 0) {
+        if (cppadcg_pool_verbose) {
+            fprintf(stdout, "numa_init(): NUMA topology not available\n");
+        }
+        return;
+    }
+
+    num_nodes = CPU_COUNT(&nodes);
+    if (num_nodes <= 1) {
+        return;
+    }
+
+    thpool->node_cpus = (cpu_set_t*)malloc(num_nodes * sizeof(cpu_set_t));
+    if (thpool->node_cpus == NULL) {
+        fprintf(stderr, "numa_init(): Could not allocate memory\n");
+        return;
+    }
+
+    n = 0;
+    for (node = 0; node < CPU_SETSIZE && n < num_nodes; ++node) {
+        if (!CPU_ISSET(node, &nodes)) continue;
+
+        snprintf(path, sizeof(path), CPPADCG_THPOOL_NUMA_PATH "/node%d/cpulist", node);
+        if (numa_read_list(path, &thpool->node_cpus[n]) != 0 || CPU_COUNT(&thpool->node_cpus[n]) == 0) {
+            continue;  // memory only node
+        }
+
+        if (cppadcg_pool_verbose) {
+            fprintf(stdout, "numa_init(): node %i with %i CPUs used as node %i\n", node,
+                    CPU_COUNT(&thpool->node_cpus[n]), n);
+        }
+        n++;
+    }
+
+    if (n <= 1) {
+        free(thpool->node_cpus);
+        thpool->node_cpus = NULL;
+        return;
+    }
+
+    thpool->num_nodes = n;
+#endif
+}
+
+/* Pins the current thread to the CPUs of its NUMA node */
+static void numa_pin_thread(Thread* thread) {
+#if defined(__linux__)
+    ThPool* thpool = thread->thpool;
+
+    if (thpool->node_cpus == NULL) {
+        return;
+    }
+
+    if (sched_setaffinity(0, sizeof(cpu_set_t), &thpool->node_cpus[thread->node]) != 0) {
+        fprintf(stderr, "numa_pin_thread(): Failed to set the CPU affinity of thread %i\n", thread->id);
+    } else if (cppadcg_pool_verbose) {
+        fprintf(stdout, "numa_pin_thread(): Thread %i placed in node %i\n", thread->id, thread->node);
+    }
+#endif
+}
+
+/* Free all NUMA resources back to the system */
+static void numa_destroy(ThPool* thpool) {
+#if defined(__linux__)
+    free(thpool->node_cpus);
+    thpool->node_cpus = NULL;
+#endif
+}
+
 /* ======================== SYNCHRONISATION ========================= */
 
 /* Init semaphore to 1 or 0 */
@@ -1358,5 +2222,5 @@ static void bsem_wait(BSem* bsem) {
 }
 )*=*";
 
-const size_t CPPADCG_PTHREAD_POOL_C_FILE_SIZE = 42259;
+const size_t CPPADCG_PTHREAD_POOL_C_FILE_SIZE = 69970;
 
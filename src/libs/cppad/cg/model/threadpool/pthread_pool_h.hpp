@@ -15,6 +15,8 @@ const char CPPADCG_PTHREAD_POOL_H_FILE[] = R"*=*(#ifndef CPPADCG_PTHREAD_POOL_H
  * Author: Joao Leal
  */
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -25,6 +27,8 @@ enum ElapsedTimeReference { ELAPSED_TIME_AVG, ELAPSED_TIME_MIN };
 
 typedef void (*cppadcg_thpool_function_type)(void*);
 
+typedef struct JobGroup cppadcg_thpool_job_group;
+
 void cppadcg_thpool_set_threads(int n);
 
 int cppadcg_thpool_get_threads();
@@ -49,6 +53,22 @@ void cppadcg_thpool_set_verbose(int v);
 
 int cppadcg_thpool_is_verbose();
 
+/**
+ * Threads are pinned to the CPUs of each NUMA node and jobs from job groups
+ * are preferably executed by threads of the node where they were placed.
+ * It must be defined before the thread pool is created.
+ */
+void cppadcg_thpool_set_numa_aware(int numaAware);
+
+int cppadcg_thpool_is_numa_aware();
+
+/**
+ * Provides a scratch buffer owned by the calling thread.
+ * It is allocated and initialized by its owner (and therefore placed in
+ * its NUMA node) and it is reused in subsequent calls from the same thread.
+ */
+void* cppadcg_thpool_scratch(size_t size);
+
 void cppadcg_thpool_set_disabled(int disabled);
 
 int cppadcg_thpool_is_disabled();
@@ -68,6 +88,42 @@ void cppadcg_thpool_add_jobs(cppadcg_thpool_function_type functions[],
 
 void cppadcg_thpool_wait();
 
+/**
+ * Job groups are independent sets of jobs with their own completion latch
+ * which can be submitted and waited for concurrently by several threads.
+ * A group can be reused after cppadcg_thpool_group_wait().
+ */
+cppadcg_thpool_job_group* cppadcg_thpool_group_create(int maxJobs);
+
+/**
+ * Provides a job group owned by the calling thread which is reused by
+ * subsequent calls from the same thread (a new group is only created for
+ * nested calls or when more jobs are required).
+ * It must be returned with cppadcg_thpool_group_release() after
+ * cppadcg_thpool_group_wait().
+ */
+cppadcg_thpool_job_group* cppadcg_thpool_group_acquire(int maxJobs);
+
+void cppadcg_thpool_group_release(cppadcg_thpool_job_group* group);
+
+/**
+ * Adds jobs to a job group.
+ * The expected elapsed time of each job (avgElapsed) is used to combine
+ * jobs with the static and guided scheduling strategies; jobs are
+ * scheduled dynamically when it is not provided.
+ */
+void cppadcg_thpool_group_add_jobs(cppadcg_thpool_job_group* group,
+                                   cppadcg_thpool_function_type functions[],
+                                   void* args[],
+                                   const float avgElapsed[],
+                                   float elapsed[],
+                                   const int order[],
+                                   int nJobs);
+
+void cppadcg_thpool_group_wait(cppadcg_thpool_job_group* group);
+
+void cppadcg_thpool_group_destroy(cppadcg_thpool_job_group* group);
+
 void cppadcg_thpool_update_order(
         float refElapsed[], unsigned int nTimeMeas, const float elapsed[], int order[], int nJobs);
 
@@ -80,5 +136,5 @@ void cppadcg_thpool_shutdown();
 #endif
 )*=*";
 
-const size_t CPPADCG_PTHREAD_POOL_H_FILE_SIZE = 2422;
+const size_t CPPADCG_PTHREAD_POOL_H_FILE_SIZE = 4554;
 
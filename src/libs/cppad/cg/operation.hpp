@@ -85,6 +85,7 @@ enum class CGOpCode {
     EndIf,          // end of if
     CondResult,     // assignment inside an if branch
     UserCustom,     // a custom type added by a user which has no direct support in CppADCodeGen
+    OutlinedCall,   // call to a function shared by several isomorphic subgraphs
     NumberOp        // total number of operation types
 };
 
@@ -150,6 +151,7 @@ inline std::ostream& operator<<(std::ostream& os, const CGOpCode& op) {
                                         "endif",                                         // EndIf
                                         "ifResult =",                                    // CondResult
                                         "custom",                                        // UserCustom
+                                        "outlined()",                                    // OutlinedCall
                                         "numberOp"};
     // check ensuring conversion to size_t is as expected
     CPPADCG_ASSERT_UNKNOWN(size_t(CGOpCode::NumberOp) + 1 == sizeof(OpNameTable) / sizeof(OpNameTable[0]));
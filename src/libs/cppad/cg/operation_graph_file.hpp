@@ -0,0 +1,695 @@
+#ifndef CPPAD_CG_OPERATION_GRAPH_FILE_INCLUDED
+#define CPPAD_CG_OPERATION_GRAPH_FILE_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * A binary file with an operation graph (the nodes of a CodeHandler used to
+ * compute a set of dependent variables).
+ *
+ * The graph can be saved once (e.g. after taping and optimizing a model)
+ * and then loaded into a new CodeHandler in other processes, which avoids
+ * the creation of the ADFun<CG<Base>> and the repetition of the taping
+ * stage.
+ * The file is mapped into memory and only the nodes required by the
+ * requested dependent variables are read and created (see Loader), so the
+ * dependent variables can also be loaded one at a time.
+ * The loaded variables can be used by any evaluator or source code
+ * generator, just like the original ones.
+ *
+ * File layout (64-bit words in the native byte order):
+ *  - header: magic, version, sizeof(Base), node count, independent count,
+ *            dependent count, atomic function count and the offsets of the
+ *            node offset table, the dependent table, and the atomic
+ *            function table;
+ *  - node records in topological order (independent variables first):
+ *    operation, info size, argument count, name length, info values,
+ *    arguments, name;
+ *  - node offset table;
+ *  - dependent table (one argument per dependent variable);
+ *  - atomic function table: ID and name of each atomic function.
+ * An argument is a reference to a previous node (index << 1) or a parameter
+ * (the value 1 followed by the bytes of the value).
+ *
+ * Only the operations of taped models are supported. Loop operations are
+ * not saved: they are created during source code generation (from the
+ * patterns detected among related dependent variables) and reference
+ * LoopModel tapes, which are not part of the graph. The graph of a model
+ * with loops must be saved without them and the patterns detected again
+ * after loading.
+ *
+ * @author Feng Yang
+ */
+template <class Base>
+class OperationGraphFile {
+    static_assert(std::is_trivially_copyable<Base>::value,
+                  "Operation graph files require a trivially copyable Base type");
+
+public:
+    using Node = OperationNode<Base>;
+    using Arg = Argument<Base>;
+    using CGB = CG<Base>;
+
+    /**
+     * the version of the file format
+     */
+    static constexpr uint64_t VERSION = 1;
+
+protected:
+    static constexpr size_t HEADER_WORDS = 10;
+    static const char MAGIC[8];
+
+    // the file path
+    const std::string path_;
+    // the memory mapped file
+    const char* data_;
+    // the file size in bytes
+    size_t size_;
+    // the total number of nodes (including the independent variables)
+    size_t nodeCount_;
+    // the number of independent variables
+    size_t indepCount_;
+    // the number of dependent variables
+    size_t depCount_;
+    // the position of the table with the offset of each node record
+    size_t nodeTable_;
+    // the position of the argument of each dependent variable
+    std::vector<size_t> depPos_;
+    // the atomic function names (ID in the file -> name)
+    std::map<size_t, std::string> atomicNames_;
+
+public:
+    /**
+     * Maps an operation graph file into memory.
+     *
+     * @param path the file path
+     * @throws CGException if the file cannot be read or it is not a valid
+     *                     operation graph file for this Base type
+     */
+    explicit OperationGraphFile(std::string path)
+        : path_(std::move(path)),
+          data_(nullptr),
+          size_(0),
+          nodeCount_(0),
+          indepCount_(0),
+          depCount_(0),
+          nodeTable_(0) {
+        data_ = system::mapFile(path_, size_);
+        try {
+            readHeader();
+        } catch (...) {
+            system::unmapFile(data_, size_);
+            throw;
+        }
+    }
+
+    OperationGraphFile(const OperationGraphFile&) = delete;
+    OperationGraphFile& operator=(const OperationGraphFile&) = delete;
+
+    virtual ~OperationGraphFile() { system::unmapFile(data_, size_); }
+
+    inline const std::string& getPath() const { return path_; }
+
+    /**
+     * @return the total number of operation nodes in the file (including
+     *         the independent variables)
+     */
+    inline size_t getNodeCount() const { return nodeCount_; }
+
+    inline size_t getIndependentSize() const { return indepCount_; }
+
+    inline size_t getDependentSize() const { return depCount_; }
+
+    /**
+     * Provides the names of the atomic functions used by the graph.
+     * Atomic functions with these names must be registered in the
+     * CodeHandler (used by the taping of the new model) before load().
+     */
+    inline std::set<std::string> getAtomicFunctionNames() const {
+        std::set<std::string> names;
+        for (const auto& it : atomicNames_) names.insert(it.second);
+        return names;
+    }
+
+    /**
+     * Creates the nodes of the graph in a CodeHandler on demand.
+     *
+     * Only the records of the nodes required by the requested dependent
+     * variables are read from the mapped file, and the nodes shared with
+     * previously requested dependent variables are reused. Therefore, the
+     * dependent variables can be loaded, generated and evaluated one at a
+     * time without creating the whole graph.
+     * The loader must not outlive the file or the code handler.
+     */
+    class Loader {
+    protected:
+        const OperationGraphFile& file_;
+        CodeHandler<Base>& handler_;
+        // the atomic function IDs (file ID -> handler ID)
+        const std::map<size_t, size_t> atomicIds_;
+        // the independent variables
+        std::vector<CGB> indep_;
+        // the created nodes (by node index in the file)
+        std::vector<Node*> nodes_;
+        // whether or not a node was already requested (by node index in the file)
+        std::vector<bool> requested_;
+
+    public:
+        /**
+         * Creates the independent variables in a code handler.
+         *
+         * @throws CGException if an atomic function used by the graph is not
+         *                     registered in the handler
+         */
+        inline Loader(const OperationGraphFile& file, CodeHandler<Base>& handler)
+            : file_(file),
+              handler_(handler),
+              atomicIds_(file.mapAtomicFunctions(handler)),
+              indep_(file.indepCount_),
+              nodes_(file.nodeCount_, nullptr),
+              requested_(file.nodeCount_, false) {
+            handler_.makeVariables(indep_);
+            for (size_t i = 0; i < indep_.size(); ++i) {
+                nodes_[i] = indep_[i].getOperationNode();
+                requested_[i] = true;
+            }
+        }
+
+        Loader(const Loader&) = delete;
+        Loader& operator=(const Loader&) = delete;
+
+        inline const std::vector<CGB>& getIndependentVariables() const { return indep_; }
+
+        /**
+         * @return the number of nodes created so far (including the
+         *         independent variables)
+         */
+        inline size_t getCreatedNodeCount() const {
+            return nodes_.size() - size_t(std::count(nodes_.begin(), nodes_.end(), nullptr));
+        }
+
+        /**
+         * Creates a dependent variable (and the nodes it requires).
+         *
+         * @param i the index of the dependent variable
+         * @throws CGException if the index is invalid or the file is corrupted
+         */
+        inline CGB dependent(size_t i) { return dependents(std::vector<size_t>{i})[0]; }
+
+        /**
+         * Creates some dependent variables (and the nodes they require).
+         *
+         * @param depIndexes the indexes of the dependent variables
+         * @return the dependent variables (in the same order as depIndexes)
+         * @throws CGException if an index is invalid or the file is corrupted
+         */
+        inline std::vector<CGB> dependents(const std::vector<size_t>& depIndexes) {
+            std::vector<size_t> depArgs(depIndexes.size());
+            for (size_t i = 0; i < depIndexes.size(); ++i) {
+                if (depIndexes[i] >= file_.depCount_) {
+                    throw CGException("Invalid dependent variable index ", depIndexes[i], " (the graph in '",
+                                      file_.path_, "' has ", file_.depCount_, " dependent variables)");
+                }
+                depArgs[i] = file_.depPos_[depIndexes[i]];
+            }
+
+            createNodes(depArgs);
+
+            std::vector<CGB> dep(depIndexes.size());
+            for (size_t i = 0; i < depIndexes.size(); ++i) {
+                Arg arg = file_.readArgument(depArgs[i], nodes_);
+                if (arg.getOperation() != nullptr)
+                    dep[i] = CGB(*arg.getOperation());
+                else
+                    dep[i] = CGB(*arg.getParameter());
+            }
+
+            return dep;
+        }
+
+    protected:
+        /**
+         * Creates the nodes (not created yet) used by some arguments.
+         *
+         * @param argPos the positions of the arguments in the file
+         */
+        inline void createNodes(const std::vector<size_t>& argPos) {
+            /**
+             * determine the nodes which are needed (a node only references
+             * previous nodes)
+             */
+            std::vector<size_t> newNodes;
+            std::vector<size_t> stack;
+            auto request = [&](size_t pos) {
+                uint64_t ref = file_.readWord(pos);
+                if ((ref & 1) != 0) return;
+                size_t j = file_.nodeIndex(ref);
+                if (requested_[j]) return;
+                requested_[j] = true;
+                newNodes.push_back(j);
+                stack.push_back(j);
+            };
+
+            for (size_t pos : argPos) request(pos);
+
+            while (!stack.empty()) {
+                size_t i = stack.back();
+                stack.pop_back();
+
+                Record r = file_.readRecord(i);
+                size_t pos = r.args;
+                for (size_t a = 0; a < r.nArgs; ++a) {
+                    uint64_t ref = file_.readWord(pos);
+                    if ((ref & 1) == 0 && file_.nodeIndex(ref) >= i) {
+                        throw CGException("Invalid argument in operation graph file '", file_.path_, "'");
+                    }
+                    request(pos);
+                    pos = file_.skipArgument(pos);
+                }
+            }
+
+            /**
+             * create the nodes (arguments first)
+             */
+            std::sort(newNodes.begin(), newNodes.end());
+
+            std::vector<size_t> info;
+            std::vector<Arg> args;
+            for (size_t i : newNodes) {
+                Record r = file_.readRecord(i);
+
+                info.resize(r.nInfo);
+                for (size_t k = 0; k < r.nInfo; ++k) info[k] = file_.readWord(r.info + 8 * k);
+
+                if ((r.op == CGOpCode::AtomicForward || r.op == CGOpCode::AtomicReverse) && !info.empty()) {
+                    auto it = atomicIds_.find(info[0]);
+                    if (it == atomicIds_.end())
+                        throw CGException("Invalid atomic function in operation graph file '", file_.path_, "'");
+                    info[0] = it->second;
+                }
+
+                args.clear();
+                args.reserve(r.nArgs);
+                size_t pos = r.args;
+                for (size_t a = 0; a < r.nArgs; ++a) {
+                    args.push_back(file_.readArgument(pos, nodes_));
+                    pos = file_.skipArgument(pos);
+                }
+
+                Node* node = handler_.makeNode(r.op, info, args);
+
+                if (r.nameLength > 0) {
+                    file_.checkRange(pos, r.nameLength - 1);
+                    node->setName(std::string(file_.data_ + pos, r.nameLength - 1));
+                }
+
+                nodes_[i] = node;
+            }
+        }
+    };
+
+    /**
+     * Creates all the dependent variables in a CodeHandler.
+     *
+     * @param handler the code handler which will own the new nodes
+     * @param indep the new independent variables (output)
+     * @return the dependent variables
+     * @throws CGException if the file is corrupted or an atomic function is
+     *                     not registered in the handler
+     */
+    inline std::vector<CGB> load(CodeHandler<Base>& handler, std::vector<CGB>& indep) const {
+        std::vector<size_t> depIndexes(depCount_);
+        for (size_t i = 0; i < depCount_; ++i) depIndexes[i] = i;
+
+        return load(handler, indep, depIndexes);
+    }
+
+    /**
+     * Creates some of the dependent variables in a CodeHandler.
+     * Only the nodes used to compute those variables are read from the file
+     * (see Loader to create dependent variables on demand).
+     *
+     * @param handler the code handler which will own the new nodes
+     * @param indep the new independent variables (output)
+     * @param depIndexes the indexes of the dependent variables to load
+     * @return the dependent variables (in the same order as depIndexes)
+     * @throws CGException if the file is corrupted or an atomic function is
+     *                     not registered in the handler
+     */
+    inline std::vector<CGB> load(CodeHandler<Base>& handler,
+                                 std::vector<CGB>& indep,
+                                 const std::vector<size_t>& depIndexes) const {
+        Loader loader(*this, handler);
+        indep = loader.getIndependentVariables();
+        return loader.dependents(depIndexes);
+    }
+
+    /**
+     * Saves the operation graph used to compute some dependent variables.
+     *
+     * @param path the file path
+     * @param handler the code handler which owns the operation nodes
+     * @param dependent the dependent variables
+     * @throws CGException if the graph contains unsupported operations or
+     *                     the file cannot be written
+     */
+    static inline void save(const std::string& path, CodeHandler<Base>& handler, ArrayView<const CGB> dependent) {
+        std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw CGException("Failed to create file '", path, "'");
+        }
+
+        const std::vector<Node*>& indep = handler.getIndependentVariables();
+
+        // the node index in the file plus one (zero means not saved yet)
+        CodeHandlerVector<Base, size_t> index(handler);
+        index.adjustSize();
+        std::vector<uint64_t> offsets;
+        offsets.reserve(indep.size());
+        std::set<size_t> atomicIds;
+
+        writeHeader(out, 0, 0, 0, 0, 0, 0, 0);  // updated at the end
+
+        for (Node* node : indep) {
+            index[*node] = offsets.size() + 1;
+            offsets.push_back(uint64_t(out.tellp()));
+            writeNode(out, *node, index);
+        }
+
+        /**
+         * depth-first search which saves the arguments of a node before the
+         * node itself (without recursion, graphs can be very deep)
+         */
+        std::vector<std::pair<Node*, size_t>> stack;
+        for (const CGB& dep : dependent) {
+            Node* root = dep.getOperationNode();
+            if (root == nullptr || index[*root] != 0) continue;
+
+            stack.emplace_back(root, 0);
+            while (!stack.empty()) {
+                Node* node = stack.back().first;
+                size_t& a = stack.back().second;
+                const std::vector<Arg>& args = node->getArguments();
+
+                while (a < args.size() && (args[a].getOperation() == nullptr || index[*args[a].getOperation()] != 0)) {
+                    ++a;
+                }
+
+                if (a < args.size()) {
+                    stack.emplace_back(args[a].getOperation(), 0);  // invalidates the reference a
+                    continue;
+                }
+
+                CGOpCode op = node->getOperationType();
+                if (op == CGOpCode::Inv) {
+                    throw CGException("Independent variable not managed by the code handler");
+                } else if (OperationNode<Base>::CUSTOM_NODE_CLASS.count(op) > 0) {
+                    throw CGException("Unable to save operation graph: operation type '", op,
+                                      "' is not supported");
+                } else if ((op == CGOpCode::AtomicForward || op == CGOpCode::AtomicReverse) &&
+                           !node->getInfo().empty()) {
+                    atomicIds.insert(node->getInfo()[0]);
+                }
+
+                index[*node] = offsets.size() + 1;
+                offsets.push_back(uint64_t(out.tellp()));
+                writeNode(out, *node, index);
+                stack.pop_back();
+            }
+        }
+
+        uint64_t nodeTable = uint64_t(out.tellp());
+        out.write(reinterpret_cast<const char*>(offsets.data()), std::streamsize(offsets.size() * 8));
+
+        uint64_t depTable = uint64_t(out.tellp());
+        for (const CGB& dep : dependent) {
+            if (dep.getOperationNode() != nullptr) {
+                writeWord(out, (index[*dep.getOperationNode()] - 1) << 1);
+            } else {
+                writeParameter(out, dep.getValue());
+            }
+        }
+
+        uint64_t atomicTable = uint64_t(out.tellp());
+        for (size_t id : atomicIds) {
+            std::string name = handler.getAtomicFunctionName(id);
+            if (name.empty()) {
+                throw CGException("Unable to save operation graph: unknown atomic function ID ", id);
+            }
+            writeWord(out, id);
+            writeString(out, name);
+        }
+
+        out.seekp(0);
+        writeHeader(out, offsets.size(), indep.size(), dependent.size(), atomicIds.size(), nodeTable, depTable,
+                    atomicTable);
+
+        out.close();
+        if (out.fail()) {
+            throw CGException("Failed to write operation graph to file '", path, "'");
+        }
+    }
+
+protected:
+    inline void readHeader() {
+        if (size_ < 8 * HEADER_WORDS || std::memcmp(data_, MAGIC, 8) != 0) {
+            throw CGException("'", path_, "' is not an operation graph file");
+        }
+        if (readWord(8) != VERSION) {
+            throw CGException("Unsupported operation graph file version ", readWord(8), " in '", path_,
+                              "' (expected version ", VERSION, ")");
+        }
+        if (readWord(16) != sizeof(Base)) {
+            throw CGException("The operation graph in '", path_, "' was saved with a different Base type");
+        }
+
+        nodeCount_ = readWord(24);
+        indepCount_ = readWord(32);
+        depCount_ = readWord(40);
+        size_t atomicCount = readWord(48);
+        nodeTable_ = readWord(56);
+        size_t pos = readWord(64);
+
+        if (indepCount_ > nodeCount_ || nodeCount_ > size_ / 8 || nodeTable_ > size_ - 8 * nodeCount_ ||
+            depCount_ > size_ / 8 || atomicCount > size_ / 16) {
+            throw CGException("Corrupted operation graph file '", path_, "'");
+        }
+
+        depPos_.resize(depCount_);
+        for (size_t i = 0; i < depCount_; ++i) {
+            depPos_[i] = pos;
+            pos = skipArgument(pos);
+        }
+
+        pos = readWord(72);
+
+        for (size_t i = 0; i < atomicCount; ++i) {
+            size_t id = readWord(pos);
+            size_t length = readWord(pos + 8);
+            checkRange(pos + 16, length);
+            atomicNames_[id] = std::string(data_ + pos + 16, length);
+            pos += 16 + padded(length);
+        }
+    }
+
+    /**
+     * Matches the atomic functions in the file with the ones registered in
+     * a code handler.
+     *
+     * @return the atomic function IDs (file ID -> handler ID)
+     */
+    inline std::map<size_t, size_t> mapAtomicFunctions(const CodeHandler<Base>& handler) const {
+        std::map<std::string, size_t> handlerIds;
+        for (const auto& it : handler.getAtomicFunctions()) {
+            handlerIds[it.second->atomic_name()] = it.first;
+        }
+
+        std::map<size_t, size_t> ids;
+        for (const auto& it : atomicNames_) {
+            auto itH = handlerIds.find(it.second);
+            if (itH == handlerIds.end()) {
+                throw CGException("Atomic function '", it.second,
+                                  "' must be registered in the code handler before loading '", path_, "'");
+            }
+            ids[it.first] = itH->second;
+        }
+
+        return ids;
+    }
+
+    /**
+     * The position of the fields of a node record
+     */
+    struct Record {
+        CGOpCode op;
+        size_t nInfo;
+        size_t nArgs;
+        size_t nameLength;
+        size_t info;  // position of the first info value
+        size_t args;  // position of the first argument
+    };
+
+    /**
+     * Reads and validates the header of the record of a node which is not
+     * an independent variable.
+     */
+    inline Record readRecord(size_t i) const {
+        size_t pos = readWord(nodeTable_ + 8 * i);
+        checkRange(pos, 32);
+
+        uint64_t op = readWord(pos);
+        if (op >= uint64_t(CGOpCode::NumberOp)) {
+            throw CGException("Invalid operation code ", op, " in operation graph file '", path_, "'");
+        }
+
+        Record r;
+        r.op = CGOpCode(op);
+        if (r.op == CGOpCode::Inv || OperationNode<Base>::CUSTOM_NODE_CLASS.count(r.op) > 0) {
+            throw CGException("Unsupported operation '", r.op, "' in operation graph file '", path_, "'");
+        }
+
+        r.nInfo = readWord(pos + 8);
+        r.nArgs = readWord(pos + 16);
+        r.nameLength = readWord(pos + 24);
+        r.info = pos + 32;
+
+        // each value uses at least one word
+        size_t available = (size_ - r.info) / 8;
+        if (r.nInfo > available || r.nArgs > available - r.nInfo || r.nameLength > size_) {
+            throw CGException("Invalid node record size in operation graph file '", path_, "'");
+        }
+        r.args = r.info + 8 * r.nInfo;
+
+        return r;
+    }
+
+    inline size_t nodeIndex(uint64_t ref) const {
+        size_t i = size_t(ref >> 1);
+        if (i >= nodeCount_) throw CGException("Invalid node reference in operation graph file '", path_, "'");
+        return i;
+    }
+
+    inline Arg readArgument(size_t pos, const std::vector<Node*>& nodes) const {
+        uint64_t ref = readWord(pos);
+        if ((ref & 1) == 0) {
+            Node* n = nodes[nodeIndex(ref)];
+            if (n == nullptr) {
+                throw CGException("Invalid node reference in operation graph file '", path_, "'");
+            }
+            return Arg(*n);
+        } else {
+            checkRange(pos + 8, sizeof(Base));
+            Base value;
+            std::memcpy(&value, data_ + pos + 8, sizeof(Base));
+            return Arg(value);
+        }
+    }
+
+    inline size_t skipArgument(size_t pos) const {
+        if ((readWord(pos) & 1) == 0)
+            return pos + 8;
+        else
+            return pos + 8 + padded(sizeof(Base));
+    }
+
+    inline uint64_t readWord(size_t pos) const {
+        checkRange(pos, 8);
+        uint64_t v;
+        std::memcpy(&v, data_ + pos, 8);
+        return v;
+    }
+
+    inline void checkRange(size_t pos, size_t length) const {
+        if (pos > size_ || length > size_ - pos) {
+            throw CGException("Corrupted operation graph file '", path_, "'");
+        }
+    }
+
+    static inline size_t padded(size_t length) { return (length + 7) / 8 * 8; }
+
+    static inline void writeHeader(std::ofstream& out,
+                                   uint64_t nodeCount,
+                                   uint64_t indepCount,
+                                   uint64_t depCount,
+                                   uint64_t atomicCount,
+                                   uint64_t nodeTable,
+                                   uint64_t depTable,
+                                   uint64_t atomicTable) {
+        out.write(MAGIC, 8);
+        writeWord(out, VERSION);
+        writeWord(out, sizeof(Base));
+        writeWord(out, nodeCount);
+        writeWord(out, indepCount);
+        writeWord(out, depCount);
+        writeWord(out, atomicCount);
+        writeWord(out, nodeTable);
+        writeWord(out, depTable);
+        writeWord(out, atomicTable);
+    }
+
+    static inline void writeNode(std::ofstream& out, const Node& node, const CodeHandlerVector<Base, size_t>& index) {
+        const std::vector<size_t>& info = node.getInfo();
+        const std::vector<Arg>& args = node.getArguments();
+        const std::string* name = node.getName();
+
+        writeWord(out, uint64_t(node.getOperationType()));
+        writeWord(out, info.size());
+        writeWord(out, args.size());
+        writeWord(out, name != nullptr ? name->size() + 1 : 0);
+        for (size_t i : info) writeWord(out, i);
+        for (const Arg& a : args) {
+            if (a.getOperation() != nullptr)
+                writeWord(out, (index[*a.getOperation()] - 1) << 1);
+            else
+                writeParameter(out, *a.getParameter());
+        }
+        if (name != nullptr) {
+            out.write(name->data(), std::streamsize(name->size()));
+            writePadding(out, name->size());
+        }
+    }
+
+    static inline void writeParameter(std::ofstream& out, const Base& value) {
+        writeWord(out, 1);
+        out.write(reinterpret_cast<const char*>(&value), sizeof(Base));
+        writePadding(out, sizeof(Base));
+    }
+
+    static inline void writeString(std::ofstream& out, const std::string& s) {
+        writeWord(out, s.size());
+        out.write(s.data(), std::streamsize(s.size()));
+        writePadding(out, s.size());
+    }
+
+    static inline void writeWord(std::ofstream& out, uint64_t v) {
+        out.write(reinterpret_cast<const char*>(&v), 8);
+    }
+
+    static inline void writePadding(std::ofstream& out, size_t length) {
+        static const char zeros[8] = {};
+        out.write(zeros, std::streamsize(padded(length) - length));
+    }
+};
+
+template <class Base>
+const char OperationGraphFile<Base>::MAGIC[8] = {'C', 'G', 'G', 'R', 'A', 'P', 'H', '\0'};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
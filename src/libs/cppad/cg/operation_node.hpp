@@ -36,6 +36,17 @@ public:
 
 public:
     static const std::set<CGOpCode> CUSTOM_NODE_CLASS;
+    /**
+     * The maximum number of nodes managed by a CodeHandler
+     * (node positions are stored with 32 bits)
+     */
+    static constexpr size_t MAX_HANDLER_POSITION = (std::numeric_limits<uint32_t>::max)();
+
+private:
+    /**
+     * position value of nodes which are not managed by a CodeHandler
+     */
+    static constexpr uint32_t UNMANAGED_POSITION = (std::numeric_limits<uint32_t>::max)();
 
 private:
     /**
@@ -47,6 +58,12 @@ private:
      * the operation type represented by this node
      */
     CGOpCode operation_;
+    /**
+     * index in the CodeHandler managed nodes array
+     * (stored with 32 bits next to the operation type to reduce the size of
+     *  each node)
+     */
+    uint32_t pos_;
     /**
      * additional information/options associated with the operation type
      */
@@ -57,10 +74,6 @@ private:
      *  of a dependent variable)
      */
     std::vector<Argument<Base>> arguments_;
-    /**
-     * index in the CodeHandler managed nodes array
-     */
-    size_t pos_;
     /**
      * name for the result of this operation
      */
@@ -169,7 +182,9 @@ public:
      *
      * @return the index in the CodeHandler's array of managed nodes
      */
-    inline size_t getHandlerPosition() const { return pos_; }
+    inline size_t getHandlerPosition() const {
+        return pos_ == UNMANAGED_POSITION ? (std::numeric_limits<size_t>::max)() : size_t(pos_);
+    }
 
     // argument iterators
 
@@ -203,19 +218,19 @@ protected:
     inline OperationNode(const OperationNode& orig)
         : handler_(orig.handler_),
           operation_(orig.operation_),
+          pos_(UNMANAGED_POSITION),
           info_(orig.info_),
           arguments_(orig.arguments_),
-          pos_((std::numeric_limits<size_t>::max)()),
           name_(orig.name_ != nullptr ? new std::string(*orig.name_) : nullptr) {}
 
     inline OperationNode(CodeHandler<Base>* handler, CGOpCode op)
-        : handler_(handler), operation_(op), pos_((std::numeric_limits<size_t>::max)()) {}
+        : handler_(handler), operation_(op), pos_(UNMANAGED_POSITION) {}
 
     inline OperationNode(CodeHandler<Base>* handler, CGOpCode op, const Argument<Base>& arg)
-        : handler_(handler), operation_(op), arguments_{arg}, pos_((std::numeric_limits<size_t>::max)()) {}
+        : handler_(handler), operation_(op), pos_(UNMANAGED_POSITION), arguments_{arg} {}
 
     inline OperationNode(CodeHandler<Base>* handler, CGOpCode op, std::vector<Argument<Base>>&& args)
-        : handler_(handler), operation_(op), arguments_(std::move(args)), pos_((std::numeric_limits<size_t>::max)()) {}
+        : handler_(handler), operation_(op), pos_(UNMANAGED_POSITION), arguments_(std::move(args)) {}
 
     inline OperationNode(CodeHandler<Base>* handler,
                          CGOpCode op,
@@ -223,9 +238,9 @@ protected:
                          std::vector<Argument<Base>>&& args)
         : handler_(handler),
           operation_(op),
+          pos_(UNMANAGED_POSITION),
           info_(std::move(info)),
-          arguments_(std::move(args)),
-          pos_((std::numeric_limits<size_t>::max)()) {}
+          arguments_(std::move(args)) {}
 
     inline OperationNode(CodeHandler<Base>* handler,
                          CGOpCode op,
@@ -233,11 +248,14 @@ protected:
                          const std::vector<Argument<Base>>& args)
         : handler_(handler),
           operation_(op),
+          pos_(UNMANAGED_POSITION),
           info_(info),
-          arguments_(args),
-          pos_((std::numeric_limits<size_t>::max)()) {}
+          arguments_(args) {}
 
-    inline void setHandlerPosition(size_t pos) { pos_ = pos; }
+    inline void setHandlerPosition(size_t pos) {
+        CPPADCG_ASSERT_UNKNOWN(pos < MAX_HANDLER_POSITION)
+        pos_ = uint32_t(pos);
+    }
 
 public:
     /**
@@ -0,0 +1,117 @@
+#ifndef CPPAD_CG_OUTLINED_FUNCTION_INCLUDED
+#define CPPAD_CG_OUTLINED_FUNCTION_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * An operation graph which replaces several isomorphic subgraphs of another
+ * operation graph.
+ * The original subgraphs are replaced by CGOpCode::OutlinedCall nodes whose
+ * arguments are the inputs of each subgraph and the first element of the
+ * node information is the index of the outlined function.
+ *
+ * @author Feng Yang
+ */
+template <class Base>
+class OutlinedFunction {
+public:
+    /**
+     * The original operation of a subgraph root replaced by a call to this
+     * function
+     */
+    struct Call {
+        OperationNode<Base>* root;
+        CGOpCode operation;
+        std::vector<Argument<Base>> arguments;
+        std::vector<size_t> info;
+    };
+
+private:
+    /**
+     * The handler which owns the nodes of the function body
+     */
+    std::unique_ptr<CodeHandler<Base>> handler_;
+    /**
+     * The function arguments (independent variables of handler_)
+     */
+    std::vector<CG<Base>> arguments_;
+    /**
+     * The value returned by the function
+     */
+    CG<Base> result_;
+    /**
+     * The number of operations in the function body
+     */
+    size_t operationCount_;
+    /**
+     * The subgraphs replaced by this function
+     */
+    std::vector<Call> calls_;
+
+public:
+    inline OutlinedFunction(size_t argumentCount, size_t operationCount)
+        : handler_(new CodeHandler<Base>()),
+          arguments_(argumentCount),
+          operationCount_(operationCount) {
+        handler_->makeVariables(arguments_);
+    }
+
+    OutlinedFunction(const OutlinedFunction&) = delete;
+
+    OutlinedFunction& operator=(const OutlinedFunction&) = delete;
+
+    inline CodeHandler<Base>& getHandler() { return *handler_; }
+
+    inline const std::vector<CG<Base>>& getArguments() const { return arguments_; }
+
+    inline size_t getArgumentCount() const { return arguments_.size(); }
+
+    inline CG<Base>& getResult() { return result_; }
+
+    inline void setResult(const CG<Base>& result) { result_ = result; }
+
+    inline size_t getOperationCount() const { return operationCount_; }
+
+    inline size_t getCallCount() const { return calls_.size(); }
+
+    /**
+     * Saves the original operation of a subgraph root which is about to be
+     * replaced by a call to this function.
+     */
+    inline void addCall(OperationNode<Base>& root) {
+        calls_.push_back(Call{&root, root.getOperationType(), root.getArguments(), root.getInfo()});
+    }
+
+    /**
+     * Restores the original operations of the replaced subgraph roots.
+     */
+    inline void restoreCalls() {
+        for (Call& c : calls_) {
+            c.root->setOperation(c.operation, c.arguments);
+            c.root->getInfo() = std::move(c.info);
+        }
+        calls_.clear();
+    }
+
+    inline virtual ~OutlinedFunction() = default;
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
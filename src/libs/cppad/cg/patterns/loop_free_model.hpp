@@ -207,7 +207,8 @@ public:
      * @param temps
      * @param noLoopEvalJacSparsity
      * @param individualColoring
-     * @param iterationIndexOp
+     * @param maxThreads the maximum number of threads used to add sparsity
+     *                   patterns (zero uses the number of hardware threads)
      * @return
      */
     inline std::map<size_t, std::map<size_t, CGB>> calculateJacobianHessianUsedByLoops(
@@ -216,7 +217,8 @@ public:
             const std::vector<CGB>& x,
             std::vector<CGB>& temps,
             const VectorSet& noLoopEvalJacSparsity,
-            bool individualColoring) {
+            bool individualColoring,
+            size_t maxThreads = 1) {
         using namespace std;
         using namespace CppAD::cg::loops;
 
@@ -232,15 +234,19 @@ public:
         /**
          * Hessian - temporary variables
          */
-        std::vector<std::set<size_t>> noLoopEvalHessTempsSparsity(n);
-
+        std::vector<CsrSparsity> loopHessTemps;
+        loopHessTemps.reserve(loopHessInfo.size());
         for (const auto& itLoop2Info : loopHessInfo) {
             const HessianWithLoopsInfo<Base>& info = itLoop2Info.second;
 
-            addMatrixSparsity(info.noLoopEvalHessTempsSparsity, noLoopEvalHessTempsSparsity);
+            loopHessTemps.emplace_back(info.noLoopEvalHessTempsSparsity, n, n);
         }
+        CsrSparsity hessTemps =
+                loopHessTemps.empty() ? CsrSparsity(n, n) : CsrSparsity::unite(loopHessTemps, maxThreads);
+
+        std::vector<std::set<size_t>> noLoopEvalHessTempsSparsity = hessTemps.toSets<std::vector<std::set<size_t>>>();
         std::vector<size_t> hesRow, hesCol;
-        generateSparsityIndexes(noLoopEvalHessTempsSparsity, hesRow, hesCol);
+        generateSparsityIndexes(hessTemps, hesRow, hesCol);
 
         size_t l = 0;
         for (const auto& itLoop2Info : loopHessInfo) {
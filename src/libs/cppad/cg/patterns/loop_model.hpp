@@ -429,17 +429,28 @@ public:
 
     inline const std::vector<std::set<size_t>>& getJacobianSparsity() const { return jacTapeSparsity_; }
 
-    inline void evalHessianSparsity() {
+    /**
+     * Determines the Hessian sparsity of each equation group and their sum.
+     *
+     * @param maxThreads the maximum number of threads used to add the
+     *                   sparsity patterns of the equation groups (zero uses
+     *                   the number of hardware threads)
+     */
+    inline void evalHessianSparsity(size_t maxThreads = 1) {
         if (!hessSparsity_) {
             size_t n = fun_->Domain();
-            hessTapeSparsity_.resize(n);
 
+            std::vector<CsrSparsity> groupHess;
+            groupHess.reserve(equationGroups_.size());
             for (size_t g = 0; g < equationGroups_.size(); g++) {
                 equationGroups_[g].evalHessianSparsity();
-                const std::vector<std::set<size_t>>& ghess = equationGroups_[g].getHessianSparsity();
-                for (size_t j = 0; j < n; j++) {
-                    hessTapeSparsity_[j].insert(ghess[j].begin(), ghess[j].end());
-                }
+                groupHess.emplace_back(equationGroups_[g].getHessianSparsity(), n, n);
+            }
+
+            if (groupHess.empty()) {
+                hessTapeSparsity_.resize(n);
+            } else {
+                hessTapeSparsity_ = CsrSparsity::unite(groupHess, maxThreads).toSets<std::vector<std::set<size_t>>>();
             }
 
             hessSparsity_ = true;
@@ -0,0 +1,633 @@
+#ifndef CPPAD_CG_REVERSE_DIFFERENTIATOR_INCLUDED
+#define CPPAD_CG_REVERSE_DIFFERENTIATOR_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Symbolic reverse mode differentiation performed directly on an operation
+ * graph of a CodeHandler (source transformation).
+ *
+ * The adjoints are created as new operation nodes in the same handler
+ * without replaying a CppAD tape. Only the operations which depend on the
+ * independent variables and which contribute to an output are visited,
+ * so structurally zero partial derivatives never create nodes.
+ * The local partial derivatives of each operation are created only once
+ * and are shared by the adjoints of all outputs (and by higher order
+ * derivatives determined with the same differentiator).
+ *
+ * Atomic functions, arrays and loops are not supported
+ * (see isDifferentiable()).
+ *
+ * @author Feng Yang
+ */
+template <class Base>
+class ReverseDifferentiator {
+public:
+    using Node = OperationNode<Base>;
+    using Arg = Argument<Base>;
+    using CGB = CG<Base>;
+    /**
+     * The derivatives relative to the independent variables which were
+     * reached by a reverse sweep (sorted by independent variable index).
+     * Missing independent variables have a zero derivative.
+     */
+    using SparseGradient = std::vector<std::pair<size_t, CGB>>;
+
+protected:
+    /**
+     * The local partial derivatives of an operation
+     */
+    struct Partials {
+        std::vector<CGB> values;
+        std::vector<bool> defined;
+    };
+
+protected:
+    /**
+     * The handler which owns the operation graph
+     */
+    CodeHandler<Base>& handler_;
+    /**
+     * The independent variables
+     */
+    std::vector<Node*> indep_;
+    /**
+     * The index of the independent variable of each node plus one
+     * (by node position in the handler)
+     */
+    std::vector<size_t> indepIndex_;
+    /**
+     * Whether or not each node depends on the independent variables:
+     * 0 - unknown, 1 - no, 2 - yes (by node position in the handler)
+     */
+    std::vector<char> dependent_;
+    /**
+     * The local partial derivatives of each node (by node position in the
+     * handler)
+     */
+    std::vector<std::unique_ptr<Partials>> partials_;
+    /**
+     * The adjoint of each node in the current sweep (by node position in
+     * the handler)
+     */
+    std::vector<std::unique_ptr<CGB>> adjoint_;
+    /**
+     * The sweep in which each node was last visited (by node position in
+     * the handler)
+     */
+    std::vector<size_t> visited_;
+    size_t sweep_;
+
+public:
+    /**
+     * @param handler the handler which owns the operation graph
+     * @param x the independent variables (variables of the handler)
+     */
+    inline ReverseDifferentiator(CodeHandler<Base>& handler, const ArrayView<const CGB>& x)
+        : handler_(handler), sweep_(0) {
+        indep_.reserve(x.size());
+        for (size_t j = 0; j < x.size(); j++) {
+            if (!x[j].isVariable() || x[j].getCodeHandler() != &handler_) {
+                throw CGException("The independent variable ", j, " is not a variable of the provided handler");
+            }
+            indep_.push_back(x[j].getOperationNode());
+        }
+
+        resize();
+        for (size_t j = 0; j < indep_.size(); j++) {
+            indepIndex_[indep_[j]->getHandlerPosition()] = j + 1;
+            dependent_[indep_[j]->getHandlerPosition()] = 2;
+        }
+    }
+
+    ReverseDifferentiator(const ReverseDifferentiator&) = delete;
+
+    ReverseDifferentiator& operator=(const ReverseDifferentiator&) = delete;
+
+    inline virtual ~ReverseDifferentiator() = default;
+
+    /**
+     * Determines whether or not all the operations used by the provided
+     * expressions can be differentiated.
+     */
+    inline bool isDifferentiable(const ArrayView<const CGB>& y) {
+        resize();
+        sweep_++;
+
+        std::vector<Node*> stack;
+        for (size_t i = 0; i < y.size(); i++) {
+            if (y[i].isVariable()) stack.push_back(y[i].getOperationNode());
+        }
+
+        while (!stack.empty()) {
+            Node* node = stack.back();
+            stack.pop_back();
+            size_t p = node->getHandlerPosition();
+            if (visited_[p] == sweep_ || indepIndex_[p] != 0) continue;
+            visited_[p] = sweep_;
+
+            if (!isSupported(node->getOperationType())) return false;
+
+            for (const Arg& a : node->getArguments()) {
+                if (a.getOperation() != nullptr) stack.push_back(a.getOperation());
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Determines the gradient of a weighted sum of expressions: d(w^T y)/dx
+     *
+     * @param y the expressions
+     * @param w the weights (parameters or variables which do not depend on x)
+     * @return the derivatives of the reached independent variables
+     */
+    inline SparseGradient gradient(const ArrayView<const CGB>& y, const ArrayView<const CGB>& w) {
+        CPPADCG_ASSERT_KNOWN(y.size() == w.size(), "Invalid weight vector size")
+
+        std::vector<std::pair<Node*, CGB>> seeds;
+        seeds.reserve(y.size());
+        for (size_t i = 0; i < y.size(); i++) {
+            if (y[i].isVariable() && !w[i].isIdenticalZero()) {
+                seeds.emplace_back(y[i].getOperationNode(), w[i]);
+            }
+        }
+
+        return reverse(seeds);
+    }
+
+    /**
+     * Determines the gradient of a weighted sum of sparse expressions
+     * (e.g. the directional derivative of a gradient): d(w^T y)/dx
+     *
+     * @param y the non-zero expressions (by index)
+     * @param w the weights for all indexes (parameters or variables which
+     *          do not depend on x)
+     * @return the derivatives of the reached independent variables
+     */
+    inline SparseGradient gradient(const SparseGradient& y, const ArrayView<const CGB>& w) {
+        std::vector<std::pair<Node*, CGB>> seeds;
+        seeds.reserve(y.size());
+        for (const auto& e : y) {
+            CPPADCG_ASSERT_KNOWN(e.first < w.size(), "Invalid weight vector size")
+            if (e.second.isVariable() && !w[e.first].isIdenticalZero()) {
+                seeds.emplace_back(e.second.getOperationNode(), w[e.first]);
+            }
+        }
+
+        return reverse(seeds);
+    }
+
+    /**
+     * Determines the gradient of a single expression: dy/dx
+     *
+     * @return the derivatives of the reached independent variables
+     */
+    inline SparseGradient gradient(const CGB& y) {
+        std::vector<std::pair<Node*, CGB>> seeds;
+        if (y.isVariable()) {
+            seeds.emplace_back(y.getOperationNode(), CGB(Base(1.0)));
+        }
+
+        return reverse(seeds);
+    }
+
+    /**
+     * Determines the dense Jacobian (row-major) of some expressions.
+     */
+    inline std::vector<CGB> jacobian(const ArrayView<const CGB>& y) {
+        size_t n = indep_.size();
+        std::vector<CGB> jac(y.size() * n);
+        for (size_t i = 0; i < y.size(); i++) {
+            for (auto& e : gradient(y[i])) {
+                jac[i * n + e.first] = std::move(e.second);
+            }
+        }
+        return jac;
+    }
+
+    /**
+     * Determines some elements of the Jacobian of some expressions.
+     * Each row requires a single reverse sweep.
+     *
+     * @param y the expressions
+     * @param rows the row index of each element
+     * @param cols the column index of each element
+     * @return the Jacobian elements
+     */
+    inline std::vector<CGB> sparseJacobian(const ArrayView<const CGB>& y,
+                                           const std::vector<size_t>& rows,
+                                           const std::vector<size_t>& cols) {
+        CPPADCG_ASSERT_KNOWN(rows.size() == cols.size(), "Invalid Jacobian element indexes")
+
+        std::vector<CGB> jac(rows.size());
+        forEachRow(rows, cols, [&](size_t i) { return gradient(y[i]); }, jac);
+        return jac;
+    }
+
+    /**
+     * Determines the dense Hessian (row-major) of a weighted sum of
+     * expressions: d^2(w^T y)/dx^2 (reverse-over-reverse).
+     */
+    inline std::vector<CGB> hessian(const ArrayView<const CGB>& y, const ArrayView<const CGB>& w) {
+        size_t n = indep_.size();
+        SparseGradient grad = gradient(y, w);
+
+        std::vector<CGB> hess(n * n);
+        for (const auto& g : grad) {
+            for (auto& e : gradient(g.second)) {
+                hess[g.first * n + e.first] = std::move(e.second);
+            }
+        }
+        return hess;
+    }
+
+    /**
+     * Determines some elements of the Hessian of a weighted sum of
+     * expressions: d^2(w^T y)/dx^2 (reverse-over-reverse).
+     * Each row requires a single reverse sweep of the gradient.
+     *
+     * @param y the expressions
+     * @param w the weights (parameters or variables which do not depend on x)
+     * @param rows the row index of each element
+     * @param cols the column index of each element
+     * @return the Hessian elements
+     */
+    inline std::vector<CGB> sparseHessian(const ArrayView<const CGB>& y,
+                                          const ArrayView<const CGB>& w,
+                                          const std::vector<size_t>& rows,
+                                          const std::vector<size_t>& cols) {
+        CPPADCG_ASSERT_KNOWN(rows.size() == cols.size(), "Invalid Hessian element indexes")
+
+        SparseGradient grad = gradient(y, w);
+
+        std::vector<CGB> hess(rows.size());
+        forEachRow(rows, cols,
+                   [&](size_t j) {
+                       const CGB* g = find(grad, j);
+                       return g != nullptr ? gradient(*g) : SparseGradient();
+                   },
+                   hess);
+        return hess;
+    }
+
+protected:
+    inline void resize() {
+        size_t size = handler_.getManagedNodesCount();
+        if (indepIndex_.size() < size) {
+            indepIndex_.resize(size, 0);
+            dependent_.resize(size, 0);
+            partials_.resize(size);
+            adjoint_.resize(size);
+            visited_.resize(size, 0);
+        }
+    }
+
+    /**
+     * Evaluates the rows of a sparse matrix (one at a time)
+     */
+    template <class RowFunc>
+    inline void forEachRow(const std::vector<size_t>& rows,
+                           const std::vector<size_t>& cols,
+                           RowFunc rowFunc,
+                           std::vector<CGB>& values) {
+        std::map<size_t, std::vector<size_t>> row2Els;
+        for (size_t e = 0; e < rows.size(); e++) {
+            row2Els[rows[e]].push_back(e);
+        }
+
+        for (auto& it : row2Els) {
+            std::vector<size_t>& els = it.second;
+            std::sort(els.begin(), els.end(), [&](size_t e1, size_t e2) { return cols[e1] < cols[e2]; });
+
+            // both the elements and the row are sorted by column
+            SparseGradient row = rowFunc(it.first);
+            auto itRow = row.begin();
+            for (size_t e : els) {
+                while (itRow != row.end() && itRow->first < cols[e]) ++itRow;
+                if (itRow != row.end() && itRow->first == cols[e]) {
+                    values[e] = itRow->second;
+                }
+            }
+        }
+    }
+
+    /**
+     * Performs a reverse sweep starting at the provided nodes.
+     *
+     * @param seeds the nodes and their initial adjoints
+     * @return the adjoints of the reached independent variables
+     */
+    inline SparseGradient reverse(const std::vector<std::pair<Node*, CGB>>& seeds) {
+        resize();
+
+        SparseGradient dx;
+
+        std::vector<Node*> order = topologicalOrder(seeds);
+
+        for (const auto& s : seeds) {
+            size_t p = s.first->getHandlerPosition();
+            if (dependent_[p] != 2) continue;
+            addAdjoint(p, s.second);
+        }
+
+        // in reverse topological order
+        for (auto it = order.rbegin(); it != order.rend(); ++it) {
+            Node* node = *it;
+            size_t p = node->getHandlerPosition();
+            std::unique_ptr<CGB> adj = std::move(adjoint_[p]);
+
+            if (adj == nullptr || adj->isIdenticalZero()) continue;
+
+            if (indepIndex_[p] != 0) {
+                dx.emplace_back(indepIndex_[p] - 1, std::move(*adj));
+                continue;
+            }
+
+            const std::vector<Arg>& args = node->getArguments();
+            for (size_t a = 0; a < args.size(); a++) {
+                Node* argNode = args[a].getOperation();
+                if (argNode == nullptr || dependent_[argNode->getHandlerPosition()] != 2) continue;
+
+                const CGB& partial = getPartial(*node, a);
+                if (partial.isIdenticalZero()) continue;
+
+                addAdjoint(argNode->getHandlerPosition(), *adj * partial);
+            }
+        }
+
+        std::sort(dx.begin(), dx.end(), [](const std::pair<size_t, CGB>& e1, const std::pair<size_t, CGB>& e2) {
+            return e1.first < e2.first;
+        });
+        return dx;
+    }
+
+    /**
+     * Provides the derivative of an independent variable in a sparse
+     * gradient (or null if it is zero).
+     */
+    static inline const CGB* find(const SparseGradient& grad, size_t j) {
+        auto it = std::lower_bound(grad.begin(), grad.end(), j,
+                                   [](const std::pair<size_t, CGB>& e, size_t k) { return e.first < k; });
+        if (it == grad.end() || it->first != j) return nullptr;
+        return &it->second;
+    }
+
+    inline void addAdjoint(size_t p, const CGB& value) {
+        std::unique_ptr<CGB>& adj = adjoint_[p];
+        if (adj == nullptr) {
+            adj.reset(new CGB(value));
+        } else {
+            *adj += value;
+        }
+    }
+
+    /**
+     * Determines the nodes which depend on the independent variables used
+     * by the seeds (in topological order).
+     */
+    inline std::vector<Node*> topologicalOrder(const std::vector<std::pair<Node*, CGB>>& seeds) {
+        sweep_++;
+
+        std::vector<Node*> order;
+        std::vector<std::pair<Node*, size_t>> stack;  // (node, next argument)
+
+        for (const auto& s : seeds) {
+            if (visited_[s.first->getHandlerPosition()] == sweep_) continue;
+            visited_[s.first->getHandlerPosition()] = sweep_;
+            stack.emplace_back(s.first, 0);
+
+            while (!stack.empty()) {
+                Node* node = stack.back().first;
+                size_t p = node->getHandlerPosition();
+                const std::vector<Arg>& args = node->getArguments();
+                size_t& a = stack.back().second;
+
+                if (indepIndex_[p] == 0) {
+                    for (; a < args.size(); a++) {
+                        Node* argNode = args[a].getOperation();
+                        if (argNode != nullptr && visited_[argNode->getHandlerPosition()] != sweep_ &&
+                            dependent_[argNode->getHandlerPosition()] != 1) {
+                            break;  // not visited yet and it might depend on the independent variables
+                        }
+                    }
+                }
+
+                if (indepIndex_[p] == 0 && a < args.size()) {
+                    Node* argNode = args[a].getOperation();
+                    visited_[argNode->getHandlerPosition()] = sweep_;
+                    stack.emplace_back(argNode, 0);  // invalidates 'a'
+                    continue;
+                }
+
+                // all arguments were visited
+                stack.pop_back();
+
+                if (dependent_[p] == 0) {
+                    dependent_[p] = 1;
+                    for (const Arg& arg : args) {
+                        if (arg.getOperation() != nullptr && dependent_[arg.getOperation()->getHandlerPosition()] == 2) {
+                            dependent_[p] = 2;
+                            break;
+                        }
+                    }
+                }
+
+                if (dependent_[p] == 2) {
+                    if (!isSupported(node->getOperationType())) {
+                        throw CGException("Unable to differentiate the operation '", node->getOperationType(), "'");
+                    }
+                    order.push_back(node);
+                }
+            }
+        }
+
+        return order;
+    }
+
+    static inline bool isSupported(CGOpCode op) {
+        switch (op) {
+            case CGOpCode::Abs:
+            case CGOpCode::Acos:
+            case CGOpCode::Acosh:
+            case CGOpCode::Add:
+            case CGOpCode::Alias:
+            case CGOpCode::Asin:
+            case CGOpCode::Asinh:
+            case CGOpCode::Atan:
+            case CGOpCode::Atanh:
+            case CGOpCode::ComLt:
+            case CGOpCode::ComLe:
+            case CGOpCode::ComEq:
+            case CGOpCode::ComGe:
+            case CGOpCode::ComGt:
+            case CGOpCode::ComNe:
+            case CGOpCode::Cosh:
+            case CGOpCode::Cos:
+            case CGOpCode::Div:
+            case CGOpCode::Erf:
+            case CGOpCode::Erfc:
+            case CGOpCode::Exp:
+            case CGOpCode::Expm1:
+            case CGOpCode::Inv:
+            case CGOpCode::Log:
+            case CGOpCode::Log1p:
+            case CGOpCode::Mul:
+            case CGOpCode::Pow:
+            case CGOpCode::Pri:
+            case CGOpCode::Sign:
+            case CGOpCode::Sinh:
+            case CGOpCode::Sin:
+            case CGOpCode::Sqrt:
+            case CGOpCode::Sub:
+            case CGOpCode::Tanh:
+            case CGOpCode::Tan:
+            case CGOpCode::UnMinus:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    /**
+     * Provides the partial derivative of an operation relative to one of
+     * its arguments (created only once).
+     */
+    inline const CGB& getPartial(Node& node, size_t argIndex) {
+        std::unique_ptr<Partials>& partials = partials_[node.getHandlerPosition()];
+        if (partials == nullptr) {
+            size_t nArgs = node.getArguments().size();
+            partials.reset(new Partials());
+            partials->values.resize(nArgs);
+            partials->defined.resize(nArgs, false);
+        }
+
+        if (!partials->defined[argIndex]) {
+            partials->values[argIndex] = createPartial(node, argIndex);
+            partials->defined[argIndex] = true;
+        }
+
+        return partials->values[argIndex];
+    }
+
+    inline CGB createPartial(Node& node, size_t argIndex) {
+        const std::vector<Arg>& args = node.getArguments();
+        CGOpCode op = node.getOperationType();
+
+        CGB r(node);  // the result of the operation
+        CGB x = asCG(args[0]);
+
+        switch (op) {
+            case CGOpCode::Add:
+            case CGOpCode::Alias:
+            case CGOpCode::Pri:
+                return CGB(Base(1.0));
+            case CGOpCode::Sub:
+                return CGB(Base(argIndex == 0 ? 1.0 : -1.0));
+            case CGOpCode::UnMinus:
+                return CGB(Base(-1.0));
+            case CGOpCode::Mul:
+                return asCG(args[argIndex == 0 ? 1 : 0]);
+            case CGOpCode::Div: {
+                CGB y = asCG(args[1]);
+                if (argIndex == 0) return Base(1.0) / y;
+                return -r / y;
+            }
+            case CGOpCode::Pow: {
+                CGB y = asCG(args[1]);
+                if (argIndex == 0) {
+                    if (y.isParameter()) {
+                        if (y.getValue() == Base(2.0)) return Base(2.0) * x;
+                        return y * pow(x, CGB(y.getValue() - Base(1.0)));
+                    }
+                    return y * pow(x, y - Base(1.0));
+                }
+                return r * log(x);
+            }
+            case CGOpCode::Exp:
+                return r;
+            case CGOpCode::Expm1:
+                return r + Base(1.0);
+            case CGOpCode::Log:
+                return Base(1.0) / x;
+            case CGOpCode::Log1p:
+                return Base(1.0) / (Base(1.0) + x);
+            case CGOpCode::Sqrt:
+                return Base(0.5) / r;
+            case CGOpCode::Sin:
+                return cos(x);
+            case CGOpCode::Cos:
+                return -sin(x);
+            case CGOpCode::Tan:
+                return Base(1.0) + r * r;
+            case CGOpCode::Asin:
+                return Base(1.0) / sqrt(Base(1.0) - x * x);
+            case CGOpCode::Acos:
+                return Base(-1.0) / sqrt(Base(1.0) - x * x);
+            case CGOpCode::Atan:
+                return Base(1.0) / (Base(1.0) + x * x);
+            case CGOpCode::Sinh:
+                return cosh(x);
+            case CGOpCode::Cosh:
+                return sinh(x);
+            case CGOpCode::Tanh:
+                return Base(1.0) - r * r;
+            case CGOpCode::Asinh:
+                return Base(1.0) / sqrt(x * x + Base(1.0));
+            case CGOpCode::Acosh:
+                return Base(1.0) / sqrt(x * x - Base(1.0));
+            case CGOpCode::Atanh:
+                return Base(1.0) / (Base(1.0) - x * x);
+            case CGOpCode::Abs:
+                return sign(x);
+            case CGOpCode::Sign:
+                return CGB(Base(0.0));
+            case CGOpCode::Erf:
+            case CGOpCode::Erfc: {
+                // 2 / sqrt(pi)
+                const Base c = Base(1.1283791670955126);
+                CGB d = c * exp(-(x * x));
+                return op == CGOpCode::Erf ? d : -d;
+            }
+            case CGOpCode::ComLt:
+            case CGOpCode::ComLe:
+            case CGOpCode::ComEq:
+            case CGOpCode::ComGe:
+            case CGOpCode::ComGt:
+            case CGOpCode::ComNe: {
+                if (argIndex < 2) return CGB(Base(0.0));  // the comparison is piecewise constant
+                Arg one(Base(1.0));
+                Arg zero(Base(0.0));
+                return CGB(*handler_.makeNode(op, {args[0], args[1], argIndex == 2 ? one : zero, argIndex == 2 ? zero : one}));
+            }
+            default:
+                throw CGException("Unable to differentiate the operation '", op, "'");
+        }
+    }
+
+    static inline CGB asCG(const Arg& arg) {
+        if (arg.getOperation() != nullptr) return CGB(*arg.getOperation());
+        return CGB(*arg.getParameter());
+    }
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
@@ -0,0 +1,423 @@
+#ifndef CPPAD_CG_SUBGRAPH_OUTLINER_INCLUDED
+#define CPPAD_CG_SUBGRAPH_OUTLINER_INCLUDED
+/* --------------------------------------------------------------------------
+ *  CppADCodeGen: C++ Algorithmic Differentiation with Source Code Generation:
+ *    Copyright (C) 2026 Feng Yang
+ *
+ *  CppADCodeGen is distributed under multiple licenses:
+ *
+ *   - Eclipse Public License Version 1.0 (EPL1), and
+ *   - GNU General Public License Version 3 (GPL3).
+ *
+ *  EPL1 terms and conditions can be found in the file "epl-v10.txt", while
+ *  terms and conditions for the GPL3 can be found in the file "gpl3.txt".
+ * ----------------------------------------------------------------------------
+ * Author: Feng Yang
+ */
+
+namespace CppAD {
+namespace cg {
+
+/**
+ * Detects isomorphic subgraphs in an operation graph and replaces them with
+ * calls to shared functions (see OutlinedFunction).
+ *
+ * The subgraphs considered are fan-out free trees: every operation inside
+ * the tree, except for its root, is used only once and by an operation of
+ * the same tree. Operations used more than once, independent variables and
+ * operations which cannot be evaluated inside a function (loops,
+ * conditional blocks, atomic functions, ...) become function arguments.
+ *
+ * @author Feng Yang
+ */
+template <class Base>
+class SubgraphOutliner {
+public:
+    using Node = OperationNode<Base>;
+    using Arg = Argument<Base>;
+    using CGB = CG<Base>;
+
+protected:
+    /**
+     * The handler which owns the operation graph
+     */
+    CodeHandler<Base>& handler_;
+    /**
+     * The minimum number of operations in a subgraph for it to be outlined
+     */
+    size_t minOperations_;
+    /**
+     * The maximum number of arguments of an outlined function
+     */
+    size_t maxArguments_;
+    /**
+     * The number of times each node is used (by node position in the handler)
+     */
+    std::vector<size_t> useCount_;
+    /**
+     * The number of operations in the tree of each node
+     */
+    std::vector<size_t> size_;
+    /**
+     * The number of inputs of the tree of each node
+     */
+    std::vector<size_t> inputs_;
+    /**
+     * A structural hash of the tree of each node
+     */
+    std::vector<size_t> hash_;
+    /**
+     * Whether or not a node was already outlined
+     */
+    std::vector<bool> covered_;
+
+public:
+    /**
+     * @param handler the handler which owns the operation graph
+     * @param minOperations the minimum number of operations in a subgraph
+     *                      for it to be outlined
+     * @param maxArguments the maximum number of arguments of an outlined
+     *                     function
+     */
+    inline SubgraphOutliner(CodeHandler<Base>& handler, size_t minOperations, size_t maxArguments = 64)
+        : handler_(handler), minOperations_(std::max<size_t>(minOperations, 2)), maxArguments_(maxArguments) {}
+
+    SubgraphOutliner(const SubgraphOutliner&) = delete;
+
+    SubgraphOutliner& operator=(const SubgraphOutliner&) = delete;
+
+    /**
+     * Replaces the repeated subgraphs used by the dependent variables with
+     * calls to outlined functions.
+     *
+     * @param dependent the dependent variables
+     * @param functions the outlined functions (new functions are appended);
+     *                  they keep the original operations of the replaced
+     *                  nodes (see OutlinedFunction::restoreCalls())
+     * @return the number of replaced subgraphs
+     */
+    inline size_t outline(ArrayView<CGB>& dependent, std::vector<std::unique_ptr<OutlinedFunction<Base>>>& functions) {
+        size_t nNodes = handler_.getManagedNodesCount();
+        useCount_.assign(nNodes, 0);
+        size_.assign(nNodes, 0);
+        inputs_.assign(nNodes, 0);
+        hash_.assign(nNodes, 0);
+        covered_.assign(nNodes, false);
+
+        /**
+         * determine usages and the post-order of the nodes
+         */
+        std::vector<Node*> order;
+        order.reserve(nNodes);
+        std::vector<bool> visited(nNodes, false);
+        std::vector<std::pair<Node*, size_t>> stack;
+
+        for (size_t i = 0; i < dependent.size(); ++i) {
+            Node* root = dependent[i].getOperationNode();
+            if (root == nullptr) continue;
+
+            useCount_[root->getHandlerPosition()]++;
+            if (visited[root->getHandlerPosition()]) continue;
+
+            visited[root->getHandlerPosition()] = true;
+            stack.emplace_back(root, 0);
+
+            while (!stack.empty()) {
+                Node* node = stack.back().first;
+                size_t a = stack.back().second;
+                const std::vector<Arg>& args = node->getArguments();
+                if (a < args.size()) {
+                    stack.back().second++;
+                    Node* arg = args[a].getOperation();
+                    if (arg != nullptr) {
+                        useCount_[arg->getHandlerPosition()]++;
+                        if (!visited[arg->getHandlerPosition()]) {
+                            visited[arg->getHandlerPosition()] = true;
+                            stack.emplace_back(arg, 0);
+                        }
+                    }
+                } else {
+                    order.push_back(node);
+                    stack.pop_back();
+                }
+            }
+        }
+
+        /**
+         * characterize the tree of each node
+         */
+        std::map<size_t, std::vector<Node*>> groups;
+
+        for (Node* node : order) {
+            CGOpCode op = node->getOperationType();
+            if (!isOutlinable(op)) continue;
+
+            size_t pos = node->getHandlerPosition();
+            size_t h = size_t(op);
+            hashCombine(h, node->getInfo().size());
+            for (size_t i : node->getInfo()) hashCombine(h, i);
+
+            size_[pos] = 1;
+            for (const Arg& a : node->getArguments()) {
+                if (a.getOperation() == nullptr) {
+                    hashCombine(h, 1);
+                } else if (isInternal(*a.getOperation())) {
+                    size_t aPos = a.getOperation()->getHandlerPosition();
+                    size_[pos] += size_[aPos];
+                    inputs_[pos] += inputs_[aPos];
+                    hashCombine(h, hash_[aPos]);
+                } else {
+                    inputs_[pos]++;
+                    hashCombine(h, 2);
+                }
+            }
+            hash_[pos] = h;
+
+            if (size_[pos] >= minOperations_ && inputs_[pos] <= maxArguments_) {
+                groups[h].push_back(node);
+            }
+        }
+
+        /**
+         * larger subgraphs first
+         */
+        std::vector<std::vector<Node*>*> sorted;
+        for (auto& g : groups) {
+            if (g.second.size() > 1) sorted.push_back(&g.second);
+        }
+        std::stable_sort(sorted.begin(), sorted.end(), [this](const std::vector<Node*>* g1, const std::vector<Node*>* g2) {
+            return size_[g1->front()->getHandlerPosition()] > size_[g2->front()->getHandlerPosition()];
+        });
+
+        size_t replaced = 0;
+        for (std::vector<Node*>* group : sorted) {
+            std::vector<Node*> pending;
+            for (Node* node : *group) {
+                if (!covered_[node->getHandlerPosition()]) pending.push_back(node);
+            }
+
+            while (pending.size() > 1) {
+                // the hash value does not guarantee that subgraphs are identical
+                Node* ref = pending[0];
+                std::vector<Node*> same{ref};
+                std::vector<Node*> other;
+                for (size_t p = 1; p < pending.size(); ++p) {
+                    if (isIsomorphic(*ref, *pending[p]))
+                        same.push_back(pending[p]);
+                    else
+                        other.push_back(pending[p]);
+                }
+
+                if (same.size() > 1) {
+                    replace(same, functions);
+                    replaced += same.size();
+                }
+
+                pending.swap(other);
+            }
+        }
+
+        return replaced;
+    }
+
+    /**
+     * Whether or not an operation can be part of an outlined function
+     */
+    static inline bool isOutlinable(CGOpCode op) {
+        switch (op) {
+            case CGOpCode::Abs:
+            case CGOpCode::Acos:
+            case CGOpCode::Acosh:
+            case CGOpCode::Add:
+            case CGOpCode::Asin:
+            case CGOpCode::Asinh:
+            case CGOpCode::Atan:
+            case CGOpCode::Atanh:
+            case CGOpCode::ComLt:
+            case CGOpCode::ComLe:
+            case CGOpCode::ComEq:
+            case CGOpCode::ComGe:
+            case CGOpCode::ComGt:
+            case CGOpCode::ComNe:
+            case CGOpCode::Cosh:
+            case CGOpCode::Cos:
+            case CGOpCode::Div:
+            case CGOpCode::Erf:
+            case CGOpCode::Erfc:
+            case CGOpCode::Exp:
+            case CGOpCode::Expm1:
+            case CGOpCode::Log:
+            case CGOpCode::Log1p:
+            case CGOpCode::Mul:
+            case CGOpCode::Pow:
+            case CGOpCode::Sign:
+            case CGOpCode::Sinh:
+            case CGOpCode::Sin:
+            case CGOpCode::Sqrt:
+            case CGOpCode::Sub:
+            case CGOpCode::Tanh:
+            case CGOpCode::Tan:
+            case CGOpCode::UnMinus:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    inline virtual ~SubgraphOutliner() = default;
+
+protected:
+    /**
+     * Whether or not a node belongs to the tree of the operation using it
+     */
+    inline bool isInternal(const Node& node) const {
+        return isOutlinable(node.getOperationType()) && useCount_[node.getHandlerPosition()] == 1;
+    }
+
+    static inline void hashCombine(size_t& seed, size_t value) {
+        seed ^= value + size_t(0x9e3779b9) + (seed << 6) + (seed >> 2);
+    }
+
+    inline bool isIsomorphic(const Node& node1, const Node& node2) const {
+        if (size_[node1.getHandlerPosition()] != size_[node2.getHandlerPosition()]) return false;
+
+        std::vector<std::pair<const Node*, const Node*>> stack{{&node1, &node2}};
+
+        while (!stack.empty()) {
+            const Node& n1 = *stack.back().first;
+            const Node& n2 = *stack.back().second;
+            stack.pop_back();
+
+            if (n1.getOperationType() != n2.getOperationType() || n1.getInfo() != n2.getInfo() ||
+                n1.getArguments().size() != n2.getArguments().size()) {
+                return false;
+            }
+
+            const std::vector<Arg>& args1 = n1.getArguments();
+            const std::vector<Arg>& args2 = n2.getArguments();
+            for (size_t a = 0; a < args1.size(); ++a) {
+                const Node* a1 = args1[a].getOperation();
+                const Node* a2 = args2[a].getOperation();
+                if (a1 == nullptr || a2 == nullptr) {
+                    if (a1 != a2 || !(*args1[a].getParameter() == *args2[a].getParameter())) return false;
+                } else {
+                    bool internal1 = isInternal(*a1);
+                    if (internal1 != isInternal(*a2)) return false;
+                    if (internal1) stack.emplace_back(a1, a2);
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Determines the inputs of the tree of a node (in a depth-first order)
+     * and the nodes inside the tree.
+     */
+    inline void collectTree(Node& root, std::vector<Arg>& inputs, std::vector<Node*>& nodes) const {
+        std::vector<std::pair<Node*, size_t>> stack{{&root, 0}};
+
+        while (!stack.empty()) {
+            Node* node = stack.back().first;
+            size_t a = stack.back().second;
+            const std::vector<Arg>& args = node->getArguments();
+            if (a < args.size()) {
+                stack.back().second++;
+                Node* arg = args[a].getOperation();
+                if (arg != nullptr) {
+                    if (isInternal(*arg)) {
+                        stack.emplace_back(arg, 0);
+                    } else {
+                        inputs.emplace_back(*arg);
+                    }
+                }
+            } else {
+                nodes.push_back(node);
+                stack.pop_back();
+            }
+        }
+    }
+
+    /**
+     * Creates an outlined function for a group of isomorphic subgraphs and
+     * replaces them with calls to this function.
+     */
+    inline void replace(const std::vector<Node*>& roots,
+                        std::vector<std::unique_ptr<OutlinedFunction<Base>>>& functions) {
+        Node& ref = *roots[0];
+        size_t refPos = ref.getHandlerPosition();
+
+        auto* fun = new OutlinedFunction<Base>(inputs_[refPos], size_[refPos]);
+        functions.emplace_back(fun);
+        size_t funIndex = functions.size() - 1;
+
+        /**
+         * copy the reference subgraph into the function handler
+         */
+        CodeHandler<Base>& funHandler = fun->getHandler();
+        const std::vector<CGB>& funArgs = fun->getArguments();
+        size_t input = 0;
+
+        struct Frame {
+            Node* node;
+            size_t arg;
+            std::vector<Arg> newArgs;
+        };
+        std::vector<Frame> stack;
+        stack.push_back(Frame{&ref, 0, {}});
+        Node* clone = nullptr;
+
+        while (!stack.empty()) {
+            Frame& frame = stack.back();
+            const std::vector<Arg>& args = frame.node->getArguments();
+            if (frame.arg < args.size()) {
+                const Arg& a = args[frame.arg];
+                frame.arg++;
+                if (a.getOperation() == nullptr) {
+                    frame.newArgs.emplace_back(*a.getParameter());
+                } else if (isInternal(*a.getOperation())) {
+                    stack.push_back(Frame{a.getOperation(), 0, {}});  // frame is invalidated
+                } else {
+                    frame.newArgs.emplace_back(*funArgs[input].getOperationNode());
+                    input++;
+                }
+            } else {
+                clone = funHandler.makeNode(frame.node->getOperationType(), frame.node->getInfo(), frame.newArgs);
+                stack.pop_back();
+                if (!stack.empty()) {
+                    stack.back().newArgs.emplace_back(*clone);
+                }
+            }
+        }
+
+        CPPADCG_ASSERT_UNKNOWN(input == fun->getArgumentCount())
+        fun->setResult(CGB(*clone));
+
+        /**
+         * replace the subgraphs
+         */
+        std::vector<Arg> inputs;
+        std::vector<Node*> nodes;
+        for (Node* root : roots) {
+            inputs.clear();
+            nodes.clear();
+            collectTree(*root, inputs, nodes);
+            CPPADCG_ASSERT_UNKNOWN(inputs.size() == fun->getArgumentCount())
+
+            for (Node* n : nodes) {
+                covered_[n->getHandlerPosition()] = true;
+            }
+
+            fun->addCall(*root);  // no new nodes in the handler of the model
+
+            root->setOperation(CGOpCode::OutlinedCall, inputs);
+            root->getInfo() = {funIndex};
+        }
+    }
+};
+
+}  // namespace cg
+}  // namespace CppAD
+
+#endif
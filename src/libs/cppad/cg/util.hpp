@@ -58,7 +58,7 @@ inline VectorSet transposePattern(const VectorSet& pattern, size_t mRows, size_t
     VectorSet transpose(nCols);
     for (size_t i = 0; i < mRows; i++) {
         for (size_t it : pattern[i]) {
-            transpose[it].insert(i);
+            transpose[it].insert(transpose[it].end(), i);  // rows are visited in order
         }
     }
     return transpose;
@@ -182,22 +182,10 @@ inline void multMatrixMatrixSparsity(const VectorSet& a,
         }
     }
 
-    VectorSet2 bt = transposePattern(b, n, q);
+    CsrSparsity aCsr(a, m, n);
+    CsrSparsity bCsr(b, n, q);
 
-    for (size_t jj = 0; jj < q; jj++) {  // loop columns of b
-        const std::set<size_t>& colB = bt[jj];
-        if (!colB.empty()) {
-            for (size_t i = 0; i < m; i++) {
-                const std::set<size_t>& rowA = a[i];
-                for (size_t rowb : colB) {
-                    if (rowA.find(rowb) != rowA.end()) {
-                        result[i].insert(jj);
-                        break;
-                    }
-                }
-            }
-        }
-    }
+    CsrSparsity::multiply(aCsr, bCsr).addTo(result);
 }
 
 /**
@@ -248,25 +236,10 @@ inline void multMatrixTransMatrixSparsity(const VectorSet& a,
         return;
     }
 
-    VectorSet at = transposePattern(a, m, n);
-    VectorSet2 bt = transposePattern(b, m, q);
-
-    for (size_t jj = 0; jj < q; jj++) {  // loop columns of b
-        const std::set<size_t>& colB = bt[jj];
-        if (!colB.empty()) {
-            for (size_t i = 0; i < n; i++) {
-                const std::set<size_t>& rowAt = at[i];
-                if (!rowAt.empty()) {
-                    for (size_t rowb : colB) {
-                        if (rowAt.find(rowb) != rowAt.end()) {
-                            result[i].insert(jj);
-                            break;
-                        }
-                    }
-                }
-            }
-        }
-    }
+    CsrSparsity at = CsrSparsity(a, m, n).transpose();
+    CsrSparsity bCsr(b, m, q);
+
+    CsrSparsity::multiply(at, bCsr).addTo(result);
 }
 
 /**
@@ -305,19 +278,11 @@ inline void multMatrixMatrixSparsityTrans(
         return;
     }
 
-    VectorSet a = transposePattern(aT, m, q);
-    VectorSet2 bT = transposePattern(b, m, n);
+    // R^T = B^T * A^T
+    CsrSparsity bT = CsrSparsity(b, m, n).transpose();
+    CsrSparsity aTCsr(aT, m, q);
 
-    for (size_t jj = 0; jj < n; jj++) {  // loop columns of b
-        for (size_t i = 0; i < q; i++) {
-            for (size_t it : a[i]) {
-                if (bT[jj].find(it) != bT[jj].end()) {
-                    rT[jj].insert(i);
-                    break;
-                }
-            }
-        }
-    }
+    CsrSparsity::multiply(bT, aTCsr).addTo(rT);
 }
 
 template <class VectorBool>
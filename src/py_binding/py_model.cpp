@@ -0,0 +1,496 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <cppad/cg.hpp>
+
+#include <nanobind/nanobind.h>
+#include <nanobind/operators.h>
+#include <nanobind/stl/optional.h>
+#include <nanobind/stl/shared_ptr.h>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/tuple.h>
+#include <nanobind/stl/vector.h>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <iomanip>
+#include <sstream>
+
+namespace nb = nanobind;
+using namespace nb::literals;
+using namespace CppAD;
+using namespace CppAD::cg;
+
+namespace {
+using CGD = CG<double>;
+using ADCG = AD<CGD>;
+
+/**
+ * CppAD uses a single memory pool (no parallel setup) so the operation
+ * recording and source generation of different threads must not overlap.
+ */
+std::mutex& tapeMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+/**
+ * Whether or not the calling thread is recording the operations of a model
+ * (the tape mutex is not recursive).
+ */
+bool& isTaping() {
+    static thread_local bool taping = false;
+    return taping;
+}
+
+/**
+ * The background threads which compile models.
+ * They are joined when the interpreter exits so that no thread outlives the
+ * module.
+ */
+class CompileThreads {
+public:
+    static CompileThreads& instance() {
+        static CompileThreads threads;
+        return threads;
+    }
+
+    ~CompileThreads() { joinAll(); }
+
+    void start(std::packaged_task<std::string()> task) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        forgetParentThreads();
+        joinFinished();
+
+        auto finished = std::make_shared<std::atomic<bool>>(false);
+        std::thread thread([task = std::move(task), finished]() mutable {
+            task();
+            *finished = true;
+        });
+        threads_.push_back(Entry{std::move(thread), std::move(finished)});
+    }
+
+    void joinAll() {
+        std::vector<Entry> threads;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            forgetParentThreads();
+            threads.swap(threads_);
+        }
+        for (Entry& e : threads) {
+            e.thread.join();
+        }
+    }
+
+private:
+    struct Entry {
+        std::thread thread;
+        std::shared_ptr<std::atomic<bool>> finished;
+    };
+
+    /**
+     * The threads of the parent process do not exist in a forked child
+     * process: they can neither be joined nor destroyed
+     * (must be called while holding the mutex).
+     */
+    void forgetParentThreads() {
+        if (pid_ != getpid()) {
+            new std::vector<Entry>(std::move(threads_));  // never released
+            threads_.clear();
+            pid_ = getpid();
+        }
+    }
+
+    /**
+     * Joins the threads which have already completed their compilation
+     * (must be called while holding the mutex).
+     */
+    void joinFinished() {
+        auto it = threads_.begin();
+        while (it != threads_.end()) {
+            if (*it->finished) {
+                it->thread.join();
+                it = threads_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::vector<Entry> threads_;
+    pid_t pid_ = getpid();
+};
+
+/**
+ * Hashes all the sources of a model library (FNV-1a, stable across processes).
+ */
+class SourceHasher : public ModelLibraryProcessor<double> {
+public:
+    explicit SourceHasher(ModelLibraryCSourceGen<double>& libGen) : ModelLibraryProcessor<double>(libGen) {}
+
+    std::string hash() {
+        uint64_t h = 14695981039346656037ULL;
+        auto add = [&](const std::map<std::string, std::string>& sources) {
+            for (const auto& s : sources) {
+                for (const std::string* str : {&s.first, &s.second}) {
+                    for (unsigned char c : *str) {
+                        h = (h ^ c) * 1099511628211ULL;
+                    }
+                }
+            }
+        };
+        for (const auto& m : modelLibraryHelper_->getModels()) {
+            add(getSources(*m.second));
+        }
+        add(getLibrarySources());
+
+        std::ostringstream os;
+        os << std::hex << std::setw(16) << std::setfill('0') << h;
+        return os.str();
+    }
+};
+
+/**
+ * Loads a dynamic library only once per process.
+ */
+std::shared_ptr<DynamicLib<double>> loadLibrary(const std::string& path) {
+    static std::mutex mutex;
+    static std::map<std::string, std::weak_ptr<DynamicLib<double>>> libraries;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<DynamicLib<double>> lib = libraries[path].lock();
+    if (lib == nullptr) {
+        lib = std::make_shared<LinuxDynamicLib<double>>(path);
+        libraries[path] = lib;
+    }
+    return lib;
+}
+
+/**
+ * The signature of the generated model functions (forward_zero, jacobian,
+ * sparse_jacobian, hessian, sparse_hessian, ...).
+ */
+using ModelFunction = void (*)(double const* const* in, double* const* out, LangCAtomicFun atomicFun);
+
+/**
+ * Everything needed to call a generated model function through a raw
+ * pointer (see callModelFunction).
+ */
+struct CallContext {
+    ModelFunction function;
+    LangCAtomicFun atomicFun;
+};
+
+/**
+ * Calls a generated model function using only pointer arguments so that it
+ * can be used from JIT compiled code (Numba, JAX custom calls, ctypes):
+ *
+ *   void call(const void* context, const double* x, const double* w, double* out)
+ *
+ * w is only read by Hessian functions (it can be null otherwise) and out
+ * must have the size of the function result.
+ */
+extern "C" void callModelFunction(const void* context, const double* x, const double* w, double* out) {
+    const auto* ctx = static_cast<const CallContext*>(context);
+    const double* in[2] = {x, w};
+    double* outs[1] = {out};
+    (*ctx->function)(in, outs, ctx->atomicFun);
+}
+
+/**
+ * A model in a compiled dynamic library.
+ * It is pickled as a reference to the library file.
+ */
+class CompiledModel {
+public:
+    CompiledModel(std::string libraryPath, std::string name)
+        : libraryPath_(std::move(libraryPath)),
+          name_(std::move(name)),
+          lib_(loadLibrary(libraryPath_)),
+          model_(lib_->model(name_)) {
+        if (model_ == nullptr) {
+            throw CGException("Model '", name_, "' not found in '", libraryPath_, "'");
+        }
+    }
+
+    const std::string& libraryPath() const { return libraryPath_; }
+
+    const std::string& name() const { return name_; }
+
+    size_t domain() { return model_->Domain(); }
+
+    size_t range() { return model_->Range(); }
+
+    std::vector<double> forwardZero(const std::vector<double>& x) { return model_->ForwardZero(x); }
+
+    std::vector<double> jacobian(const std::vector<double>& x) { return model_->Jacobian(x); }
+
+    std::vector<double> hessian(const std::vector<double>& x, const std::vector<double>& w) {
+        return model_->Hessian(x, w);
+    }
+
+    /**
+     * @param function the function name without the model prefix (e.g. "forward_zero")
+     * @return the address of the generated function (see ModelFunction)
+     */
+    uintptr_t functionAddress(const std::string& function) {
+        return reinterpret_cast<uintptr_t>(lib_->loadModelFunction(name_, name_ + "_" + function));
+    }
+
+    /**
+     * @return the address of the LangCAtomicFun which must be passed (by value)
+     *         to the generated functions
+     */
+    uintptr_t atomicContextAddress() { return reinterpret_cast<uintptr_t>(&atomicContext()); }
+
+    /**
+     * @return the address of a CallContext for callModelFunction which remains
+     *         valid while this object exists
+     */
+    uintptr_t callContextAddress(const std::string& function) {
+        std::unique_ptr<CallContext>& ctx = callContexts_[function];
+        if (ctx == nullptr) {
+            auto f = reinterpret_cast<ModelFunction>(functionAddress(function));
+            ctx.reset(new CallContext{f, atomicContext()});
+        }
+        return reinterpret_cast<uintptr_t>(ctx.get());
+    }
+
+    std::tuple<std::vector<size_t>, std::vector<size_t>> jacobianSparsity() {
+        std::vector<size_t> rows, cols;
+        model_->JacobianSparsity(rows, cols);
+        return {rows, cols};
+    }
+
+    /**
+     * @return the addresses of the row and column arrays (unsigned long) of
+     *         the sparse Jacobian elements in the library and their number
+     */
+    std::tuple<uintptr_t, uintptr_t, size_t> jacobianSparsityArrays() {
+        using SparsityFunction = void (*)(unsigned long const** row, unsigned long const** col, unsigned long* nnz);
+        auto f = reinterpret_cast<SparsityFunction>(functionAddress("jacobian_sparsity"));
+
+        unsigned long const* row = nullptr;
+        unsigned long const* col = nullptr;
+        unsigned long nnz = 0;
+        (*f)(&row, &col, &nnz);
+        return {reinterpret_cast<uintptr_t>(row), reinterpret_cast<uintptr_t>(col), nnz};
+    }
+
+private:
+    const LangCAtomicFun& atomicContext() {
+        auto* model = dynamic_cast<FunctorGenericModel<double>*>(model_.get());
+        if (model == nullptr) {
+            throw CGException("Model '", name_, "' does not provide an atomic function context");
+        }
+        return model->getAtomicFunctionContext();
+    }
+
+    std::string libraryPath_;
+    std::string name_;
+    std::shared_ptr<DynamicLib<double>> lib_;  // must outlive the model
+    std::unique_ptr<GenericModel<double>> model_;
+    std::map<std::string, std::unique_ptr<CallContext>> callContexts_;
+};
+
+/**
+ * The result of a compilation running in a background thread.
+ */
+class CompileFuture {
+public:
+    explicit CompileFuture(std::shared_future<std::string> libraryPath, std::string name)
+        : libraryPath_(std::move(libraryPath)), name_(std::move(name)) {}
+
+    bool done() const { return libraryPath_.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }
+
+    std::shared_ptr<CompiledModel> result(std::optional<double> timeout) {
+        {
+            nb::gil_scoped_release release;
+            if (timeout) {
+                auto duration = std::chrono::duration<double>(*timeout);
+                if (libraryPath_.wait_for(duration) != std::future_status::ready) {
+                    throw std::runtime_error("Timeout while waiting for the model compilation");
+                }
+            } else {
+                libraryPath_.wait();
+            }
+        }
+        return std::make_shared<CompiledModel>(libraryPath_.get(), name_);
+    }
+
+private:
+    std::shared_future<std::string> libraryPath_;
+    std::string name_;
+};
+
+/**
+ * Records the operations of a Python callable which receives a list with
+ * n variables and returns a sequence of variables (or floats).
+ */
+std::unique_ptr<ADFun<CGD>> tape(const nb::callable& f, size_t n) {
+    if (isTaping()) {
+        // the callable would wait for the tape mutex held by this thread
+        throw std::runtime_error("Models cannot be taped or compiled while another model is being taped");
+    }
+
+    std::unique_lock<std::mutex> lock(tapeMutex(), std::defer_lock);
+    {
+        nb::gil_scoped_release release;
+        lock.lock();
+    }
+
+    struct TapingFlag {
+        TapingFlag() { isTaping() = true; }
+        ~TapingFlag() { isTaping() = false; }
+    } taping;
+
+    std::vector<ADCG> x(n);
+    Independent(x);
+
+    std::vector<ADCG> y;
+    try {
+        nb::list xl;
+        for (const ADCG& xj : x) {
+            xl.append(nb::cast(xj));
+        }
+        nb::object r = f(xl);
+        for (nb::handle yi : r) {
+            y.push_back(nb::cast<ADCG>(yi));
+        }
+    } catch (...) {
+        ADCG::abort_recording();
+        throw;
+    }
+
+    auto fun = std::make_unique<ADFun<CGD>>();
+    fun->Dependent(x, y);
+    return fun;
+}
+
+/**
+ * Tapes a model in the calling thread and compiles it in a background thread.
+ * Libraries are saved in folder with a name which depends on the generated
+ * sources so that previously compiled models are loaded without compiling.
+ */
+CompileFuture compileAsync(const nb::callable& f,
+                           size_t n,
+                           const std::string& name,
+                           const std::string& folder,
+                           bool jacobian,
+                           bool hessian) {
+    std::shared_ptr<ADFun<CGD>> fun = tape(f, n);
+
+    std::packaged_task<std::string()> task([fun = std::move(fun), name, folder, jacobian, hessian]() mutable {
+        // the tape is released by the thread which uses it
+        struct TapeRelease {
+            std::shared_ptr<ADFun<CGD>>& fun;
+            ~TapeRelease() {
+                std::lock_guard<std::mutex> lock(tapeMutex());
+                fun.reset();
+            }
+        } release{fun};
+
+        std::unique_lock<std::mutex> lock(tapeMutex());
+        ModelCSourceGen<double> gen(*fun, name);
+        gen.setCreateJacobian(jacobian);
+        gen.setCreateHessian(hessian);
+        ModelLibraryCSourceGen<double> libGen(gen);
+
+        std::string hash = SourceHasher(libGen).hash();  // generates (and keeps) all sources
+        lock.unlock();
+        std::string base = system::createPath(folder, "cppadcg_" + name + "_" + hash);
+        std::string path = base + system::SystemInfo<>::DYNAMIC_LIB_EXTENSION;
+
+        std::ifstream cached(path);
+        if (cached.good()) return path;
+
+        system::createFolder(folder);
+
+        // build under a unique name and rename it so that other processes never see partial files
+        static std::atomic<unsigned long> counter(0);
+        std::ostringstream unique;
+        unique << base << ".tmp" << getpid() << "_" << counter++;
+
+        GccCompiler<double> compiler;
+        compiler.setTemporaryFolder(unique.str() + "_objs");
+        DynamicModelLibraryProcessor<double> p(libGen, unique.str());
+        p.createDynamicLibrary(compiler, false);
+
+        std::string tmpPath = unique.str() + system::SystemInfo<>::DYNAMIC_LIB_EXTENSION;
+        if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+            throw CGException("Failed to move the library '", tmpPath, "' to '", path, "'");
+        }
+        return path;
+    });
+
+    CompileFuture future(task.get_future().share(), name);
+    CompileThreads::instance().start(std::move(task));
+    return future;
+}
+}  // namespace
+
+void bindModel(nb::module_& m) {
+    nb::class_<ADCG>(m, "CGDouble")
+            .def(nb::init<>())
+            .def(nb::init_implicit<double>())
+            .def(nb::self + nb::self)
+            .def(nb::self - nb::self)
+            .def(nb::self * nb::self)
+            .def(nb::self / nb::self)
+            .def(-nb::self)
+            .def("__radd__", [](const ADCG& a, double b) { return ADCG(b) + a; })
+            .def("__rsub__", [](const ADCG& a, double b) { return ADCG(b) - a; })
+            .def("__rmul__", [](const ADCG& a, double b) { return ADCG(b) * a; })
+            .def("__rtruediv__", [](const ADCG& a, double b) { return ADCG(b) / a; })
+            .def("__pow__", [](const ADCG& a, const ADCG& b) { return CppAD::pow(a, b); });
+
+    m.def("sin", [](const ADCG& a) { return CppAD::sin(a); });
+    m.def("cos", [](const ADCG& a) { return CppAD::cos(a); });
+    m.def("tan", [](const ADCG& a) { return CppAD::tan(a); });
+    m.def("exp", [](const ADCG& a) { return CppAD::exp(a); });
+    m.def("log", [](const ADCG& a) { return CppAD::log(a); });
+    m.def("sqrt", [](const ADCG& a) { return CppAD::sqrt(a); });
+    m.def("tanh", [](const ADCG& a) { return CppAD::tanh(a); });
+
+    nb::class_<CompiledModel>(m, "CompiledModel")
+            .def(nb::init<std::string, std::string>(), "library_path"_a, "name"_a)
+            .def_prop_ro("library_path", &CompiledModel::libraryPath)
+            .def_prop_ro("name", &CompiledModel::name)
+            .def_prop_ro("n", &CompiledModel::domain)
+            .def_prop_ro("m", &CompiledModel::range)
+            .def("forward_zero", &CompiledModel::forwardZero, "x"_a)
+            .def("jacobian", &CompiledModel::jacobian, "x"_a)
+            .def("hessian", &CompiledModel::hessian, "x"_a, "w"_a)
+            .def("function_address", &CompiledModel::functionAddress, "function"_a)
+            .def_prop_ro("atomic_context_address", &CompiledModel::atomicContextAddress)
+            .def("call_context_address", &CompiledModel::callContextAddress, "function"_a)
+            .def_prop_ro("jacobian_sparsity", &CompiledModel::jacobianSparsity)
+            .def_prop_ro("jacobian_sparsity_arrays", &CompiledModel::jacobianSparsityArrays)
+            .def("__getstate__",
+                 [](const CompiledModel& model) { return std::make_tuple(model.libraryPath(), model.name()); })
+            .def("__setstate__", [](CompiledModel& model, const std::tuple<std::string, std::string>& state) {
+                new (&model) CompiledModel(std::get<0>(state), std::get<1>(state));
+            });
+
+    m.attr("call_address") = reinterpret_cast<uintptr_t>(&callModelFunction);
+
+    nb::class_<CompileFuture>(m, "CompileFuture")
+            .def("done", &CompileFuture::done)
+            .def("result", &CompileFuture::result, "timeout"_a = nb::none());
+
+    m.def("compile_async", &compileAsync, "f"_a, "n"_a, "name"_a, "folder"_a = "cppadcg_cache", "jacobian"_a = true,
+          "hessian"_a = false);
+
+    // running compilations are completed before the interpreter is finalized
+    nb::module_::import_("atexit").attr("register")(nb::cpp_function([]() {
+        nb::gil_scoped_release release;
+        CompileThreads::instance().joinAll();
+    }));
+}
@@ -10,9 +10,11 @@ namespace nb = nanobind;
 using namespace nb::literals;
 
 extern void bindAD(nb::module_& m);
+extern void bindModel(nb::module_& m);
 
 NB_MODULE(py_tardis_ext, m) {
     m.doc() = "python binding for Tardis";
 
     bindAD(m);
+    bindModel(m);
 }
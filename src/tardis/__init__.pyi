@@ -1,3 +1,4 @@
+from collections.abc import Callable, Sequence
 from typing import overload
 
 
@@ -16,3 +17,91 @@ class Double:
     def acos_me(self) -> Double: ...
 
     def asin_me(self) -> Double: ...
+
+class CGDouble:
+    @overload
+    def __init__(self) -> None: ...
+
+    @overload
+    def __init__(self, arg: float, /) -> None: ...
+
+    def __add__(self, arg: CGDouble, /) -> CGDouble: ...
+
+    def __sub__(self, arg: CGDouble, /) -> CGDouble: ...
+
+    def __mul__(self, arg: CGDouble, /) -> CGDouble: ...
+
+    def __truediv__(self, arg: CGDouble, /) -> CGDouble: ...
+
+    def __neg__(self) -> CGDouble: ...
+
+    def __radd__(self, arg: float, /) -> CGDouble: ...
+
+    def __rsub__(self, arg: float, /) -> CGDouble: ...
+
+    def __rmul__(self, arg: float, /) -> CGDouble: ...
+
+    def __rtruediv__(self, arg: float, /) -> CGDouble: ...
+
+    def __pow__(self, arg: CGDouble, /) -> CGDouble: ...
+
+def sin(arg: CGDouble, /) -> CGDouble: ...
+
+def cos(arg: CGDouble, /) -> CGDouble: ...
+
+def tan(arg: CGDouble, /) -> CGDouble: ...
+
+def exp(arg: CGDouble, /) -> CGDouble: ...
+
+def log(arg: CGDouble, /) -> CGDouble: ...
+
+def sqrt(arg: CGDouble, /) -> CGDouble: ...
+
+def tanh(arg: CGDouble, /) -> CGDouble: ...
+
+class CompiledModel:
+    def __init__(self, library_path: str, name: str) -> None: ...
+
+    @property
+    def library_path(self) -> str: ...
+
+    @property
+    def name(self) -> str: ...
+
+    @property
+    def n(self) -> int: ...
+
+    @property
+    def m(self) -> int: ...
+
+    def forward_zero(self, x: Sequence[float]) -> list[float]: ...
+
+    def jacobian(self, x: Sequence[float]) -> list[float]: ...
+
+    def hessian(self, x: Sequence[float], w: Sequence[float]) -> list[float]: ...
+
+    def function_address(self, function: str) -> int: ...
+
+    @property
+    def atomic_context_address(self) -> int: ...
+
+    def call_context_address(self, function: str) -> int: ...
+
+    @property
+    def jacobian_sparsity(self) -> tuple[list[int], list[int]]: ...
+
+    @property
+    def jacobian_sparsity_arrays(self) -> tuple[int, int, int]: ...
+
+    def __getstate__(self) -> tuple[str, str]: ...
+
+    def __setstate__(self, arg: tuple[str, str], /) -> None: ...
+
+call_address: int = ...
+
+class CompileFuture:
+    def done(self) -> bool: ...
+
+    def result(self, timeout: float | None = None) -> CompiledModel: ...
+
+def compile_async(f: Callable, n: int, name: str, folder: str = 'cppadcg_cache', jacobian: bool = True, hessian: bool = False) -> CompileFuture: ...
@@ -0,0 +1,313 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <random>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+using Node = OperationNode<double>;
+using Arg = Argument<double>;
+
+namespace {
+
+const size_t n = 4;
+
+/**
+ * Creates an operation without the simplifications performed by the CG
+ * operators.
+ */
+Arg op(CodeHandler<double>& handler, CGOpCode code, std::vector<Arg>&& args) {
+    return Arg(*handler.makeNode(code, std::move(args)));
+}
+
+CGD dep(const Arg& a) { return a.getOperation() != nullptr ? CGD(*a.getOperation()) : CGD(*a.getParameter()); }
+
+/**
+ * One dependent variable per rewrite rule
+ */
+std::vector<CGD> createModel(CodeHandler<double>& handler, std::vector<CGD>& x) {
+    x.resize(n);
+    handler.makeVariables(x);
+
+    Arg x0(*x[0].getOperationNode());
+    Arg x1(*x[1].getOperationNode());
+    Arg x2(*x[2].getOperationNode());
+    Arg x3(*x[3].getOperationNode());
+    auto neg = [&](const Arg& a) { return op(handler, CGOpCode::UnMinus, {a}); };
+
+    std::vector<CGD> y;
+    // powers
+    y.push_back(dep(op(handler, CGOpCode::Pow, {x0, Arg(3.0)})));
+    y.push_back(dep(op(handler, CGOpCode::Pow, {x1, Arg(-2.0)})));
+    y.push_back(dep(op(handler, CGOpCode::Pow, {x2, Arg(0.5)})));
+    y.push_back(dep(op(handler, CGOpCode::Pow, {x3, Arg(0.0)})));
+    // shared reciprocals
+    y.push_back(dep(op(handler, CGOpCode::Div, {x0, x3})));
+    y.push_back(dep(op(handler, CGOpCode::Div, {x1, x3})));
+    // inverse functions (NaN sensitive: exp(log(x)) for x < 0, sqrt(x) * sqrt(x) for x < 0)
+    y.push_back(dep(op(handler, CGOpCode::Exp, {op(handler, CGOpCode::Log, {x0})})));
+    y.push_back(dep(op(handler, CGOpCode::Log, {op(handler, CGOpCode::Exp, {x1})})));
+    Arg s2 = op(handler, CGOpCode::Sqrt, {x2});
+    y.push_back(dep(op(handler, CGOpCode::Mul, {s2, s2})));
+    // signs
+    y.push_back(dep(neg(neg(x0))));
+    y.push_back(dep(op(handler, CGOpCode::Mul, {x1, Arg(-1.0)})));
+    y.push_back(dep(op(handler, CGOpCode::Add, {x0, neg(x1)})));
+    y.push_back(dep(op(handler, CGOpCode::Sub, {x0, neg(x2)})));
+    y.push_back(dep(neg(op(handler, CGOpCode::Sub, {x0, x1}))));  // signed zero sensitive: -(a - a) = -0
+    y.push_back(dep(op(handler, CGOpCode::Mul, {neg(x0), neg(x1)})));
+    y.push_back(dep(op(handler, CGOpCode::Div, {neg(x2), neg(x3)})));
+    y.push_back(dep(op(handler, CGOpCode::Div, {x2, Arg(-1.0)})));
+    y.push_back(dep(op(handler, CGOpCode::Abs, {neg(x3)})));
+    y.push_back(dep(op(handler, CGOpCode::Abs, {op(handler, CGOpCode::Abs, {x3})})));
+    // neutral and absorbing elements (signed zero and NaN sensitive)
+    y.push_back(dep(op(handler, CGOpCode::Add, {x0, Arg(0.0)})));  // -0 + 0 = +0
+    y.push_back(dep(op(handler, CGOpCode::Sub, {Arg(0.0), x1})));  // 0 - 0 = +0
+    y.push_back(dep(op(handler, CGOpCode::Mul, {x2, Arg(0.0)})));  // inf * 0 = nan
+    y.push_back(dep(op(handler, CGOpCode::Sub, {x3, x3})));        // inf - inf = nan
+    y.push_back(dep(op(handler, CGOpCode::Mul, {x3, Arg(1.0)})));
+    // constants
+    y.push_back(dep(op(handler, CGOpCode::Add, {op(handler, CGOpCode::Add, {x0, Arg(1.0)}), Arg(2.0)})));
+    y.push_back(dep(op(handler, CGOpCode::Sub, {Arg(2.0), op(handler, CGOpCode::Sub, {Arg(1.0), x1})})));
+    y.push_back(dep(op(handler, CGOpCode::Mul, {Arg(2.0), op(handler, CGOpCode::Mul, {Arg(3.0), x2})})));
+
+    return y;
+}
+
+std::vector<double> evaluate(CodeHandler<double>& handler, const std::vector<CGD>& y, const std::vector<double>& x) {
+    std::vector<AD<double>> xAD(x.begin(), x.end());
+    Evaluator<double, double> evaluator(handler);
+    std::vector<AD<double>> yAD = evaluator.evaluate(xAD, y);
+
+    std::vector<double> values(yAD.size());
+    for (size_t i = 0; i < yAD.size(); i++) values[i] = Value(yAD[i]);
+    return values;
+}
+
+std::vector<std::vector<double>> createSamples() {
+    const double inf = std::numeric_limits<double>::infinity();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const std::vector<double> special{0.0, -0.0, 1.0, -1.0, 1e300, -1e-300, inf, -inf, nan};
+
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<double> dist(-3.0, 3.0);
+    std::uniform_int_distribution<size_t> pick(0, special.size() - 1);
+
+    std::vector<std::vector<double>> samples;
+    for (size_t s = 0; s < 200; s++) {
+        std::vector<double> x(n);
+        for (size_t j = 0; j < n; j++) x[j] = dist(gen);
+        samples.push_back(x);
+    }
+    // positive values (the inverse functions are defined)
+    for (size_t s = 0; s < 50; s++) {
+        std::vector<double> x(n);
+        for (size_t j = 0; j < n; j++) x[j] = std::abs(dist(gen)) + 1e-3;
+        samples.push_back(x);
+    }
+    // special values
+    for (size_t s = 0; s < 200; s++) {
+        std::vector<double> x(n);
+        for (size_t j = 0; j < n; j++) x[j] = (gen() % 2 == 0) ? special[pick(gen)] : dist(gen);
+        samples.push_back(x);
+    }
+    for (double v : special) samples.push_back(std::vector<double>(n, v));
+
+    return samples;
+}
+
+std::string generate(CodeHandler<double>& handler, std::vector<CGD>& y) {
+    // the variable names of previous generations must not be reused
+    for (Node* node : handler.getManagedNodes()) {
+        if (node->getOperationType() != CGOpCode::Inv) node->clearName();
+    }
+
+    LanguageC<double> langC("double");
+    LangCDefaultVariableNameGenerator<double> nameGen;
+    std::ostringstream code;
+    handler.generateCode(code, langC, y, nameGen);
+    return code.str();
+}
+
+bool isIdentical(double a, double b) {
+    return (std::isnan(a) && std::isnan(b)) || (a == b && std::signbit(a) == std::signbit(b));
+}
+
+}  // namespace
+
+TEST(AlgebraicSimplifier, matchesOriginalGraph) {
+    CodeHandler<double> handler;
+    std::vector<CGD> x;
+    std::vector<CGD> y = createModel(handler, x);
+    std::vector<std::vector<double>> samples = createSamples();
+
+    std::vector<std::vector<double>> original;
+    for (const auto& s : samples) original.push_back(evaluate(handler, y, s));
+
+    size_t nodesBefore = handler.getManagedNodesCount();
+
+    AlgebraicSimplifier<double> simplifier(handler);
+    std::list<std::pair<Node*, Node*>> originals;
+    ArrayView<CGD> yView(y);
+    ASSERT_GT(simplifier.simplify(yView, originals), 0u);
+    EXPECT_LT(simplifier.getOperationsAfter(), simplifier.getOperationsBefore());
+    EXPECT_GT(handler.getManagedNodesCount(), nodesBefore);  // reciprocal and power nodes
+
+    size_t nanChanges = 0;
+    size_t zeroSignChanges = 0;
+    for (size_t s = 0; s < samples.size(); s++) {
+        std::vector<double> simplified = evaluate(handler, y, samples[s]);
+        ASSERT_EQ(simplified.size(), y.size());
+
+        for (size_t i = 0; i < y.size(); i++) {
+            double o = original[s][i];
+            double v = simplified[i];
+
+            if (isIdentical(o, v)) continue;
+
+            if (std::isnan(o) || std::isnan(v) || std::isinf(o) || std::isinf(v)) {
+                // like fast-math: the propagation of NaNs and overflows is not preserved
+                nanChanges++;
+            } else if (o == 0 && v == 0) {
+                // the sign of zero is not preserved (e.g. -0 + 0 -> -0)
+                zeroSignChanges++;
+            } else {
+                EXPECT_NEAR(v, o, 1e-12 * std::max(1.0, std::abs(o))) << "sample " << s << ", dependent " << i;
+            }
+        }
+    }
+    // the special values must have reached the sensitive identities
+    EXPECT_GT(nanChanges, 0u);
+    EXPECT_GT(zeroSignChanges, 0u);
+
+    // restore the original graph
+    for (const auto& it : originals) {
+        it.first->setOperation(it.second->getOperationType(), it.second->getArguments());
+        it.first->getInfo() = it.second->getInfo();
+    }
+
+    for (size_t s = 0; s < samples.size(); s++) {
+        std::vector<double> restored = evaluate(handler, y, samples[s]);
+        for (size_t i = 0; i < y.size(); i++) {
+            EXPECT_TRUE(isIdentical(restored[i], original[s][i])) << "sample " << s << ", dependent " << i;
+        }
+    }
+}
+
+TEST(AlgebraicSimplifier, generatedCodeMatchesDisabledSimplification) {
+    CodeHandler<double> handler;
+    std::vector<CGD> x;
+    std::vector<CGD> y = createModel(handler, x);
+
+    std::string original = generate(handler, y);
+
+    handler.setAlgebraicSimplification(true);
+    EXPECT_NE(generate(handler, y), original);
+    EXPECT_GT(handler.getSimplifiedOperationCount(), 0u);
+
+    // the graph is restored after the generation
+    handler.setAlgebraicSimplification(false);
+    EXPECT_EQ(generate(handler, y), original);
+}
+
+TEST(AlgebraicSimplifier, reproducibleReciprocals) {
+    // several denominators shared by divisions (the reciprocals are created in the same order in every run)
+    auto create = [](CodeHandler<double>& handler, std::vector<CGD>& x) {
+        x.resize(n);
+        handler.makeVariables(x);
+        std::vector<Arg> den;
+        for (size_t j = 0; j < n; j++) den.push_back(op(handler, CGOpCode::Exp, {Arg(*x[j].getOperationNode())}));
+
+        std::vector<CGD> y;
+        for (size_t j = n; j-- > 0;) {
+            for (size_t k = 0; k < n; k++) {
+                y.push_back(dep(op(handler, CGOpCode::Div, {Arg(*x[k].getOperationNode()), den[j]})));
+            }
+        }
+        return y;
+    };
+
+    std::vector<std::string> sources;
+    for (size_t r = 0; r < 4; r++) {
+        // other allocations change the addresses of the nodes
+        std::vector<std::unique_ptr<char[]>> noise;
+        for (size_t i = 0; i < r * 7 + 1; i++) noise.emplace_back(new char[48 * (i + 1)]);
+
+        CodeHandler<double> handler;
+        handler.setAlgebraicSimplification(true);
+        std::vector<CGD> x;
+        std::vector<CGD> y = create(handler, x);
+        sources.push_back(generate(handler, y));
+        EXPECT_GT(handler.getSimplifiedOperationCount(), 0u);
+    }
+
+    for (size_t r = 1; r < sources.size(); r++) {
+        EXPECT_EQ(sources[r], sources[0]);
+    }
+}
+
+TEST(AlgebraicSimplifier, modelOption) {
+    const size_t nm = 3;
+    auto createFun = [](auto& x) {
+        using ADT = typename std::remove_reference<decltype(x[0])>::type;
+        Independent(x);
+        CppAD::vector<ADT> y(nm);
+        y[0] = pow(x[0], 3) / x[2] + x[1] / x[2];
+        y[1] = exp(log(x[1])) * x[0] / x[2];
+        y[2] = -(-x[0]) * pow(x[1], 2) + 2.0 * (3.0 * x[2]);
+        return y;
+    };
+
+    CppAD::vector<AD<CGD>> ax(nm);
+    for (size_t j = 0; j < nm; j++) ax[j] = 1.0 + j;
+    CppAD::vector<AD<CGD>> ay = createFun(ax);
+    ADFun<CGD> fun(ax, ay);
+
+    ModelCSourceGen<double> cgen(fun, "model_simplified");
+    cgen.setCreateForwardZero(true);
+    cgen.setCreateJacobian(true);
+    cgen.setAlgebraicSimplification(true);
+    EXPECT_TRUE(cgen.isAlgebraicSimplification());
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+    libcgen.saveSources("cppadcg_model_simplified_sources");
+
+    DynamicModelLibraryProcessor<double> p(libcgen, "cppadcg_model_simplified");
+    GccCompiler<double> compiler;
+    std::unique_ptr<DynamicLib<double>> dynamicLib = p.createDynamicLibrary(compiler);
+    std::unique_ptr<GenericModel<double>> model = dynamicLib->model("model_simplified");
+    ASSERT_NE(model, nullptr);
+
+    // the powers are replaced by multiplications
+    std::ifstream file("cppadcg_model_simplified_sources/model_simplified_forward_zero.c");
+    std::stringstream source;
+    source << file.rdbuf();
+    EXPECT_EQ(source.str().find("pow("), std::string::npos) << source.str();
+
+    CppAD::vector<AD<double>> rx(nm);
+    for (size_t j = 0; j < nm; j++) rx[j] = 1.0 + j;
+    CppAD::vector<AD<double>> ry = createFun(rx);
+    ADFun<double> reference(rx, ry);
+
+    for (const std::vector<double>& xv : {std::vector<double>{0.3, 1.2, 0.8}, std::vector<double>{-1.1, 0.2, 1.6}}) {
+        std::vector<double> yv = model->ForwardZero(xv);
+        std::vector<double> expected = reference.Forward(0, xv);
+        for (size_t i = 0; i < nm; i++) EXPECT_NEAR(yv[i], expected[i], 1e-12 * std::max(1.0, std::abs(expected[i])));
+
+        std::vector<double> jac = model->Jacobian(xv);
+        std::vector<double> expectedJac = reference.Jacobian(xv);
+        for (size_t i = 0; i < jac.size(); i++) {
+            EXPECT_NEAR(jac[i], expectedJac[i], 1e-12 * std::max(1.0, std::abs(expectedJac[i])));
+        }
+    }
+}
@@ -0,0 +1,199 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <random>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+using Node = OperationNode<double>;
+using Arg = Argument<double>;
+
+namespace {
+
+class ArrayIdCompresserTest : public ::testing::Test {
+protected:
+    CodeHandler<double> handler_;
+    std::vector<CGD> x_;
+    CodeHandlerVector<double, size_t> varId_;
+    std::unique_ptr<ArrayIdCompresser<double>> comp_;
+
+    ArrayIdCompresserTest() : x_(20), varId_(handler_) {
+        handler_.makeVariables(x_);
+        comp_.reset(new ArrayIdCompresser<double>(varId_, 4));
+    }
+
+    Arg x(size_t j) const { return Arg(*x_[j].getOperationNode()); }
+
+    Node& array(std::vector<Arg> args) { return *handler_.makeNode(CGOpCode::ArrayCreation, std::move(args)); }
+
+    Arg element(Node& array, size_t index) {
+        return Arg(*handler_.makeNode(CGOpCode::ArrayElement, std::vector<size_t>{index}, {Arg(array), x(0)}));
+    }
+
+    /**
+     * Reserves the space of an array like the code handler does
+     */
+    size_t reserve(Node& array) {
+        varId_.adjustSize();
+        size_t start = comp_->reserveArraySpace(array);
+        varId_[array] = start + 1;
+        return start;
+    }
+
+    void release(Node& array) { comp_->addFreeArraySpace(array); }
+};
+
+}  // namespace
+
+TEST_F(ArrayIdCompresserTest, appendsNewArrays) {
+    EXPECT_EQ(reserve(array({x(0), x(1), x(2)})), 0u);
+    EXPECT_EQ(reserve(array({x(3), x(4)})), 3u);
+    EXPECT_EQ(comp_->getIdCount(), 6u);
+}
+
+TEST_F(ArrayIdCompresserTest, usesSmallestFreeSpace) {
+    Node& a = array({x(0), x(1), x(2)});
+    Node& b = array({x(3)});
+    Node& c = array({x(4), x(5)});
+    Node& d = array({x(6)});
+    EXPECT_EQ(reserve(a), 0u);
+    EXPECT_EQ(reserve(b), 3u);
+    EXPECT_EQ(reserve(c), 4u);
+    EXPECT_EQ(reserve(d), 6u);
+
+    release(a);
+    release(c);
+    EXPECT_EQ(reserve(array({x(7), x(8)})), 4u);
+    EXPECT_EQ(reserve(array({x(9), x(10)})), 0u);
+    EXPECT_EQ(comp_->getIdCount(), 8u);
+}
+
+TEST_F(ArrayIdCompresserTest, mergesFreeSpace) {
+    Node& a = array({x(0), x(1)});
+    Node& b = array({x(2), x(3)});
+    Node& c = array({x(4)});
+    reserve(a);
+    reserve(b);
+    reserve(c);
+
+    release(a);
+    release(b);
+    EXPECT_EQ(reserve(array({x(5), x(6), x(7), x(8)})), 0u);
+    EXPECT_EQ(comp_->getIdCount(), 6u);
+}
+
+TEST_F(ArrayIdCompresserTest, reusesSpaceWithTheSameValues) {
+    Node& a = array({x(0), x(1), x(2)});
+    Node& b = array({x(3)});
+    Node& c = array({x(4), x(5), x(6)});
+    Node& d = array({x(7)});
+    reserve(a);
+    reserve(b);
+    EXPECT_EQ(reserve(c), 4u);
+    reserve(d);
+
+    release(a);
+    release(c);
+    // both free spaces fit, but only the second one already has the values
+    EXPECT_EQ(reserve(array({x(4), x(5), x(6)})), 4u);
+}
+
+TEST_F(ArrayIdCompresserTest, reusesSpaceWithTheSameParameters) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    Node& a = array({x(0), x(1), x(2)});
+    Node& b = array({x(3)});
+    Node& c = array({Arg(1.5), Arg(nan), Arg(3.5)});
+    Node& d = array({x(7)});
+    reserve(a);
+    reserve(b);
+    EXPECT_EQ(reserve(c), 4u);
+    reserve(d);
+
+    release(a);
+    release(c);
+    // different arguments with the same values (NaN is never the same value)
+    EXPECT_EQ(reserve(array({Arg(1.5), Arg(nan), Arg(3.5)})), 4u);
+}
+
+TEST_F(ArrayIdCompresserTest, avoidsElementsUsedByTheNewArray) {
+    Node& a = array({x(0), x(1), x(2)});
+    Node& b = array({x(3), x(4)});
+    reserve(a);
+    reserve(b);
+
+    // a is released when the new array (which reads a[1]) is created
+    Arg a1 = element(a, 1);
+    release(a);
+    EXPECT_EQ(reserve(array({a1, x(5)})), 5u);
+
+    // other arrays can use it
+    EXPECT_EQ(reserve(array({x(6), x(7)})), 0u);
+}
+
+TEST_F(ArrayIdCompresserTest, randomSequences) {
+    std::mt19937 gen(5);
+
+    struct Live {
+        Node* array;
+        size_t start;
+    };
+    std::vector<Live> live;
+
+    for (size_t step = 0; step < 3000; step++) {
+        if (!live.empty() && gen() % 3 == 0) {
+            size_t r = gen() % live.size();
+            release(*live[r].array);
+            live.erase(live.begin() + r);
+            continue;
+        }
+
+        size_t size = 1 + gen() % 6;
+        std::vector<Arg> args;
+        std::vector<size_t> blackList;
+
+        // release an array and read some of its elements (like at the last usage of an array)
+        Live old{nullptr, 0};
+        if (!live.empty() && gen() % 2 == 0) {
+            size_t r = gen() % live.size();
+            old = live[r];
+            release(*old.array);
+            live.erase(live.begin() + r);
+        }
+
+        for (size_t i = 0; i < size; i++) {
+            if (old.array != nullptr && gen() % 2 == 0) {
+                size_t index = gen() % old.array->getArguments().size();
+                args.push_back(element(*old.array, index));
+                blackList.push_back(old.start + index);
+            } else if (gen() % 4 == 0) {
+                args.push_back(Arg(double(i)));
+            } else {
+                args.push_back(x(gen() % x_.size()));
+            }
+        }
+
+        Node& newArray = array(args);
+        size_t start = reserve(newArray);
+        size_t end = start + args.size();
+
+        ASSERT_LE(end, comp_->getIdCount() - 1) << "step " << step;
+        for (size_t p : blackList) {
+            ASSERT_TRUE(p < start || p >= end) << "step " << step << ": element " << p << " overwritten";
+        }
+        for (const Live& l : live) {
+            size_t lEnd = l.start + l.array->getArguments().size();
+            ASSERT_TRUE(end <= l.start || lEnd <= start) << "step " << step << ": overlapping arrays";
+        }
+
+        live.push_back({&newArray, start});
+    }
+}
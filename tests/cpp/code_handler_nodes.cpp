@@ -0,0 +1,83 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+
+namespace {
+
+std::string generate(CodeHandler<double>& handler, std::vector<CGD>& y) {
+    LanguageC<double> langC("double");
+    LangCDefaultVariableNameGenerator<double> nameGen;
+
+    std::ostringstream code;
+    handler.generateCode(code, langC, y, nameGen);
+    return code.str();
+}
+
+}  // namespace
+
+TEST(CodeHandlerNodes, handlerPositions) {
+    CodeHandler<double> handler;
+    std::vector<CGD> x(3);
+    handler.makeVariables(x);
+
+    CGD a = x[0] * x[1] + x[2];
+    CGD b = exp(a) * a;
+    (void) b;
+
+    const std::vector<OperationNode<double>*>& nodes = handler.getManagedNodes();
+    ASSERT_EQ(nodes.size(), handler.getManagedNodesCount());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        EXPECT_EQ(nodes[i]->getHandlerPosition(), i);
+        EXPECT_EQ(nodes[i]->getCodeHandler(), &handler);
+    }
+
+    handler.reset();
+    EXPECT_EQ(handler.getManagedNodesCount(), 0u);
+}
+
+TEST(CodeHandlerNodes, visits) {
+    CodeHandler<double> handler;
+    std::vector<CGD> x(2);
+    handler.makeVariables(x);
+    CGD a = x[0] * x[1];
+
+    handler.startNewOperationTreeVisit();
+    size_t id = handler.getOperationTreeVisitId();
+    EXPECT_FALSE(handler.isVisited(*a.getOperationNode()));
+    handler.markVisited(*a.getOperationNode());
+    EXPECT_TRUE(handler.isVisited(*a.getOperationNode()));
+    EXPECT_FALSE(handler.isVisited(*x[0].getOperationNode()));
+
+    handler.startNewOperationTreeVisit();
+    EXPECT_EQ(handler.getOperationTreeVisitId(), id + 1);
+    EXPECT_FALSE(handler.isVisited(*a.getOperationNode()));
+}
+
+TEST(CodeHandlerNodes, orderIsResetBetweenGenerations) {
+    CodeHandler<double> handler;
+    std::vector<CGD> x(3);
+    handler.makeVariables(x);
+
+    CGD a = x[0] * x[1];
+    std::vector<CGD> y{a + sin(a), a * x[2]};
+    std::string code1 = generate(handler, y);
+    EXPECT_EQ(generate(handler, y), code1);
+
+    // new nodes after a generation (the per-node tables must grow)
+    CGD b = cos(y[0]) * y[1];
+    std::vector<CGD> z{y[0], y[1], b + b};
+    std::string code2 = generate(handler, z);
+    EXPECT_NE(code2.find("cos("), std::string::npos);
+
+    EXPECT_EQ(generate(handler, y), code1);
+}
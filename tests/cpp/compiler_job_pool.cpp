@@ -0,0 +1,143 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <dlfcn.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+TEST(CompilerJobPool, runsJobsConcurrently) {
+    CompilerJobPool pool(4);
+    ASSERT_EQ(pool.size(), 4u);
+
+    std::atomic<int> running(0);
+    std::atomic<int> maxRunning(0);
+    std::atomic<int> done(0);
+    for (size_t i = 0; i < 8; i++) {
+        pool.submit([&]() {
+            int r = ++running;
+            int m = maxRunning;
+            while (r > m && !maxRunning.compare_exchange_weak(m, r)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            --running;
+            ++done;
+        });
+    }
+    pool.wait();
+
+    EXPECT_EQ(done, 8);
+    EXPECT_GT(maxRunning, 1);
+    EXPECT_LE(maxRunning, 4);
+}
+
+TEST(CompilerJobPool, reportsFirstError) {
+    CompilerJobPool pool(2);
+
+    pool.submit([]() { throw CGException("first failure"); });
+    try {
+        pool.wait();
+        FAIL() << "the error was not reported";
+    } catch (const CGException& e) {
+        EXPECT_NE(std::string(e.what()).find("first failure"), std::string::npos);
+    }
+
+    // the pool can be reused after an error
+    std::atomic<int> done(0);
+    for (size_t i = 0; i < 4; i++) {
+        pool.submit([&]() { ++done; });
+    }
+    EXPECT_NO_THROW(pool.wait());
+    EXPECT_EQ(done, 4);
+}
+
+TEST(CallExecutable, largeInputAndOutput) {
+    // cat writes its output while reading: the output pipe fills up long before all the input is written
+    std::string input(4 << 20, 'a');
+    for (size_t i = 0; i < input.size(); i += 81) input[i] = '\n';
+
+    std::string output;
+    system::callExecutable("/bin/cat", {}, &output, &input);
+    EXPECT_GT(output.size(), 0u);
+    EXPECT_LT(output.size(), input.size());  // only the beginning is kept
+    EXPECT_EQ(output, input.substr(0, output.size()));
+}
+
+TEST(CallExecutable, reportsFailures) {
+    std::string output;
+    try {
+        system::callExecutable("/bin/sh", {"-c", "echo 'compilation failed' >&2; exit 3"}, &output);
+        FAIL() << "the exit code was not reported";
+    } catch (const CGException& e) {
+        std::string message = e.what();
+        EXPECT_NE(message.find("exited with code 3"), std::string::npos) << message;
+        EXPECT_NE(message.find("compilation failed"), std::string::npos) << message;
+    }
+
+    // the executable exits without reading its input
+    std::string input(1 << 20, ' ');
+    EXPECT_THROW(system::callExecutable("/bin/sh", {"-c", "exit 4"}, &output, &input), CGException);
+
+    EXPECT_THROW(system::callExecutable("/nonexistent/executable", {}), CGException);
+}
+
+TEST(GccCompiler, compilesSourcesInParallel) {
+    const size_t nSources = 12;
+    std::map<std::string, std::string> sources;
+    for (size_t i = 0; i < nSources; i++) {
+        sources["source_" + std::to_string(i) + ".c"] =
+                "int parallel_function_" + std::to_string(i) + "(void) { return " + std::to_string(i) + "; }\n";
+    }
+
+    GccCompiler<double> compiler;
+    compiler.setTemporaryFolder("cppadcg_tmp_parallel");
+    compiler.setMaxParallelJobs(4);
+
+    compiler.compileSources(sources, true);
+    EXPECT_EQ(compiler.getObjectFiles().size(), nSources);
+
+    const std::string library = "./cppadcg_parallel_compile" + system::SystemInfo<>::DYNAMIC_LIB_EXTENSION;
+    compiler.buildDynamic(library);
+
+    void* handle = dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+    ASSERT_NE(handle, nullptr) << dlerror();
+    for (size_t i = 0; i < nSources; i++) {
+        auto f = reinterpret_cast<int (*)()>(dlsym(handle, ("parallel_function_" + std::to_string(i)).c_str()));
+        ASSERT_NE(f, nullptr) << i;
+        EXPECT_EQ(f(), int(i));
+    }
+    dlclose(handle);
+
+    compiler.cleanup();
+}
+
+TEST(GccCompiler, reportsParallelCompilationErrors) {
+    std::map<std::string, std::string> sources;
+    for (size_t i = 0; i < 6; i++) {
+        sources["good_" + std::to_string(i) + ".c"] = "int good_" + std::to_string(i) + "(void) { return 1; }\n";
+    }
+    sources["bad.c"] = "int bad(void) { return undeclared_variable; }\n";
+
+    GccCompiler<double> compiler;
+    compiler.setTemporaryFolder("cppadcg_tmp_parallel_error");
+    compiler.setMaxParallelJobs(3);
+
+    EXPECT_THROW(compiler.compileSources(sources, true), CGException);
+
+    // the compiler can still be used
+    std::map<std::string, std::string> fixed{{"fixed.c", "int fixed(void) { return 2; }\n"},
+                                             {"fixed2.c", "int fixed2(void) { return 3; }\n"}};
+    EXPECT_NO_THROW(compiler.compileSources(fixed, true));
+
+    compiler.cleanup();
+}
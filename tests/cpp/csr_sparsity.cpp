@@ -0,0 +1,110 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <random>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using VectorSet = std::vector<std::set<size_t>>;
+
+namespace {
+
+VectorSet randomPattern(size_t m, size_t n, double density, std::mt19937& gen) {
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    VectorSet p(m);
+    for (size_t i = 0; i < m; i++) {
+        for (size_t j = 0; j < n; j++) {
+            if (dist(gen) < density) p[i].insert(j);
+        }
+    }
+    return p;
+}
+
+VectorSet multiply(const VectorSet& a, const VectorSet& b) {
+    VectorSet r(a.size());
+    for (size_t i = 0; i < a.size(); i++) {
+        for (size_t k : a[i]) r[i].insert(b[k].begin(), b[k].end());
+    }
+    return r;
+}
+
+}  // namespace
+
+TEST(CsrSparsity, transpose) {
+    std::mt19937 gen(1);
+    VectorSet a = randomPattern(37, 53, 0.1, gen);
+
+    VectorSet expected(53);
+    for (size_t i = 0; i < a.size(); i++) {
+        for (size_t j : a[i]) expected[j].insert(i);
+    }
+
+    CsrSparsity t = CsrSparsity(a, 37, 53).transpose();
+    EXPECT_EQ(t.rows(), 53u);
+    EXPECT_EQ(t.cols(), 37u);
+    EXPECT_EQ(t.toSets<VectorSet>(), expected);
+}
+
+TEST(CsrSparsity, multiply) {
+    std::mt19937 gen(2);
+    for (size_t s = 0; s < 10; s++) {
+        size_t m = 1 + gen() % 200;
+        size_t n = 1 + gen() % 200;
+        size_t q = 1 + gen() % 200;
+        VectorSet a = randomPattern(m, n, 0.05, gen);
+        VectorSet b = randomPattern(n, q, 0.05, gen);
+        VectorSet expected = multiply(a, b);
+
+        CsrSparsity aCsr(a, m, n);
+        CsrSparsity bCsr(b, n, q);
+        EXPECT_EQ(CsrSparsity::multiply(aCsr, bCsr).toSets<VectorSet>(), expected);
+        EXPECT_EQ(CsrSparsity::multiply(aCsr, bCsr, 4).toSets<VectorSet>(), expected);
+
+        CppAD::vector<std::set<size_t>> r(m);
+        multMatrixMatrixSparsity(a, b, r, m, n, q);
+        for (size_t i = 0; i < m; i++) EXPECT_EQ(r[i], expected[i]);
+    }
+}
+
+TEST(CsrSparsity, multiplyWithSeveralThreads) {
+    // large enough to be split among threads
+    std::mt19937 gen(3);
+    size_t n = 2000;
+    VectorSet a = randomPattern(n, n, 0.01, gen);
+    CsrSparsity aCsr(a, n, n);
+
+    VectorSet expected = multiply(a, a);
+    EXPECT_EQ(CsrSparsity::multiply(aCsr, aCsr, 0).toSets<VectorSet>(), expected);
+    EXPECT_EQ(CsrSparsity::multiply(aCsr, aCsr, 3).toSets<VectorSet>(), expected);
+}
+
+TEST(CsrSparsity, unite) {
+    std::mt19937 gen(4);
+    size_t m = 150;
+    size_t n = 90;
+
+    std::vector<CsrSparsity> patterns;
+    VectorSet expected(m);
+    for (size_t k = 0; k < 6; k++) {
+        VectorSet p = randomPattern(m, n, 0.03, gen);
+        patterns.emplace_back(p, m, n);
+        for (size_t i = 0; i < m; i++) expected[i].insert(p[i].begin(), p[i].end());
+    }
+
+    CsrSparsity sum = CsrSparsity::unite(patterns);
+    EXPECT_EQ(sum.toSets<VectorSet>(), expected);
+    EXPECT_EQ(CsrSparsity::unite(patterns, 0).toSets<VectorSet>(), expected);
+
+    std::vector<size_t> rows, cols, expectedRows, expectedCols;
+    generateSparsityIndexes(sum, rows, cols);
+    generateSparsityIndexes(expected, expectedRows, expectedCols);
+    EXPECT_EQ(rows, expectedRows);
+    EXPECT_EQ(cols, expectedCols);
+}
@@ -0,0 +1,127 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+#include <cppad/cg/dae_index_reduction/dae_block_lower_triangular.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+using ADCG = AD<CGD>;
+
+namespace {
+
+/**
+ * Index one DAE (variables: x, dxdt, y1, y2, y3, t)
+ *
+ * @param singular whether or not y3 is removed from the equations
+ *                 (which makes the system structurally singular)
+ */
+std::unique_ptr<ADFun<CGD>> createModel(bool singular,
+                                        std::vector<DaeVarInfo>& varInfo,
+                                        std::vector<DaeEquationInfo>& eqInfo) {
+    std::vector<ADCG> u(6);
+    for (size_t j = 0; j < u.size(); j++) u[j] = 0.5 + j;
+    Independent(u);
+
+    std::vector<ADCG> res(4);
+    res[0] = u[1] + u[0] - u[2];  // dxdt = -x + y1
+    res[1] = u[2] - 2.0 * u[0];   // y1 = 2 x
+    if (singular) {
+        res[2] = u[3] - u[0] * u[5];
+        res[3] = u[3] * u[3] - 0.25;
+    } else {
+        res[2] = u[3] + u[4] - u[0] * u[5];  // y2 + y3 = x t
+        res[3] = u[3] * u[4] - 0.25;         // y2 y3 = 0.25
+    }
+
+    varInfo.resize(u.size());
+    varInfo[0] = DaeVarInfo("x");
+    varInfo[0].setDerivative(1);
+    varInfo[1] = DaeVarInfo(0, "dxdt");
+    varInfo[2] = DaeVarInfo("y1");
+    varInfo[3] = DaeVarInfo("y2");
+    varInfo[4] = DaeVarInfo("y3");
+    varInfo[5] = DaeVarInfo("t");
+    varInfo[5].makeIntegratedVariable();
+
+    eqInfo.resize(res.size());
+    for (size_t i = 0; i < res.size(); i++) eqInfo[i] = DaeEquationInfo(i, int(i), -1, -1);
+
+    return std::unique_ptr<ADFun<CGD>>(new ADFun<CGD>(u, res));
+}
+
+size_t findBlock(const std::vector<DaeBlockInfo>& blocks, size_t equation) {
+    for (size_t b = 0; b < blocks.size(); b++) {
+        const auto& eqs = blocks[b].getEquations();
+        if (std::find(eqs.begin(), eqs.end(), equation) != eqs.end()) return b;
+    }
+    return blocks.size();
+}
+
+}  // namespace
+
+TEST(DaeBlockLowerTriangular, decompose) {
+    std::vector<DaeVarInfo> varInfo;
+    std::vector<DaeEquationInfo> eqInfo;
+    std::unique_ptr<ADFun<CGD>> fun = createModel(false, varInfo, eqInfo);
+
+    DaeBlockLowerTriangular<double> blt(*fun, varInfo, eqInfo);
+    EXPECT_FALSE(blt.isUnknown(0));  // differential variable
+    EXPECT_TRUE(blt.isUnknown(1));
+    EXPECT_TRUE(blt.isUnknown(2));
+    EXPECT_TRUE(blt.isUnknown(3));
+    EXPECT_TRUE(blt.isUnknown(4));
+    EXPECT_FALSE(blt.isUnknown(5));  // integrated variable
+
+    const std::vector<DaeBlockInfo>& blocks = blt.decompose();
+    ASSERT_EQ(blocks.size(), 3u);
+
+    size_t bY1 = findBlock(blocks, 1);
+    size_t bDxdt = findBlock(blocks, 0);
+    size_t bLoop = findBlock(blocks, 2);
+    ASSERT_LT(bY1, blocks.size());
+    ASSERT_LT(bDxdt, blocks.size());
+    ASSERT_LT(bLoop, blocks.size());
+
+    // dxdt depends on y1
+    EXPECT_LT(bY1, bDxdt);
+
+    EXPECT_TRUE(blocks[bY1].isExplicit());
+    EXPECT_EQ(blocks[bY1].getVariables(), std::vector<size_t>{2});
+    EXPECT_TRUE(blocks[bDxdt].isExplicit());
+    EXPECT_EQ(blocks[bDxdt].getVariables(), std::vector<size_t>{1});
+
+    EXPECT_FALSE(blocks[bLoop].isExplicit());
+    EXPECT_EQ(blocks[bLoop].getEquations(), (std::vector<size_t>{2, 3}));
+    std::vector<size_t> loopVars = blocks[bLoop].getVariables();
+    std::sort(loopVars.begin(), loopVars.end());
+    EXPECT_EQ(loopVars, (std::vector<size_t>{3, 4}));
+
+    EXPECT_EQ(blt.getAlgebraicLoops(), std::vector<size_t>{bLoop});
+
+    std::map<std::string, std::string> sources;
+    blt.generateSources(sources, "dae");
+    for (size_t b = 0; b < blocks.size(); b++) {
+        EXPECT_TRUE(sources.count("dae_block" + std::to_string(b) + ".c") > 0) << "block " << b;
+    }
+    ASSERT_TRUE(sources.count("dae_blocks.c") > 0);
+    EXPECT_NE(sources["dae_blocks.c"].find("// algebraic loops: " + std::to_string(bLoop) + "[2]"),
+              std::string::npos);
+}
+
+TEST(DaeBlockLowerTriangular, structurallySingular) {
+    std::vector<DaeVarInfo> varInfo;
+    std::vector<DaeEquationInfo> eqInfo;
+    std::unique_ptr<ADFun<CGD>> fun = createModel(true, varInfo, eqInfo);
+
+    DaeBlockLowerTriangular<double> blt(*fun, varInfo, eqInfo);
+    EXPECT_THROW(blt.decompose(), CGException);
+}
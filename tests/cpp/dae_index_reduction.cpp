@@ -0,0 +1,111 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <random>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+#include <cppad/cg/dae_index_reduction/pantelides.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+using ADCG = AD<CGD>;
+
+namespace {
+
+/**
+ * Index 3 pendulum in Cartesian coordinates
+ * (variables: x, y, vx, vy, T, dxdt, dydt, dvxdt, dvydt, t)
+ */
+std::unique_ptr<ADFun<CGD>> createPendulum(std::vector<DaeVarInfo>& varInfo, std::vector<double>& x0) {
+    const double g = 9.80665;
+    const double l = 1.0;
+
+    x0 = {0.6, -0.8, 0.1, 0.075, 1.2, 0.1, 0.075, -0.72, -8.84, 0.0};
+
+    std::vector<ADCG> u(x0.size());
+    for (size_t j = 0; j < u.size(); j++) u[j] = x0[j];
+    Independent(u);
+
+    std::vector<ADCG> res(5);
+    res[0] = u[5] - u[2];
+    res[1] = u[6] - u[3];
+    res[2] = u[7] + u[4] * u[0];
+    res[3] = u[8] + u[4] * u[1] + g;
+    res[4] = u[0] * u[0] + u[1] * u[1] - l * l;
+
+    varInfo.resize(u.size());
+    const char* names[] = {"x", "y", "vx", "vy", "T"};
+    for (size_t j = 0; j < 5; j++) varInfo[j].setName(names[j]);
+    for (size_t j = 0; j < 4; j++) varInfo[5 + j] = DaeVarInfo(int(j), std::string("d") + names[j] + "dt");
+    varInfo[9].makeIntegratedVariable();
+
+    return std::unique_ptr<ADFun<CGD>>(new ADFun<CGD>(u, res));
+}
+
+std::unique_ptr<ADFun<CGD>> reduceIndex(ADFun<CGD>& fun,
+                                        const std::vector<DaeVarInfo>& varInfo,
+                                        const std::vector<double>& x0,
+                                        bool symbolic,
+                                        std::vector<bool>& graphSparsity) {
+    std::vector<std::string> eqName(fun.Range());
+    Pantelides<double> pantelides(fun, varInfo, eqName, x0);
+    pantelides.setSymbolicTimeDerivatives(symbolic);
+
+    std::vector<DaeVarInfo> newVarInfo;
+    std::vector<DaeEquationInfo> equationInfo;
+    std::unique_ptr<ADFun<CGD>> reduced = pantelides.reduceIndex(newVarInfo, equationInfo);
+
+    graphSparsity = pantelides.getGraph().getReducedModelSparsity();
+    return reduced;
+}
+
+}  // namespace
+
+TEST(DaeIndexReduction, graphDerivativesMatchReTaping) {
+    std::vector<DaeVarInfo> varInfo;
+    std::vector<double> x0;
+    std::unique_ptr<ADFun<CGD>> fun = createPendulum(varInfo, x0);
+
+    std::vector<bool> graphSparsity, retapeSparsity;
+    std::unique_ptr<ADFun<CGD>> graphModel = reduceIndex(*fun, varInfo, x0, true, graphSparsity);
+    std::unique_ptr<ADFun<CGD>> retapeModel = reduceIndex(*fun, varInfo, x0, false, retapeSparsity);
+
+    ASSERT_NE(graphModel, nullptr);
+    ASSERT_NE(retapeModel, nullptr);
+    ASSERT_EQ(graphModel->Domain(), retapeModel->Domain());
+    ASSERT_EQ(graphModel->Range(), retapeModel->Range());
+    EXPECT_TRUE(retapeSparsity.empty());
+
+    const size_t n = graphModel->Domain();
+    const size_t m = graphModel->Range();
+
+    // the sparsity taken from the operation graph
+    ASSERT_EQ(graphSparsity.size(), n * m);
+    std::vector<bool> expectedSparsity = jacobianReverseSparsity<std::vector<bool>, CGD>(*retapeModel);
+    EXPECT_EQ(graphSparsity, expectedSparsity);
+
+    // the equations
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> dist(-2.0, 2.0);
+    for (size_t s = 0; s < 10; s++) {
+        std::vector<CGD> x(n);
+        for (size_t j = 0; j < n; j++) x[j] = dist(gen);
+
+        std::vector<CGD> yGraph = graphModel->Forward(0, x);
+        std::vector<CGD> yRetape = retapeModel->Forward(0, x);
+
+        for (size_t i = 0; i < m; i++) {
+            ASSERT_TRUE(yGraph[i].isValueDefined());
+            ASSERT_TRUE(yRetape[i].isValueDefined());
+            double expected = yRetape[i].getValue();
+            EXPECT_NEAR(yGraph[i].getValue(), expected, 1e-10 * std::max(1.0, std::abs(expected)))
+                    << "sample " << s << ", equation " << i;
+        }
+    }
+}
@@ -0,0 +1,84 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <random>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+
+namespace {
+
+const size_t n = 3;
+const size_t m = 2;
+
+template <class T>
+std::unique_ptr<ADFun<T>> createModel() {
+    CppAD::vector<AD<T>> x(n);
+    for (size_t j = 0; j < n; j++) x[j] = 1.0 + j;
+    Independent(x);
+
+    CppAD::vector<AD<T>> y(m);
+    y[0] = exp(x[0]) * sin(x[1]) + x[2] / (1.0 + x[0] * x[0]);
+    y[1] = pow(x[2], 3) - cos(x[0] * x[1]) + sqrt(x[2]) * log(x[1]);
+
+    return std::unique_ptr<ADFun<T>>(new ADFun<T>(x, y));
+}
+
+}  // namespace
+
+TEST(ForwardTaylor, matchesCppADForward) {
+    const size_t p = 3;
+
+    std::unique_ptr<ADFun<CGD>> fun = createModel<CGD>();
+    ModelCSourceGen<double> cgen(*fun, "model_taylor");
+    cgen.setCreateForwardTaylor(true);
+    cgen.setForwardTaylorOrder(p);
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+
+    DynamicModelLibraryProcessor<double> processor(libcgen, "cppadcg_model_taylor");
+    GccCompiler<double> compiler;
+    std::unique_ptr<DynamicLib<double>> dynamicLib = processor.createDynamicLibrary(compiler);
+    std::unique_ptr<GenericModel<double>> model = dynamicLib->model("model_taylor");
+
+    ASSERT_TRUE(model->isForwardTaylorAvailable());
+    ASSERT_EQ(model->getForwardTaylorOrder(), p);
+
+    std::unique_ptr<ADFun<double>> reference = createModel<double>();
+
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<double> dist(0.2, 2.0);
+    for (size_t s = 0; s < 5; s++) {
+        std::vector<double> tx(n * (p + 1));
+        for (double& v : tx) v = dist(gen);
+
+        std::vector<double> ty = model->ForwardTaylor(tx);
+        std::vector<double> expected = reference->Forward(p, tx);
+
+        ASSERT_EQ(ty.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            EXPECT_NEAR(ty[i], expected[i], 1e-10 * std::max(1.0, std::abs(expected[i])))
+                    << "sample " << s << ", dependent " << i / (p + 1) << ", order " << i % (p + 1);
+        }
+    }
+}
+
+TEST(ForwardTaylor, notAvailableByDefault) {
+    std::unique_ptr<ADFun<CGD>> fun = createModel<CGD>();
+    ModelCSourceGen<double> cgen(*fun, "model_no_taylor");
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+
+    DynamicModelLibraryProcessor<double> processor(libcgen, "cppadcg_model_no_taylor");
+    GccCompiler<double> compiler;
+    std::unique_ptr<DynamicLib<double>> dynamicLib = processor.createDynamicLibrary(compiler);
+    std::unique_ptr<GenericModel<double>> model = dynamicLib->model("model_no_taylor");
+
+    EXPECT_FALSE(model->isForwardTaylorAvailable());
+}
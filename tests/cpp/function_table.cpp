@@ -0,0 +1,142 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <dlfcn.h>
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+
+namespace {
+
+template <class T>
+std::unique_ptr<ADFun<T>> createModel(double c) {
+    CppAD::vector<AD<T>> x(2);
+    x[0] = 1.0;
+    x[1] = 2.0;
+    Independent(x);
+
+    CppAD::vector<AD<T>> y(2);
+    y[0] = c * x[0] * x[1] + sin(x[0]);
+    y[1] = exp(x[1]) / x[0];
+
+    return std::unique_ptr<ADFun<T>>(new ADFun<T>(x, y));
+}
+
+/**
+ * Compiles a library with the models "model_a" and "model_b"
+ *
+ * @return the file name of the dynamic library
+ */
+std::string createLibrary(const std::string& libraryName, bool tablesOnly) {
+    std::unique_ptr<ADFun<CGD>> funA = createModel<CGD>(2.0);
+    std::unique_ptr<ADFun<CGD>> funB = createModel<CGD>(3.0);
+
+    ModelCSourceGen<double> cgenA(*funA, "model_a");
+    cgenA.setCreateJacobian(true);
+    ModelCSourceGen<double> cgenB(*funB, "model_b");
+    ModelLibraryCSourceGen<double> libcgen(cgenA, cgenB);
+
+    DynamicModelLibraryProcessor<double> processor(libcgen, libraryName);
+    processor.setExportFunctionTablesOnly(tablesOnly);
+    GccCompiler<double> compiler;
+    processor.createDynamicLibrary(compiler, false);
+
+    return libraryName + system::SystemInfo<>::DYNAMIC_LIB_EXTENSION;
+}
+
+void* findInTable(const CppADCGModelTable& table, const std::string& name) {
+    for (unsigned long i = 0; i < table.n_functions; i++) {
+        if (name == table.function_names[i]) return table.functions[i];
+    }
+    return nullptr;
+}
+
+void checkModel(GenericModel<double>& model, double c) {
+    std::unique_ptr<ADFun<double>> reference = createModel<double>(c);
+    std::vector<double> x{0.7, -1.3};
+
+    std::vector<double> y = model.ForwardZero(x);
+    std::vector<double> expected = reference->Forward(0, x);
+    ASSERT_EQ(y.size(), expected.size());
+    for (size_t i = 0; i < y.size(); i++) {
+        EXPECT_NEAR(y[i], expected[i], 1e-12) << model.getName() << ", dependent " << i;
+    }
+}
+
+}  // namespace
+
+TEST(FunctionTable, describesAllModels) {
+    std::string libFile = createLibrary("cppadcg_function_table", false);
+
+    void* handle = dlopen(("./" + libFile).c_str(), RTLD_NOW | RTLD_LOCAL);
+    ASSERT_NE(handle, nullptr) << dlerror();
+
+    const auto* library = reinterpret_cast<const CppADCGLibraryTable*>(
+            dlsym(handle, ModelLibraryCSourceGen<double>::LIBRARY_TABLE.c_str()));
+    ASSERT_NE(library, nullptr);
+    EXPECT_EQ(library->version, ModelLibraryCSourceGen<double>::API_VERSION);
+    ASSERT_EQ(library->n_models, 2u);
+
+    std::set<std::string> names;
+    for (unsigned long i = 0; i < library->n_models; i++) {
+        const CppADCGModelTable& table = *library->models[i];
+        names.insert(table.name);
+        EXPECT_EQ(table.version, ModelLibraryCSourceGen<double>::API_VERSION);
+
+        // the table holds the same functions as the exported symbols
+        std::string prefix = std::string(table.name) + "_";
+        for (unsigned long f = 0; f < table.n_functions; f++) {
+            EXPECT_EQ(std::strncmp(table.function_names[f], prefix.c_str(), prefix.size()), 0);
+            EXPECT_EQ(table.functions[f], dlsym(handle, table.function_names[f])) << table.function_names[f];
+        }
+
+        std::string forwardZero = prefix + ModelCSourceGen<double>::FUNCTION_FORWAD_ZERO;
+        EXPECT_NE(findInTable(table, forwardZero), nullptr);
+
+        // only the generated functions are listed
+        std::string jacobian = prefix + ModelCSourceGen<double>::FUNCTION_JACOBIAN;
+        EXPECT_EQ(findInTable(table, jacobian) != nullptr, std::string(table.name) == "model_a");
+
+        // the model descriptor is also exported on its own
+        EXPECT_EQ(dlsym(handle, (prefix + ModelCSourceGen<double>::FUNCTION_TABLE).c_str()), &table);
+    }
+    EXPECT_EQ(names, (std::set<std::string>{"model_a", "model_b"}));
+
+    dlclose(handle);
+}
+
+TEST(FunctionTable, exportTablesOnly) {
+    std::string libFile = createLibrary("cppadcg_function_table_only", true);
+
+    void* handle = dlopen(("./" + libFile).c_str(), RTLD_NOW | RTLD_LOCAL);
+    ASSERT_NE(handle, nullptr) << dlerror();
+    EXPECT_NE(dlsym(handle, ModelLibraryCSourceGen<double>::LIBRARY_TABLE.c_str()), nullptr);
+    EXPECT_NE(dlsym(handle, ("model_a_" + ModelCSourceGen<double>::FUNCTION_TABLE).c_str()), nullptr);
+    EXPECT_EQ(dlsym(handle, ("model_a_" + ModelCSourceGen<double>::FUNCTION_FORWAD_ZERO).c_str()), nullptr);
+    EXPECT_EQ(dlsym(handle, ModelLibraryCSourceGen<double>::FUNCTION_VERSION.c_str()), nullptr);
+    dlclose(handle);
+
+    // the models are loaded through the tables
+    LinuxDynamicLib<double> dynamicLib(libFile);
+    EXPECT_EQ(dynamicLib.getModelNames(), (std::set<std::string>{"model_a", "model_b"}));
+
+    std::unique_ptr<GenericModel<double>> modelA = dynamicLib.model("model_a");
+    std::unique_ptr<GenericModel<double>> modelB = dynamicLib.model("model_b");
+    ASSERT_NE(modelA, nullptr);
+    ASSERT_NE(modelB, nullptr);
+    EXPECT_TRUE(modelA->isJacobianAvailable());
+    EXPECT_FALSE(modelB->isJacobianAvailable());
+
+    checkModel(*modelA, 2.0);
+    checkModel(*modelB, 3.0);
+}
@@ -0,0 +1,153 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <cstdlib>
+#include <fstream>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+
+namespace {
+
+const size_t n = 3;
+const size_t m = 2;
+
+template <class T>
+std::unique_ptr<ADFun<T>> createModel() {
+    CppAD::vector<AD<T>> x(n);
+    for (size_t j = 0; j < n; j++) x[j] = 1.0 + j;
+    Independent(x);
+
+    CppAD::vector<AD<T>> y(m);
+    y[0] = x[0] * x[1] * x[2] + sin(x[0]) / (1.0 + x[2] * x[2]);
+    y[1] = exp(x[1]) - pow(x[2], 3) * log(x[0]);
+
+    return std::unique_ptr<ADFun<T>>(new ADFun<T>(x, y));
+}
+
+/**
+ * y = x0 * x1 (only zero order forward mode)
+ */
+class MulAtomic : public atomic_base<double> {
+public:
+    MulAtomic() : atomic_base<double>("mul_atomic") {}
+
+    bool forward(size_t p,
+                 size_t q,
+                 const CppAD::vector<bool>& vx,
+                 CppAD::vector<bool>& vy,
+                 const CppAD::vector<double>& tx,
+                 CppAD::vector<double>& ty) override {
+        if (q > 0) return false;
+        if (vx.size() > 0) vy[0] = vx[0] || vx[1];
+        ty[0] = tx[0] * tx[1];
+        return true;
+    }
+};
+
+/**
+ * Compiles and runs a program which prints the results of the functions
+ * in the header-only model
+ */
+std::vector<double> runHeader(const std::string& header,
+                              const std::vector<double>& x,
+                              const std::vector<double>& w) {
+    const std::string name = "cppadcg_header_only_test";
+    std::ofstream(name + ".hpp") << header;
+
+    std::ofstream main(name + ".cpp");
+    main << "#include \"" << name << ".hpp\"\n"
+         << "int main() {\n"
+            "    using namespace cppadcg_models::model;\n"
+            "    std::array<double, n> x{";
+    for (size_t j = 0; j < x.size(); j++) main << (j > 0 ? ", " : "") << x[j];
+    main << "};\n"
+            "    std::array<double, m> w{";
+    for (size_t i = 0; i < w.size(); i++) main << (i > 0 ? ", " : "") << w[i];
+    main << "};\n"
+            "    std::FILE* out = std::fopen(\""
+         << name
+         << ".out\", \"w\");\n"
+            "    for (double v : forward_zero(x)) std::fprintf(out, \"%.17g\\n\", v);\n"
+            "    for (double v : jacobian(x)) std::fprintf(out, \"%.17g\\n\", v);\n"
+            "    for (double v : hessian(x, w)) std::fprintf(out, \"%.17g\\n\", v);\n"
+            "    // the functions are templates on the scalar type\n"
+            "    std::array<float, n> xf{float(x[0]), float(x[1]), float(x[2])};\n"
+            "    std::fprintf(out, \"%.17g\\n\", double(forward_zero(xf)[0]));\n"
+            "    std::fclose(out);\n"
+            "    return 0;\n"
+            "}\n";
+    main.close();
+
+    std::string cmd = "g++ -std=c++11 -O1 " + name + ".cpp -o " + name + " && ./" + name;
+    EXPECT_EQ(std::system(cmd.c_str()), 0) << cmd;
+
+    std::vector<double> values;
+    std::ifstream out(name + ".out");
+    double v;
+    while (out >> v) values.push_back(v);
+    return values;
+}
+
+}  // namespace
+
+TEST(HeaderOnlyModel, matchesCppAD) {
+    std::unique_ptr<ADFun<CGD>> fun = createModel<CGD>();
+    ModelCSourceGen<double> cgen(*fun, "model");
+    cgen.setCreateForwardZero(true);
+    cgen.setCreateSparseJacobian(true);
+    cgen.setCreateHessian(true);
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+
+    HeaderOnlyModelLibraryProcessor<double> processor(libcgen);
+    std::string header = processor.generateHeader();
+    EXPECT_NE(header.find("namespace cppadcg_models"), std::string::npos);
+    EXPECT_NE(header.find("constexpr std::size_t n = 3;"), std::string::npos);
+    EXPECT_NE(header.find("constexpr std::size_t m = 2;"), std::string::npos);
+
+    std::vector<double> x{0.7, 1.3, -0.4};
+    std::vector<double> w{1.5, -0.5};
+
+    std::vector<double> values = runHeader(header, x, w);
+    ASSERT_EQ(values.size(), m + m * n + n * n + 1);
+
+    std::unique_ptr<ADFun<double>> reference = createModel<double>();
+    std::vector<double> expected = reference->Forward(0, x);
+    std::vector<double> jac = reference->Jacobian(x);
+    std::vector<double> hess = reference->Hessian(x, w);
+    expected.insert(expected.end(), jac.begin(), jac.end());
+    expected.insert(expected.end(), hess.begin(), hess.end());
+
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_NEAR(values[i], expected[i], 1e-12 * std::max(1.0, std::abs(expected[i]))) << "value " << i;
+    }
+    EXPECT_NEAR(values.back(), expected[0], 1e-5 * std::max(1.0, std::abs(expected[0])));
+}
+
+TEST(HeaderOnlyModel, rejectsAtomicFunctions) {
+    MulAtomic atomic;
+    CppAD::vector<double> xSparsity(2);
+    xSparsity[0] = 1.0;
+    xSparsity[1] = 1.0;
+    CGAtomicFun<double> cgAtomic(atomic, xSparsity, true);
+
+    std::vector<AD<CGD>> ax{1.0, 2.0};
+    Independent(ax);
+    std::vector<AD<CGD>> ay(1);
+    cgAtomic(ax, ay);
+    ADFun<CGD> fun(ax, ay);
+
+    ModelCSourceGen<double> cgen(fun, "model_atomic");
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+
+    HeaderOnlyModelLibraryProcessor<double> processor(libcgen);
+    EXPECT_THROW(processor.generateHeader(), CGException);
+}
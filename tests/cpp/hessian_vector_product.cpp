@@ -0,0 +1,88 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+using ADCG = AD<CGD>;
+
+namespace {
+
+std::unique_ptr<ADFun<CGD>> createHvpModel() {
+    CppAD::vector<ADCG> x(3);
+    x[0] = 1.;
+    x[1] = 2.;
+    x[2] = 3.;
+    Independent(x);
+
+    CppAD::vector<ADCG> y(2);
+    y[0] = x[0] * x[0] * x[1] + sin(x[2]) * x[0];
+    y[1] = exp(x[1] * x[2]) / (1. + x[0] * x[0]);
+
+    return std::unique_ptr<ADFun<CGD>>(new ADFun<CGD>(x, y));
+}
+
+void testHessianVectorProduct(bool symbolic, const std::string& name) {
+    std::unique_ptr<ADFun<CGD>> fun = createHvpModel();
+
+    ModelCSourceGen<double> cgen(*fun, name);
+    cgen.setCreateHessian(true);
+    cgen.setCreateHessianVectorProduct(true);
+    cgen.setHessianVectorProductDirections(2);
+    cgen.setSymbolicDerivatives(symbolic);
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+
+    DynamicModelLibraryProcessor<double> p(libcgen, "cppadcg_" + name);
+    GccCompiler<double> compiler;
+    std::unique_ptr<DynamicLib<double>> dynamicLib = p.createDynamicLibrary(compiler);
+    std::unique_ptr<GenericModel<double>> model = dynamicLib->model(name);
+
+    ASSERT_TRUE(model->isHessianVectorProductAvailable());
+    ASSERT_EQ(model->getHessianVectorProductDirections(), 2u);
+
+    const size_t n = 3;
+    std::vector<double> x{0.5, -1.5, 0.75};
+    std::vector<double> w{2.0, -0.5};
+    // three directions: the last compiled call is padded with zeros
+    std::vector<double> v{1.0, 0.0, 0.0,  //
+                          0.3, -2.0, 1.1,  //
+                          0.0, 0.5, -4.0};
+
+    std::vector<double> hess = model->Hessian(x, w);
+    std::vector<double> hv = model->HessianVectorProduct(x, w, v);
+    ASSERT_EQ(hv.size(), v.size());
+
+    for (size_t d = 0; d < 3; ++d) {
+        for (size_t i = 0; i < n; ++i) {
+            double expected = 0;
+            for (size_t j = 0; j < n; ++j) {
+                expected += hess[i * n + j] * v[d * n + j];
+            }
+            EXPECT_NEAR(hv[d * n + i], expected, 1e-10 * std::max(1.0, std::abs(expected)))
+                    << "direction " << d << ", row " << i;
+        }
+    }
+
+    // no directions
+    std::vector<double> empty;
+    std::vector<double> hvEmpty(0);
+    model->HessianVectorProduct(ArrayView<const double>(x), ArrayView<const double>(w),
+                                ArrayView<const double>(empty), ArrayView<double>(hvEmpty));
+}
+
+}  // namespace
+
+TEST(HessianVectorProduct, matchesHessianTimesVector) {
+    testHessianVectorProduct(false, "model_hvp");
+}
+
+TEST(HessianVectorProduct, symbolicMatchesHessianTimesVector) {
+    testHessianVectorProduct(true, "model_hvp_symbolic");
+}
@@ -0,0 +1,306 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+namespace {
+
+/**
+ * A JSON value (only what is needed to check the trace files)
+ */
+class Json {
+public:
+    enum class Type { Null, Bool, Number, String, Array, Object };
+
+    Type type = Type::Null;
+    bool boolean = false;
+    double number = 0;
+    std::string string;
+    std::vector<Json> array;
+    std::map<std::string, Json> object;
+
+    const Json& operator[](const std::string& key) const {
+        auto it = object.find(key);
+        if (type != Type::Object || it == object.end()) throw CGException("missing JSON member '", key, "'");
+        return it->second;
+    }
+
+    bool has(const std::string& key) const { return object.find(key) != object.end(); }
+
+    static Json parse(const std::string& text) {
+        size_t pos = 0;
+        Json value = parseValue(text, pos);
+        skipSpaces(text, pos);
+        if (pos != text.size()) throw CGException("unexpected JSON content at ", pos);
+        return value;
+    }
+
+private:
+    static void skipSpaces(const std::string& text, size_t& pos) {
+        while (pos < text.size() && std::isspace((unsigned char) text[pos])) pos++;
+    }
+
+    static void expect(const std::string& text, size_t& pos, char c) {
+        skipSpaces(text, pos);
+        if (pos >= text.size() || text[pos] != c) throw CGException("expected '", c, "' in JSON at ", pos);
+        pos++;
+    }
+
+    static std::string parseString(const std::string& text, size_t& pos) {
+        expect(text, pos, '"');
+        std::string value;
+        while (pos < text.size() && text[pos] != '"') {
+            char c = text[pos++];
+            if ((unsigned char) c < 0x20) throw CGException("control character in JSON string at ", pos);
+            if (c != '\\') {
+                value += c;
+                continue;
+            }
+            if (pos >= text.size()) break;
+            char e = text[pos++];
+            switch (e) {
+                case '"':
+                case '\\':
+                case '/':
+                    value += e;
+                    break;
+                case 'n':
+                    value += '\n';
+                    break;
+                case 't':
+                    value += '\t';
+                    break;
+                case 'u':
+                    if (pos + 4 > text.size()) throw CGException("invalid JSON escape at ", pos);
+                    value += char(std::stoi(text.substr(pos, 4), nullptr, 16));
+                    pos += 4;
+                    break;
+                default:
+                    throw CGException("invalid JSON escape at ", pos);
+            }
+        }
+        expect(text, pos, '"');
+        return value;
+    }
+
+    static Json parseValue(const std::string& text, size_t& pos) {
+        skipSpaces(text, pos);
+        if (pos >= text.size()) throw CGException("unexpected end of JSON");
+
+        Json value;
+        char c = text[pos];
+        if (c == '{') {
+            value.type = Type::Object;
+            pos++;
+            skipSpaces(text, pos);
+            if (text[pos] == '}') {
+                pos++;
+                return value;
+            }
+            while (true) {
+                std::string key = parseString(text, pos);
+                if (value.has(key)) throw CGException("repeated JSON member '", key, "'");
+                expect(text, pos, ':');
+                value.object[key] = parseValue(text, pos);
+                skipSpaces(text, pos);
+                if (pos < text.size() && text[pos] == ',') {
+                    pos++;
+                    continue;
+                }
+                expect(text, pos, '}');
+                return value;
+            }
+        } else if (c == '[') {
+            value.type = Type::Array;
+            pos++;
+            skipSpaces(text, pos);
+            if (text[pos] == ']') {
+                pos++;
+                return value;
+            }
+            while (true) {
+                value.array.push_back(parseValue(text, pos));
+                skipSpaces(text, pos);
+                if (pos < text.size() && text[pos] == ',') {
+                    pos++;
+                    continue;
+                }
+                expect(text, pos, ']');
+                return value;
+            }
+        } else if (c == '"') {
+            value.type = Type::String;
+            value.string = parseString(text, pos);
+        } else if (text.compare(pos, 4, "true") == 0 || text.compare(pos, 5, "false") == 0) {
+            value.type = Type::Bool;
+            value.boolean = c == 't';
+            pos += value.boolean ? 4 : 5;
+        } else if (text.compare(pos, 4, "null") == 0) {
+            pos += 4;
+        } else {
+            value.type = Type::Number;
+            const char* begin = text.c_str() + pos;
+            char* end;
+            value.number = std::strtod(begin, &end);
+            if (end == begin) throw CGException("invalid JSON value at ", pos);
+            pos += end - begin;
+        }
+        return value;
+    }
+};
+
+/**
+ * Increases the peak resident set size of the process
+ */
+size_t touchMemory(size_t bytes) {
+    std::vector<char> data(bytes);
+    std::memset(data.data(), 1, bytes);
+    size_t sum = 0;
+    for (size_t i = 0; i < bytes; i += 4096) sum += data[i];
+    return sum;
+}
+
+std::vector<const Json*> findEvents(const Json& trace, const std::string& phase) {
+    std::vector<const Json*> events;
+    for (const Json& e : trace["traceEvents"].array) {
+        if (e["ph"].string == phase) events.push_back(&e);
+    }
+    return events;
+}
+
+}  // namespace
+
+TEST(JobTimer, chromeTrace) {
+    const size_t mib = 1024 * 1024;
+
+    JobTimer timer;
+    timer.setTracing(true);
+
+    timer.startingJob("outer");
+    timer.addJobCounter("nodes", 5);
+    timer.addJobCounter("nodes", 3);
+    timer.startingJob("inner \"quoted\"\n", JobTimer::COMPILING);
+    // more than the previous peak (other tests might have used a lot of memory)
+    EXPECT_GT(touchMemory(system::getPeakResidentSetSize() + 32 * mib), 0u);
+    timer.finishedJob();
+    timer.finishedJob();
+
+    // a job executed by another thread
+    std::thread worker([&timer]() {
+        auto begin = std::chrono::steady_clock::now();
+        size_t beginPeakMemory = system::getPeakResidentSetSize();
+        timer.traceJob("worker job", JobTimer::COMPILING, begin, beginPeakMemory, {{"bytes", 10}});
+    });
+    worker.join();
+
+    std::ostringstream out;
+    timer.writeChromeTrace(out);
+    Json trace = Json::parse(out.str());
+    ASSERT_EQ(trace.type, Json::Type::Object);
+    EXPECT_EQ(trace["displayTimeUnit"].string, "ms");
+    ASSERT_EQ(trace["traceEvents"].type, Json::Type::Array);
+
+    // thread names
+    std::map<double, std::string> threads;
+    for (const Json* e : findEvents(trace, "M")) {
+        EXPECT_EQ((*e)["name"].string, "thread_name");
+        threads[(*e)["tid"].number] = (*e)["args"]["name"].string;
+    }
+    EXPECT_EQ(threads, (std::map<double, std::string>{{0, "main"}, {1, "worker 1"}}));
+
+    // completed jobs (in the order they ended)
+    std::vector<const Json*> jobs = findEvents(trace, "X");
+    ASSERT_EQ(jobs.size(), 3u);
+    const Json& inner = *jobs[0];
+    const Json& outer = *jobs[1];
+    const Json& workerJob = *jobs[2];
+
+    EXPECT_EQ(inner["name"].string, "compiling inner \"quoted\"\n");
+    EXPECT_EQ(inner["cat"].string, "compiling");
+    EXPECT_EQ(outer["name"].string, "generating outer");
+    EXPECT_EQ(workerJob["name"].string, "compiling worker job");
+
+    EXPECT_EQ(inner["tid"].number, 0);
+    EXPECT_EQ(outer["tid"].number, 0);
+    EXPECT_EQ(workerJob["tid"].number, 1);
+    EXPECT_EQ(inner["args"]["depth"].number, 1);
+    EXPECT_EQ(outer["args"]["depth"].number, 0);
+
+    // the inner job is inside the outer job
+    EXPECT_GE(inner["ts"].number, outer["ts"].number);
+    EXPECT_LE(inner["ts"].number + inner["dur"].number, outer["ts"].number + outer["dur"].number + 1);
+
+    EXPECT_EQ(outer["args"]["nodes"].number, 8);
+    EXPECT_FALSE(inner["args"].has("nodes"));
+    EXPECT_EQ(workerJob["args"]["bytes"].number, 10);
+
+    // peak memory usage
+    for (const Json* e : jobs) {
+        EXPECT_GT((*e)["args"]["peak_rss"].number, 0) << (*e)["name"].string;
+        EXPECT_LE((*e)["args"]["peak_rss_delta"].number, (*e)["args"]["peak_rss"].number) << (*e)["name"].string;
+    }
+    EXPECT_GE(inner["args"]["peak_rss_delta"].number, 32.0 * mib);
+    EXPECT_GE(outer["args"]["peak_rss_delta"].number, inner["args"]["peak_rss_delta"].number);
+    EXPECT_GE(outer["args"]["peak_rss"].number, inner["args"]["peak_rss"].number);
+
+    // a peak memory counter when each job ends
+    std::vector<const Json*> counters = findEvents(trace, "C");
+    ASSERT_EQ(counters.size(), jobs.size());
+    for (size_t i = 0; i < jobs.size(); i++) {
+        const Json& job = *jobs[i];
+        const Json& counter = *counters[i];
+        EXPECT_EQ(counter["name"].string, "peak RSS (MiB)");
+        EXPECT_NEAR(counter["ts"].number, job["ts"].number + job["dur"].number, 1) << i;  // rounding
+        EXPECT_NEAR(counter["args"]["peak_rss"].number, job["args"]["peak_rss"].number / mib, 0.051) << i;
+    }
+
+    // tracing again removes the recorded jobs
+    timer.setTracing(false);
+    timer.setTracing(true);
+    std::ostringstream empty;
+    timer.writeChromeTrace(empty);
+    Json emptyTrace = Json::parse(empty.str());
+    EXPECT_TRUE(findEvents(emptyTrace, "X").empty());
+    EXPECT_EQ(findEvents(emptyTrace, "M").size(), 1u);
+}
+
+TEST(JobTimer, saveChromeTrace) {
+    JobTimer timer;
+    timer.setTracing(true);
+    timer.startingJob("job");
+    timer.finishedJob();
+
+    const std::string fileName = "cppadcg_job_timer_trace.json";
+    timer.saveChromeTrace(fileName);
+
+    std::ifstream file(fileName);
+    std::stringstream content;
+    content << file.rdbuf();
+
+    std::ostringstream expected;
+    timer.writeChromeTrace(expected);
+    EXPECT_EQ(content.str(), expected.str());
+    EXPECT_EQ(findEvents(Json::parse(content.str()), "X").size(), 1u);
+    std::remove(fileName.c_str());
+
+    EXPECT_THROW(timer.saveChromeTrace("cppadcg_missing_folder/trace.json"), CGException);
+}
+
+TEST(JobTimer, peakResidentSetSize) {
+    size_t before = system::getPeakResidentSetSize();
+    EXPECT_GT(before, 0u);
+
+    EXPECT_GT(touchMemory(16 * 1024 * 1024), 0u);
+    EXPECT_GE(system::getPeakResidentSetSize(), before);
+}
@@ -0,0 +1,141 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+
+namespace {
+
+const size_t n = 4;
+const size_t m = 3;
+
+/**
+ * Conditional expressions with expensive cases.
+ * The temporary variable s is used by cases of two different conditional
+ * expressions (it must be defined outside both branches).
+ */
+template <class T>
+std::unique_ptr<ADFun<T>> createModel() {
+    CppAD::vector<AD<T>> x(n);
+    for (size_t j = 0; j < n; j++) x[j] = 1.0 + 0.5 * j;
+    Independent(x);
+
+    AD<T> s = sqrt(1.0 + x[2] * x[2]) * exp(x[3]);
+
+    CppAD::vector<AD<T>> y(m);
+    y[0] = CondExpLt(x[0], x[1], exp(x[2]) * sin(x[3]) + cos(x[2] * x[3]) * s, x[2] * x[3]);
+    y[1] = CondExpGt(x[0], x[2], x[1] * x[3], s * cos(x[1]) + sin(x[1] * x[3]) / (1.0 + x[1] * x[1]));
+    y[2] = CondExpLe(x[1], x[3], x[0] - x[3], 2.0 * x[1]) + x[0];
+
+    return std::unique_ptr<ADFun<T>>(new ADFun<T>(x, y));
+}
+
+std::string generateSource(ADFun<CGD>& fun, size_t minLazyBranchOperations, CppAD::vector<CGD>& y) {
+    CodeHandler<double> handler;
+    handler.setMinLazyBranchOperations(minLazyBranchOperations);
+
+    CppAD::vector<CGD> x(n);
+    handler.makeVariables(x);
+    y = fun.Forward(0, x);
+
+    LanguageC<double> langC("double");
+    LangCDefaultVariableNameGenerator<double> nameGen;
+
+    std::ostringstream code;
+    handler.generateCode(code, langC, y, nameGen);
+    return code.str();
+}
+
+std::unique_ptr<GenericModel<double>> compileModel(const std::string& name,
+                                                   size_t minLazyBranchOperations,
+                                                   std::unique_ptr<DynamicLib<double>>& dynamicLib) {
+    std::unique_ptr<ADFun<CGD>> fun = createModel<CGD>();
+
+    ModelCSourceGen<double> cgen(*fun, name);
+    cgen.setCreateForwardZero(true);
+    cgen.setCreateJacobian(true);
+    cgen.setCreateHessian(true);
+    cgen.setMinLazyBranchOperations(minLazyBranchOperations);
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+
+    DynamicModelLibraryProcessor<double> p(libcgen, "cppadcg_" + name);
+    GccCompiler<double> compiler;
+    dynamicLib = p.createDynamicLibrary(compiler);
+    return dynamicLib->model(name);
+}
+
+void expectNear(const std::vector<double>& values, const std::vector<double>& expected, const std::string& what) {
+    ASSERT_EQ(values.size(), expected.size()) << what;
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_NEAR(values[i], expected[i], 1e-12 * std::max(1.0, std::abs(expected[i]))) << what << " " << i;
+    }
+}
+
+}  // namespace
+
+TEST(LazyBranchLowering, generatesIfElse) {
+    std::unique_ptr<ADFun<CGD>> fun = createModel<CGD>();
+
+    CppAD::vector<CGD> yTernary;
+    std::string ternary = generateSource(*fun, 0, yTernary);
+    // both cases are evaluated before the conditional assignment
+    size_t ternaryIf = ternary.find("if( x[0] < x[1] ) {");
+    ASSERT_NE(ternaryIf, std::string::npos) << ternary;
+    EXPECT_LT(ternary.find("exp(x[2])"), ternaryIf) << ternary;
+
+    CppAD::vector<CGD> y;
+    std::string lowered = generateSource(*fun, 3, y);
+    // only the selected case is evaluated
+    size_t loweredIf = lowered.find("if(x[0] < x[1]) {");
+    ASSERT_NE(loweredIf, std::string::npos) << lowered;
+    EXPECT_GT(lowered.find("exp(x[2])"), loweredIf) << lowered;
+    EXPECT_NE(lowered.find("if(x[0] > x[2]) {"), std::string::npos) << lowered;
+    // s is used by two different branches and must be evaluated before both
+    size_t sqrtPos = lowered.find("sqrt(");
+    ASSERT_NE(sqrtPos, std::string::npos) << lowered;
+    EXPECT_LT(sqrtPos, loweredIf) << lowered;
+    // cheap cases are not lowered
+    EXPECT_NE(lowered.find("if( x[1] <= x[3] ) {"), std::string::npos) << lowered;
+
+    // the original conditional expressions are restored
+    EXPECT_EQ(y[0].getOperationNode()->getOperationType(), CGOpCode::ComLt);
+    EXPECT_EQ(y[1].getOperationNode()->getOperationType(), CGOpCode::ComGt);
+    EXPECT_EQ(y[0].getOperationNode()->getArguments().size(), 4u);
+}
+
+TEST(LazyBranchLowering, matchesTernaryEvaluation) {
+    std::unique_ptr<DynamicLib<double>> libTernary, libLowered;
+    std::unique_ptr<GenericModel<double>> ternary = compileModel("model_ternary", 0, libTernary);
+    std::unique_ptr<GenericModel<double>> lowered = compileModel("model_lowered", 3, libLowered);
+    ASSERT_NE(ternary, nullptr);
+    ASSERT_NE(lowered, nullptr);
+
+    std::unique_ptr<ADFun<double>> reference = createModel<double>();
+
+    std::vector<double> w{1.0, -0.5, 2.0};
+    // all the combinations of true and false cases
+    for (const std::vector<double>& x : {std::vector<double>{0.3, 1.2, 0.8, -0.4},
+                                         std::vector<double>{1.5, 1.2, 0.8, 1.4},
+                                         std::vector<double>{0.3, 1.2, -0.8, 0.4},
+                                         std::vector<double>{2.1, 0.2, 2.6, -0.9}}) {
+        std::vector<double> y = lowered->ForwardZero(x);
+        expectNear(y, ternary->ForwardZero(x), "forward zero (ternary)");
+        expectNear(y, reference->Forward(0, x), "forward zero (CppAD)");
+
+        std::vector<double> jac = lowered->Jacobian(x);
+        expectNear(jac, ternary->Jacobian(x), "Jacobian (ternary)");
+        expectNear(jac, reference->Jacobian(x), "Jacobian (CppAD)");
+
+        std::vector<double> hess = lowered->Hessian(x, w);
+        expectNear(hess, ternary->Hessian(x, w), "Hessian (ternary)");
+        expectNear(hess, reference->Hessian(x, w), "Hessian (CppAD)");
+    }
+}
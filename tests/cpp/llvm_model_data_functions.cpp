@@ -0,0 +1,163 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <llvm/Config/llvm-config.h>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+#include <cppad/cg/model/llvm/llvm.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+namespace {
+
+using SparsityFunction = void (*)(unsigned long const**, unsigned long const**, unsigned long*);
+using SparsitiesFunction = void (*)(unsigned long, unsigned long const**, unsigned long const**, unsigned long*);
+using InfoFunction = void (*)(const char**, unsigned long*, unsigned long*, unsigned int*, unsigned int*);
+using AtomicNamesFunction = void (*)(const char***, unsigned long*);
+
+/**
+ * Compiles a module with the functions created by LlvmModelDataFunctions
+ */
+class DataFunctionsJit {
+public:
+    std::unique_ptr<llvm::orc::LLJIT> jit;
+
+    explicit DataFunctionsJit(const std::function<void(LlvmModelDataFunctions&)>& create) {
+        llvm::InitializeNativeTarget();
+        llvm::InitializeNativeTargetAsmPrinter();
+
+        auto context = std::make_unique<llvm::LLVMContext>();
+        auto module = std::make_unique<llvm::Module>("data", *context);
+
+        LlvmModelDataFunctions data(*module);
+        create(data);
+
+        std::string errors;
+        llvm::raw_string_ostream errorStream(errors);
+        EXPECT_FALSE(llvm::verifyModule(*module, &errorStream)) << errorStream.str();
+
+        auto created = llvm::orc::LLJITBuilder().create();
+        if (!created) throw CGException(llvm::toString(created.takeError()));
+        jit = std::move(*created);
+
+        llvm::Error error = jit->addIRModule(
+                llvm::orc::ThreadSafeModule(std::move(module), llvm::orc::ThreadSafeContext(std::move(context))));
+        if (error) throw CGException(llvm::toString(std::move(error)));
+    }
+
+    template <class Function>
+    Function lookup(const std::string& name) {
+        auto symbol = jit->lookup(name);
+        if (!symbol) throw CGException(llvm::toString(symbol.takeError()));
+#if LLVM_VERSION_MAJOR >= 15
+        return symbol->toPtr<Function>();
+#else
+        return reinterpret_cast<Function>(symbol->getAddress());
+#endif
+    }
+};
+
+std::vector<size_t> toVector(unsigned long const* values, unsigned long size) {
+    return std::vector<size_t>(values, values + size);
+}
+
+}  // namespace
+
+TEST(LlvmModelDataFunctions, sparsity) {
+    const std::vector<size_t> rows{0, 0, 1, 3, 3};
+    const std::vector<size_t> cols{1, 4, 2, 0, 3};
+
+    DataFunctionsJit jit([&](LlvmModelDataFunctions& data) {
+        data.createSparsity("model_jacobian_sparsity", rows, cols);
+        data.createSparsity("model_hessian_sparsity", {}, {});
+    });
+
+    unsigned long const* row = nullptr;
+    unsigned long const* col = nullptr;
+    unsigned long nnz = 99;
+    jit.lookup<SparsityFunction>("model_jacobian_sparsity")(&row, &col, &nnz);
+    ASSERT_EQ(nnz, rows.size());
+    EXPECT_EQ(toVector(row, nnz), rows);
+    EXPECT_EQ(toVector(col, nnz), cols);
+
+    jit.lookup<SparsityFunction>("model_hessian_sparsity")(&row, &col, &nnz);
+    EXPECT_EQ(nnz, 0u);
+}
+
+TEST(LlvmModelDataFunctions, sparsities) {
+    // an empty pattern between non-empty patterns and empty patterns at the end
+    const std::vector<std::vector<size_t>> rows{{0, 1}, {}, {2, 2, 0}, {}, {}};
+    const std::vector<std::vector<size_t>> cols{{0, 1}, {}, {0, 2, 2}, {}, {}};
+
+    DataFunctionsJit jit([&](LlvmModelDataFunctions& data) {
+        data.createSparsities("model_hessian_sparsity2", rows, cols);
+        data.createSparsities("model_empty_sparsity2", {{}, {}}, {{}, {}});
+    });
+
+    auto sparsities = jit.lookup<SparsitiesFunction>("model_hessian_sparsity2");
+    for (unsigned long i = 0; i < rows.size() + 2; i++) {
+        unsigned long const* row = nullptr;
+        unsigned long const* col = nullptr;
+        unsigned long nnz = 99;
+        sparsities(i, &row, &col, &nnz);
+        if (i < rows.size()) {
+            ASSERT_EQ(nnz, rows[i].size()) << i;
+            EXPECT_EQ(toVector(row, nnz), rows[i]) << i;
+            EXPECT_EQ(toVector(col, nnz), cols[i]) << i;
+        } else {
+            EXPECT_EQ(nnz, 0u) << i;
+            EXPECT_EQ(row, nullptr) << i;
+            EXPECT_EQ(col, nullptr) << i;
+        }
+    }
+
+    unsigned long const* row = nullptr;
+    unsigned long const* col = nullptr;
+    unsigned long nnz = 99;
+    jit.lookup<SparsitiesFunction>("model_empty_sparsity2")(0, &row, &col, &nnz);
+    EXPECT_EQ(nnz, 0u);
+    EXPECT_EQ(row, nullptr);
+}
+
+TEST(LlvmModelDataFunctions, infoAndAtomicNames) {
+    DataFunctionsJit jit([&](LlvmModelDataFunctions& data) {
+        data.createInfo("model_info", "double  d", 3, 5, 1, 2);
+        data.createAtomicFunctionNames("model_atomic_functions", {"atomic_a", "atomic_b"});
+        data.createAtomicFunctionNames("model2_atomic_functions", {});
+    });
+
+    const char* baseName = nullptr;
+    unsigned long m = 0, n = 0;
+    unsigned int indCount = 0, depCount = 0;
+    jit.lookup<InfoFunction>("model_info")(&baseName, &m, &n, &indCount, &depCount);
+    ASSERT_NE(baseName, nullptr);
+    EXPECT_STREQ(baseName, "double  d");
+    EXPECT_EQ(m, 3u);
+    EXPECT_EQ(n, 5u);
+    EXPECT_EQ(indCount, 1u);
+    EXPECT_EQ(depCount, 2u);
+
+    const char** names = nullptr;
+    unsigned long size = 0;
+    jit.lookup<AtomicNamesFunction>("model_atomic_functions")(&names, &size);
+    ASSERT_EQ(size, 2u);
+    EXPECT_STREQ(names[0], "atomic_a");
+    EXPECT_STREQ(names[1], "atomic_b");
+
+    jit.lookup<AtomicNamesFunction>("model2_atomic_functions")(&names, &size);
+    EXPECT_EQ(size, 0u);
+}
+
+TEST(LlvmModelDataFunctions, repeatedName) {
+    llvm::LLVMContext context;
+    llvm::Module module("data", context);
+
+    LlvmModelDataFunctions data(module);
+    data.createSparsity("model_jacobian_sparsity", {0}, {0});
+    EXPECT_THROW(data.createSparsity("model_jacobian_sparsity", {1}, {1}), CGException);
+}
@@ -0,0 +1,233 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <llvm/Config/llvm-config.h>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+#include <cppad/cg/model/llvm/llvm.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+
+namespace {
+
+/**
+ * Records the functions created directly as LLVM IR
+ */
+class LlvmProcessor : public LlvmModelLibraryProcessor<double> {
+public:
+    std::set<std::string> irFunctions;
+
+    using LlvmModelLibraryProcessor<double>::LlvmModelLibraryProcessor;
+
+protected:
+    bool createIrFunction(llvm::Module& module,
+                          ModelCSourceGen<double>& model,
+                          const std::string& function,
+                          CodeHandler<double>& handler,
+                          std::vector<CGD>& dep,
+                          VariableNameGenerator<double>& nameGen,
+                          const std::map<std::string, std::string>& sources,
+                          std::set<std::string>& replaced) override {
+        bool created = LlvmModelLibraryProcessor<double>::createIrFunction(module, model, function, handler, dep,
+                                                                           nameGen, sources, replaced);
+        if (created) irFunctions.insert(function);
+        return created;
+    }
+};
+
+/**
+ * y = x0 * x1
+ */
+class MulAtomic : public atomic_base<double> {
+public:
+    MulAtomic() : atomic_base<double>("mul_atomic", set_sparsity_enum) {}
+
+    bool forward(size_t p,
+                 size_t q,
+                 const CppAD::vector<bool>& vx,
+                 CppAD::vector<bool>& vy,
+                 const CppAD::vector<double>& tx,
+                 CppAD::vector<double>& ty) override {
+        if (q > 1) return false;
+        size_t q1 = q + 1;
+        if (vx.size() > 0) vy[0] = vx[0] || vx[1];
+        if (p == 0) ty[0] = tx[0] * tx[1];
+        if (q == 1) ty[1] = tx[0 * q1 + 1] * tx[1 * q1] + tx[0 * q1] * tx[1 * q1 + 1];
+        return true;
+    }
+
+    bool reverse(size_t q,
+                 const CppAD::vector<double>& tx,
+                 const CppAD::vector<double>& ty,
+                 CppAD::vector<double>& px,
+                 const CppAD::vector<double>& py) override {
+        if (q > 0) return false;
+        px[0] = tx[1] * py[0];
+        px[1] = tx[0] * py[0];
+        return true;
+    }
+
+    bool for_sparse_jac(size_t q,
+                        const CppAD::vector<std::set<size_t>>& r,
+                        CppAD::vector<std::set<size_t>>& s) override {
+        s[0] = r[0];
+        s[0].insert(r[1].begin(), r[1].end());
+        return true;
+    }
+
+    bool for_sparse_jac(size_t q,
+                        const CppAD::vector<std::set<size_t>>& r,
+                        CppAD::vector<std::set<size_t>>& s,
+                        const CppAD::vector<double>& x) override {
+        return for_sparse_jac(q, r, s);
+    }
+
+    bool rev_sparse_jac(size_t q,
+                        const CppAD::vector<std::set<size_t>>& rt,
+                        CppAD::vector<std::set<size_t>>& st) override {
+        st[0] = rt[0];
+        st[1] = rt[0];
+        return true;
+    }
+
+    bool rev_sparse_jac(size_t q,
+                        const CppAD::vector<std::set<size_t>>& rt,
+                        CppAD::vector<std::set<size_t>>& st,
+                        const CppAD::vector<double>& x) override {
+        return rev_sparse_jac(q, rt, st);
+    }
+};
+
+template <class T>
+std::unique_ptr<ADFun<T>> createModel() {
+    CppAD::vector<AD<T>> x(3);
+    for (size_t j = 0; j < x.size(); j++) x[j] = 1.0 + j;
+    Independent(x);
+
+    CppAD::vector<AD<T>> y(2);
+    y[0] = exp(x[0]) * sin(x[1]) + x[2] / (1.0 + x[0] * x[0]);
+    y[1] = CondExpLt(x[0], x[1], pow(x[2], 3), tanh(x[0] * x[1])) + sqrt(x[2]) * log(x[1]);
+
+    return std::unique_ptr<ADFun<T>>(new ADFun<T>(x, y));
+}
+
+void expectNear(const std::vector<double>& values, const std::vector<double>& expected, const std::string& what) {
+    ASSERT_EQ(values.size(), expected.size()) << what;
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_NEAR(values[i], expected[i], 1e-10 * std::max(1.0, std::abs(expected[i]))) << what << " " << i;
+    }
+}
+
+}  // namespace
+
+TEST(LlvmModelLibrary, irModelFunctions) {
+    std::unique_ptr<ADFun<CGD>> fun = createModel<CGD>();
+    ModelCSourceGen<double> cgen(*fun, "model_llvm");
+    cgen.setCreateForwardZero(true);
+    cgen.setCreateJacobian(true);
+    cgen.setCreateHessian(true);
+    cgen.setCreateSparseJacobian(true);
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+
+    LlvmProcessor processor(libcgen);
+    std::unique_ptr<LlvmModelLibrary<double>> lib = processor.create();
+    EXPECT_EQ(processor.irFunctions, (std::set<std::string>{ModelCSourceGen<double>::FUNCTION_FORWAD_ZERO,
+                                                            ModelCSourceGen<double>::FUNCTION_JACOBIAN,
+                                                            ModelCSourceGen<double>::FUNCTION_HESSIAN}));
+
+    std::unique_ptr<GenericModel<double>> model = lib->model("model_llvm");
+    ASSERT_NE(model, nullptr);
+
+    // the model information and the sparsity patterns are also created as IR
+    EXPECT_EQ(model->Domain(), 3u);
+    EXPECT_EQ(model->Range(), 2u);
+    EXPECT_EQ(model->JacobianSparsitySet(), (std::vector<std::set<size_t>>{{0, 1, 2}, {0, 1, 2}}));
+
+    std::unique_ptr<ADFun<double>> reference = createModel<double>();
+    std::vector<double> w{0.5, -1.5};
+    for (const std::vector<double>& x : {std::vector<double>{0.3, 1.2, 0.8}, std::vector<double>{2.0, 1.1, 1.7}}) {
+        expectNear(model->ForwardZero(x), reference->Forward(0, x), "forward zero");
+        expectNear(model->Jacobian(x), reference->Jacobian(x), "Jacobian");
+        expectNear(model->Hessian(x, w), reference->Hessian(x, w), "Hessian");
+
+        // still compiled from C
+        std::vector<double> jac = reference->Jacobian(x);
+        std::vector<double> sparseJac;
+        std::vector<size_t> row, col;
+        model->SparseJacobian(x, sparseJac, row, col);
+        for (size_t e = 0; e < sparseJac.size(); e++) {
+            EXPECT_NEAR(sparseJac[e], jac[row[e] * x.size() + col[e]], 1e-10) << "sparse Jacobian " << e;
+        }
+    }
+}
+
+TEST(LlvmModelLibrary, irModelFunctionsWithAtomics) {
+    MulAtomic atomic;
+    CppAD::vector<double> xSparsity(2);
+    xSparsity[0] = 1.0;
+    xSparsity[1] = 1.0;
+    CGAtomicFun<double> cgAtomic(atomic, xSparsity, true);
+
+    CppAD::vector<AD<CGD>> ax(2);
+    ax[0] = 1.0;
+    ax[1] = 2.0;
+    Independent(ax);
+    CppAD::vector<AD<CGD>> atomicX(2);
+    atomicX[0] = sin(ax[0]);
+    atomicX[1] = ax[0] + ax[1];
+    CppAD::vector<AD<CGD>> atomicY(1);
+    cgAtomic(atomicX, atomicY);
+    CppAD::vector<AD<CGD>> ay(2);
+    ay[0] = 2.0 * atomicY[0];
+    ay[1] = atomicY[0] * ax[1];
+    ADFun<CGD> fun(ax, ay);
+
+    ModelCSourceGen<double> cgen(fun, "model_llvm_atomic");
+    cgen.setCreateForwardZero(true);
+    cgen.setCreateJacobian(true);
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+
+    LlvmProcessor processor(libcgen);
+    std::unique_ptr<LlvmModelLibrary<double>> lib = processor.create();
+    EXPECT_EQ(processor.irFunctions, (std::set<std::string>{ModelCSourceGen<double>::FUNCTION_FORWAD_ZERO,
+                                                            ModelCSourceGen<double>::FUNCTION_JACOBIAN}));
+
+    std::unique_ptr<GenericModel<double>> model = lib->model("model_llvm_atomic");
+    ASSERT_NE(model, nullptr);
+    EXPECT_EQ(model->getAtomicFunctionNames(), std::vector<std::string>{"mul_atomic"});
+    model->addAtomicFunction(atomic);
+
+    std::vector<double> x{0.7, -1.3};
+    double a = std::sin(x[0]) * (x[0] + x[1]);
+    double da0 = std::cos(x[0]) * (x[0] + x[1]) + std::sin(x[0]);
+    double da1 = std::sin(x[0]);
+
+    expectNear(model->ForwardZero(x), {2.0 * a, a * x[1]}, "forward zero");
+    expectNear(model->Jacobian(x), {2.0 * da0, 2.0 * da1, da0 * x[1], da1 * x[1] + a}, "Jacobian");
+}
+
+TEST(LlvmModelLibrary, cSourcesOnly) {
+    std::unique_ptr<ADFun<CGD>> fun = createModel<CGD>();
+    ModelCSourceGen<double> cgen(*fun, "model_llvm_c");
+    cgen.setCreateForwardZero(true);
+    cgen.setCreateJacobian(true);
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+
+    LlvmProcessor processor(libcgen);
+    processor.setCreateIrModelFunctions(false);
+    std::unique_ptr<LlvmModelLibrary<double>> lib = processor.create();
+    EXPECT_TRUE(processor.irFunctions.empty());
+
+    std::unique_ptr<GenericModel<double>> model = lib->model("model_llvm_c");
+    std::unique_ptr<ADFun<double>> reference = createModel<double>();
+    std::vector<double> x{0.3, 1.2, 0.8};
+    expectNear(model->ForwardZero(x), reference->Forward(0, x), "forward zero");
+    expectNear(model->Jacobian(x), reference->Jacobian(x), "Jacobian");
+}
@@ -0,0 +1,199 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+
+namespace {
+
+/**
+ * Generates the source code of a model where the temporary variables a and b
+ * share the same variable ID.
+ *
+ * @param reduceB whether or not b also uses a reduced precision
+ * @param name the name of the shared temporary variable (output)
+ * @return the declaration of the temporary variables
+ */
+std::string generateSharedSlot(bool reduceB, std::string& name) {
+    CodeHandler<double> handler;
+    handler.setReuseVariableIDs(true);
+
+    std::vector<CGD> x(2);
+    handler.makeVariables(x);
+
+    CGD a = x[0] * x[1];
+    CGD b = a * sin(a);  // the last use of a
+    std::vector<CGD> y{b + x[0], b * x[1]};
+
+    std::set<const OperationNode<double>*> reduced{a.getOperationNode()};
+    if (reduceB) reduced.insert(b.getOperationNode());
+
+    LanguageC<double> langC("double");
+    langC.setReducedPrecision(reduced);
+    langC.setGenerateFunction("model");  // declares the temporary variables
+    LangCDefaultVariableNameGenerator<double> nameGen;
+    nameGen.setTemporaryScalars(true);
+
+    std::ostringstream code;
+    handler.generateCode(code, langC, y, nameGen);
+
+    EXPECT_NE(a.getOperationNode()->getName(), nullptr);
+    EXPECT_NE(b.getOperationNode()->getName(), nullptr);
+    if (a.getOperationNode()->getName() == nullptr || b.getOperationNode()->getName() == nullptr) return "";
+    EXPECT_EQ(*a.getOperationNode()->getName(), *b.getOperationNode()->getName());  // a reused ID
+
+    name = *a.getOperationNode()->getName();
+
+    std::string source = code.str();
+    size_t start = source.find("// auxiliary variables");
+    EXPECT_NE(start, std::string::npos);
+    return source.substr(start, source.find("\n\n", start) - start);
+}
+
+const size_t n = 4;
+const size_t m = 3;
+
+/**
+ * A model with mostly elementwise operations
+ */
+template <class T>
+std::unique_ptr<ADFun<T>> createModel() {
+    CppAD::vector<AD<T>> x(n);
+    for (size_t j = 0; j < n; j++) x[j] = 1.0 + 0.25 * j;
+    Independent(x);
+
+    CppAD::vector<AD<T>> y(m);
+    for (size_t i = 0; i < m; i++) {
+        AD<T> a = sin(x[i]) * exp(0.5 * x[i + 1]);
+        AD<T> b = sqrt(x[i + 1] * x[i + 1] + 1.0) * cos(x[i]);
+        y[i] = a * b + x[i] / x[i + 1];
+    }
+
+    return std::unique_ptr<ADFun<T>>(new ADFun<T>(x, y));
+}
+
+std::string readFile(const std::string& path) {
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+}  // namespace
+
+TEST(MixedPrecision, selectedOperations) {
+    CodeHandler<double> handler;
+
+    std::vector<CGD> x(3);
+    handler.makeVariables(x);
+    x[0].setValue(1.5);
+    x[1].setValue(0.75);
+    x[2].setValue(2.0);
+
+    CGD prod = x[0] * x[1];      // elementwise
+    CGD sine = sin(prod);        // elementwise
+    CGD quot = sine / x[2];      // division
+    CGD sum1 = quot + x[0];      // elementwise sum
+    CGD sum2 = sum1 + prod;      // accumulation
+    std::vector<CGD> y{sum2 * x[2], quot};
+
+    MixedPrecisionSelector<double> selector(handler, 1e-4);
+    std::set<const OperationNode<double>*> reduced = selector.select(y, x);
+
+    EXPECT_EQ(reduced.count(prod.getOperationNode()), 1u);
+    EXPECT_EQ(reduced.count(sine.getOperationNode()), 1u);
+    EXPECT_EQ(reduced.count(sum1.getOperationNode()), 1u);
+    EXPECT_EQ(reduced.count(quot.getOperationNode()), 0u);  // divisions keep the precision
+    EXPECT_EQ(reduced.count(sum2.getOperationNode()), 0u);  // accumulations keep the precision
+    for (const CGD& yi : y) {
+        EXPECT_EQ(reduced.count(yi.getOperationNode()), 0u);  // dependent assignments keep the precision
+    }
+
+    // a tolerance below the single precision roundoff
+    MixedPrecisionSelector<double> strict(handler, 1e-9);
+    EXPECT_TRUE(strict.select(y, x).empty());
+
+    // the typical values are required
+    CodeHandler<double> handler2;
+    std::vector<CGD> x2(2);
+    handler2.makeVariables(x2);
+    std::vector<CGD> y2{sin(x2[0] * x2[1]) * x2[0]};
+    MixedPrecisionSelector<double> noValues(handler2, 1e-4);
+    EXPECT_TRUE(noValues.select(y2, x2).empty());
+}
+
+TEST(MixedPrecision, reducedPrecisionWithinTolerance) {
+    const double tolerance = 1e-5;
+    const std::string name = "model_mixed";
+
+    std::unique_ptr<ADFun<CGD>> fun = createModel<CGD>();
+    std::vector<double> xTypical{0.8, 1.3, -0.6, 1.9};
+
+    ModelCSourceGen<double> cgen(*fun, name);
+    cgen.setCreateForwardZero(true);
+    cgen.setCreateJacobian(true);
+    cgen.setTypicalIndependentValues(xTypical);
+    cgen.setMixedPrecision(true, tolerance);
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+
+    DynamicModelLibraryProcessor<double> p(libcgen, "cppadcg_" + name);
+    GccCompiler<double> compiler;
+    std::unique_ptr<DynamicLib<double>> dynamicLib = p.createDynamicLibrary(compiler);
+    std::unique_ptr<GenericModel<double>> model = dynamicLib->model(name);
+    ASSERT_NE(model, nullptr);
+
+    // some operations were demoted
+    const std::string folder = "cppadcg_mixed_sources";
+    libcgen.saveSources(folder);
+    std::string zeroSource = readFile(folder + "/" + name + "_" + ModelCSourceGen<double>::FUNCTION_FORWAD_ZERO + ".c");
+    EXPECT_NE(zeroSource.find("float"), std::string::npos) << zeroSource;
+
+    std::unique_ptr<ADFun<double>> reference = createModel<double>();
+
+    std::vector<double> y = model->ForwardZero(xTypical);
+    std::vector<double> expected = reference->Forward(0, xTypical);
+    ASSERT_EQ(y.size(), expected.size());
+    bool differs = false;
+    for (size_t i = 0; i < m; i++) {
+        EXPECT_LE(std::abs(y[i] - expected[i]), tolerance * std::abs(expected[i])) << "dependent " << i;
+        differs |= y[i] != expected[i];
+    }
+    EXPECT_TRUE(differs);  // single precision was really used
+
+    std::vector<double> jac = model->Jacobian(xTypical);
+    std::vector<double> jacExpected = reference->Jacobian(xTypical);
+    ASSERT_EQ(jac.size(), jacExpected.size());
+    double jacNorm = 0;
+    for (double v : jacExpected) jacNorm = std::max(jacNorm, std::abs(v));
+    for (size_t e = 0; e < jac.size(); e++) {
+        // the errors are estimated relative to the magnitude of the dependents
+        EXPECT_LE(std::abs(jac[e] - jacExpected[e]), 10 * tolerance * jacNorm) << "Jacobian element " << e;
+    }
+}
+
+TEST(MixedPrecision, sharedTemporaryKeepsOriginalPrecision) {
+    std::string name;
+    std::string dcl = generateSharedSlot(false, name);
+    ASSERT_FALSE(dcl.empty());
+
+    EXPECT_EQ(dcl.find("float "), std::string::npos) << dcl;
+    EXPECT_NE(dcl.find("double " + name), std::string::npos) << dcl;
+}
+
+TEST(MixedPrecision, sharedTemporaryWithReducedPrecision) {
+    std::string name;
+    std::string dcl = generateSharedSlot(true, name);
+    ASSERT_FALSE(dcl.empty());
+
+    EXPECT_NE(dcl.find("float " + name), std::string::npos) << dcl;
+}
@@ -0,0 +1,175 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+
+namespace {
+
+const size_t n = 3;
+
+std::vector<CGD> createModel(CodeHandler<double>& handler) {
+    std::vector<CGD> x(n);
+    handler.makeVariables(x);
+
+    CGD a = x[0] * x[1];
+    std::vector<CGD> y(3);
+    y[0] = a + sin(x[2]) / 2.0;
+    y[1] = exp(a) - pow(x[0], x[2]) + 1.5;
+    y[2] = 4.0;
+    return y;
+}
+
+std::vector<double> evaluate(CodeHandler<double>& handler, const std::vector<CGD>& y, const std::vector<double>& x) {
+    std::vector<AD<double>> xAD(x.begin(), x.end());
+    Evaluator<double, double> evaluator(handler);
+    std::vector<AD<double>> yAD = evaluator.evaluate(xAD, y);
+
+    std::vector<double> values(yAD.size());
+    for (size_t i = 0; i < yAD.size(); i++) values[i] = Value(yAD[i]);
+    return values;
+}
+
+std::string saveModel(const std::string& name) {
+    CodeHandler<double> handler;
+    std::vector<CGD> y = createModel(handler);
+    OperationGraphFile<double>::save(name, handler, y);
+    return name;
+}
+
+std::vector<char> readBytes(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void writeBytes(const std::string& path, const std::vector<char>& bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), std::streamsize(bytes.size()));
+}
+
+uint64_t getWord(const std::vector<char>& bytes, size_t pos) {
+    uint64_t v;
+    std::memcpy(&v, bytes.data() + pos, 8);
+    return v;
+}
+
+void setWord(std::vector<char>& bytes, size_t pos, uint64_t v) { std::memcpy(bytes.data() + pos, &v, 8); }
+
+/**
+ * @return the position of the record of the first node which is not an
+ *         independent variable
+ */
+size_t firstOperationRecord(const std::vector<char>& bytes) {
+    size_t nodeTable = getWord(bytes, 56);
+    size_t indepCount = getWord(bytes, 32);
+    return getWord(bytes, nodeTable + 8 * indepCount);
+}
+
+void expectCorruptedLoad(const std::string& path) {
+    CodeHandler<double> handler;
+    std::vector<CGD> indep;
+    EXPECT_THROW(OperationGraphFile<double>(path).load(handler, indep), CGException);
+}
+
+}  // namespace
+
+TEST(OperationGraphFile, roundTrip) {
+    CodeHandler<double> handler;
+    std::vector<CGD> y = createModel(handler);
+    OperationGraphFile<double>::save("graph_round_trip.bin", handler, y);
+
+    OperationGraphFile<double> file("graph_round_trip.bin");
+    ASSERT_EQ(file.getIndependentSize(), n);
+    ASSERT_EQ(file.getDependentSize(), y.size());
+
+    CodeHandler<double> handler2;
+    std::vector<CGD> indep;
+    std::vector<CGD> y2 = file.load(handler2, indep);
+    ASSERT_EQ(indep.size(), n);
+    ASSERT_EQ(y2.size(), y.size());
+    ASSERT_TRUE(y2[2].isParameter());
+    EXPECT_EQ(y2[2].getValue(), 4.0);
+
+    std::vector<std::vector<double>> samples{{0.5, 1.5, -0.3}, {2.0, -0.7, 1.1}, {1.3, 0.2, 0.9}};
+    for (const auto& x : samples) {
+        std::vector<double> expected = evaluate(handler, y, x);
+        std::vector<double> actual = evaluate(handler2, y2, x);
+        for (size_t i = 0; i < y.size(); i++) EXPECT_DOUBLE_EQ(actual[i], expected[i]) << i;
+    }
+
+    std::remove("graph_round_trip.bin");
+}
+
+TEST(OperationGraphFile, loadsNodesOnDemand) {
+    saveModel("graph_on_demand.bin");
+    OperationGraphFile<double> file("graph_on_demand.bin");
+
+    CodeHandler<double> handler;
+    OperationGraphFile<double>::Loader loader(file, handler);
+    EXPECT_EQ(loader.getCreatedNodeCount(), n);
+
+    // y[0] = x0 * x1 + sin(x2) / 2
+    CGD y0 = loader.dependent(0);
+    size_t created = loader.getCreatedNodeCount();
+    EXPECT_LT(created, file.getNodeCount());
+
+    // x0 * x1 is reused
+    std::vector<CGD> y = loader.dependents({0, 1});
+    EXPECT_EQ(y[0].getOperationNode(), y0.getOperationNode());
+    EXPECT_EQ(loader.getCreatedNodeCount(), file.getNodeCount());
+    EXPECT_EQ(handler.getManagedNodesCount(), file.getNodeCount());
+
+    EXPECT_THROW(loader.dependent(3), CGException);
+
+    std::remove("graph_on_demand.bin");
+}
+
+TEST(OperationGraphFile, rejectsCorruptedFiles) {
+    const std::vector<char> original = readBytes(saveModel("graph_corrupted.bin"));
+    const size_t record = firstOperationRecord(original);
+
+    // truncated
+    std::vector<char> bytes(original.begin(), original.begin() + original.size() / 2);
+    writeBytes("graph_corrupted.bin", bytes);
+    EXPECT_THROW(OperationGraphFile<double>("graph_corrupted.bin"), CGException);
+
+    // invalid operation code
+    bytes = original;
+    setWord(bytes, record, uint64_t(CGOpCode::NumberOp) + 7);
+    writeBytes("graph_corrupted.bin", bytes);
+    expectCorruptedLoad("graph_corrupted.bin");
+
+    // operations which cannot be saved
+    bytes = original;
+    setWord(bytes, record, uint64_t(CGOpCode::LoopStart));
+    writeBytes("graph_corrupted.bin", bytes);
+    expectCorruptedLoad("graph_corrupted.bin");
+
+    // too many arguments
+    bytes = original;
+    setWord(bytes, record + 16, uint64_t(-1) / 2);
+    writeBytes("graph_corrupted.bin", bytes);
+    expectCorruptedLoad("graph_corrupted.bin");
+
+    // reference to a node which is not created before
+    bytes = original;
+    size_t nInfo = getWord(bytes, record + 8);
+    setWord(bytes, record + 32 + 8 * nInfo, getWord(bytes, 24) << 1);
+    writeBytes("graph_corrupted.bin", bytes);
+    expectCorruptedLoad("graph_corrupted.bin");
+
+    std::remove("graph_corrupted.bin");
+}
@@ -0,0 +1,125 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+
+namespace {
+
+const size_t n = 6;
+const size_t m = 4;
+
+/**
+ * A model with many temporary variables which are used far away from
+ * where they are defined in the default evaluation order.
+ */
+template <class T>
+std::unique_ptr<ADFun<T>> createModel() {
+    CppAD::vector<AD<T>> x(n);
+    for (size_t j = 0; j < n; j++) x[j] = 1.0 + 0.1 * j;
+    Independent(x);
+
+    std::vector<AD<T>> a(n), b(n);
+    for (size_t j = 0; j < n; j++) a[j] = sin(x[j]) * x[(j + 1) % n];
+    for (size_t j = 0; j < n; j++) b[j] = exp(0.1 * a[j]) + a[(j + 2) % n] * x[j];
+
+    CppAD::vector<AD<T>> y(m);
+    for (size_t i = 0; i < m; i++) {
+        y[i] = 0;
+        for (size_t j = 0; j < n; j++) y[i] += b[(i + j) % n] * a[(i * j) % n] / (1.0 + x[j] * x[j]);
+    }
+
+    return std::unique_ptr<ADFun<T>>(new ADFun<T>(x, y));
+}
+
+std::unique_ptr<GenericModel<double>> compileModel(const std::string& name,
+                                                   bool registerPressureAware,
+                                                   std::unique_ptr<DynamicLib<double>>& dynamicLib) {
+    std::unique_ptr<ADFun<CGD>> fun = createModel<CGD>();
+
+    ModelCSourceGen<double> cgen(*fun, name);
+    cgen.setCreateForwardZero(true);
+    cgen.setCreateJacobian(true);
+    cgen.setCreateSparseJacobian(true);
+    cgen.setCreateHessian(true);
+    cgen.setRegisterPressureAware(registerPressureAware);
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+
+    DynamicModelLibraryProcessor<double> p(libcgen, "cppadcg_" + name);
+    GccCompiler<double> compiler;
+    dynamicLib = p.createDynamicLibrary(compiler);
+    return dynamicLib->model(name);
+}
+
+void expectNear(const std::vector<double>& values, const std::vector<double>& expected, const std::string& what) {
+    ASSERT_EQ(values.size(), expected.size()) << what;
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_NEAR(values[i], expected[i], 1e-12 * std::max(1.0, std::abs(expected[i]))) << what << " " << i;
+    }
+}
+
+}  // namespace
+
+TEST(RegisterPressure, scalarTemporaries) {
+    std::unique_ptr<ADFun<CGD>> fun = createModel<CGD>();
+
+    CodeHandler<double> handler;
+    handler.setRegisterPressureScheduling(true);
+
+    CppAD::vector<CGD> x(n);
+    handler.makeVariables(x);
+    CppAD::vector<CGD> y = fun->Forward(0, x);
+
+    LanguageC<double> langC("double");
+    langC.setGenerateFunction("model");
+    LangCDefaultVariableNameGenerator<double> nameGen;
+    nameGen.setTemporaryScalars(true);
+
+    std::ostringstream code;
+    handler.generateCode(code, langC, y, nameGen);
+
+    EXPECT_EQ(code.str().find("v["), std::string::npos) << code.str();
+    EXPECT_NE(code.str().find("double v"), std::string::npos) << code.str();
+}
+
+TEST(RegisterPressure, matchesDefaultOrder) {
+    std::unique_ptr<DynamicLib<double>> libDefault, libScheduled;
+    std::unique_ptr<GenericModel<double>> modelDefault = compileModel("model_default", false, libDefault);
+    std::unique_ptr<GenericModel<double>> modelScheduled = compileModel("model_scheduled", true, libScheduled);
+    ASSERT_NE(modelDefault, nullptr);
+    ASSERT_NE(modelScheduled, nullptr);
+
+    std::unique_ptr<ADFun<double>> reference = createModel<double>();
+
+    std::vector<double> w{1.0, -0.5, 2.0, 0.25};
+    for (const std::vector<double>& x : {std::vector<double>{0.3, 1.2, 0.8, -0.4, 2.1, 0.7},
+                                         std::vector<double>{-1.1, 0.2, 1.6, 0.9, -0.3, 1.4}}) {
+        std::vector<double> y = modelScheduled->ForwardZero(x);
+        expectNear(y, modelDefault->ForwardZero(x), "forward zero (default order)");
+        expectNear(y, reference->Forward(0, x), "forward zero (CppAD)");
+
+        std::vector<double> jac = modelScheduled->Jacobian(x);
+        expectNear(jac, modelDefault->Jacobian(x), "Jacobian (default order)");
+        expectNear(jac, reference->Jacobian(x), "Jacobian (CppAD)");
+
+        std::vector<double> sparseJac, sparseJacDefault;
+        std::vector<size_t> row, col, rowDefault, colDefault;
+        modelScheduled->SparseJacobian(x, sparseJac, row, col);
+        modelDefault->SparseJacobian(x, sparseJacDefault, rowDefault, colDefault);
+        EXPECT_EQ(row, rowDefault);
+        EXPECT_EQ(col, colDefault);
+        expectNear(sparseJac, sparseJacDefault, "sparse Jacobian (default order)");
+
+        std::vector<double> hess = modelScheduled->Hessian(x, w);
+        expectNear(hess, modelDefault->Hessian(x, w), "Hessian (default order)");
+        expectNear(hess, reference->Hessian(x, w), "Hessian (CppAD)");
+    }
+}
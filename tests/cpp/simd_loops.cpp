@@ -0,0 +1,150 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+
+namespace {
+
+const size_t n = 9;
+const size_t m = 9;
+
+/**
+ * Two equation patterns:
+ *  - y[0..3]: linear dependent indexes and a permuted independent (can be vectorized)
+ *  - y[4], y[5], y[7], y[8]: non-linear dependent indexes (must not be vectorized)
+ */
+template <class T>
+std::unique_ptr<ADFun<T>> createModel() {
+    CppAD::vector<AD<T>> x(n);
+    for (size_t j = 0; j < n; j++) x[j] = 0.5 + 0.1 * j;
+    Independent(x);
+
+    const size_t permutation[] = {2, 0, 3, 1};
+
+    CppAD::vector<AD<T>> y(m);
+    for (size_t i = 0; i < 4; i++) {
+        y[i] = sin(x[i]) * exp(0.5 * x[permutation[i]]) + x[i] * x[i];
+    }
+    for (size_t i : {4, 5, 7, 8}) {
+        y[i] = cos(x[i]) * log(1.0 + x[i] * x[i]);
+    }
+    y[6] = x[0] + x[6];
+
+    return std::unique_ptr<ADFun<T>>(new ADFun<T>(x, y));
+}
+
+std::unique_ptr<GenericModel<double>> compileModel(const std::string& name,
+                                                   bool simdLoops,
+                                                   std::unique_ptr<DynamicLib<double>>& dynamicLib) {
+    std::unique_ptr<ADFun<CGD>> fun = createModel<CGD>();
+
+    ModelCSourceGen<double> cgen(*fun, name);
+    cgen.setCreateForwardZero(true);
+    cgen.setCreateJacobian(true);
+    cgen.setCreateSparseJacobian(true);
+    cgen.setRelatedDependents({{0, 1, 2, 3}, {4, 5, 7, 8}});
+    cgen.setSimdLoops(simdLoops);
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+    libcgen.saveSources("cppadcg_" + name + "_sources");
+
+    DynamicModelLibraryProcessor<double> p(libcgen, "cppadcg_" + name);
+    GccCompiler<double> compiler;
+    dynamicLib = p.createDynamicLibrary(compiler);
+    return dynamicLib->model(name);
+}
+
+std::string readFile(const std::string& path) {
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+size_t count(const std::string& source, const std::string& text) {
+    size_t c = 0;
+    for (size_t pos = source.find(text); pos != std::string::npos; pos = source.find(text, pos + 1)) c++;
+    return c;
+}
+
+void expectNear(const std::vector<double>& values, const std::vector<double>& expected, const std::string& what) {
+    ASSERT_EQ(values.size(), expected.size()) << what;
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_NEAR(values[i], expected[i], 1e-12 * std::max(1.0, std::abs(expected[i]))) << what << " " << i;
+    }
+}
+
+void throwError(bool known, int line, const char* file, const char* exp, const char* msg) {
+    throw CGException(msg);
+}
+
+}  // namespace
+
+TEST(SimdLoops, vectorizableLoopsOnly) {
+    std::unique_ptr<DynamicLib<double>> libDefault, libSimd;
+    std::unique_ptr<GenericModel<double>> modelDefault = compileModel("model_nosimd", false, libDefault);
+    std::unique_ptr<GenericModel<double>> modelSimd = compileModel("model_simd", true, libSimd);
+    ASSERT_NE(modelDefault, nullptr);
+    ASSERT_NE(modelSimd, nullptr);
+
+    const std::string zeroFile = std::string("_") + ModelCSourceGen<double>::FUNCTION_FORWAD_ZERO + ".c";
+    std::string simd = readFile("cppadcg_model_simd_sources/model_simd" + zeroFile);
+    std::string noSimd = readFile("cppadcg_model_nosimd_sources/model_nosimd" + zeroFile);
+    ASSERT_FALSE(simd.empty());
+    ASSERT_FALSE(noSimd.empty());
+
+    // the input and output arrays cannot alias
+    EXPECT_NE(simd.find("const double* restrict x = in[0];"), std::string::npos) << simd;
+    EXPECT_NE(simd.find("double* restrict y = out[0];"), std::string::npos) << simd;
+    EXPECT_EQ(noSimd.find("restrict"), std::string::npos) << noSimd;
+
+    // only the loop with linear dependent indexes is marked
+    EXPECT_GE(count(simd, "for(j = 0;"), 2u) << simd;
+    EXPECT_EQ(count(simd, "#pragma GCC ivdep\n"), 1u) << simd;
+    EXPECT_EQ(count(simd, "#pragma clang loop vectorize(assume_safety)\n"), 1u) << simd;
+    EXPECT_EQ(noSimd.find("#pragma"), std::string::npos) << noSimd;
+
+    // the permuted independent is copied into a contiguous array before the loop
+    size_t gather = simd.find("double gx0[4];");
+    ASSERT_NE(gather, std::string::npos) << simd;
+    EXPECT_LT(gather, simd.find("#pragma GCC ivdep")) << simd;
+    EXPECT_NE(simd.find("gx0[j]"), std::string::npos) << simd;
+
+    std::unique_ptr<ADFun<double>> reference = createModel<double>();
+
+    for (const std::vector<double>& x : {std::vector<double>{0.3, 1.2, 0.8, -0.4, 2.1, 0.7, 1.1, -0.2, 0.9},
+                                         std::vector<double>{-1.1, 0.2, 1.6, 0.9, -0.3, 1.4, 0.5, 2.2, -0.7}}) {
+        std::vector<double> y = modelSimd->ForwardZero(x);
+        expectNear(y, modelDefault->ForwardZero(x), "forward zero (without SIMD loops)");
+        expectNear(y, reference->Forward(0, x), "forward zero (CppAD)");
+
+        std::vector<double> jac = modelSimd->Jacobian(x);
+        expectNear(jac, modelDefault->Jacobian(x), "Jacobian (without SIMD loops)");
+        expectNear(jac, reference->Jacobian(x), "Jacobian (CppAD)");
+
+        std::vector<double> sparseJac, sparseJacDefault;
+        std::vector<size_t> row, col, rowDefault, colDefault;
+        modelSimd->SparseJacobian(x, sparseJac, row, col);
+        modelDefault->SparseJacobian(x, sparseJacDefault, rowDefault, colDefault);
+        EXPECT_EQ(row, rowDefault);
+        EXPECT_EQ(col, colDefault);
+        expectNear(sparseJac, sparseJacDefault, "sparse Jacobian (without SIMD loops)");
+    }
+
+    // overlapping input and output arrays are rejected
+    CppAD::ErrorHandler handler(throwError);
+    std::vector<double> xy(n + m, 0.5);
+    ArrayView<const double> x(xy.data(), n);
+    EXPECT_THROW(modelSimd->ForwardZero(x, ArrayView<double>(xy.data() + 1, m)), CGException);
+    EXPECT_NO_THROW(modelSimd->ForwardZero(x, ArrayView<double>(xy.data() + n, m)));
+}
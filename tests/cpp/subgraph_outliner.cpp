@@ -0,0 +1,138 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+
+namespace {
+
+const size_t n = 5;
+const size_t m = 4;
+
+/**
+ * Each dependent variable uses the same expression tree with different
+ * independent variables
+ */
+template <class T>
+std::unique_ptr<ADFun<T>> createModel() {
+    CppAD::vector<AD<T>> x(n);
+    for (size_t j = 0; j < n; j++) x[j] = 1.0 + 0.5 * j;
+    Independent(x);
+
+    CppAD::vector<AD<T>> y(m);
+    for (size_t i = 0; i < m; i++) {
+        y[i] = sin(x[i]) * cos(x[i + 1]) + x[i] / (1.0 + x[i + 1] * x[i + 1]);
+    }
+
+    return std::unique_ptr<ADFun<T>>(new ADFun<T>(x, y));
+}
+
+std::unique_ptr<GenericModel<double>> compileModel(const std::string& name,
+                                                   size_t minOutlineOperations,
+                                                   std::unique_ptr<DynamicLib<double>>& dynamicLib) {
+    std::unique_ptr<ADFun<CGD>> fun = createModel<CGD>();
+
+    ModelCSourceGen<double> cgen(*fun, name);
+    cgen.setCreateForwardZero(true);
+    cgen.setCreateJacobian(true);
+    cgen.setCreateSparseJacobian(true);
+    cgen.setMinOutlineOperations(minOutlineOperations);
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+
+    DynamicModelLibraryProcessor<double> p(libcgen, "cppadcg_" + name);
+    GccCompiler<double> compiler;
+    dynamicLib = p.createDynamicLibrary(compiler);
+    return dynamicLib->model(name);
+}
+
+void expectNear(const std::vector<double>& values, const std::vector<double>& expected, const std::string& what) {
+    ASSERT_EQ(values.size(), expected.size()) << what;
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_NEAR(values[i], expected[i], 1e-12 * std::max(1.0, std::abs(expected[i]))) << what << " " << i;
+    }
+}
+
+}  // namespace
+
+TEST(SubgraphOutliner, generatesSharedFunction) {
+    std::unique_ptr<ADFun<CGD>> fun = createModel<CGD>();
+
+    CodeHandler<double> handler;
+    handler.setMinOutlineOperations(4);
+
+    CppAD::vector<CGD> x(n);
+    handler.makeVariables(x);
+    CppAD::vector<CGD> y = fun->Forward(0, x);
+
+    LanguageC<double> langC("double");
+    langC.setGenerateFunction("model");
+    LangCDefaultVariableNameGenerator<double> nameGen;
+
+    std::ostringstream code;
+    handler.generateCode(code, langC, y, nameGen);
+    std::string source = code.str();
+
+    EXPECT_NE(source.find("static double model__outlined0("), std::string::npos) << source;
+    EXPECT_EQ(source.find("model__outlined1("), std::string::npos) << source;
+    // called once for each dependent
+    size_t calls = 0;
+    for (size_t pos = source.find("model__outlined0(x["); pos != std::string::npos;
+         pos = source.find("model__outlined0(x[", pos + 1)) {
+        calls++;
+    }
+    EXPECT_EQ(calls, m) << source;
+
+    // the original graph is restored without new nodes
+    size_t nodes = handler.getManagedNodesCount();
+    for (size_t k = 0; k < 3; k++) {
+        std::ostringstream again;
+        LanguageC<double> langC2("double");
+        langC2.setGenerateFunction("model");
+        LangCDefaultVariableNameGenerator<double> nameGen2;
+        handler.generateCode(again, langC2, y, nameGen2);
+        EXPECT_EQ(again.str(), source);
+    }
+    EXPECT_EQ(handler.getManagedNodesCount(), nodes);
+
+    for (size_t i = 0; i < m; i++) {
+        ASSERT_NE(y[i].getOperationNode(), nullptr);
+        EXPECT_EQ(y[i].getOperationNode()->getOperationType(), CGOpCode::Add);
+    }
+}
+
+TEST(SubgraphOutliner, outlinedMatchesInlined) {
+    std::unique_ptr<DynamicLib<double>> libInlined, libOutlined;
+    std::unique_ptr<GenericModel<double>> inlined = compileModel("model_inlined", 0, libInlined);
+    std::unique_ptr<GenericModel<double>> outlined = compileModel("model_outlined", 3, libOutlined);
+    ASSERT_NE(inlined, nullptr);
+    ASSERT_NE(outlined, nullptr);
+
+    std::unique_ptr<ADFun<double>> reference = createModel<double>();
+
+    for (const std::vector<double>& x : {std::vector<double>{0.3, 1.2, 0.8, -0.4, 2.1},
+                                         std::vector<double>{-1.1, 0.2, 1.6, 0.9, -0.3}}) {
+        std::vector<double> y = outlined->ForwardZero(x);
+        expectNear(y, inlined->ForwardZero(x), "forward zero (inlined)");
+        expectNear(y, reference->Forward(0, x), "forward zero (CppAD)");
+
+        std::vector<double> jac = outlined->Jacobian(x);
+        expectNear(jac, inlined->Jacobian(x), "Jacobian (inlined)");
+        expectNear(jac, reference->Jacobian(x), "Jacobian (CppAD)");
+
+        std::vector<double> sparseJac, sparseJacInlined;
+        std::vector<size_t> row, col, rowInlined, colInlined;
+        outlined->SparseJacobian(x, sparseJac, row, col);
+        inlined->SparseJacobian(x, sparseJacInlined, rowInlined, colInlined);
+        EXPECT_EQ(row, rowInlined);
+        EXPECT_EQ(col, colInlined);
+        expectNear(sparseJac, sparseJacInlined, "sparse Jacobian (inlined)");
+    }
+}
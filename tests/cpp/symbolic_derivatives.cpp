@@ -0,0 +1,138 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+using ADCG = AD<CGD>;
+
+namespace {
+
+const size_t n = 4;
+const size_t m = 3;
+
+std::unique_ptr<ADFun<CGD>> createModel() {
+    CppAD::vector<ADCG> x(n);
+    for (size_t j = 0; j < n; j++) x[j] = 1.0 + j;
+    Independent(x);
+
+    CppAD::vector<ADCG> y(m);
+    y[0] = x[0] * x[1] + sin(x[2]);
+    y[1] = exp(x[1]) / (1. + x[3] * x[3]);
+    y[2] = pow(x[0], 3) - log(x[3]) * x[2] + sqrt(x[0] * x[3]);
+
+    return std::unique_ptr<ADFun<CGD>>(new ADFun<CGD>(x, y));
+}
+
+std::unique_ptr<DynamicLib<double>> compileModel(bool symbolic, const std::string& name) {
+    std::unique_ptr<ADFun<CGD>> fun = createModel();
+
+    ModelCSourceGen<double> cgen(*fun, name);
+    cgen.setCreateJacobian(true);
+    cgen.setCreateSparseJacobian(true);
+    cgen.setCreateHessian(true);
+    cgen.setCreateSparseHessian(true);
+    cgen.setCreateForwardOne(true);
+    cgen.setCreateReverseOne(true);
+    cgen.setCreateReverseTwo(true);
+    cgen.setSymbolicDerivatives(symbolic);
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+
+    DynamicModelLibraryProcessor<double> p(libcgen, "cppadcg_" + name);
+    GccCompiler<double> compiler;
+    return p.createDynamicLibrary(compiler);
+}
+
+void expectNear(const std::vector<double>& expected, const std::vector<double>& actual, const std::string& what) {
+    ASSERT_EQ(expected.size(), actual.size()) << what;
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_NEAR(expected[i], actual[i], 1e-10 * std::max(1.0, std::abs(expected[i]))) << what << " " << i;
+    }
+}
+
+}  // namespace
+
+TEST(SymbolicDerivatives, gradientOnlyContainsReachedVariables) {
+    CodeHandler<double> handler;
+    std::vector<CGD> x(n);
+    handler.makeVariables(x);
+    for (size_t j = 0; j < n; j++) x[j].setValue(0.5 + j);
+
+    CGD y = x[0] * x[2] + sin(x[2]);
+
+    ReverseDifferentiator<double> diff(handler, x);
+    ReverseDifferentiator<double>::SparseGradient grad = diff.gradient(y);
+
+    ASSERT_EQ(grad.size(), 2u);
+    EXPECT_EQ(grad[0].first, 0u);
+    EXPECT_EQ(grad[1].first, 2u);
+    ASSERT_TRUE(grad[0].second.isValueDefined());
+    ASSERT_TRUE(grad[1].second.isValueDefined());
+    EXPECT_NEAR(grad[0].second.getValue(), 2.5, 1e-12);
+    EXPECT_NEAR(grad[1].second.getValue(), 0.5 + std::cos(2.5), 1e-12);
+
+    // weighted sum of sparse expressions
+    std::vector<CGD> w{CGD(1.0), CGD(2.0), CGD(3.0), CGD(4.0)};
+    ReverseDifferentiator<double>::SparseGradient hv = diff.gradient(grad, w);
+    ASSERT_EQ(hv.size(), 2u);
+    EXPECT_EQ(hv[0].first, 0u);
+    EXPECT_EQ(hv[1].first, 2u);
+    EXPECT_NEAR(hv[0].second.getValue(), 3.0, 1e-12);                        // w2 * d2y/dx0dx2
+    EXPECT_NEAR(hv[1].second.getValue(), 1.0 - 3.0 * std::sin(2.5), 1e-12);  // w0 + w2 * d2y/dx2^2
+}
+
+TEST(SymbolicDerivatives, matchesCppADSweeps) {
+    std::unique_ptr<DynamicLib<double>> cppadLib = compileModel(false, "model_cppad_sweeps");
+    std::unique_ptr<DynamicLib<double>> symbolicLib = compileModel(true, "model_symbolic");
+    std::unique_ptr<GenericModel<double>> cppadModel = cppadLib->model("model_cppad_sweeps");
+    std::unique_ptr<GenericModel<double>> symbolicModel = symbolicLib->model("model_symbolic");
+
+    std::vector<double> x{0.7, -0.4, 1.3, 2.1};
+    std::vector<double> w{0.5, -1.5, 2.0};
+
+    expectNear(cppadModel->Jacobian(x), symbolicModel->Jacobian(x), "Jacobian");
+    expectNear(cppadModel->SparseJacobian(x), symbolicModel->SparseJacobian(x), "sparse Jacobian");
+    expectNear(cppadModel->Hessian(x, w), symbolicModel->Hessian(x, w), "Hessian");
+    expectNear(cppadModel->SparseHessian(x, w), symbolicModel->SparseHessian(x, w), "sparse Hessian");
+
+    std::vector<double> ty = cppadModel->ForwardZero(x);
+
+    for (size_t j = 0; j < n; j++) {
+        std::vector<double> tx(2 * n);
+        for (size_t j2 = 0; j2 < n; j2++) tx[j2 * 2] = x[j2];
+        tx[j * 2 + 1] = 1.0;
+
+        expectNear(cppadModel->ForwardOne(tx), symbolicModel->ForwardOne(tx), "forward one");
+    }
+
+    for (size_t i = 0; i < m; i++) {
+        std::vector<double> py(m);
+        py[i] = 1.0;
+
+        expectNear(cppadModel->ReverseOne(x, ty, py), symbolicModel->ReverseOne(x, ty, py), "reverse one");
+    }
+
+    for (size_t j = 0; j < n; j++) {
+        std::vector<double> tx(2 * n);
+        for (size_t j2 = 0; j2 < n; j2++) tx[j2 * 2] = x[j2];
+        tx[j * 2 + 1] = 1.0;
+        std::vector<double> ty2(2 * m);
+        std::vector<double> py(2 * m);
+        for (size_t i = 0; i < m; i++) py[i * 2 + 1] = w[i];  // py[i * 2] must be zero
+
+        std::vector<double> pxCppAD = cppadModel->ReverseTwo(tx, ty2, py);
+        std::vector<double> pxSymbolic = symbolicModel->ReverseTwo(tx, ty2, py);
+        // only the first order values are defined
+        for (size_t j2 = 0; j2 < n; j2++) {
+            EXPECT_NEAR(pxCppAD[j2 * 2], pxSymbolic[j2 * 2], 1e-10 * std::max(1.0, std::abs(pxCppAD[j2 * 2])))
+                    << "reverse two " << j << " " << j2;
+        }
+    }
+}
@@ -0,0 +1,319 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <dlfcn.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+#include <cppad/cg/model/threadpool/pthread_pool.h>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+namespace {
+
+/**
+ * The thread pool used by the model libraries compiled into its own
+ * dynamic library (each instance has its own pool)
+ */
+class ThreadPoolLibrary {
+public:
+    decltype(&cppadcg_thpool_set_threads) setThreads;
+    decltype(&cppadcg_thpool_set_scheduler_strategy) setSchedulerStrategy;
+    decltype(&cppadcg_thpool_set_verbose) setVerbose;
+    decltype(&cppadcg_thpool_set_numa_aware) setNumaAware;
+    decltype(&cppadcg_thpool_is_numa_aware) isNumaAware;
+    decltype(&cppadcg_thpool_scratch) scratch;
+    decltype(&cppadcg_thpool_prepare) prepare;
+    decltype(&cppadcg_thpool_group_create) groupCreate;
+    decltype(&cppadcg_thpool_group_acquire) groupAcquire;
+    decltype(&cppadcg_thpool_group_release) groupRelease;
+    decltype(&cppadcg_thpool_group_add_jobs) groupAddJobs;
+    decltype(&cppadcg_thpool_group_wait) groupWait;
+    decltype(&cppadcg_thpool_group_destroy) groupDestroy;
+    decltype(&cppadcg_thpool_shutdown) shutdown;
+
+    explicit ThreadPoolLibrary(const std::string& name, const std::vector<std::string>& compileFlags = {}) {
+        GccCompiler<double> compiler;
+        compiler.setTemporaryFolder("cppadcg_tmp_" + name);
+        for (const std::string& flag : compileFlags) compiler.addCompileFlag(flag);
+        compiler.compileSources({{"thread_pool.c", CPPADCG_PTHREAD_POOL_C_FILE}}, true);
+
+        _library = "./cppadcg_" + name + system::SystemInfo<>::DYNAMIC_LIB_EXTENSION;
+        compiler.buildDynamic(_library);
+        compiler.cleanup();
+
+        _handle = dlopen(_library.c_str(), RTLD_NOW | RTLD_LOCAL);
+        if (_handle == nullptr) throw CGException("Failed to load the thread pool library: ", dlerror());
+
+        load(setThreads, "cppadcg_thpool_set_threads");
+        load(setSchedulerStrategy, "cppadcg_thpool_set_scheduler_strategy");
+        load(setVerbose, "cppadcg_thpool_set_verbose");
+        load(setNumaAware, "cppadcg_thpool_set_numa_aware");
+        load(isNumaAware, "cppadcg_thpool_is_numa_aware");
+        load(scratch, "cppadcg_thpool_scratch");
+        load(prepare, "cppadcg_thpool_prepare");
+        load(groupCreate, "cppadcg_thpool_group_create");
+        load(groupAcquire, "cppadcg_thpool_group_acquire");
+        load(groupRelease, "cppadcg_thpool_group_release");
+        load(groupAddJobs, "cppadcg_thpool_group_add_jobs");
+        load(groupWait, "cppadcg_thpool_group_wait");
+        load(groupDestroy, "cppadcg_thpool_group_destroy");
+        load(shutdown, "cppadcg_thpool_shutdown");
+    }
+
+    ThreadPoolLibrary(const ThreadPoolLibrary&) = delete;
+    ThreadPoolLibrary& operator=(const ThreadPoolLibrary&) = delete;
+
+    ~ThreadPoolLibrary() {
+        shutdown();
+        dlclose(_handle);
+        std::remove(_library.c_str());
+    }
+
+private:
+    std::string _library;
+    void* _handle;
+
+    template <class Function>
+    void load(Function& function, const char* name) {
+        function = reinterpret_cast<Function>(dlsym(_handle, name));
+        if (function == nullptr) throw CGException("Failed to find '", name, "' in the thread pool library");
+    }
+};
+
+/**
+ * The arguments of a job which counts how many times it was executed
+ */
+struct CountedJob {
+    std::atomic<int>* count;
+};
+
+void countJob(void* arg) {
+    static_cast<CountedJob*>(arg)->count->fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * Several threads submit job groups concurrently (with groups owned by each
+ * thread and with groups created for each call) and check that every job
+ * of their groups is executed exactly once before the group wait returns.
+ */
+void runConcurrentGroups(ThreadPoolLibrary& pool, size_t nCallers, size_t nGroups, int nJobs) {
+    std::vector<int> failures(nCallers, 0);
+    std::vector<std::thread> callers;
+
+    for (size_t t = 0; t < nCallers; t++) {
+        callers.emplace_back([&, t]() {
+            std::vector<std::atomic<int>> counts(nJobs);
+            std::vector<CountedJob> jobs(nJobs);
+            std::vector<cppadcg_thpool_function_type> functions(nJobs, countJob);
+            std::vector<void*> args(nJobs);
+            std::vector<float> avgElapsed(nJobs);
+            std::vector<float> elapsed(nJobs);
+            std::vector<int> order(nJobs);
+            for (int j = 0; j < nJobs; j++) {
+                jobs[j].count = &counts[j];
+                args[j] = &jobs[j];
+                avgElapsed[j] = 1.0f + float((j * 7 + t) % 13);
+                order[j] = nJobs - 1 - j;
+            }
+
+            for (size_t g = 0; g < nGroups; g++) {
+                for (auto& c : counts) c.store(0, std::memory_order_relaxed);
+
+                bool owned = g % 2 == 0;
+                bool timed = g % 3 != 0;
+                cppadcg_thpool_job_group* group = owned ? pool.groupAcquire(nJobs) : pool.groupCreate(nJobs);
+                if (group == nullptr) {
+                    failures[t]++;
+                    continue;
+                }
+
+                pool.groupAddJobs(group,
+                                  functions.data(),
+                                  args.data(),
+                                  timed ? avgElapsed.data() : nullptr,
+                                  timed ? elapsed.data() : nullptr,
+                                  timed ? order.data() : nullptr,
+                                  nJobs);
+                pool.groupWait(group);
+
+                for (auto& c : counts) {
+                    if (c.load(std::memory_order_relaxed) != 1) failures[t]++;
+                }
+
+                if (owned) {
+                    pool.groupRelease(group);
+                } else {
+                    pool.groupDestroy(group);
+                }
+            }
+        });
+    }
+    for (std::thread& c : callers) c.join();
+
+    EXPECT_EQ(failures, std::vector<int>(nCallers, 0));
+}
+
+/**
+ * Creates a folder describing NUMA nodes (in the same format used by Linux)
+ * where each node has the CPUs available to this process.
+ */
+std::string createNumaTopology(const std::string& folder, size_t nNodes) {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &cpus) != 0) throw CGException("Failed to get the CPU affinity");
+
+    std::string cpuList;
+    for (int c = 0; c < CPU_SETSIZE; c++) {
+        if (!CPU_ISSET(c, &cpus)) continue;
+        if (!cpuList.empty()) cpuList += ",";
+        cpuList += std::to_string(c);
+    }
+
+    system::createFolder(folder);
+    std::ofstream(folder + "/online") << "0-" << (nNodes - 1) << "\n";
+    for (size_t n = 0; n < nNodes; n++) {
+        std::string nodeFolder = folder + "/node" + std::to_string(n);
+        system::createFolder(nodeFolder);
+        std::ofstream(nodeFolder + "/cpulist") << cpuList << "\n";
+    }
+
+    char* path = realpath(folder.c_str(), nullptr);
+    std::string absolute(path);
+    free(path);
+    return absolute;
+}
+
+}  // namespace
+
+TEST(ThreadPool, concurrentGroups) {
+    ThreadPoolLibrary pool("thread_pool_groups");
+    pool.setThreads(4);
+
+    for (ScheduleStrategy strategy : {SCHED_STATIC, SCHED_DYNAMIC, SCHED_GUIDED}) {
+        SCOPED_TRACE("strategy " + std::to_string(int(strategy)));
+        pool.setSchedulerStrategy(strategy);
+        pool.prepare();
+        runConcurrentGroups(pool, 6, 300, 64);
+    }
+}
+
+TEST(ThreadPool, shutdownWithRunningCallers) {
+    ThreadPoolLibrary pool("thread_pool_shutdown");
+    pool.setThreads(2);
+
+    const size_t nCallers = 3;
+    const size_t size = 1024 * 1024;
+    std::atomic<size_t> ready(0);
+    std::atomic<bool> shutdown(false);
+    std::vector<int> failures(nCallers, 0);
+    std::vector<std::thread> callers;
+
+    for (size_t t = 0; t < nCallers; t++) {
+        callers.emplace_back([&, t]() {
+            // the data owned by this thread is released by the shutdown while the thread is running
+            char* buffer = static_cast<char*>(pool.scratch(size));
+            if (buffer == nullptr) {
+                failures[t]++;
+            } else {
+                std::memset(buffer, 1, size);
+            }
+            cppadcg_thpool_job_group* group = pool.groupAcquire(16);
+            pool.groupRelease(group);
+
+            ready++;
+            while (!shutdown) std::this_thread::yield();
+
+            // new data is created for this thread
+            buffer = static_cast<char*>(pool.scratch(64));
+            if (buffer == nullptr || std::count(buffer, buffer + 64, 0) != 64) failures[t]++;
+            group = pool.groupAcquire(16);
+            if (group == nullptr) failures[t]++;
+            pool.groupRelease(group);
+        });
+    }
+
+    while (ready != nCallers) std::this_thread::yield();
+    pool.shutdown();
+    shutdown = true;
+    for (std::thread& c : callers) c.join();
+
+    EXPECT_EQ(failures, std::vector<int>(nCallers, 0));
+}
+
+TEST(ThreadPool, numaAwareGroups) {
+    // two NUMA nodes are emulated so that the threads are distributed even in machines with a single node
+    std::string topology = createNumaTopology("cppadcg_numa_topology", 2);
+    ThreadPoolLibrary pool("thread_pool_numa", {"-DCPPADCG_THPOOL_NUMA_PATH=\"" + topology + "\""});
+    pool.setThreads(4);
+
+    EXPECT_FALSE(pool.isNumaAware());
+    pool.setNumaAware(1);
+    EXPECT_TRUE(pool.isNumaAware());
+
+    pool.setVerbose(1);
+    testing::internal::CaptureStdout();
+    pool.prepare();
+    std::fflush(stdout);
+    std::string output = testing::internal::GetCapturedStdout();
+    pool.setVerbose(0);
+
+    EXPECT_NE(output.find("used as node 1"), std::string::npos) << output;
+    for (int t = 0; t < 4; t++) {
+        std::string placed = "Thread " + std::to_string(t) + " placed in node " + std::to_string(t % 2);
+        EXPECT_NE(output.find(placed), std::string::npos) << output;
+    }
+
+    for (ScheduleStrategy strategy : {SCHED_STATIC, SCHED_DYNAMIC, SCHED_GUIDED}) {
+        SCOPED_TRACE("strategy " + std::to_string(int(strategy)));
+        pool.setSchedulerStrategy(strategy);
+        runConcurrentGroups(pool, 6, 300, 64);
+    }
+}
+
+TEST(ThreadPool, scratchBuffer) {
+    ThreadPoolLibrary pool("thread_pool_scratch");
+    pool.setNumaAware(1);
+
+    auto isZero = [](const void* buffer, size_t size) {
+        const char* b = static_cast<const char*>(buffer);
+        return std::count(b, b + size, 0) == std::ptrdiff_t(size);
+    };
+
+    void* buffer = pool.scratch(256);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_TRUE(isZero(buffer, 256));
+    std::memset(buffer, 1, 256);
+
+    // the same buffer is provided while it is large enough
+    EXPECT_EQ(pool.scratch(128), buffer);
+    EXPECT_EQ(pool.scratch(256), buffer);
+
+    // a larger buffer is initialized again
+    void* larger = pool.scratch(64 * 1024);
+    ASSERT_NE(larger, nullptr);
+    EXPECT_TRUE(isZero(larger, 64 * 1024));
+
+    // each thread has its own buffer
+    void* other = nullptr;
+    bool otherZero = false;
+    std::thread thread([&]() {
+        other = pool.scratch(256);
+        otherZero = other != nullptr && isZero(other, 256);
+    });
+    thread.join();
+    EXPECT_NE(other, nullptr);
+    EXPECT_NE(other, larger);
+    EXPECT_TRUE(otherZero);
+}
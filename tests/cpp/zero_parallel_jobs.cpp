@@ -0,0 +1,187 @@
+//  Copyright (c) 2026 Feng Yang
+//
+//  I am making my contributions/submissions to this project solely in my
+//  personal capacity and am not conveying any rights to any intellectual
+//  property of any third parties.
+
+#include <fstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <cppad/cg.hpp>
+
+using namespace CppAD;
+using namespace CppAD::cg;
+
+using CGD = CG<double>;
+
+namespace {
+
+/**
+ * Independent chains of operations (one for each independent variable)
+ * whose results are combined by the dependent variables: the chains and
+ * the combinations are evaluated in different levels.
+ */
+template <class T>
+std::unique_ptr<ADFun<T>> createModel(size_t n, size_t chainLength) {
+    CppAD::vector<AD<T>> x(n);
+    for (size_t j = 0; j < n; j++) x[j] = 0.5 + 0.01 * j;
+    Independent(x);
+
+    std::vector<AD<T>> a(n);
+    for (size_t j = 0; j < n; j++) {
+        a[j] = x[j];
+        for (size_t k = 0; k < chainLength; k++) {
+            a[j] = sin(a[j]) * 0.9 + cos(x[j] * (1.0 + 0.01 * k)) * 0.1;
+        }
+    }
+
+    CppAD::vector<AD<T>> y(n);
+    for (size_t i = 0; i < n; i++) {
+        y[i] = a[i] * a[(i + 1) % n] + exp(0.1 * a[(i + 2) % n]);
+    }
+
+    return std::unique_ptr<ADFun<T>>(new ADFun<T>(x, y));
+}
+
+std::unique_ptr<DynamicLib<double>> compileModel(const std::string& name,
+                                                 size_t n,
+                                                 size_t chainLength,
+                                                 size_t maxJobs) {
+    std::unique_ptr<ADFun<CGD>> fun = createModel<CGD>(n, chainLength);
+
+    ModelCSourceGen<double> cgen(*fun, name);
+    cgen.setCreateForwardZero(true);
+    cgen.setMultiThreading(true);
+    cgen.setZeroParallelJobs(maxJobs, 10);
+    ModelLibraryCSourceGen<double> libcgen(cgen);
+    libcgen.setMultiThreading(MultiThreadingType::PTHREADS);
+    libcgen.saveSources("cppadcg_" + name + "_sources");
+
+    DynamicModelLibraryProcessor<double> p(libcgen, "cppadcg_" + name);
+    GccCompiler<double> compiler;
+    return p.createDynamicLibrary(compiler);
+}
+
+std::string readFile(const std::string& path) {
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+void expectNear(const std::vector<double>& values, const std::vector<double>& expected, const std::string& what) {
+    ASSERT_EQ(values.size(), expected.size()) << what;
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_NEAR(values[i], expected[i], 1e-12 * std::max(1.0, std::abs(expected[i]))) << what << " " << i;
+    }
+}
+
+std::vector<double> point(size_t n, double shift) {
+    std::vector<double> x(n);
+    for (size_t j = 0; j < n; j++) x[j] = std::sin(0.3 * j + shift);
+    return x;
+}
+
+}  // namespace
+
+TEST(ZeroParallelJobs, matchesSerialEvaluation) {
+    const size_t n = 8;
+    std::unique_ptr<DynamicLib<double>> libSerial = compileModel("model_zero_serial", n, 30, 1);
+    std::unique_ptr<DynamicLib<double>> libLevels = compileModel("model_zero_levels", n, 30, 4);
+
+    const std::string zeroFile = std::string("_") + ModelCSourceGen<double>::FUNCTION_FORWAD_ZERO + ".c";
+    std::string serialSource = readFile("cppadcg_model_zero_serial_sources/model_zero_serial" + zeroFile);
+    std::string source = readFile("cppadcg_model_zero_levels_sources/model_zero_levels" + zeroFile);
+    EXPECT_EQ(serialSource.find("_level0"), std::string::npos) << serialSource;
+    EXPECT_NE(source.find("model_zero_levels_forward_zero_level0("), std::string::npos) << source;
+    // the values shared by the levels belong to each call
+    EXPECT_NE(source.find("free(shared);"), std::string::npos) << source;
+    EXPECT_EQ(source.find("__thread"), std::string::npos) << source;
+    // the arguments of a few jobs are kept in the stack
+    EXPECT_NE(source.find("ExecArgStruct args_data["), std::string::npos) << source;
+
+    std::unique_ptr<GenericModel<double>> serial = libSerial->model("model_zero_serial");
+    std::unique_ptr<GenericModel<double>> levels = libLevels->model("model_zero_levels");
+    ASSERT_NE(serial, nullptr);
+    ASSERT_NE(levels, nullptr);
+
+    std::unique_ptr<ADFun<double>> reference = createModel<double>(n, 30);
+
+    for (bool disabled : {false, true}) {
+        libLevels->setThreadPoolDisabled(disabled);
+        for (double shift : {0.0, 0.7, -1.3}) {
+            std::vector<double> x = point(n, shift);
+            std::vector<double> y = levels->ForwardZero(x);
+            expectNear(y, serial->ForwardZero(x), "serial");
+            expectNear(y, reference->Forward(0, x), "CppAD");
+        }
+    }
+    libLevels->setThreadPoolDisabled(false);
+
+    // concurrent callers use different shared arrays
+    std::vector<std::vector<double>> expected;
+    for (size_t t = 0; t < 4; t++) expected.push_back(serial->ForwardZero(point(n, 0.1 * t)));
+
+    std::vector<std::thread> callers;
+    std::vector<int> failures(4, 0);
+    for (size_t t = 0; t < 4; t++) {
+        callers.emplace_back([&, t]() {
+            std::unique_ptr<GenericModel<double>> model = libLevels->model("model_zero_levels");
+            std::vector<double> x = point(n, 0.1 * t);
+            std::vector<double> y(n);
+            for (size_t r = 0; r < 200; r++) {
+                model->ForwardZero(x, y);
+                for (size_t i = 0; i < n; i++) {
+                    if (std::abs(y[i] - expected[t][i]) > 1e-12 * std::max(1.0, std::abs(expected[t][i]))) {
+                        failures[t]++;
+                    }
+                }
+            }
+        });
+    }
+    for (std::thread& c : callers) c.join();
+    EXPECT_EQ(failures, std::vector<int>(4, 0));
+}
+
+TEST(ZeroParallelJobs, manyJobs) {
+    // more jobs than the arguments kept in the stack (256)
+    const size_t n = 300;
+    std::unique_ptr<DynamicLib<double>> libLevels = compileModel("model_zero_many", n, 6, n);
+
+    const std::string zeroFile = std::string("_") + ModelCSourceGen<double>::FUNCTION_FORWAD_ZERO + ".c";
+    std::string source = readFile("cppadcg_model_zero_many_sources/model_zero_many" + zeroFile);
+    EXPECT_NE(source.find("ExecArgStruct* args_data = (ExecArgStruct*) malloc("), std::string::npos) << source;
+    EXPECT_NE(source.find("free(args_data);"), std::string::npos) << source;
+
+    std::unique_ptr<GenericModel<double>> levels = libLevels->model("model_zero_many");
+    ASSERT_NE(levels, nullptr);
+    std::unique_ptr<ADFun<double>> reference = createModel<double>(n, 6);
+
+    for (double shift : {0.0, 0.4}) {
+        std::vector<double> x = point(n, shift);
+        expectNear(levels->ForwardZero(x), reference->Forward(0, x), "CppAD");
+    }
+}
+
+TEST(ZeroParallelJobs, numaAware) {
+    const size_t n = 8;
+    std::unique_ptr<DynamicLib<double>> libLevels = compileModel("model_zero_numa", n, 30, 4);
+
+    // it must be defined before the thread pool is created (by the first evaluation)
+    EXPECT_FALSE(libLevels->isThreadPoolNumaAware());
+    libLevels->setThreadPoolNumaAware(true);
+    EXPECT_TRUE(libLevels->isThreadPoolNumaAware());
+
+    std::unique_ptr<GenericModel<double>> levels = libLevels->model("model_zero_numa");
+    ASSERT_NE(levels, nullptr);
+    std::unique_ptr<ADFun<double>> reference = createModel<double>(n, 30);
+
+    for (double shift : {0.0, 0.7}) {
+        std::vector<double> x = point(n, shift);
+        expectNear(levels->ForwardZero(x), reference->Forward(0, x), "CppAD");
+    }
+
+    libLevels->setThreadPoolNumaAware(false);
+    EXPECT_FALSE(libLevels->isThreadPoolNumaAware());
+}
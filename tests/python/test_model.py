@@ -0,0 +1,61 @@
+#  Copyright (c) 2026 Feng Yang
+#
+#  I am making my contributions/submissions to this project solely in my
+#  personal capacity and am not conveying any rights to any intellectual
+#  property of any third parties.
+
+import pickle
+
+import tardis as td
+import pytest
+
+
+def model(x):
+    return [x[0] * x[1], td.sin(x[0]) + 2.0 * x[1]]
+
+
+def test_compile_async(tmp_path):
+    future = td.compile_async(model, 2, "model", folder=str(tmp_path))
+    compiled = future.result()
+    assert future.done()
+
+    y = compiled.forward_zero([1.0, 2.0])
+    assert y[0] == pytest.approx(2.0)
+
+    jac = compiled.jacobian([1.0, 2.0])
+    assert jac[1] == pytest.approx(1.0)
+
+    # pickled models only reference the compiled library
+    loaded = pickle.loads(pickle.dumps(compiled))
+    assert loaded.library_path == compiled.library_path
+    assert loaded.forward_zero([1.0, 2.0]) == pytest.approx(y)
+
+    # the library is reused for the same model
+    again = td.compile_async(model, 2, "model", folder=str(tmp_path)).result()
+    assert again.library_path == compiled.library_path
+
+
+def test_raw_call(tmp_path):
+    ctypes = pytest.importorskip("ctypes")
+
+    compiled = td.compile_async(model, 2, "model", folder=str(tmp_path)).result()
+
+    call = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.POINTER(ctypes.c_double), ctypes.c_void_p,
+                            ctypes.POINTER(ctypes.c_double))(td.call_address)
+    x = (ctypes.c_double * 2)(1.0, 2.0)
+    y = (ctypes.c_double * 2)()
+    call(compiled.call_context_address("forward_zero"), x, None, y)
+    assert list(y) == pytest.approx(compiled.forward_zero([1.0, 2.0]))
+
+
+def test_compile_async_while_taping(tmp_path):
+    def nested(x):
+        td.compile_async(model, 2, "inner", folder=str(tmp_path))
+        return [x[0]]
+
+    with pytest.raises(RuntimeError):
+        td.compile_async(nested, 2, "outer", folder=str(tmp_path))
+
+    # the tape is available again
+    compiled = td.compile_async(model, 2, "model", folder=str(tmp_path)).result()
+    assert compiled.forward_zero([1.0, 2.0])[0] == pytest.approx(2.0)